@@ -2,60 +2,171 @@
 """
 SPA 빌드 파일들을 C 코드로 변환하는 스크립트 (Gzip 압축 지원)
 사용법: python convert_spa_files.py <spa_build_folder> <output_file>
+
+HTML 이외의 에셋(JS/CSS/이미지 등)은 파일 이름에 내용 해시를 붙이고(app.css -> app.1a2b3c4d.css)
+다른 파일의 참조 경로도 함께 고쳐 씀. 이름에 해시가 있는 파일은 내용이 바뀌면 이름도 바뀌므로
+브라우저가 영구 캐시(Cache-Control: immutable)하고, 첫 화면은 HTML만 검증하면 됨.
+번들러가 이미 해시를 붙인 파일(index-BfX3k2aQ.js 등)은 그대로 두고 immutable로 표시.
 """
 
 import os
+import re
 import sys
 import gzip
+import hashlib
 import argparse
 from pathlib import Path
 
-def file_to_c_array(file_path, var_name, use_gzip=True):
-    """파일을 C 배열 형태로 변환 (Gzip 압축 옵션)"""
-    with open(file_path, 'rb') as f:
-        original_data = f.read()
-    
-    # Gzip 압축 여부 결정
-    if use_gzip:
-        compressed_data = gzip.compress(original_data, compresslevel=9)
-        # 압축된 크기가 원본보다 큰 경우 압축하지 않음
-        if len(compressed_data) < len(original_data):
-            data = compressed_data
-            is_compressed = True
-            compression_ratio = len(original_data) / len(compressed_data)
-        else:
-            data = original_data
-            is_compressed = False
-            compression_ratio = 1.0
-    else:
-        data = original_data
-        is_compressed = False
-        compression_ratio = 1.0
-    
-    # C 배열 생성
-    hex_data = ', '.join(f'0x{b:02X}' for b in data)
-    
-    # 80자 단위로 줄바꿈
+# 번들러 형식의 해시 파일 이름 (name-HASH.ext, name.HASH.ext)
+HASHED_NAME_RE = re.compile(r'[.-][A-Za-z0-9_]{8,}\.[A-Za-z0-9]+$')
+
+# 임베드하는 인코딩 변형 (static_files.h의 embedded_encoding_t 순서)
+ENCODINGS = ['identity', 'gzip', 'br']
+ENCODING_ETAG_SUFFIX = {'gzip': 'gz', 'br': 'br'}
+
+# 미리 만든 헤더의 Keep-Alive timeout (http_server.h의 HTTP_KEEP_ALIVE_TIMEOUT_S와 같아야 함)
+DEFAULT_KEEP_ALIVE_TIMEOUT = 5
+
+# brotli 모듈이 있으면 br 변형도 임베드 (pip install brotli)
+try:
+    import brotli
+except ImportError:
+    brotli = None
+
+# 다른 에셋의 경로를 담을 수 있는 텍스트 파일 (참조 경로를 고쳐 씀)
+REWRITE_EXTS = {'.html', '.css', '.js', '.json', '.svg'}
+
+def asset_order(rel_path):
+    """참조되는 파일을 먼저 처리하는 순서 (이미지/폰트 -> CSS -> JS -> HTML)"""
+    ext = rel_path.suffix.lower()
+    if ext == '.html':
+        return 3
+    if ext == '.js':
+        return 2
+    if ext == '.css':
+        return 1
+    return 0
+
+def hash_asset_names(files):
+    """HTML 이외의 파일 이름에 내용 해시를 붙이고 참조 경로를 고쳐 씀
+    files: [(상대 경로, 데이터)] -> [(상대 경로, 데이터, immutable)]"""
+    renamed = {}
+    result = []
+    for rel_path, data in sorted(files, key=lambda f: (asset_order(f[0]), str(f[0]))):
+        if rel_path.suffix.lower() in REWRITE_EXTS:
+            for old, new in renamed.items():
+                data = data.replace(old.encode('utf-8'), new.encode('utf-8'))
+        
+        immutable = bool(HASHED_NAME_RE.search(rel_path.name))
+        if rel_path.suffix.lower() != '.html' and not immutable:
+            digest = hashlib.sha256(data).hexdigest()[:8]
+            new_path = rel_path.with_name(f'{rel_path.stem}.{digest}{rel_path.suffix}')
+            renamed[rel_path.as_posix()] = new_path.as_posix()
+            print(f"Hashed: {rel_path.as_posix()} -> {new_path.as_posix()}")
+            rel_path = new_path
+            immutable = True
+        result.append((rel_path, data, immutable))
+    return result
+
+def bytes_to_c_array(data, array_name):
+    """바이트를 C 배열 정의로 변환 (12바이트씩 줄바꿈)"""
+    hex_data_list = [f'0x{b:02X}' for b in data]
     lines = []
-    hex_data_list = hex_data.split(', ')
     for i in range(0, len(hex_data_list), 12):
         line = ', '.join(hex_data_list[i:i+12])
         lines.append(f'    {line}')
     
-    c_array = f'// Original size: {len(original_data)} bytes'
-    if is_compressed:
-        c_array += f', Compressed size: {len(data)} bytes (ratio: {compression_ratio:.2f}x)\n'
-    else:
-        c_array += f' (not compressed)\n'
-    
-    c_array += f'const uint8_t {var_name}_data[] = {{\n'
+    c_array = f'const uint8_t {array_name}[] = {{\n'
     c_array += ',\n'.join(lines)
     c_array += '\n};\n'
-    c_array += f'const size_t {var_name}_size = {len(data)};\n'
-    c_array += f'const size_t {var_name}_original_size = {len(original_data)};\n'
-    c_array += f'const bool {var_name}_is_compressed = {"true" if is_compressed else "false"};\n\n'
+    return c_array
+
+def encode_variants(original_data, use_gzip=True, use_brotli=True):
+    """전송용 인코딩 변형 생성 {인코딩: 데이터}
+    identity는 항상 포함 (압축을 지원하지 않는 클라이언트용), gzip/br은 원본보다 작을 때만 포함"""
+    variants = {'identity': original_data}
+    if use_gzip:
+        # mtime=0: 같은 내용이면 항상 같은 바이트 (ETag가 빌드마다 바뀌지 않도록)
+        compressed_data = gzip.compress(original_data, compresslevel=9, mtime=0)
+        if len(compressed_data) < len(original_data):
+            variants['gzip'] = compressed_data
+    if use_brotli and brotli is not None:
+        compressed_data = brotli.compress(original_data, quality=11)
+        if len(compressed_data) < len(original_data):
+            variants['br'] = compressed_data
+    return variants
+
+def file_to_c_array(original_data, var_name, use_gzip=True, use_brotli=True):
+    """파일 내용을 인코딩 변형별 C 배열로 변환
+    반환값: (C 코드, {인코딩: (배열 이름, 크기, ETag)})"""
+    variants = encode_variants(original_data, use_gzip, use_brotli)
+    
+    # ETag: 원본 내용의 해시 + 인코딩 (같은 URI라도 변형마다 바이트가 다르므로 구분)
+    base_etag = hashlib.sha256(original_data).hexdigest()[:16]
     
-    return c_array, len(data), len(original_data), is_compressed
+    c_array = f'// {var_name}: original size {len(original_data)} bytes\n'
+    result = {}
+    for encoding in ENCODINGS:
+        if encoding not in variants:
+            continue
+        data = variants[encoding]
+        array_name = f'{var_name}_{encoding}_data'
+        etag = base_etag if encoding == 'identity' else f'{base_etag}-{ENCODING_ETAG_SUFFIX[encoding]}'
+        if encoding != 'identity':
+            c_array += f'// {encoding}: {len(data)} bytes (ratio: {len(original_data) / len(data):.2f}x)\n'
+        c_array += bytes_to_c_array(data, array_name)
+        result[encoding] = (array_name, len(data), etag)
+    c_array += '\n'
+    
+    return c_array, result
+
+def get_cache_control(content_type, immutable):
+    """Cache-Control 값: 해시 이름 에셋은 영구 캐시, HTML은 매번 재검증, 나머지는 1시간"""
+    if immutable:
+        return 'public, max-age=31536000, immutable'
+    if content_type == 'text/html':
+        return 'no-cache'
+    return 'public, max-age=3600'
+
+def c_string_literal(text):
+    """C 문자열 리터럴 (헤더 줄 단위로 나눠 출력)"""
+    lines = text.split('\r\n')
+    parts = [line.replace('\\', '\\\\').replace('"', '\\"') + '\\r\\n' for line in lines[:-1]]
+    return '\n'.join(f'    "{part}"' for part in parts)
+
+def header_blocks(var_name, encoding, size, etag, content_type, immutable, vary, keep_alive_timeout):
+    """변형 하나의 응답 헤더 블록 C 코드 (embedded_header_kind_t 순서의 배열 이름 목록 반환)
+    상태 줄부터 빈 줄까지 완성된 헤더이므로 서버는 요청마다 그대로 전송만 함"""
+    cache_lines = ''
+    if vary:
+        cache_lines += 'Vary: Accept-Encoding\r\n'
+    cache_lines += f'ETag: "{etag}"\r\n'
+    cache_lines += f'Cache-Control: {get_cache_control(content_type, immutable)}\r\n'
+    
+    ok = 'HTTP/1.1 200 OK\r\n'
+    ok += f'Content-Type: {content_type}\r\n'
+    ok += f'Content-Length: {size}\r\n'
+    if encoding != 'identity':
+        ok += f'Content-Encoding: {encoding}\r\n'
+    ok += cache_lines
+    not_modified = 'HTTP/1.1 304 Not Modified\r\n' + cache_lines
+    
+    close = 'Connection: close\r\n\r\n'
+    keep_alive = f'Connection: keep-alive\r\nKeep-Alive: timeout={keep_alive_timeout}\r\n\r\n'
+    
+    blocks = [
+        ('ok', ok + close),
+        ('ok_ka', ok + keep_alive),
+        ('nm', not_modified + close),
+        ('nm_ka', not_modified + keep_alive),
+    ]
+    c_code = ''
+    names = []
+    for suffix, text in blocks:
+        name = f'{var_name}_{encoding}_hdr_{suffix}'
+        c_code += f'static const char {name}[] =\n{c_string_literal(text)};\n'
+        names.append(name)
+    return c_code, names
 
 def get_content_type(file_ext):
     """파일 확장자에 따른 Content-Type 반환"""
@@ -75,8 +186,9 @@ def get_content_type(file_ext):
     }
     return content_types.get(file_ext.lower(), 'application/octet-stream')
 
-def convert_spa_files(spa_folder, output_file, use_gzip=True):
-    """SPA 폴더의 파일들을 C 코드로 변환 (Gzip 압축 옵션)"""
+def convert_spa_files(spa_folder, output_file, use_gzip=True, hash_assets=True, use_brotli=True,
+                      keep_alive_timeout=DEFAULT_KEEP_ALIVE_TIMEOUT):
+    """SPA 폴더의 파일들을 C 코드로 변환 (인코딩 변형별로 임베드)"""
     spa_path = Path(spa_folder)
     if not spa_path.exists():
         print(f"Error: SPA folder '{spa_folder}' does not exist")
@@ -90,14 +202,46 @@ def convert_spa_files(spa_folder, output_file, use_gzip=True):
 #include <stddef.h>
 #include <stdbool.h>
 
+'''
+    header_content += f'// 미리 만든 헤더의 Keep-Alive timeout (초)\n#define EMBEDDED_KEEP_ALIVE_TIMEOUT_S {keep_alive_timeout}\n\n'
+    header_content += '''// 전송 인코딩 (Content-Encoding 값)
+typedef enum {
+    EMBEDDED_ENCODING_IDENTITY = 0,     // 압축 안 함 (항상 있음)
+    EMBEDDED_ENCODING_GZIP,
+    EMBEDDED_ENCODING_BR,
+    EMBEDDED_ENCODING_COUNT
+} embedded_encoding_t;
+
+// 미리 만든 응답 헤더 종류 (상태 코드 x Connection)
+typedef enum {
+    EMBEDDED_HEADER_OK = 0,                     // 200, Connection: close
+    EMBEDDED_HEADER_OK_KEEP_ALIVE,              // 200, Connection: keep-alive
+    EMBEDDED_HEADER_NOT_MODIFIED,               // 304, Connection: close
+    EMBEDDED_HEADER_NOT_MODIFIED_KEEP_ALIVE,    // 304, Connection: keep-alive
+    EMBEDDED_HEADER_COUNT
+} embedded_header_kind_t;
+
+// 전송 준비가 끝난 응답 헤더 (상태 줄부터 빈 줄까지)
+typedef struct {
+    const char* data;
+    uint16_t len;
+} embedded_header_t;
+
+// 인코딩 변형 하나
+typedef struct {
+    const uint8_t* data;    // NULL이면 이 인코딩 없음 (원본보다 크거나 생성하지 않음)
+    size_t size;
+    const char* etag;       // 내용 해시 + 인코딩 (따옴표 포함, ETag 헤더 값)
+    embedded_header_t headers[EMBEDDED_HEADER_COUNT];
+} embedded_variant_t;
+
 // 임베드된 파일 구조체
 typedef struct {
     const char* path;
     const char* content_type;
-    const uint8_t* data;
-    size_t size;
     size_t original_size;
-    bool is_compressed;
+    embedded_variant_t variants[EMBEDDED_ENCODING_COUNT];
+    bool immutable;         // 파일 이름에 내용 해시 포함 (영구 캐시)
 } embedded_file_t;
 
 '''
@@ -113,52 +257,80 @@ typedef struct {
     total_original_size = 0
     total_compressed_size = 0
     
-    # SPA 폴더의 모든 파일 처리
+    # SPA 폴더의 모든 파일 읽기
+    files = []
     for file_path in spa_path.rglob('*'):
         if file_path.is_file():
-            # 상대 경로 계산
-            rel_path = file_path.relative_to(spa_path)
-            web_path = '/' + str(rel_path).replace('\\', '/')
+            with open(file_path, 'rb') as f:
+                files.append((file_path.relative_to(spa_path), f.read()))
+    
+    if hash_assets:
+        files = hash_asset_names(files)
+    else:
+        files = [(rel_path, data, bool(HASHED_NAME_RE.search(rel_path.name))) for rel_path, data in sorted(files)]
+    
+    for rel_path, file_data, immutable in files:
+        web_path = '/' + rel_path.as_posix()
+        
+        # index.html을 루트 경로로도 매핑
+        if rel_path.name == 'index.html':
+            web_path_root = '/'
+        else:
+            web_path_root = None
+        
+        # 변수명 생성 (특수문자 제거)
+        var_name = str(rel_path).replace('/', '_').replace('\\', '_').replace('.', '_').replace('-', '_')
+        
+        # 파일을 C 배열로 변환
+        try:
+            c_array, variants = file_to_c_array(file_data, var_name, use_gzip, use_brotli)
+            c_content += c_array
+            
+            # Content-Type 결정
+            content_type = get_content_type(rel_path.suffix)
+            
+            # 변형별 응답 헤더 블록 (변형이 여러 개면 캐시가 Accept-Encoding별로 구분하도록 Vary 포함)
+            vary = len(variants) > 1
+            header_names = {}
+            for encoding, (_, size, etag) in variants.items():
+                header_code, header_names[encoding] = header_blocks(
+                    var_name, encoding, size, etag, content_type, immutable, vary, keep_alive_timeout)
+                c_content += header_code
+            c_content += '\n'
+            
+            # 압축을 지원하는 클라이언트가 받는 가장 작은 변형 기준
+            smallest_size = min(size for _, size, _ in variants.values())
+            total_original_size += len(file_data)
+            total_compressed_size += smallest_size
+            
+            # 헤더에 extern 선언 추가
+            for array_name, _, _ in variants.values():
+                var_declarations.append(f'extern const uint8_t {array_name}[];')
             
-            # index.html을 루트 경로로도 매핑
-            if rel_path.name == 'index.html':
-                web_path_root = '/'
-            else:
-                web_path_root = None
+            # 변형 목록 (embedded_encoding_t 순서, 없는 인코딩은 NULL)
+            variant_inits = []
+            for encoding in ENCODINGS:
+                if encoding in variants:
+                    array_name, size, etag = variants[encoding]
+                    headers = ', '.join(f'{{{name}, sizeof({name}) - 1}}' for name in header_names[encoding])
+                    variant_inits.append(f'{{{array_name}, {size}, "\\"{etag}\\"", {{{headers}}}}}')
+                else:
+                    variant_inits.append('{NULL, 0, NULL, {{NULL, 0}}}')
+            entry_tail = f'"{content_type}", {len(file_data)}, {{{", ".join(variant_inits)}}}, {str(immutable).lower()}}}'
             
-            # 변수명 생성 (특수문자 제거)
-            var_name = str(rel_path).replace('/', '_').replace('\\', '_').replace('.', '_').replace('-', '_')
+            # 파일 테이블 항목 추가
+            file_entries.append(f'    {{"{web_path}", {entry_tail}')
             
-            # 파일을 C 배열로 변환
-            try:
-                c_array, compressed_size, original_size, is_compressed = file_to_c_array(file_path, var_name, use_gzip)
-                c_content += c_array
-                
-                total_original_size += original_size
-                total_compressed_size += compressed_size
-                
-                # 헤더에 extern 선언 추가
-                var_declarations.append(f'extern const uint8_t {var_name}_data[];')
-                var_declarations.append(f'extern const size_t {var_name}_size;')
-                var_declarations.append(f'extern const size_t {var_name}_original_size;')
-                var_declarations.append(f'extern const bool {var_name}_is_compressed;')
-                
-                # Content-Type 결정
-                content_type = get_content_type(file_path.suffix)
-                
-                # 파일 테이블 항목 추가
-                file_entries.append(f'    {{"{web_path}", "{content_type}", {var_name}_data, {compressed_size}, {original_size}, {str(is_compressed).lower()}}}')
-                
-                # index.html인 경우 루트 경로도 추가
-                if web_path_root:
-                    file_entries.append(f'    {{"{web_path_root}", "{content_type}", {var_name}_data, {compressed_size}, {original_size}, {str(is_compressed).lower()}}}')
-                
-                compression_info = f" (compressed: {is_compressed}, ratio: {original_size/compressed_size:.2f}x)" if is_compressed else " (not compressed)"
-                print(f"Converted: {rel_path} -> {var_name} ({original_size} -> {compressed_size} bytes){compression_info}")
-                
-            except Exception as e:
-                print(f"Error converting {file_path}: {e}")
-                continue
+            # index.html인 경우 루트 경로도 추가
+            if web_path_root:
+                file_entries.append(f'    {{"{web_path_root}", {entry_tail}')
+            
+            encoding_info = ', '.join(f'{encoding} {size}' for encoding, (_, size, _) in variants.items())
+            print(f"Converted: {rel_path} -> {var_name} ({len(file_data)} bytes; {encoding_info})")
+            
+        except Exception as e:
+            print(f"Error converting {rel_path}: {e}")
+            continue
     
     # 헤더 파일 완성
     header_content += '\n'.join(var_declarations) + '\n\n'
@@ -168,6 +340,8 @@ extern const size_t embedded_files_count;
 
 // 함수 선언
 const char* get_content_type(const char* file_path);
+const char* embedded_encoding_name(embedded_encoding_t encoding);
+const embedded_file_t* find_embedded_file(const char* path);
 const char* get_embedded_file_with_content_type(const char* path, size_t* file_size, bool* is_compressed, size_t* original_size, const char** content_type);
 
 #endif // STATIC_FILES_H
@@ -205,24 +379,50 @@ const char* get_content_type(const char* file_path) {
     return "application/octet-stream";
 }
 
-// 임베드된 파일 찾기 (Content-Type 포함)
-const char* get_embedded_file_with_content_type(const char* path, size_t* file_size, bool* is_compressed, size_t* original_size, const char** content_type) {
-    if (!path || !file_size || !is_compressed || !original_size || !content_type) {
+// Content-Encoding 헤더 값
+const char* embedded_encoding_name(embedded_encoding_t encoding) {
+    switch (encoding) {
+        case EMBEDDED_ENCODING_GZIP: return "gzip";
+        case EMBEDDED_ENCODING_BR:   return "br";
+        default:                     return "identity";
+    }
+}
+
+// 임베드된 파일 항목 찾기
+const embedded_file_t* find_embedded_file(const char* path) {
+    if (!path) {
         return NULL;
     }
     
     for (size_t i = 0; i < embedded_files_count; i++) {
         if (strcmp(embedded_files[i].path, path) == 0) {
-            *file_size = embedded_files[i].size;
-            *original_size = embedded_files[i].original_size;
-            *is_compressed = embedded_files[i].is_compressed;
-            *content_type = embedded_files[i].content_type;
-            return (const char*)embedded_files[i].data;
+            return &embedded_files[i];
         }
     }
     
     return NULL;
 }
+
+// 임베드된 파일 찾기 (Content-Type 포함, gzip 변형이 있으면 gzip)
+const char* get_embedded_file_with_content_type(const char* path, size_t* file_size, bool* is_compressed, size_t* original_size, const char** content_type) {
+    if (!path || !file_size || !is_compressed || !original_size || !content_type) {
+        return NULL;
+    }
+    
+    const embedded_file_t* file = find_embedded_file(path);
+    if (!file) {
+        return NULL;
+    }
+    const embedded_variant_t* variant = &file->variants[EMBEDDED_ENCODING_GZIP];
+    *is_compressed = variant->data != NULL;
+    if (!*is_compressed) {
+        variant = &file->variants[EMBEDDED_ENCODING_IDENTITY];
+    }
+    *file_size = variant->size;
+    *original_size = file->original_size;
+    *content_type = file->content_type;
+    return (const char*)variant->data;
+}
 '''
     
     # 파일 저장
@@ -238,7 +438,7 @@ const char* get_embedded_file_with_content_type(const char* path, size_t* file_s
         print(f"Successfully generated {output_file}.h and {output_file}.c")
         print(f"Total files converted: {len(file_entries)}")
         print(f"Total original size: {total_original_size:,} bytes")
-        print(f"Total compressed size: {total_compressed_size:,} bytes")
+        print(f"Total compressed size: {total_compressed_size:,} bytes (smallest variant per file)")
         if total_original_size > 0:
             print(f"Overall compression ratio: {total_original_size/total_compressed_size:.2f}x")
             print(f"Space saved: {total_original_size - total_compressed_size:,} bytes ({(1-total_compressed_size/total_original_size)*100:.1f}%)")
@@ -253,16 +453,21 @@ def main():
     parser.add_argument('spa_folder', help='Path to SPA build folder (e.g., dist, build, web)')
     parser.add_argument('-o', '--output', default='static_files', help='Output filename prefix (default: static_files)')
     parser.add_argument('--no-gzip', action='store_true', help='Disable Gzip compression')
+    parser.add_argument('--no-brotli', action='store_true', help='Do not embed Brotli variants even if the brotli module is available')
+    parser.add_argument('--keep-alive-timeout', type=int, default=DEFAULT_KEEP_ALIVE_TIMEOUT,
+                        help='Keep-Alive timeout in the precomputed headers (must match HTTP_KEEP_ALIVE_TIMEOUT_S)')
+    parser.add_argument('--no-hash', action='store_true', help='Keep asset file names (no content hash, no immutable caching)')
     
     args = parser.parse_args()
     
-    if convert_spa_files(args.spa_folder, args.output, use_gzip=not args.no_gzip):
+    if convert_spa_files(args.spa_folder, args.output, use_gzip=not args.no_gzip, hash_assets=not args.no_hash, use_brotli=not args.no_brotli,
+                         keep_alive_timeout=args.keep_alive_timeout):
         print("\nConversion completed successfully!")
         print(f"Include the generated files in your CMakeLists.txt:")
         print(f"  {args.output}.c")
         print(f"Make sure to #include \"{args.output}.h\" in your HTTP server code.")
-        if not args.no_gzip:
-            print("Note: Files are Gzip compressed. Make sure your HTTP server supports decompression.")
+        if brotli is None and not args.no_brotli:
+            print("Note: brotli module not found, Brotli variants were not embedded (pip install brotli).")
     else:
         print("Conversion failed!")
         sys.exit(1)
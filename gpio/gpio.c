@@ -1,6 +1,8 @@
 #include "gpio.h"
+#include "gpio_wave.h"
+#include "gpio_history.h"
 #include "system/system_config.h"
-#include "tcp/tcp_server.h"
+#include "handlers/event_notify.h"
 #include "uart/uart_rs232.h"
 #include "debug/debug.h"
 #include <stdio.h>
@@ -9,6 +11,8 @@
 
 uint16_t gpio_input_data = 0xFFFF; // HCT165 이전 데이터
 uint16_t gpio_output_data = 0x0000; // HCT595 출력 데이터
+volatile uint16_t gpio_output_latched = 0x0000; // 실제 595에 래치된 정적 출력 (배치 중에는 gpio_output_data와 다를 수 있음)
+static uint8_t hct595_batch_depth = 0;          // 0보다 크면 래치 보류
 
 // Trigger 모드를 위한 상태 추적 (채널별로 ON->OFF 사이클 감지)
 static uint16_t gpio_trigger_state = 0x0000;  // 각 채널의 trigger 상태
@@ -47,9 +51,10 @@ bool gpio_spi_init(void) {
     return true;
 }
 
-void hct595_write(uint16_t data) {
+// 595 프레임 전송 (전역 상태 갱신 없음, 파형 타이머 인터럽트에서도 호출됨)
+void hct595_shift_out(uint16_t frame) {
     // 출력 반전 (0이 ON, 1이 OFF인 경우 사용)
-    uint16_t inverted_data = ~data;
+    uint16_t inverted_data = ~frame;
     
     // HCT595는 MSB-first이므로 바이트 순서를 맞춰서 전송
     uint8_t buffer[2];
@@ -61,16 +66,75 @@ void hct595_write(uint16_t data) {
     
     // 데이터를 출력 레지스터로 래치 (STCP 펄스: HIGH -> LOW)
     gpio_put(HCT595_LATCH_PIN, 0); // STCP low - 데이터 래치
-    sleep_us(1);
+    busy_wait_us_32(1);
     gpio_put(HCT595_LATCH_PIN, 1); // STCP high - 준비 상태
+}
+
+// 출력 변경 알림 (output 이벤트를 구독한 TCP 클라이언트와 이벤트 스트림에만 전송)
+static void send_output_event(uint16_t changed_bits, uint16_t current_data) {
+    if (!event_has_subscribers(TCP_EVENT_OUTPUT, changed_bits)) {
+        return;
+    }
+
+    char feedback[64];
+    if (gpio_config.rt_mode == GPIO_RT_MODE_CHANNEL) {
+        for (int channel = 1; channel <= 16; channel++) {
+            uint16_t mask = (1 << (channel - 1));
+            if (changed_bits & mask) {
+                snprintf(feedback, sizeof(feedback), "output_channel,%d,%d,%s\r\n",
+                         gpio_config.device_id, channel, (current_data & mask) ? "1" : "0");
+                event_notify(TCP_EVENT_OUTPUT, mask, (uint8_t*)feedback, strlen(feedback));
+            }
+        }
+    } else {
+        snprintf(feedback, sizeof(feedback), "output_bytes,%d,%d,%d\r\n",
+                 gpio_config.device_id, current_data & 0xFF, (current_data >> 8) & 0xFF);
+        event_notify(TCP_EVENT_OUTPUT, changed_bits, (uint8_t*)feedback, strlen(feedback));
+    }
+}
+
+void hct595_write(uint16_t data) {
+    if (hct595_batch_depth > 0) {
+        // 배치 중에는 상태만 갱신하고 commit 시 한 번에 래치
+        gpio_output_data = data;
+        return;
+    }
+
+    // 파형 타이머와 SPI 버스를 공유하므로 인터럽트를 막고 전송
+    uint32_t ints = save_and_disable_interrupts();
     
     // 전역 변수 업데이트
+    uint16_t changed_bits = gpio_output_latched ^ data;
     gpio_output_data = data;
+    gpio_output_latched = data;
+    
+    // 파형 동작 채널은 현재 파형 비트를 유지
+    hct595_shift_out(gpio_wave_merge(data));
+    
+    restore_interrupts(ints);
+    
+    if (changed_bits != 0) {
+        send_output_event(changed_bits, data);
+    }
+}
+
+// 출력 배치: begin~commit 사이의 hct595_write는 모아서 한 번에 래치 (중첩 가능)
+void hct595_batch_begin(void) {
+    hct595_batch_depth++;
+}
+
+void hct595_batch_commit(void) {
+    if (hct595_batch_depth == 0 || --hct595_batch_depth > 0) {
+        return;
+    }
+    hct595_write(gpio_output_data);
 }
 
 // GPIO 입력 변경 응답 전송 (rt_mode에 따라 포맷 결정 - TEXT 모드만)
+// UART로는 항상 보내고, TCP/이벤트 스트림 전달은 구독한 연결이 있을 때만 수행
 static void send_gpio_response(uint16_t changed_bits, uint16_t current_data) {
-    char feedback[2048];
+    char feedback[64];
+    bool notify = event_has_subscribers(TCP_EVENT_INPUT, changed_bits);
     
     DBG_GPIO_PRINT("send_gpio_response called: changed_bits=0x%04X, current_data=0x%04X, rt_mode=%d\n", 
                    changed_bits, current_data, gpio_config.rt_mode);
@@ -87,7 +151,9 @@ static void send_gpio_response(uint16_t changed_bits, uint16_t current_data) {
                         gpio_config.device_id, channel, value ? "1" : "0");
                 
                 DBG_GPIO_PRINT("Sending CHANNEL response: %s", feedback);
-                tcp_servers_broadcast((uint8_t*)feedback, strlen(feedback));
+                if (notify) {
+                    event_notify(TCP_EVENT_INPUT, mask, (uint8_t*)feedback, strlen(feedback));
+                }
                 uart_rs232_write(RS232_PORT_1, (uint8_t*)feedback, strlen(feedback));
             }
         }
@@ -101,19 +167,24 @@ static void send_gpio_response(uint16_t changed_bits, uint16_t current_data) {
                 gpio_config.device_id, low_byte, high_byte);
         
         DBG_GPIO_PRINT("Sending BYTES response: %s", feedback);
-        tcp_servers_broadcast((uint8_t*)feedback, strlen(feedback));
+        if (notify) {
+            event_notify(TCP_EVENT_INPUT, changed_bits, (uint8_t*)feedback, strlen(feedback));
+        }
         uart_rs232_write(RS232_PORT_1, (uint8_t*)feedback, strlen(feedback));
     }
 }
 
 uint16_t hct165_read(void) {
+    // 파형 타이머의 595 전송과 겹치지 않도록 인터럽트를 막고 읽기
+    uint32_t ints = save_and_disable_interrupts();
     gpio_put(HCT165_LOAD_PIN, 0); // SH/LD low (load)
-    sleep_us(1);
+    busy_wait_us_32(1);
     gpio_put(HCT165_LOAD_PIN, 1); // SH/LD high (shift)
     
     // 바이트 순서를 맞춰서 읽기 (HCT165 연결 순서에 따라 조정)
     uint8_t buffer[2];
     spi_read_blocking(GPIO_PORT, 0x00, buffer, 2);
+    restore_interrupts(ints);
     uint16_t raw_data = (buffer[0] << 8) | buffer[1];  // 상위 바이트를 buffer[0]으로
     
     // 현재 시간
@@ -154,6 +225,12 @@ uint16_t hct165_read(void) {
     // 안정화된 데이터 업데이트
     gpio_channel_stable_data = debounced_data;
     
+    // 입력 변화 기록 (자동 응답 설정과 무관)
+    gpio_history_record_inputs(changed_channels, debounced_data);
+    
+    // 이벤트 스트림에는 자동 응답/트리거 모드와 무관하게 모든 입력 변화 전달
+    uint16_t input_changed = debounced_data ^ gpio_input_data;
+    
     // 값이 변경되었고 자동 응답이 활성화된 경우 피드백 전송
     if (debounced_data != gpio_input_data && gpio_config.auto_response && changed_channels != 0) {
         DBG_GPIO_PRINT("Input: 0x%04X->0x%04X\n", gpio_input_data, debounced_data);
@@ -188,6 +265,10 @@ uint16_t hct165_read(void) {
         gpio_input_data = debounced_data;
     }
     
+    if (input_changed != 0) {
+        event_notify(TCP_EVENT_INPUT, input_changed, NULL, 0);
+    }
+    
     return debounced_data;
 }
 
@@ -50,6 +50,9 @@ extern gpio_config_t gpio_config;
 // GPIO Functions
 bool gpio_spi_init(void);
 void hct595_write(uint16_t data);
+void hct595_shift_out(uint16_t frame);   // 595 프레임 전송만 수행 (gpio_output_data 갱신 없음)
+void hct595_batch_begin(void);           // 이후 hct595_write는 래치 보류
+void hct595_batch_commit(void);          // 보류된 출력을 한 번에 래치 (변경 알림 포함)
 uint16_t hct165_read(void);
 
 // GPIO 설정 관리 함수
@@ -71,5 +74,6 @@ bool update_gpio_config(uint8_t device_id, bool auto_response,
 // Global variables
 extern uint16_t gpio_input_data;
 extern uint16_t gpio_output_data;
+extern volatile uint16_t gpio_output_latched;
 
 #endif // GPIO_H
\ No newline at end of file
@@ -0,0 +1,309 @@
+#include "gpio_history.h"
+#include "gpio.h"
+#include "system/system_config.h"
+#include "debug/debug.h"
+#include "hardware/flash.h"
+#include "hardware/sync.h"
+#include "pico/stdlib.h"
+#include <string.h>
+
+#define HISTORY_RECORD_SIZE     sizeof(gpio_history_record_t)
+
+static bool history_ready = false;            // 링 스캔 완료 및 기록 가능
+static uint8_t history_sector = 0;            // 현재 기록 중인 섹터
+static uint32_t history_seq = 0;              // 현재 섹터 순번
+static uint32_t history_offset = 0;           // 섹터 내 다음 레코드 위치
+static uint8_t history_page[FLASH_PAGE_SIZE]; // RAM 스테이징 페이지
+static uint32_t history_page_offset = 0;      // 스테이징 페이지의 플래시 오프셋
+static bool history_dirty = false;
+static uint32_t history_last_flush_ms = 0;
+static uint32_t history_last_event_ms = 0;    // 직전 레코드 시각
+
+static inline uint32_t sector_offset(uint8_t sector) {
+    return GPIO_HISTORY_FLASH_OFFSET + (uint32_t)sector * FLASH_SECTOR_SIZE;
+}
+
+static inline const uint8_t *sector_ptr(uint8_t sector) {
+    return (const uint8_t *)(XIP_BASE + sector_offset(sector));
+}
+
+static inline const gpio_history_header_t *sector_header(uint8_t sector) {
+    return (const gpio_history_header_t *)sector_ptr(sector);
+}
+
+// 스테이징 페이지를 플래시에 기록 (1->0 비트만 바뀌므로 같은 페이지 재기록 가능)
+void gpio_history_flush(void) {
+    if (!history_dirty) {
+        return;
+    }
+    uint32_t ints = save_and_disable_interrupts();
+    flash_range_program(history_page_offset, history_page, FLASH_PAGE_SIZE);
+    restore_interrupts(ints);
+    history_dirty = false;
+    history_last_flush_ms = to_ms_since_boot(get_absolute_time());
+}
+
+// 다음 섹터로 이동 (가장 오래된 섹터를 지우고 헤더 작성)
+static void history_advance_sector(void) {
+    gpio_history_flush();
+
+    history_sector = (uint8_t)((history_sector + 1) % GPIO_HISTORY_SECTORS);
+    history_seq++;
+
+    uint32_t ints = save_and_disable_interrupts();
+    flash_range_erase(sector_offset(history_sector), FLASH_SECTOR_SIZE);
+    restore_interrupts(ints);
+
+    gpio_history_header_t header = {
+        .magic = GPIO_HISTORY_MAGIC,
+        .seq = history_seq,
+        .reserved = { 0xFFFFFFFF, 0xFFFFFFFF }
+    };
+    memset(history_page, 0xFF, sizeof(history_page));
+    memcpy(history_page, &header, sizeof(header));
+    history_page_offset = sector_offset(history_sector);
+    history_offset = GPIO_HISTORY_HEADER_SIZE;
+    history_dirty = true;
+
+    DBG_GPIO_PRINT("History sector %u (seq %lu)\n", history_sector, (unsigned long)history_seq);
+}
+
+static void history_append(const gpio_history_record_t *record) {
+    if (history_offset >= FLASH_SECTOR_SIZE) {
+        history_advance_sector();
+    }
+
+    // 새 페이지로 넘어가면 이전 페이지를 기록하고 스테이징 초기화
+    uint32_t page_offset = sector_offset(history_sector) + (history_offset & ~(uint32_t)(FLASH_PAGE_SIZE - 1));
+    if (page_offset != history_page_offset) {
+        gpio_history_flush();
+        memset(history_page, 0xFF, sizeof(history_page));
+        history_page_offset = page_offset;
+    }
+
+    memcpy(&history_page[history_offset % FLASH_PAGE_SIZE], record, HISTORY_RECORD_SIZE);
+    history_offset += HISTORY_RECORD_SIZE;
+    history_dirty = true;
+
+    // 페이지가 가득 차면 즉시 기록
+    if ((history_offset % FLASH_PAGE_SIZE) == 0) {
+        gpio_history_flush();
+    }
+}
+
+// 직전 레코드 이후 경과 시간을 반환 (65.5초 초과분은 GAP 레코드로 기록)
+static uint16_t history_take_delta(uint32_t now_ms) {
+    uint32_t delta = now_ms - history_last_event_ms;
+    history_last_event_ms = now_ms;
+
+    if (delta > 0xFFFF) {
+        uint32_t seconds = delta / 1000;
+        if (seconds > 0xFFFFFF) {
+            seconds = 0xFFFFFF;
+        }
+        gpio_history_record_t gap = {
+            .delta_ms = (uint16_t)(seconds & 0xFFFF),
+            .data = (uint8_t)(seconds >> 16),
+            .type = GPIO_HISTORY_GAP
+        };
+        history_append(&gap);
+        delta %= 1000;
+    }
+    return (uint16_t)delta;
+}
+
+// 부팅 시 링 스캔: 가장 큰 seq 섹터의 마지막 레코드 다음부터 이어서 기록
+static void history_open(void) {
+    int newest = -1;
+    uint32_t newest_seq = 0;
+
+    for (uint8_t i = 0; i < GPIO_HISTORY_SECTORS; i++) {
+        const gpio_history_header_t *header = sector_header(i);
+        if (header->magic == GPIO_HISTORY_MAGIC && (newest < 0 || header->seq > newest_seq)) {
+            newest = i;
+            newest_seq = header->seq;
+        }
+    }
+
+    if (newest < 0) {
+        // 빈 링: 마지막 섹터에서 시작하면 advance 시 섹터 0부터 기록
+        history_sector = GPIO_HISTORY_SECTORS - 1;
+        history_seq = 0;
+        history_advance_sector();
+    } else {
+        history_sector = (uint8_t)newest;
+        history_seq = newest_seq;
+
+        const uint8_t *base = sector_ptr(history_sector);
+        history_offset = GPIO_HISTORY_HEADER_SIZE;
+        while (history_offset < FLASH_SECTOR_SIZE &&
+               base[history_offset + offsetof(gpio_history_record_t, type)] != GPIO_HISTORY_EMPTY) {
+            history_offset += HISTORY_RECORD_SIZE;
+        }
+
+        // 쓰다 만 페이지는 스테이징으로 불러옴
+        uint32_t page_in_sector = history_offset & ~(uint32_t)(FLASH_PAGE_SIZE - 1);
+        history_page_offset = sector_offset(history_sector) + page_in_sector;
+        if (history_offset < FLASH_SECTOR_SIZE) {
+            memcpy(history_page, base + page_in_sector, FLASH_PAGE_SIZE);
+        }
+        history_dirty = false;
+    }
+
+    history_ready = true;
+    history_last_event_ms = to_ms_since_boot(get_absolute_time());
+    history_last_flush_ms = history_last_event_ms;
+
+    gpio_history_record_t boot = {
+        .delta_ms = gpio_input_data,
+        .data = 0,
+        .type = GPIO_HISTORY_BOOT
+    };
+    history_append(&boot);
+
+    DBG_GPIO_PRINT("History ring: sector %u, seq %lu, offset %lu\n",
+                   history_sector, (unsigned long)history_seq, (unsigned long)history_offset);
+}
+
+void gpio_history_init(void) {
+    if (system_config_get_history_enabled()) {
+        history_open();
+    }
+}
+
+void gpio_history_process(void) {
+    if (!history_ready || !history_dirty) {
+        return;
+    }
+    uint32_t now = to_ms_since_boot(get_absolute_time());
+    if (now - history_last_flush_ms >= GPIO_HISTORY_FLUSH_MS) {
+        gpio_history_flush();
+    }
+}
+
+void gpio_history_record_inputs(uint16_t changed_bits, uint16_t current_data) {
+    if (!history_ready || changed_bits == 0) {
+        return;
+    }
+
+    uint16_t delta = history_take_delta(to_ms_since_boot(get_absolute_time()));
+    for (int channel = 0; channel < 16; channel++) {
+        uint16_t mask = (uint16_t)(1u << channel);
+        if (!(changed_bits & mask)) {
+            continue;
+        }
+        gpio_history_record_t edge = {
+            .delta_ms = delta,
+            .data = (uint8_t)(channel | ((current_data & mask) ? 0x80 : 0x00)),
+            .type = GPIO_HISTORY_EDGE
+        };
+        history_append(&edge);
+        delta = 0;  // 같은 스캔의 나머지 채널은 동시 변화
+    }
+}
+
+bool gpio_history_set_enabled(bool enabled) {
+    if (enabled && !history_ready) {
+        history_open();
+    } else if (!enabled && history_ready) {
+        gpio_history_flush();
+        history_ready = false;
+    }
+
+    system_config_set_history_enabled(enabled);
+    return system_config_save_to_flash();
+}
+
+bool gpio_history_is_enabled(void) {
+    return history_ready;
+}
+
+size_t gpio_history_query(gpio_history_event_t *events, size_t max_events, uint32_t *total_edges) {
+    uint8_t order[GPIO_HISTORY_SECTORS];
+    uint32_t seqs[GPIO_HISTORY_SECTORS];
+    size_t sector_count = 0;
+    uint32_t edges = 0;
+    uint16_t boots = 0;
+    size_t stored = 0;
+    size_t head = 0;
+
+    gpio_history_flush();
+
+    // 유효 섹터를 seq 오름차순으로 정렬 (삽입 정렬)
+    for (uint8_t i = 0; i < GPIO_HISTORY_SECTORS; i++) {
+        const gpio_history_header_t *header = sector_header(i);
+        if (header->magic != GPIO_HISTORY_MAGIC) {
+            continue;
+        }
+        size_t pos = sector_count++;
+        while (pos > 0 && seqs[pos - 1] > header->seq) {
+            order[pos] = order[pos - 1];
+            seqs[pos] = seqs[pos - 1];
+            pos--;
+        }
+        order[pos] = i;
+        seqs[pos] = header->seq;
+    }
+
+    // 최근 max_events 개만 원형으로 보관 (boot_age 자리에 부팅 번호를 임시 저장)
+    uint32_t time_ms = 0;
+    for (size_t s = 0; s < sector_count; s++) {
+        const gpio_history_record_t *records =
+            (const gpio_history_record_t *)(sector_ptr(order[s]) + GPIO_HISTORY_HEADER_SIZE);
+        size_t record_count = (FLASH_SECTOR_SIZE - GPIO_HISTORY_HEADER_SIZE) / HISTORY_RECORD_SIZE;
+
+        for (size_t r = 0; r < record_count && records[r].type != GPIO_HISTORY_EMPTY; r++) {
+            const gpio_history_record_t *rec = &records[r];
+            switch (rec->type) {
+                case GPIO_HISTORY_BOOT:
+                    boots++;
+                    time_ms = 0;
+                    break;
+                case GPIO_HISTORY_GAP:
+                    time_ms += (((uint32_t)rec->data << 16) | rec->delta_ms) * 1000u;
+                    break;
+                case GPIO_HISTORY_EDGE:
+                    time_ms += rec->delta_ms;
+                    edges++;
+                    if (max_events > 0) {
+                        gpio_history_event_t *ev = &events[head];
+                        ev->boot_age = boots;
+                        ev->time_ms = time_ms;
+                        ev->channel = (uint8_t)((rec->data & 0x0F) + 1);
+                        ev->level = (rec->data & 0x80) != 0;
+                        head = (head + 1) % max_events;
+                        if (stored < max_events) {
+                            stored++;
+                        }
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    // 원형 버퍼를 시간 순으로 정렬하고 부팅 번호를 경과 부팅 수로 변환
+    if (stored == max_events && head != 0) {
+        for (size_t n = 0; n < head; n++) {
+            gpio_history_event_t first = events[0];
+            memmove(&events[0], &events[1], (max_events - 1) * sizeof(gpio_history_event_t));
+            events[max_events - 1] = first;
+        }
+    }
+    for (size_t i = 0; i < stored; i++) {
+        events[i].boot_age = (uint16_t)(boots > events[i].boot_age ? boots - events[i].boot_age : 0);
+    }
+
+    if (total_edges) {
+        *total_edges = edges;
+    }
+    return stored;
+}
+
+const uint8_t *gpio_history_raw(size_t *size) {
+    if (size) {
+        *size = GPIO_HISTORY_SIZE;
+    }
+    return (const uint8_t *)(XIP_BASE + GPIO_HISTORY_FLASH_OFFSET);
+}
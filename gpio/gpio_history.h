@@ -0,0 +1,69 @@
+#ifndef GPIO_HISTORY_H
+#define GPIO_HISTORY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "hardware/flash.h"
+#include "pico/stdlib.h"
+
+// 입력 변화 기록기 (플래시 링 버퍼)
+//
+// 플래시 레이아웃: GPIO_HISTORY_SECTORS 개의 4KB 섹터를 순환 사용
+//   섹터 헤더 (16 bytes): magic, seq(섹터 기록 순번), reserved[2]
+//   레코드 (4 bytes):     delta_ms(LE16), data, type  / type 0xFF = 미기록(끝)
+// 섹터를 seq 순으로 읽으면 시간 순서가 됨. /api/history 는 이 영역을 그대로 전송함
+#define GPIO_HISTORY_SECTORS        16
+#define GPIO_HISTORY_SIZE           (GPIO_HISTORY_SECTORS * FLASH_SECTOR_SIZE)
+#define GPIO_HISTORY_FLASH_END      (PICO_FLASH_SIZE_BYTES - 24576)   // 설정 섹터들 아래
+#define GPIO_HISTORY_FLASH_OFFSET   (GPIO_HISTORY_FLASH_END - GPIO_HISTORY_SIZE)
+#define GPIO_HISTORY_MAGIC          0x53494847  // "GHIS"
+#define GPIO_HISTORY_HEADER_SIZE    16
+#define GPIO_HISTORY_FLUSH_MS       5000        // RAM 스테이징 페이지 최대 보관 시간
+#define GPIO_HISTORY_QUERY_MAX      40          // gethistory 최대 출력 개수
+
+// 레코드 타입
+typedef enum {
+    GPIO_HISTORY_EDGE = 0x01,   // data: bit0-3 채널(0-15), bit7 레벨
+    GPIO_HISTORY_GAP  = 0x02,   // 긴 공백: (data << 16 | delta_ms) 초, 다음 레코드 delta에 나머지 ms
+    GPIO_HISTORY_BOOT = 0x03,   // 기록 시작: delta_ms = 시작 시점 입력 상태
+    GPIO_HISTORY_EMPTY = 0xFF   // 지워진 플래시
+} gpio_history_type_t;
+
+typedef struct {
+    uint16_t delta_ms;          // 직전 레코드 이후 경과 시간 (ms)
+    uint8_t data;
+    uint8_t type;
+} gpio_history_record_t;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t seq;
+    uint32_t reserved[2];
+} gpio_history_header_t;
+
+// gethistory 조회 결과 (시간 순)
+typedef struct {
+    uint16_t boot_age;          // 0 = 현재 부팅, 1 = 이전 부팅 ...
+    uint32_t time_ms;           // 해당 부팅의 기록 시작 이후 시간
+    uint8_t channel;            // 1-16
+    bool level;
+} gpio_history_event_t;
+
+void gpio_history_init(void);
+void gpio_history_process(void);          // 메인 루프: 주기적 플래시 기록
+void gpio_history_flush(void);
+
+// 디바운스된 입력 변화 기록 (hct165_read에서 호출)
+void gpio_history_record_inputs(uint16_t changed_bits, uint16_t current_data);
+
+bool gpio_history_set_enabled(bool enabled);   // 설정 저장 포함
+bool gpio_history_is_enabled(void);
+
+// 최근 max_events 개의 엣지를 시간 순으로 반환, total_edges에 링 전체 엣지 수
+size_t gpio_history_query(gpio_history_event_t *events, size_t max_events, uint32_t *total_edges);
+
+// 원본 링 영역 (XIP 주소) - 호출 전 gpio_history_flush() 필요
+const uint8_t *gpio_history_raw(size_t *size);
+
+#endif // GPIO_HISTORY_H
@@ -0,0 +1,187 @@
+#include "gpio_wave.h"
+#include "gpio.h"
+#include "debug/debug.h"
+#include "hardware/sync.h"
+#include "pico/stdlib.h"
+#include <string.h>
+
+// 타이머 인터럽트에서 사용하는 채널별 카운터 (tick 단위)
+typedef struct {
+    uint16_t period_ticks;   // PWM 주기 (0 = PWM 없음)
+    uint16_t on_ticks;       // PWM ON 구간
+    uint16_t pwm_pos;        // PWM 주기 내 현재 위치
+    uint32_t step_ticks;     // 블링크 스텝 길이 (0 = 블링크 없음)
+    uint32_t step_pos;       // 스텝 내 현재 위치
+    uint32_t pattern;        // 블링크 패턴
+    uint8_t pattern_len;     // 패턴 스텝 수
+    uint8_t pattern_pos;     // 현재 스텝
+} wave_state_t;
+
+static gpio_wave_config_t wave_config[GPIO_WAVE_CHANNELS];
+static wave_state_t wave_state[GPIO_WAVE_CHANNELS];
+static volatile uint16_t wave_active_mask = 0;   // 파형 동작 채널
+static volatile uint16_t wave_bits = 0;          // 마지막으로 계산된 파형 출력 비트
+static uint16_t wave_last_frame = 0;             // 마지막으로 595에 쓴 프레임
+static bool wave_last_frame_valid = false;
+static repeating_timer_t wave_timer;
+static bool wave_timer_running = false;
+
+// 고정 주기 리프레시 (타이머 인터럽트 컨텍스트)
+// SPI 버스는 HCT165 입력 스캔과 공유하므로 메인 루프 쪽 접근은 인터럽트를 막고 수행함
+static bool gpio_wave_tick(repeating_timer_t *rt) {
+    (void)rt;
+    uint16_t mask = wave_active_mask;
+    uint16_t bits = 0;
+
+    for (int ch = 0; ch < GPIO_WAVE_CHANNELS; ch++) {
+        if (!(mask & (1u << ch))) {
+            continue;
+        }
+        wave_state_t *s = &wave_state[ch];
+        bool on = true;
+
+        // 블링크 패턴: 현재 스텝이 OFF면 출력 OFF
+        if (s->step_ticks != 0) {
+            on = ((s->pattern >> s->pattern_pos) & 1u) != 0;
+            if (++s->step_pos >= s->step_ticks) {
+                s->step_pos = 0;
+                if (++s->pattern_pos >= s->pattern_len) {
+                    s->pattern_pos = 0;
+                }
+            }
+        }
+
+        // PWM: ON 스텝 안에서 듀티 구간만 출력
+        if (s->period_ticks != 0) {
+            if (on) {
+                on = s->pwm_pos < s->on_ticks;
+            }
+            if (++s->pwm_pos >= s->period_ticks) {
+                s->pwm_pos = 0;
+            }
+        }
+
+        if (on) {
+            bits |= (uint16_t)(1u << ch);
+        }
+    }
+    wave_bits = bits;
+
+    // 출력이 바뀐 경우에만 595 갱신 (SPI 트래픽 최소화)
+    uint16_t frame = (uint16_t)((gpio_output_latched & ~mask) | bits);
+    if (!wave_last_frame_valid || frame != wave_last_frame) {
+        hct595_shift_out(frame);
+        wave_last_frame = frame;
+        wave_last_frame_valid = true;
+    }
+    return true;
+}
+
+// 파형 채널 유무에 따라 리프레시 타이머 시작/정지
+static void gpio_wave_update_timer(void) {
+    if (wave_active_mask != 0 && !wave_timer_running) {
+        wave_last_frame_valid = false;
+        // 음수 지연: 콜백 시작 시점 기준 고정 주기
+        if (add_repeating_timer_us(-GPIO_WAVE_TICK_US, gpio_wave_tick, NULL, &wave_timer)) {
+            wave_timer_running = true;
+            DBG_GPIO_PRINT("Wave refresh started (%d Hz)\n", GPIO_WAVE_TICK_HZ);
+        } else {
+            DBG_GPIO_PRINT("ERROR: Wave refresh timer unavailable\n");
+        }
+    } else if (wave_active_mask == 0 && wave_timer_running) {
+        cancel_repeating_timer(&wave_timer);
+        wave_timer_running = false;
+        DBG_GPIO_PRINT("Wave refresh stopped\n");
+    }
+}
+
+bool gpio_wave_set(uint8_t channel, uint16_t freq_hz, uint8_t duty,
+                   uint16_t step_ms, uint32_t pattern, uint8_t pattern_len) {
+    if (channel < 1 || channel > GPIO_WAVE_CHANNELS) {
+        return false;
+    }
+    if (freq_hz > GPIO_WAVE_MAX_FREQ_HZ || duty > 100) {
+        return false;
+    }
+    if (step_ms != 0) {
+        if (step_ms < GPIO_WAVE_MIN_STEP_MS || step_ms > GPIO_WAVE_MAX_STEP_MS) {
+            return false;
+        }
+        if (pattern_len < 1 || pattern_len > GPIO_WAVE_MAX_PATTERN) {
+            return false;
+        }
+    }
+
+    int index = channel - 1;
+    wave_state_t state;
+    memset(&state, 0, sizeof(state));
+    if (freq_hz != 0) {
+        state.period_ticks = (uint16_t)(GPIO_WAVE_TICK_HZ / freq_hz);
+        state.on_ticks = (uint16_t)((uint32_t)state.period_ticks * duty / 100);
+    }
+    if (step_ms != 0) {
+        state.step_ticks = (uint32_t)step_ms * 1000 / GPIO_WAVE_TICK_US;
+        state.pattern = pattern;
+        state.pattern_len = pattern_len;
+    }
+
+    gpio_wave_config_t *cfg = &wave_config[index];
+    cfg->active = true;
+    cfg->freq_hz = freq_hz;
+    cfg->duty = duty;
+    cfg->step_ms = step_ms;
+    cfg->pattern = step_ms != 0 ? pattern : 0;
+    cfg->pattern_len = step_ms != 0 ? pattern_len : 0;
+
+    // 인터럽트가 반쯤 갱신된 상태를 보지 않도록 원자적으로 교체
+    uint32_t ints = save_and_disable_interrupts();
+    wave_state[index] = state;
+    wave_active_mask |= (uint16_t)(1u << index);
+    restore_interrupts(ints);
+
+    gpio_wave_update_timer();
+
+    DBG_GPIO_PRINT("Wave ch%d: freq=%u duty=%u step=%u pattern=0x%08lX/%u\n",
+                   channel, freq_hz, duty, step_ms, (unsigned long)cfg->pattern, cfg->pattern_len);
+    return true;
+}
+
+void gpio_wave_stop(uint16_t channel_mask) {
+    if ((wave_active_mask & channel_mask) == 0) {
+        return;
+    }
+
+    uint32_t ints = save_and_disable_interrupts();
+    wave_active_mask &= (uint16_t)~channel_mask;
+    wave_bits &= (uint16_t)~channel_mask;
+    restore_interrupts(ints);
+
+    for (int ch = 0; ch < GPIO_WAVE_CHANNELS; ch++) {
+        if (channel_mask & (1u << ch)) {
+            wave_config[ch].active = false;
+        }
+    }
+
+    gpio_wave_update_timer();
+
+    // 정지된 채널은 정적 출력 상태로 복귀
+    hct595_write(gpio_output_data);
+    DBG_GPIO_PRINT("Wave stopped: mask=0x%04X\n", channel_mask);
+}
+
+bool gpio_wave_get(uint8_t channel, gpio_wave_config_t *config) {
+    if (channel < 1 || channel > GPIO_WAVE_CHANNELS || config == NULL) {
+        return false;
+    }
+    *config = wave_config[channel - 1];
+    return true;
+}
+
+uint16_t gpio_wave_active_mask(void) {
+    return wave_active_mask;
+}
+
+uint16_t gpio_wave_merge(uint16_t static_data) {
+    uint16_t mask = wave_active_mask;
+    return (uint16_t)((static_data & ~mask) | (wave_bits & mask));
+}
@@ -0,0 +1,42 @@
+#ifndef GPIO_WAVE_H
+#define GPIO_WAVE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// 파형 생성기 설정 (HCT595 출력 채널별 PWM/블링크)
+#define GPIO_WAVE_TICK_US        100     // 리프레시 주기 (10kHz 고정)
+#define GPIO_WAVE_TICK_HZ        (1000000 / GPIO_WAVE_TICK_US)
+#define GPIO_WAVE_CHANNELS       16
+#define GPIO_WAVE_MAX_FREQ_HZ    1000    // 주기당 최소 10 tick (듀티 10% 분해능)
+#define GPIO_WAVE_MIN_STEP_MS    10      // 블링크 스텝 최소 길이
+#define GPIO_WAVE_MAX_STEP_MS    60000   // 블링크 스텝 최대 길이
+#define GPIO_WAVE_MAX_PATTERN    32      // 블링크 패턴 최대 스텝 수
+
+// 채널 파형 설정
+typedef struct {
+    bool active;            // 파형 출력 중 여부 (false면 정적 출력)
+    uint16_t freq_hz;       // PWM 주파수 (0 = PWM 없음, ON 구간은 항상 켜짐)
+    uint8_t duty;           // PWM 듀티 (0-100%)
+    uint16_t step_ms;       // 블링크 스텝 길이 (0 = 블링크 없음)
+    uint32_t pattern;       // 블링크 패턴 (bit0 = 첫 번째 스텝, 1 = ON)
+    uint8_t pattern_len;    // 패턴 스텝 수 (1-32)
+} gpio_wave_config_t;
+
+// 파형 설정 (channel: 1-16). 블링크 ON 스텝 동안 PWM이 출력됨
+bool gpio_wave_set(uint8_t channel, uint16_t freq_hz, uint8_t duty,
+                   uint16_t step_ms, uint32_t pattern, uint8_t pattern_len);
+
+// 지정한 채널 마스크의 파형 정지 (정적 출력 gpio_output_data로 복귀)
+void gpio_wave_stop(uint16_t channel_mask);
+
+// 채널 파형 설정 조회 (channel: 1-16)
+bool gpio_wave_get(uint8_t channel, gpio_wave_config_t *config);
+
+// 파형이 동작 중인 채널 마스크
+uint16_t gpio_wave_active_mask(void);
+
+// 정적 출력 데이터에 현재 파형 비트를 합성한 595 프레임 반환
+uint16_t gpio_wave_merge(uint16_t static_data);
+
+#endif // GPIO_WAVE_H
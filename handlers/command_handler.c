@@ -1,7 +1,11 @@
 #include "command_handler.h"
 #include "network/network_config.h"
 #include "network/multicast.h"
+#include "network/socket_pool.h"
 #include "gpio/gpio.h"
+#include "gpio/gpio_wave.h"
+#include "gpio/gpio_history.h"
+#include "system/system_config.h"
 #include "uart/uart_rs232.h"
 #include "tcp/tcp_server.h"
 #include "main.h"
@@ -11,18 +15,23 @@
 #include <stdlib.h>
 
 // forward declarations for commands implemented later in this file
-cmd_result_t cmd_get_debug(const char* param, char* response, size_t response_size);
-cmd_result_t cmd_set_debug(const char* param, char* response, size_t response_size);
+cmd_result_t cmd_get_debug(const char* param, cmd_sink_t* out);
+cmd_result_t cmd_set_debug(const char* param, cmd_sink_t* out);
 
 // 명령어 처리 함수
-cmd_result_t process_command(const char* command, char* response, size_t response_size) {
-    if (command == NULL || response == NULL || response_size == 0) {
+cmd_result_t process_command(const char* command, cmd_sink_t* out) {
+    if (command == NULL || out == NULL) {
         return CMD_ERROR_INVALID;
     }
 
     // factoryreset 명령어는 모드와 관계없이 먼저 확인 (JSON 파싱 전)
     if (strncmp(command, "factoryreset", 12) == 0) {
-        return cmd_factory_reset(response, response_size);
+        return cmd_factory_reset(out);
+    }
+
+    // 배치 명령어는 256바이트 복사 전에 처리 (전체 길이 제한 없음)
+    if (strncmp(command, "batch", 5) == 0 && (command[5] == ';' || command[5] == '\0')) {
+        return cmd_batch(command + 5, out);
     }
 
     // 텍스트 모드 - 기존 방식
@@ -58,83 +67,107 @@ cmd_result_t process_command(const char* command, char* response, size_t respons
 
     // 명령어 처리
     if (strcmp(cmd_part, "getip") == 0) {
-        return cmd_get_ip(response, response_size);
+        return cmd_get_ip(out);
     } else if (strcmp(cmd_part, "getinput") == 0) {
-        return cmd_get_input(param_part, response, response_size);
+        return cmd_get_input(param_part, out);
     } else if (strcmp(cmd_part, "getinputs") == 0) {
-        return cmd_get_inputs(param_part, response, response_size);
+        return cmd_get_inputs(param_part, out);
     } else if (strcmp(cmd_part, "getinputchannel") == 0) {
-        return cmd_get_input_channel(param_part, response, response_size);
+        return cmd_get_input_channel(param_part, out);
     } else if (strcmp(cmd_part, "getoutput") == 0) {
-        return cmd_get_output(param_part, response, response_size);
+        return cmd_get_output(param_part, out);
     } else if (strcmp(cmd_part, "getoutputs") == 0) {
-        return cmd_get_outputs(param_part, response, response_size);
+        return cmd_get_outputs(param_part, out);
     } else if (strcmp(cmd_part, "setoutput") == 0) {
-        return cmd_set_output(param_part, response, response_size);
+        return cmd_set_output(param_part, out);
     } else if (strcmp(cmd_part, "setoutputs") == 0) {
-        return cmd_set_outputs(param_part, response, response_size);
+        return cmd_set_outputs(param_part, out);
+    } else if (strcmp(cmd_part, "setwave") == 0) {
+        return cmd_set_wave(param_part, out);
+    } else if (strcmp(cmd_part, "stopwave") == 0) {
+        return cmd_stop_wave(param_part, out);
+    } else if (strcmp(cmd_part, "getwave") == 0) {
+        return cmd_get_wave(param_part, out);
     } else if (strcmp(cmd_part, "setip") == 0) {
-        return cmd_set_ip(param_part, response, response_size);
+        return cmd_set_ip(param_part, out);
     } else if (strcmp(cmd_part, "setsubnet") == 0) {
-        return cmd_set_subnet(param_part, response, response_size);
+        return cmd_set_subnet(param_part, out);
     } else if (strcmp(cmd_part, "setgateway") == 0) {
-        return cmd_set_gateway(param_part, response, response_size);
+        return cmd_set_gateway(param_part, out);
     } else if (strcmp(cmd_part, "setnetwork") == 0) {
-        return cmd_set_network(param_part, response, response_size);
+        return cmd_set_network(param_part, out);
     } else if (strcmp(cmd_part, "settcpport") == 0) {
-        return cmd_set_tcp_port(param_part, response, response_size);
+        return cmd_set_tcp_port(param_part, out);
     } else if (strcmp(cmd_part, "setdhcp") == 0) {
-        return cmd_set_dhcp(param_part, response, response_size);
+        return cmd_set_dhcp(param_part, out);
     } else if (strcmp(cmd_part, "setuartbaud") == 0) {
-        return cmd_set_uart_baud(param_part, response, response_size);
+        return cmd_set_uart_baud(param_part, out);
     } else if (strcmp(cmd_part, "getuartconfig") == 0) {
-        return cmd_get_uart_config(response, response_size);
+        return cmd_get_uart_config(out);
     } else if (strcmp(cmd_part, "setgpioid") == 0) {
-        return cmd_set_gpio_id(param_part, response, response_size);
+        return cmd_set_gpio_id(param_part, out);
     } else if (strcmp(cmd_part, "getgpioid") == 0) {
-        return cmd_get_gpio_id(response, response_size);
+        return cmd_get_gpio_id(out);
     } else if (strcmp(cmd_part, "getgpioconfig") == 0) {
-        return cmd_get_gpio_config(response, response_size);
+        return cmd_get_gpio_config(out);
     } else if (strcmp(cmd_part, "setrtmode") == 0) {
-        return cmd_set_rt_mode(param_part, response, response_size);
+        return cmd_set_rt_mode(param_part, out);
     } else if (strcmp(cmd_part, "getrtmode") == 0) {
-        return cmd_get_rt_mode(response, response_size);
+        return cmd_get_rt_mode(out);
     } else if (strcmp(cmd_part, "settriggermode") == 0) {
-        return cmd_set_trigger_mode(param_part, response, response_size);
+        return cmd_set_trigger_mode(param_part, out);
     } else if (strcmp(cmd_part, "gettriggermode") == 0) {
-        return cmd_get_trigger_mode(response, response_size);
+        return cmd_get_trigger_mode(out);
     } else if (strcmp(cmd_part, "getdebug") == 0) {
-        return cmd_get_debug(param_part, response, response_size);
+        return cmd_get_debug(param_part, out);
     } else if (strcmp(cmd_part, "setdebug") == 0) {
-        return cmd_set_debug(param_part, response, response_size);
+        return cmd_set_debug(param_part, out);
     } else if (strcmp(cmd_part, "setautoresponse") == 0) {
-        return cmd_set_auto_response(param_part, response, response_size);
+        return cmd_set_auto_response(param_part, out);
     } else if (strcmp(cmd_part, "getautoresponse") == 0) {
-        return cmd_get_auto_response(response, response_size);
+        return cmd_get_auto_response(out);
     } else if (strcmp(cmd_part, "setbroadcastmode") == 0) {
-        return cmd_set_broadcast_mode(param_part, response, response_size);
+        return cmd_set_broadcast_mode(param_part, out);
     } else if (strcmp(cmd_part, "getbroadcastmode") == 0) {
-        return cmd_get_broadcast_mode(response, response_size);
+        return cmd_get_broadcast_mode(out);
+    } else if (strcmp(cmd_part, "sethistory") == 0) {
+        return cmd_set_history(param_part, out);
+    } else if (strcmp(cmd_part, "gethistory") == 0) {
+        return cmd_get_history(param_part, out);
+    } else if (strcmp(cmd_part, "settxpolicy") == 0) {
+        return cmd_set_tx_policy(param_part, out);
+    } else if (strcmp(cmd_part, "gettxpolicy") == 0) {
+        return cmd_get_tx_policy(out);
+    } else if (strcmp(cmd_part, "gettxstats") == 0) {
+        return cmd_get_tx_stats(out);
+    } else if (strcmp(cmd_part, "getclients") == 0) {
+        return cmd_get_clients(out);
+    } else if (strcmp(cmd_part, "setidletimeout") == 0) {
+        return cmd_set_idle_timeout(param_part, out);
+    } else if (strcmp(cmd_part, "getsockets") == 0) {
+        return cmd_get_sockets(out);
+    } else if (strcmp(cmd_part, "setsocketprofile") == 0) {
+        return cmd_set_socket_profile(param_part, out);
     } else if (strcmp(cmd_part, "factoryreset") == 0) {
-        return cmd_factory_reset(response, response_size);
+        return cmd_factory_reset(out);
     } else if (strcmp(cmd_part, "help") == 0) {
-        return cmd_help(response, response_size);
+        return cmd_help(out);
     } else if (strcmp(cmd_part, "?") == 0) {
-        return cmd_help(response, response_size);
+        return cmd_help(out);
     } else if (strcmp(cmd_part, "restart") == 0) {
-        return cmd_restart(response, response_size);
+        return cmd_restart(out);
     } else {
-        snprintf(response, response_size, "Unknown command: %s. Type 'help' for available commands.", cmd_part);
+        cmd_sink_printf(out, "Unknown command: %s. Type 'help' for available commands.", cmd_part);
         return CMD_ERROR_UNKNOWN;
     }
 }
 
 // IP 주소 확인 명령어
-cmd_result_t cmd_get_ip(char* response, size_t response_size) {
+cmd_result_t cmd_get_ip(cmd_sink_t* out) {
     wiz_NetInfo current_info;
     wizchip_getnetinfo(&current_info);
 
-    snprintf(response, response_size,
+    cmd_sink_printf(out,
              "IP Address: %d.%d.%d.%d\r\n"
              "Subnet Mask: %d.%d.%d.%d\r\n"
              "Gateway: %d.%d.%d.%d\r\n"
@@ -150,9 +183,9 @@ cmd_result_t cmd_get_ip(char* response, size_t response_size) {
 }
 
 // GPIO 단일 채널 입력 읽기 (getinput,id,channel -> true/false)
-cmd_result_t cmd_get_input(const char* param, char* response, size_t response_size) {
+cmd_result_t cmd_get_input(const char* param, cmd_sink_t* out) {
     if (param == NULL) {
-        snprintf(response, response_size, "Error: Parameters required (id,channel). Use: getinput,id,channel\r\n");
+        cmd_sink_printf(out, "Error: Parameters required (id,channel). Use: getinput,id,channel\r\n");
         return CMD_ERROR_INVALID;
     }
 
@@ -165,7 +198,7 @@ cmd_result_t cmd_get_input(const char* param, char* response, size_t response_si
     char* channel_str = strtok(NULL, ",");
 
     if (id_str == NULL || channel_str == NULL) {
-        snprintf(response, response_size, "Error: Use format 'getinput,id,channel' (e.g., 'getinput,1,5')\r\n");
+        cmd_sink_printf(out, "Error: Use format 'getinput,id,channel' (e.g., 'getinput,1,5')\r\n");
         return CMD_ERROR_INVALID;
     }
 
@@ -175,12 +208,11 @@ cmd_result_t cmd_get_input(const char* param, char* response, size_t response_si
     // 디바이스 ID 체크
     if (target_id != 0 && target_id != get_gpio_device_id()) {
         // ID가 맞지 않으면 응답하지 않음
-        response[0] = '\0';
         return CMD_SUCCESS;
     }
 
     if (channel < 1 || channel > 16) {
-        snprintf(response, response_size, "Error: Invalid channel. Use 1-16\r\n");
+        cmd_sink_printf(out, "Error: Invalid channel. Use 1-16\r\n");
         return CMD_ERROR_INVALID;
     }
 
@@ -189,14 +221,14 @@ cmd_result_t cmd_get_input(const char* param, char* response, size_t response_si
     uint16_t input_data = hct165_read();
     bool value = (input_data & (1 << channel_index)) != 0;
     
-    snprintf(response, response_size, "input_ch,%d,%d,%s", get_gpio_device_id(), channel, value ? "1" : "0");
+    cmd_sink_printf(out, "input_ch,%d,%d,%s", get_gpio_device_id(), channel, value ? "1" : "0");
     return CMD_SUCCESS;
 }
 
 // GPIO 전체 입력 읽기 (getinputs,id -> low,high)
-cmd_result_t cmd_get_inputs(const char* param, char* response, size_t response_size) {
+cmd_result_t cmd_get_inputs(const char* param, cmd_sink_t* out) {
     if (param == NULL) {
-        snprintf(response, response_size, "Error: Parameter required. Use: getinputs,id\r\n");
+        cmd_sink_printf(out, "Error: Parameter required. Use: getinputs,id\r\n");
         return CMD_ERROR_INVALID;
     }
 
@@ -205,7 +237,6 @@ cmd_result_t cmd_get_inputs(const char* param, char* response, size_t response_s
     // 디바이스 ID 체크
     if (target_id != 0 && target_id != get_gpio_device_id()) {
         // ID가 맞지 않으면 응답하지 않음
-        response[0] = '\0';
         return CMD_SUCCESS;
     }
 
@@ -213,14 +244,14 @@ cmd_result_t cmd_get_inputs(const char* param, char* response, size_t response_s
     uint8_t low_byte = (uint8_t)(gpio_state & 0xFF);
     uint8_t high_byte = (uint8_t)((gpio_state >> 8) & 0xFF);
 
-    snprintf(response, response_size, "input_bytes,%d,%d,%d", get_gpio_device_id(), low_byte, high_byte);
+    cmd_sink_printf(out, "input_bytes,%d,%d,%d", get_gpio_device_id(), low_byte, high_byte);
     return CMD_SUCCESS;
 }
 
 // GPIO 입력 채널별 바이너리 텍스트 형태로 반환 (getinputchannel,id or getinputchannel,id,channel)
-cmd_result_t cmd_get_input_channel(const char* param, char* response, size_t response_size) {
+cmd_result_t cmd_get_input_channel(const char* param, cmd_sink_t* out) {
     if (param == NULL) {
-        snprintf(response, response_size, "Error: Parameter required. Use: getinputchannel,id or getinputchannel,id,channel\r\n");
+        cmd_sink_printf(out, "Error: Parameter required. Use: getinputchannel,id or getinputchannel,id,channel\r\n");
         return CMD_ERROR_INVALID;
     }
 
@@ -233,7 +264,7 @@ cmd_result_t cmd_get_input_channel(const char* param, char* response, size_t res
     char* channel_str = strtok(NULL, ",");
 
     if (id_str == NULL) {
-        snprintf(response, response_size, "Error: Device ID required\r\n");
+        cmd_sink_printf(out, "Error: Device ID required\r\n");
         return CMD_ERROR_INVALID;
     }
 
@@ -242,7 +273,6 @@ cmd_result_t cmd_get_input_channel(const char* param, char* response, size_t res
     // 디바이스 ID 체크
     if (target_id != 0 && target_id != get_gpio_device_id()) {
         // ID가 맞지 않으면 응답하지 않음
-        response[0] = '\0';
         return CMD_SUCCESS;
     }
 
@@ -253,12 +283,12 @@ cmd_result_t cmd_get_input_channel(const char* param, char* response, size_t res
     if (channel_str != NULL) {
         int channel = atoi(channel_str);
         if (channel < 1 || channel > 16) {
-            snprintf(response, response_size, "Error: Invalid channel. Use 1-16\r\n");
+            cmd_sink_printf(out, "Error: Invalid channel. Use 1-16\r\n");
             return CMD_ERROR_INVALID;
         }
         int channel_index = channel - 1;
         bool value = (input_data & (1 << channel_index)) != 0;
-        snprintf(response, response_size, "input_ch,%d,%d,%d\r\n", device_id, channel, value ? 1 : 0);
+        cmd_sink_printf(out, "input_ch,%d,%d,%d\r\n", device_id, channel, value ? 1 : 0);
     } else {
         // 전체 채널을 16자리 바이너리 텍스트로 반환 (채널 1부터 16까지)
         char binary_str[17];
@@ -266,16 +296,16 @@ cmd_result_t cmd_get_input_channel(const char* param, char* response, size_t res
             binary_str[i] = (input_data & (1 << i)) ? '1' : '0';
         }
         binary_str[16] = '\0';
-        snprintf(response, response_size, "inputs_ch,%d,%s\r\n", device_id, binary_str);
+        cmd_sink_printf(out, "inputs_ch,%d,%s\r\n", device_id, binary_str);
     }
     
     return CMD_SUCCESS;
 }
 
 // GPIO 단일 채널 출력 읽기 (getoutput,id,channel -> true/false)
-cmd_result_t cmd_get_output(const char* param, char* response, size_t response_size) {
+cmd_result_t cmd_get_output(const char* param, cmd_sink_t* out) {
     if (param == NULL) {
-        snprintf(response, response_size, "Error: Parameters required (id,channel). Use: getoutput,id,channel\r\n");
+        cmd_sink_printf(out, "Error: Parameters required (id,channel). Use: getoutput,id,channel\r\n");
         return CMD_ERROR_INVALID;
     }
 
@@ -288,7 +318,7 @@ cmd_result_t cmd_get_output(const char* param, char* response, size_t response_s
     char* channel_str = strtok(NULL, ",");
 
     if (id_str == NULL || channel_str == NULL) {
-        snprintf(response, response_size, "Error: Use format 'getoutput,id,channel' (e.g., 'getoutput,1,5')\r\n");
+        cmd_sink_printf(out, "Error: Use format 'getoutput,id,channel' (e.g., 'getoutput,1,5')\r\n");
         return CMD_ERROR_INVALID;
     }
 
@@ -298,12 +328,11 @@ cmd_result_t cmd_get_output(const char* param, char* response, size_t response_s
     // 디바이스 ID 체크
     if (target_id != 0 && target_id != get_gpio_device_id()) {
         // ID가 맞지 않으면 응답하지 않음
-        response[0] = '\0';
         return CMD_SUCCESS;
     }
 
     if (channel < 1 || channel > 16) {
-        snprintf(response, response_size, "Error: Invalid channel. Use 1-16\r\n");
+        cmd_sink_printf(out, "Error: Invalid channel. Use 1-16\r\n");
         return CMD_ERROR_INVALID;
     }
 
@@ -312,14 +341,14 @@ cmd_result_t cmd_get_output(const char* param, char* response, size_t response_s
     extern uint16_t gpio_output_data;
     bool value = (gpio_output_data & (1 << channel_index)) != 0;
     
-    snprintf(response, response_size, "output_ch,%d,%d,%s", get_gpio_device_id(), channel, value ? "1" : "0");
+    cmd_sink_printf(out, "output_ch,%d,%d,%s", get_gpio_device_id(), channel, value ? "1" : "0");
     return CMD_SUCCESS;
 }
 
 // GPIO 전체 출력 읽기 (getoutputs,id -> low,high)
-cmd_result_t cmd_get_outputs(const char* param, char* response, size_t response_size) {
+cmd_result_t cmd_get_outputs(const char* param, cmd_sink_t* out) {
     if (param == NULL) {
-        snprintf(response, response_size, "Error: Parameter required. Use: getoutputs,id\r\n");
+        cmd_sink_printf(out, "Error: Parameter required. Use: getoutputs,id\r\n");
         return CMD_ERROR_INVALID;
     }
 
@@ -328,7 +357,6 @@ cmd_result_t cmd_get_outputs(const char* param, char* response, size_t response_
     // 디바이스 ID 체크
     if (target_id != 0 && target_id != get_gpio_device_id()) {
         // ID가 맞지 않으면 응답하지 않음
-        response[0] = '\0';
         return CMD_SUCCESS;
     }
 
@@ -336,14 +364,14 @@ cmd_result_t cmd_get_outputs(const char* param, char* response, size_t response_
     uint8_t low_byte = (uint8_t)(gpio_state & 0xFF);
     uint8_t high_byte = (uint8_t)((gpio_state >> 8) & 0xFF);
 
-    snprintf(response, response_size, "output_bytes,%d,%d,%d", get_gpio_device_id(), low_byte, high_byte);
+    cmd_sink_printf(out, "output_bytes,%d,%d,%d", get_gpio_device_id(), low_byte, high_byte);
     return CMD_SUCCESS;
 }
 
 // GPIO 단일 채널 출력 설정 (setoutput,id,channel,value)
-cmd_result_t cmd_set_output(const char* param, char* response, size_t response_size) {
+cmd_result_t cmd_set_output(const char* param, cmd_sink_t* out) {
     if (param == NULL || strlen(param) == 0) {
-        snprintf(response, response_size, "Error: Parameters required. Use: setoutput,id,channel,value\r\n");
+        cmd_sink_printf(out, "Error: Parameters required. Use: setoutput,id,channel,value\r\n");
         return CMD_ERROR_INVALID;
     }
 
@@ -357,7 +385,7 @@ cmd_result_t cmd_set_output(const char* param, char* response, size_t response_s
     char* value_str = strtok(NULL, ",");
 
     if (id_str == NULL || channel_str == NULL || value_str == NULL) {
-        snprintf(response, response_size, "Error: Use format 'setoutput,id,channel,value' (e.g., 'setoutput,1,5,1')\r\n");
+        cmd_sink_printf(out, "Error: Use format 'setoutput,id,channel,value' (e.g., 'setoutput,1,5,1')\r\n");
         return CMD_ERROR_INVALID;
     }
 
@@ -368,17 +396,16 @@ cmd_result_t cmd_set_output(const char* param, char* response, size_t response_s
     // 디바이스 ID 체크
     if (target_id != 0 && target_id != get_gpio_device_id()) {
         // ID가 맞지 않으면 응답하지 않음
-        response[0] = '\0';
         return CMD_SUCCESS;
     }
 
     if (channel < 1 || channel > 16) {
-        snprintf(response, response_size, "Error: Invalid channel. Use 1-16\r\n");
+        cmd_sink_printf(out, "Error: Invalid channel. Use 1-16\r\n");
         return CMD_ERROR_INVALID;
     }
 
     if (value != 0 && value != 1) {
-        snprintf(response, response_size, "Error: Invalid value. Use 0 or 1\r\n");
+        cmd_sink_printf(out, "Error: Invalid value. Use 0 or 1\r\n");
         return CMD_ERROR_INVALID;
     }
 
@@ -386,23 +413,27 @@ cmd_result_t cmd_set_output(const char* param, char* response, size_t response_s
     int channel_index = channel - 1;
     uint16_t mask = 1 << channel_index;
     
+    // 정적 출력 명령은 해당 채널의 파형을 정지시킴
+    gpio_wave_stop(mask);
+    
     extern uint16_t gpio_output_data;
+    uint16_t output_data = gpio_output_data;
     if (value) {
-        gpio_output_data |= mask;
+        output_data |= mask;
     } else {
-        gpio_output_data &= ~mask;
+        output_data &= ~mask;
     }
     
-    hct595_write(gpio_output_data);
+    hct595_write(output_data);
     
-    snprintf(response, response_size, "output_set,OK");
+    cmd_sink_printf(out, "output_set,OK");
     return CMD_SUCCESS;
 }
 
 // GPIO 전체 출력 설정 (setoutputs,id,low,high)
-cmd_result_t cmd_set_outputs(const char* param, char* response, size_t response_size) {
+cmd_result_t cmd_set_outputs(const char* param, cmd_sink_t* out) {
     if (param == NULL || strlen(param) == 0) {
-        snprintf(response, response_size, "Error: Parameters required. Use: setoutputs,id,low,high\r\n");
+        cmd_sink_printf(out, "Error: Parameters required. Use: setoutputs,id,low,high\r\n");
         return CMD_ERROR_INVALID;
     }
 
@@ -416,7 +447,7 @@ cmd_result_t cmd_set_outputs(const char* param, char* response, size_t response_
     char* high_str = strtok(NULL, ",");
 
     if (id_str == NULL || low_str == NULL || high_str == NULL) {
-        snprintf(response, response_size, "Error: Use format 'setoutputs,id,low,high' (e.g., 'setoutputs,1,255,128')\r\n");
+        cmd_sink_printf(out, "Error: Use format 'setoutputs,id,low,high' (e.g., 'setoutputs,1,255,128')\r\n");
         return CMD_ERROR_INVALID;
     }
 
@@ -425,7 +456,6 @@ cmd_result_t cmd_set_outputs(const char* param, char* response, size_t response_
     // 디바이스 ID 체크
     if (target_id != 0 && target_id != get_gpio_device_id()) {
         // ID가 맞지 않으면 응답하지 않음
-        response[0] = '\0';
         return CMD_SUCCESS;
     }
 
@@ -433,85 +463,269 @@ cmd_result_t cmd_set_outputs(const char* param, char* response, size_t response_
     int high_byte = atoi(high_str);
     
     if (low_byte < 0 || low_byte > 255 || high_byte < 0 || high_byte > 255) {
-        snprintf(response, response_size, "Error: Values must be 0-255\r\n");
+        cmd_sink_printf(out, "Error: Values must be 0-255\r\n");
         return CMD_ERROR_INVALID;
     }
 
     uint16_t gpio_value = (uint16_t)((high_byte << 8) | low_byte);
     
-    // GPIO 출력에 적용
+    // GPIO 출력에 적용 (전체 채널 파형 정지)
+    gpio_wave_stop(0xFFFF);
     hct595_write(gpio_value);
     
-    snprintf(response, response_size, "output_set,OK");
+    cmd_sink_printf(out, "output_set,OK");
+    return CMD_SUCCESS;
+}
+
+// 채널 파형 설정 (setwave,id,channel,freq,duty[,step_ms,pattern])
+// pattern: '1'/'0' 문자열, 첫 문자가 첫 번째 스텝 (예: 1100 = 2스텝 ON, 2스텝 OFF)
+cmd_result_t cmd_set_wave(const char* param, cmd_sink_t* out) {
+    if (param == NULL || strlen(param) == 0) {
+        cmd_sink_printf(out, "Error: Parameters required. Use: setwave,id,ch,freq,duty[,step_ms,pattern]\r\n");
+        return CMD_ERROR_INVALID;
+    }
+
+    char param_copy[96];
+    strncpy(param_copy, param, sizeof(param_copy) - 1);
+    param_copy[sizeof(param_copy) - 1] = '\0';
+
+    char* id_str = strtok(param_copy, ",");
+    char* channel_str = strtok(NULL, ",");
+    char* freq_str = strtok(NULL, ",");
+    char* duty_str = strtok(NULL, ",");
+    char* step_str = strtok(NULL, ",");
+    char* pattern_str = strtok(NULL, ",");
+
+    if (id_str == NULL || channel_str == NULL || freq_str == NULL || duty_str == NULL) {
+        cmd_sink_printf(out, "Error: Use format 'setwave,id,ch,freq,duty[,step_ms,pattern]' (e.g., 'setwave,1,3,200,25,500,10')\r\n");
+        return CMD_ERROR_INVALID;
+    }
+
+    uint8_t target_id = (uint8_t)atoi(id_str);
+
+    // 디바이스 ID 체크
+    if (target_id != 0 && target_id != get_gpio_device_id()) {
+        // ID가 맞지 않으면 응답하지 않음
+        return CMD_SUCCESS;
+    }
+
+    int channel = atoi(channel_str);
+    int freq = atoi(freq_str);
+    int duty = atoi(duty_str);
+    int step_ms = 0;
+    uint32_t pattern = 0;
+    int pattern_len = 0;
+
+    if (channel < 1 || channel > GPIO_WAVE_CHANNELS) {
+        cmd_sink_printf(out, "Error: Invalid channel. Use 1-16\r\n");
+        return CMD_ERROR_INVALID;
+    }
+    if (freq < 0 || freq > GPIO_WAVE_MAX_FREQ_HZ) {
+        cmd_sink_printf(out, "Error: Invalid frequency. Use 0-%d Hz (0=no PWM)\r\n", GPIO_WAVE_MAX_FREQ_HZ);
+        return CMD_ERROR_INVALID;
+    }
+    if (duty < 0 || duty > 100) {
+        cmd_sink_printf(out, "Error: Invalid duty. Use 0-100\r\n");
+        return CMD_ERROR_INVALID;
+    }
+
+    if (step_str != NULL) {
+        step_ms = atoi(step_str);
+        if (step_ms != 0 && (step_ms < GPIO_WAVE_MIN_STEP_MS || step_ms > GPIO_WAVE_MAX_STEP_MS)) {
+            cmd_sink_printf(out, "Error: Invalid step. Use 0 or %d-%d ms\r\n",
+                     GPIO_WAVE_MIN_STEP_MS, GPIO_WAVE_MAX_STEP_MS);
+            return CMD_ERROR_INVALID;
+        }
+        if (step_ms != 0) {
+            // 패턴 생략 시 기본 50% 블링크 (ON, OFF)
+            const char* p = pattern_str != NULL ? pattern_str : "10";
+            for (; *p != '\0'; p++) {
+                if ((*p != '0' && *p != '1') || pattern_len >= GPIO_WAVE_MAX_PATTERN) {
+                    cmd_sink_printf(out, "Error: Invalid pattern. Use up to %d '0'/'1' steps\r\n",
+                             GPIO_WAVE_MAX_PATTERN);
+                    return CMD_ERROR_INVALID;
+                }
+                if (*p == '1') {
+                    pattern |= (1u << pattern_len);
+                }
+                pattern_len++;
+            }
+            if (pattern_len == 0) {
+                cmd_sink_printf(out, "Error: Empty pattern\r\n");
+                return CMD_ERROR_INVALID;
+            }
+        }
+    }
+
+    if (!gpio_wave_set((uint8_t)channel, (uint16_t)freq, (uint8_t)duty,
+                       (uint16_t)step_ms, pattern, (uint8_t)pattern_len)) {
+        cmd_sink_printf(out, "Error: Failed to start waveform\r\n");
+        return CMD_ERROR_EXECUTION;
+    }
+
+    cmd_sink_printf(out, "wave_set,OK");
+    return CMD_SUCCESS;
+}
+
+// 채널 파형 정지 (stopwave,id,channel / channel 0 = 전체)
+cmd_result_t cmd_stop_wave(const char* param, cmd_sink_t* out) {
+    if (param == NULL || strlen(param) == 0) {
+        cmd_sink_printf(out, "Error: Parameters required. Use: stopwave,id,ch (ch 0=all)\r\n");
+        return CMD_ERROR_INVALID;
+    }
+
+    char param_copy[64];
+    strncpy(param_copy, param, sizeof(param_copy) - 1);
+    param_copy[sizeof(param_copy) - 1] = '\0';
+
+    char* id_str = strtok(param_copy, ",");
+    char* channel_str = strtok(NULL, ",");
+
+    if (id_str == NULL || channel_str == NULL) {
+        cmd_sink_printf(out, "Error: Use format 'stopwave,id,ch' (e.g., 'stopwave,1,3')\r\n");
+        return CMD_ERROR_INVALID;
+    }
+
+    uint8_t target_id = (uint8_t)atoi(id_str);
+
+    // 디바이스 ID 체크
+    if (target_id != 0 && target_id != get_gpio_device_id()) {
+        // ID가 맞지 않으면 응답하지 않음
+        return CMD_SUCCESS;
+    }
+
+    int channel = atoi(channel_str);
+    if (channel < 0 || channel > GPIO_WAVE_CHANNELS) {
+        cmd_sink_printf(out, "Error: Invalid channel. Use 0(all) or 1-16\r\n");
+        return CMD_ERROR_INVALID;
+    }
+
+    gpio_wave_stop(channel == 0 ? 0xFFFF : (uint16_t)(1u << (channel - 1)));
+
+    cmd_sink_printf(out, "wave_stop,OK");
+    return CMD_SUCCESS;
+}
+
+// 채널 파형 설정 조회 (getwave,id,channel -> wave,id,ch,active,freq,duty,step_ms,pattern)
+cmd_result_t cmd_get_wave(const char* param, cmd_sink_t* out) {
+    if (param == NULL || strlen(param) == 0) {
+        cmd_sink_printf(out, "Error: Parameters required. Use: getwave,id,ch\r\n");
+        return CMD_ERROR_INVALID;
+    }
+
+    char param_copy[64];
+    strncpy(param_copy, param, sizeof(param_copy) - 1);
+    param_copy[sizeof(param_copy) - 1] = '\0';
+
+    char* id_str = strtok(param_copy, ",");
+    char* channel_str = strtok(NULL, ",");
+
+    if (id_str == NULL || channel_str == NULL) {
+        cmd_sink_printf(out, "Error: Use format 'getwave,id,ch' (e.g., 'getwave,1,3')\r\n");
+        return CMD_ERROR_INVALID;
+    }
+
+    uint8_t target_id = (uint8_t)atoi(id_str);
+
+    // 디바이스 ID 체크
+    if (target_id != 0 && target_id != get_gpio_device_id()) {
+        // ID가 맞지 않으면 응답하지 않음
+        return CMD_SUCCESS;
+    }
+
+    int channel = atoi(channel_str);
+    gpio_wave_config_t wave;
+    if (!gpio_wave_get((uint8_t)channel, &wave)) {
+        cmd_sink_printf(out, "Error: Invalid channel. Use 1-16\r\n");
+        return CMD_ERROR_INVALID;
+    }
+
+    // 패턴을 '0'/'1' 문자열로 변환 (블링크 없으면 "-")
+    char pattern_str[GPIO_WAVE_MAX_PATTERN + 1];
+    if (wave.pattern_len == 0) {
+        strcpy(pattern_str, "-");
+    } else {
+        for (int i = 0; i < wave.pattern_len; i++) {
+            pattern_str[i] = (wave.pattern & (1u << i)) ? '1' : '0';
+        }
+        pattern_str[wave.pattern_len] = '\0';
+    }
+
+    cmd_sink_printf(out, "wave,%d,%d,%d,%u,%u,%u,%s",
+             get_gpio_device_id(), channel, wave.active ? 1 : 0,
+             wave.freq_hz, wave.duty, wave.step_ms, pattern_str);
     return CMD_SUCCESS;
 }
 
 // 네트워크 설정 명령어들
-cmd_result_t cmd_set_ip(const char* param, char* response, size_t response_size) {
+cmd_result_t cmd_set_ip(const char* param, cmd_sink_t* out) {
     if (param == NULL) {
-        snprintf(response, response_size, "Error: IP address parameter required\r\n");
+        cmd_sink_printf(out, "Error: IP address parameter required\r\n");
         return CMD_ERROR_INVALID;
     }
 
     uint8_t ip[4];
     if (sscanf(param, "%hhu.%hhu.%hhu.%hhu", &ip[0], &ip[1], &ip[2], &ip[3]) != 4) {
-        snprintf(response, response_size, "Error: Invalid IP format. Use xxx.xxx.xxx.xxx\r\n");
+        cmd_sink_printf(out, "Error: Invalid IP format. Use xxx.xxx.xxx.xxx\r\n");
         return CMD_ERROR_INVALID;
     }
 
     memcpy(g_net_info.ip, ip, 4);
     g_net_info.dhcp = NETINFO_STATIC;
     network_config_save_to_flash(&g_net_info);
+    network_apply_request(NETWORK_APPLY_ADDRESS);
     
-    snprintf(response, response_size, "IP address set to %d.%d.%d.%d. Restart required.\r\n", 
+    cmd_sink_printf(out, "IP address set to %d.%d.%d.%d. Applied.\r\n", 
              ip[0], ip[1], ip[2], ip[3]);
     return CMD_SUCCESS;
 }
 
-cmd_result_t cmd_set_subnet(const char* param, char* response, size_t response_size) {
+cmd_result_t cmd_set_subnet(const char* param, cmd_sink_t* out) {
     if (param == NULL) {
-        snprintf(response, response_size, "Error: Subnet mask parameter required\r\n");
+        cmd_sink_printf(out, "Error: Subnet mask parameter required\r\n");
         return CMD_ERROR_INVALID;
     }
 
     uint8_t subnet[4];
     if (sscanf(param, "%hhu.%hhu.%hhu.%hhu", &subnet[0], &subnet[1], &subnet[2], &subnet[3]) != 4) {
-        snprintf(response, response_size, "Error: Invalid subnet format. Use xxx.xxx.xxx.xxx\r\n");
+        cmd_sink_printf(out, "Error: Invalid subnet format. Use xxx.xxx.xxx.xxx\r\n");
         return CMD_ERROR_INVALID;
     }
 
     memcpy(g_net_info.sn, subnet, 4);
     network_config_save_to_flash(&g_net_info);
+    network_apply_request(NETWORK_APPLY_ADDRESS);
     
-    snprintf(response, response_size, "Subnet mask set to %d.%d.%d.%d. Restart required.\r\n", 
+    cmd_sink_printf(out, "Subnet mask set to %d.%d.%d.%d. Applied.\r\n", 
              subnet[0], subnet[1], subnet[2], subnet[3]);
     return CMD_SUCCESS;
 }
 
-cmd_result_t cmd_set_gateway(const char* param, char* response, size_t response_size) {
+cmd_result_t cmd_set_gateway(const char* param, cmd_sink_t* out) {
     if (param == NULL) {
-        snprintf(response, response_size, "Error: Gateway parameter required\r\n");
+        cmd_sink_printf(out, "Error: Gateway parameter required\r\n");
         return CMD_ERROR_INVALID;
     }
 
     uint8_t gateway[4];
     if (sscanf(param, "%hhu.%hhu.%hhu.%hhu", &gateway[0], &gateway[1], &gateway[2], &gateway[3]) != 4) {
-        snprintf(response, response_size, "Error: Invalid gateway format. Use xxx.xxx.xxx.xxx\r\n");
+        cmd_sink_printf(out, "Error: Invalid gateway format. Use xxx.xxx.xxx.xxx\r\n");
         return CMD_ERROR_INVALID;
     }
 
     memcpy(g_net_info.gw, gateway, 4);
     network_config_save_to_flash(&g_net_info);
+    network_apply_request(NETWORK_APPLY_ADDRESS);
     
-    snprintf(response, response_size, "Gateway set to %d.%d.%d.%d. Restart required.\r\n", 
+    cmd_sink_printf(out, "Gateway set to %d.%d.%d.%d. Applied.\r\n", 
              gateway[0], gateway[1], gateway[2], gateway[3]);
     return CMD_SUCCESS;
 }
 
 // 네트워크 설정 한번에 설정 (setnetwork,ip,subnet,gateway)
-cmd_result_t cmd_set_network(const char* param, char* response, size_t response_size) {
+cmd_result_t cmd_set_network(const char* param, cmd_sink_t* out) {
     if (param == NULL) {
-        snprintf(response, response_size, "Error: Network parameters required. Use: setnetwork,ip,subnet,gateway\r\n");
+        cmd_sink_printf(out, "Error: Network parameters required. Use: setnetwork,ip,subnet,gateway\r\n");
         return CMD_ERROR_INVALID;
     }
 
@@ -525,28 +739,28 @@ cmd_result_t cmd_set_network(const char* param, char* response, size_t response_
     char* gateway_str = strtok(NULL, ",");
 
     if (ip_str == NULL || subnet_str == NULL || gateway_str == NULL) {
-        snprintf(response, response_size, "Error: Use format 'setnetwork,ip,subnet,gateway' (e.g., 'setnetwork,192.168.1.100,255.255.255.0,192.168.1.1')\r\n");
+        cmd_sink_printf(out, "Error: Use format 'setnetwork,ip,subnet,gateway' (e.g., 'setnetwork,192.168.1.100,255.255.255.0,192.168.1.1')\r\n");
         return CMD_ERROR_INVALID;
     }
 
     // IP 주소 파싱
     uint8_t ip[4];
     if (sscanf(ip_str, "%hhu.%hhu.%hhu.%hhu", &ip[0], &ip[1], &ip[2], &ip[3]) != 4) {
-        snprintf(response, response_size, "Error: Invalid IP format. Use xxx.xxx.xxx.xxx\r\n");
+        cmd_sink_printf(out, "Error: Invalid IP format. Use xxx.xxx.xxx.xxx\r\n");
         return CMD_ERROR_INVALID;
     }
 
     // 서브넷 마스크 파싱
     uint8_t subnet[4];
     if (sscanf(subnet_str, "%hhu.%hhu.%hhu.%hhu", &subnet[0], &subnet[1], &subnet[2], &subnet[3]) != 4) {
-        snprintf(response, response_size, "Error: Invalid subnet format. Use xxx.xxx.xxx.xxx\r\n");
+        cmd_sink_printf(out, "Error: Invalid subnet format. Use xxx.xxx.xxx.xxx\r\n");
         return CMD_ERROR_INVALID;
     }
 
     // 게이트웨이 파싱
     uint8_t gateway[4];
     if (sscanf(gateway_str, "%hhu.%hhu.%hhu.%hhu", &gateway[0], &gateway[1], &gateway[2], &gateway[3]) != 4) {
-        snprintf(response, response_size, "Error: Invalid gateway format. Use xxx.xxx.xxx.xxx\r\n");
+        cmd_sink_printf(out, "Error: Invalid gateway format. Use xxx.xxx.xxx.xxx\r\n");
         return CMD_ERROR_INVALID;
     }
 
@@ -556,45 +770,51 @@ cmd_result_t cmd_set_network(const char* param, char* response, size_t response_
     memcpy(g_net_info.gw, gateway, 4);
     g_net_info.dhcp = NETINFO_STATIC;
     
-    // 플래시에 저장
+    // 플래시에 저장 후 재부팅 없이 적용
     network_config_save_to_flash(&g_net_info);
+    network_apply_request(NETWORK_APPLY_ADDRESS);
     
-    snprintf(response, response_size, 
+    cmd_sink_printf(out, 
              "Network configuration set:\r\n"
              "IP: %d.%d.%d.%d\r\n"
              "Subnet: %d.%d.%d.%d\r\n"
              "Gateway: %d.%d.%d.%d\r\n"
              "DHCP: Disabled\r\n"
-             "Restart required.\r\n",
+             "Applied.\r\n",
              ip[0], ip[1], ip[2], ip[3],
              subnet[0], subnet[1], subnet[2], subnet[3],
              gateway[0], gateway[1], gateway[2], gateway[3]);
     return CMD_SUCCESS;
 }
 
-cmd_result_t cmd_set_tcp_port(const char* param, char* response, size_t response_size) {
+cmd_result_t cmd_set_tcp_port(const char* param, cmd_sink_t* out) {
     if (param == NULL) {
-        snprintf(response, response_size, "Error: TCP port parameter required\r\n");
+        cmd_sink_printf(out, "Error: TCP port parameter required\r\n");
         return CMD_ERROR_INVALID;
     }
 
     int port = atoi(param);
     if (port < 1 || port > 65535) {
-        snprintf(response, response_size, "Error: Invalid port range. Use 1-65535\r\n");
+        cmd_sink_printf(out, "Error: Invalid port range. Use 1-65535\r\n");
         return CMD_ERROR_INVALID;
     }
 
     extern uint16_t tcp_port;
+    bool changed = tcp_port != (uint16_t)port;
     tcp_port = (uint16_t)port;
     save_tcp_port_to_flash(tcp_port);
+    if (changed) {
+        // 연결된 클라이언트는 응답을 받은 뒤 끊기고 새 포트로 다시 접속
+        network_apply_request(NETWORK_APPLY_TCP_PORT);
+    }
     
-    snprintf(response, response_size, "TCP port set to %d. Restart required.\r\n", port);
+    cmd_sink_printf(out, "TCP port set to %d. Applied.\r\n", port);
     return CMD_SUCCESS;
 }
 
-cmd_result_t cmd_set_dhcp(const char* param, char* response, size_t response_size) {
+cmd_result_t cmd_set_dhcp(const char* param, cmd_sink_t* out) {
     if (param == NULL) {
-        snprintf(response, response_size, "Error: DHCP parameter required (on/off)\r\n");
+        cmd_sink_printf(out, "Error: DHCP parameter required (on/off)\r\n");
         return CMD_ERROR_INVALID;
     }
 
@@ -603,41 +823,43 @@ cmd_result_t cmd_set_dhcp(const char* param, char* response, size_t response_siz
     } else if (strcmp(param, "off") == 0 || strcmp(param, "0") == 0) {
         g_net_info.dhcp = NETINFO_STATIC;
     } else {
-        snprintf(response, response_size, "Error: Invalid DHCP value. Use 'on' or 'off'\r\n");
+        cmd_sink_printf(out, "Error: Invalid DHCP value. Use 'on' or 'off'\r\n");
         return CMD_ERROR_INVALID;
     }
 
     network_config_save_to_flash(&g_net_info);
+    network_apply_request(NETWORK_APPLY_ADDRESS);
     
-    snprintf(response, response_size, "DHCP %s. Restart required.\r\n", 
+    cmd_sink_printf(out, "DHCP %s. Applied.\r\n", 
              (g_net_info.dhcp == NETINFO_DHCP) ? "enabled" : "disabled");
     return CMD_SUCCESS;
 }
 
 // UART 설정 명령어들
-cmd_result_t cmd_set_uart_baud(const char* param, char* response, size_t response_size) {
+cmd_result_t cmd_set_uart_baud(const char* param, cmd_sink_t* out) {
     if (param == NULL) {
-        snprintf(response, response_size, "Error: Baud rate parameter required\r\n");
+        cmd_sink_printf(out, "Error: Baud rate parameter required\r\n");
         return CMD_ERROR_INVALID;
     }
 
     uint32_t baud = (uint32_t)atol(param);
     if (baud < 9600 || baud > 115200) {
-        snprintf(response, response_size, "Error: Invalid baud rate. Use 9600-115200\r\n");
+        cmd_sink_printf(out, "Error: Invalid baud rate. Use 9600-115200\r\n");
         return CMD_ERROR_INVALID;
     }
 
     extern uint32_t uart_rs232_1_baud;
     uart_rs232_1_baud = baud;
     save_uart_rs232_baud_to_flash();
+    uart_rs232_set_baud(RS232_PORT_1, baud);
     
-    snprintf(response, response_size, "UART baud rate set to %lu. Restart required.\r\n", baud);
+    cmd_sink_printf(out, "UART baud rate set to %lu. Applied.\r\n", baud);
     return CMD_SUCCESS;
 }
 
-cmd_result_t cmd_get_uart_config(char* response, size_t response_size) {
+cmd_result_t cmd_get_uart_config(cmd_sink_t* out) {
     extern uint32_t uart_rs232_1_baud;
-    snprintf(response, response_size, "UART Configuration:\r\n"
+    cmd_sink_printf(out, "UART Configuration:\r\n"
                                     "Baud Rate: %lu\r\n"
                                     "Data Bits: 8\r\n"
                                     "Parity: None\r\n"
@@ -646,42 +868,42 @@ cmd_result_t cmd_get_uart_config(char* response, size_t response_size) {
 }
 
 // GPIO 디바이스 ID 명령어들
-cmd_result_t cmd_set_gpio_id(const char* param, char* response, size_t response_size) {
+cmd_result_t cmd_set_gpio_id(const char* param, cmd_sink_t* out) {
     if (param == NULL) {
-        snprintf(response, response_size, "Error: Device ID parameter required (1-254)\r\n");
+        cmd_sink_printf(out, "Error: Device ID parameter required (1-254)\r\n");
         return CMD_ERROR_INVALID;
     }
 
     int id = atoi(param);
     if (id < 1 || id > 254) {
-        snprintf(response, response_size, "Error: Invalid device ID. Use 1-254\r\n");
+        cmd_sink_printf(out, "Error: Invalid device ID. Use 1-254\r\n");
         return CMD_ERROR_INVALID;
     }
 
     if (set_gpio_device_id((uint8_t)id)) {
-        snprintf(response, response_size, "GPIO device ID set to %d (0x%02X)\r\n", id, id);
+        cmd_sink_printf(out, "GPIO device ID set to %d (0x%02X)\r\n", id, id);
         return CMD_SUCCESS;
     } else {
-        snprintf(response, response_size, "Error: Failed to set device ID\r\n");
+        cmd_sink_printf(out, "Error: Failed to set device ID\r\n");
         return CMD_ERROR_EXECUTION;
     }
 }
 
-cmd_result_t cmd_get_gpio_id(char* response, size_t response_size) {
+cmd_result_t cmd_get_gpio_id(cmd_sink_t* out) {
     uint8_t id = get_gpio_device_id();
     
-    snprintf(response, response_size, "GPIO device ID: %d (0x%02X)\r\n", id, id);
+    cmd_sink_printf(out, "GPIO device ID: %d (0x%02X)\r\n", id, id);
     return CMD_SUCCESS;
 }
 
 // GPIO 전체 설정 조회
-cmd_result_t cmd_get_gpio_config(char* response, size_t response_size) {
+cmd_result_t cmd_get_gpio_config(cmd_sink_t* out) {
     uint8_t id = get_gpio_device_id();
     bool auto_resp = get_gpio_auto_response();
     gpio_rt_mode_t rt_mode = get_gpio_rt_mode();
     gpio_trigger_mode_t trigger_mode = get_gpio_trigger_mode();
     
-    snprintf(response, response_size,
+    cmd_sink_printf(out,
             "GPIO Configuration:\r\n"
             "Device ID: %d (0x%02X)\r\n"
             "Auto Response: %s\r\n"
@@ -695,9 +917,9 @@ cmd_result_t cmd_get_gpio_config(char* response, size_t response_size) {
 }
 
 // RT Mode 설정 명령어
-cmd_result_t cmd_set_rt_mode(const char* param, char* response, size_t response_size) {
+cmd_result_t cmd_set_rt_mode(const char* param, cmd_sink_t* out) {
     if (param == NULL) {
-        snprintf(response, response_size, "Error: Mode parameter required (bytes/channel)\r\n");
+        cmd_sink_printf(out, "Error: Mode parameter required (bytes/channel)\r\n");
         return CMD_ERROR_INVALID;
     }
 
@@ -707,33 +929,33 @@ cmd_result_t cmd_set_rt_mode(const char* param, char* response, size_t response_
     } else if (strcmp(param, "channel") == 0 || strcmp(param, "1") == 0) {
         mode = GPIO_RT_MODE_CHANNEL;
     } else {
-        snprintf(response, response_size, "Error: Invalid mode. Use 'bytes' or 'channel'\r\n");
+        cmd_sink_printf(out, "Error: Invalid mode. Use 'bytes' or 'channel'\r\n");
         return CMD_ERROR_INVALID;
     }
 
     if (set_gpio_rt_mode(mode)) {
-        snprintf(response, response_size, "RT mode set to %s\r\n", 
+        cmd_sink_printf(out, "RT mode set to %s\r\n", 
                  mode == GPIO_RT_MODE_CHANNEL ? "channel" : "bytes");
         return CMD_SUCCESS;
     } else {
-        snprintf(response, response_size, "Error: Failed to set RT mode\r\n");
+        cmd_sink_printf(out, "Error: Failed to set RT mode\r\n");
         return CMD_ERROR_EXECUTION;
     }
 }
 
 // RT Mode 조회 명령어
-cmd_result_t cmd_get_rt_mode(char* response, size_t response_size) {
+cmd_result_t cmd_get_rt_mode(cmd_sink_t* out) {
     gpio_rt_mode_t mode = get_gpio_rt_mode();
     
-    snprintf(response, response_size, "RT mode: %s\r\n",
+    cmd_sink_printf(out, "RT mode: %s\r\n",
              mode == GPIO_RT_MODE_CHANNEL ? "channel" : "bytes");
     return CMD_SUCCESS;
 }
 
 // Trigger Mode 설정 명령어
-cmd_result_t cmd_set_trigger_mode(const char* param, char* response, size_t response_size) {
+cmd_result_t cmd_set_trigger_mode(const char* param, cmd_sink_t* out) {
     if (param == NULL) {
-        snprintf(response, response_size, "Error: Mode parameter required (toggle/trigger)\r\n");
+        cmd_sink_printf(out, "Error: Mode parameter required (toggle/trigger)\r\n");
         return CMD_ERROR_INVALID;
     }
 
@@ -743,76 +965,97 @@ cmd_result_t cmd_set_trigger_mode(const char* param, char* response, size_t resp
     } else if (strcmp(param, "trigger") == 0 || strcmp(param, "1") == 0) {
         mode = GPIO_MODE_TRIGGER;
     } else {
-        snprintf(response, response_size, "Error: Invalid mode. Use 'toggle' or 'trigger'\r\n");
+        cmd_sink_printf(out, "Error: Invalid mode. Use 'toggle' or 'trigger'\r\n");
         return CMD_ERROR_INVALID;
     }
 
     if (set_gpio_trigger_mode(mode)) {
-        snprintf(response, response_size, "Trigger mode set to %s\r\n", 
+        cmd_sink_printf(out, "Trigger mode set to %s\r\n", 
                  mode == GPIO_MODE_TRIGGER ? "trigger" : "toggle");
         return CMD_SUCCESS;
     } else {
-        snprintf(response, response_size, "Error: Failed to set trigger mode\r\n");
+        cmd_sink_printf(out, "Error: Failed to set trigger mode\r\n");
         return CMD_ERROR_EXECUTION;
     }
 }
 
 // Trigger Mode 조회 명령어
-cmd_result_t cmd_get_trigger_mode(char* response, size_t response_size) {
+cmd_result_t cmd_get_trigger_mode(cmd_sink_t* out) {
     gpio_trigger_mode_t mode = get_gpio_trigger_mode();
     
-    snprintf(response, response_size, "Trigger mode: %s\r\n",
+    cmd_sink_printf(out, "Trigger mode: %s\r\n",
              mode == GPIO_MODE_TRIGGER ? "trigger" : "toggle");
     return CMD_SUCCESS;
 }
 
-// 도움말 및 시스템 명령어들
-cmd_result_t cmd_help(char* response, size_t response_size) {
-    snprintf(response, response_size,
-        "Available Commands:\r\n"
-        "Network:\r\n"
-        "  getip                      - Show network configuration\r\n"
-        "  setip,x.x.x.x             - Set IP address\r\n"
-        "  setsubnet,x.x.x.x         - Set subnet mask\r\n"
-        "  setgateway,x.x.x.x        - Set gateway\r\n"
-        "  setnetwork,ip,sub,gw      - Set IP, subnet, gateway at once\r\n"
-        "  settcpport,port           - Set TCP port\r\n"
-        "  setdhcp,on/off            - Enable/disable DHCP\r\n"
-        "UART:\r\n"
-        "  getuartconfig             - Show UART configuration\r\n"
-        "  setuartbaud,rate          - Set UART baud rate\r\n"
-        "GPIO Control (All Channels):\r\n"
-        "  getinputs,id              - Get all 16 inputs (format: low,high)\r\n"
-        "  getinputchannel,id        - Get all 16 inputs as binary text (format: inputs_ch,id,0101010101010101)\r\n"
-        "  getoutputs,id             - Get all 16 outputs (format: low,high)\r\n"
-        "  setoutputs,id,low,high    - Set all 16 outputs (0-255,0-255)\r\n"
-        "GPIO Control (Single Channel):\r\n"
-        "  getinput,id,ch            - Get single input (returns: true/false)\r\n"
-        "  getinputchannel,id,ch     - Get single input channel (format: input_ch,id,ch,value)\r\n"
-        "  setoutput,id,ch,val       - Set single output (id:0=all/1-254, ch:1-16, val:0/1)\r\n"
-        "  getoutput,id,ch           - Get single output (returns: true/false)\r\n"
-        "Device Configuration:\r\n"
-        "  getgpioid                 - Get device ID\r\n"
-        "  setgpioid,id              - Set device ID (1-254)\r\n"
-        "  getgpioconfig             - Get all GPIO configuration\r\n"
-        "  setrtmode,bytes/channel   - Set return mode (bytes=2bytes, channel=per-channel)\r\n"
-        "  getrtmode                 - Get return mode\r\n"
-        "  settriggermode,toggle/trigger - Set trigger mode (channel mode only: toggle=on-change, trigger=cycle)\r\n"
-        "  gettriggermode            - Get trigger mode\r\n"
-        "System:\r\n"
-        "  setautoresponse,0/1       - Enable/Disable auto response on input change\r\n"
-        "  getautoresponse           - Get auto response status\r\n"
-        "  factoryreset              - Factory reset (IP:192.168.1.100, Port:5050, Baud:9600)\r\n"
-        "  restart                   - Restart system\r\n"
-        "  help                      - Show this help\r\n"
-        "  getdebug,<cat>|all        - Get debug status for category or all (MAIN/NET/TCP/HTTP/UART/JSON/GPIO/DHCP/WIZNET)\r\n"
-        "  setdebug,<cat>|all,on|off - Set debug state for category or all\r\n");
-        return CMD_SUCCESS;
+// 도움말 및 시스템 명령어들 (줄 단위로 바로 출력하므로 응답 버퍼 크기 제한 없음)
+static const char* const help_lines[] = {
+    "Available Commands:\r\n",
+    "Network:\r\n",
+    "  getip                      - Show network configuration\r\n",
+    "  setip,x.x.x.x             - Set IP address\r\n",
+    "  setsubnet,x.x.x.x         - Set subnet mask\r\n",
+    "  setgateway,x.x.x.x        - Set gateway\r\n",
+    "  setnetwork,ip,sub,gw      - Set IP, subnet, gateway at once\r\n",
+    "  settcpport,port           - Set TCP port\r\n",
+    "  settxpolicy,drop|disconnect|coalesce - Slow TCP client policy\r\n",
+    "  gettxstats                - TCP client TX queue statistics\r\n",
+    "  getclients                - TCP connections (peer, age, idle, bytes/commands in and out)\r\n",
+    "  setidletimeout,sec        - Close TCP clients idle for sec seconds (0=off)\r\n",
+    "  getsockets                - W5500 socket roles, states and buffer sizes\r\n",
+    "  setsocketprofile,balanced|http|clients - Socket buffer profile (applied after restart)\r\n",
+    "  setdhcp,on/off            - Enable/disable DHCP\r\n",
+    "UART:\r\n",
+    "  getuartconfig             - Show UART configuration\r\n",
+    "  setuartbaud,rate          - Set UART baud rate\r\n",
+    "GPIO Control (All Channels):\r\n",
+    "  getinputs,id              - Get all 16 inputs (format: low,high)\r\n",
+    "  getinputchannel,id        - Get all 16 inputs as binary text (format: inputs_ch,id,0101010101010101)\r\n",
+    "  getoutputs,id             - Get all 16 outputs (format: low,high)\r\n",
+    "  setoutputs,id,low,high    - Set all 16 outputs (0-255,0-255)\r\n",
+    "GPIO Control (Single Channel):\r\n",
+    "  getinput,id,ch            - Get single input (returns: true/false)\r\n",
+    "  getinputchannel,id,ch     - Get single input channel (format: input_ch,id,ch,value)\r\n",
+    "  setoutput,id,ch,val       - Set single output (id:0=all/1-254, ch:1-16, val:0/1)\r\n",
+    "  getoutput,id,ch           - Get single output (returns: true/false)\r\n",
+    "GPIO Waveform (PWM/Blink):\r\n",
+    "  setwave,id,ch,freq,duty[,step,pat] - PWM 0-1000Hz/0-100%, blink step ms + pattern (e.g. 1100)\r\n",
+    "  stopwave,id,ch            - Stop waveform (ch 0=all)\r\n",
+    "  getwave,id,ch             - Get waveform settings\r\n",
+    "TCP Events (TCP only):\r\n",
+    "  subscribe,id,chmask[,ev]  - Filter events (ev: 1=input,2=output,4=link, default 5)\r\n",
+    "  unsubscribe,id[,ev]       - Stop events (default all)\r\n",
+    "Device Configuration:\r\n",
+    "  getgpioid                 - Get device ID\r\n",
+    "  setgpioid,id              - Set device ID (1-254)\r\n",
+    "  getgpioconfig             - Get all GPIO configuration\r\n",
+    "  setrtmode,bytes/channel   - Set return mode (bytes=2bytes, channel=per-channel)\r\n",
+    "  getrtmode                 - Get return mode\r\n",
+    "  settriggermode,toggle/trigger - Set trigger mode (channel mode only: toggle=on-change, trigger=cycle)\r\n",
+    "  gettriggermode            - Get trigger mode\r\n",
+    "System:\r\n",
+    "  setautoresponse,0/1       - Enable/Disable auto response on input change\r\n",
+    "  getautoresponse           - Get auto response status\r\n",
+    "  sethistory,on|off         - Enable/Disable input history recorder (flash ring)\r\n",
+    "  gethistory[,n]            - Show last n input edges (default 20, max 40)\r\n",
+    "  batch;cmd1;cmd2;...       - Run commands in order, one framed response, outputs latched once\r\n",
+    "  factoryreset              - Factory reset (IP:192.168.1.100, Port:5050, Baud:9600)\r\n",
+    "  restart                   - Restart system\r\n",
+    "  help                      - Show this help\r\n",
+    "  getdebug,<cat>|all        - Get debug status for category or all (MAIN/NET/TCP/HTTP/UART/JSON/GPIO/DHCP/WIZNET)\r\n",
+    "  setdebug,<cat>|all,on|off - Set debug state for category or all\r\n",
+};
+
+cmd_result_t cmd_help(cmd_sink_t* out) {
+    for (size_t i = 0; i < sizeof(help_lines) / sizeof(help_lines[0]); i++) {
+        cmd_sink_puts(out, help_lines[i]);
+    }
+    return CMD_SUCCESS;
 }
 
-cmd_result_t cmd_set_auto_response(const char* param, char* response, size_t response_size) {
+cmd_result_t cmd_set_auto_response(const char* param, cmd_sink_t* out) {
     if (param == NULL) {
-        snprintf(response, response_size, "Error: Parameter required (0=disable, 1=enable)\r\n");
+        cmd_sink_printf(out, "Error: Parameter required (0=disable, 1=enable)\r\n");
         return CMD_ERROR_INVALID;
     }
     
@@ -821,26 +1064,26 @@ cmd_result_t cmd_set_auto_response(const char* param, char* response, size_t res
     
     set_gpio_auto_response(enabled);
     
-    snprintf(response, response_size, "Auto response %s\r\n", enabled ? "enabled" : "disabled");
+    cmd_sink_printf(out, "Auto response %s\r\n", enabled ? "enabled" : "disabled");
     return CMD_SUCCESS;
 }
 
-cmd_result_t cmd_get_auto_response(char* response, size_t response_size) {
+cmd_result_t cmd_get_auto_response(cmd_sink_t* out) {
     bool enabled = get_gpio_auto_response();
     
-    snprintf(response, response_size, "Auto response: %s\r\n", enabled ? "enabled" : "disabled");
+    cmd_sink_printf(out, "Auto response: %s\r\n", enabled ? "enabled" : "disabled");
     return CMD_SUCCESS;
 }
 
-cmd_result_t cmd_restart(char* response, size_t response_size) {
-    snprintf(response, response_size, "System restart requested...\r\n");
+cmd_result_t cmd_restart(cmd_sink_t* out) {
+    cmd_sink_printf(out, "System restart requested...\r\n");
     extern void system_restart_request(void);
     system_restart_request();
     return CMD_SUCCESS;
 }
 
 // 공장 초기화
-cmd_result_t cmd_factory_reset(char* response, size_t response_size) {
+cmd_result_t cmd_factory_reset(cmd_sink_t* out) {
     // 기본 네트워크 설정
     wiz_NetInfo default_net_info = {
         .mac = {0x00, 0x08, 0xDC, 0x00, 0x00, 0x01},  // WIZnet OUI
@@ -869,7 +1112,7 @@ cmd_result_t cmd_factory_reset(char* response, size_t response_size) {
     set_gpio_device_id(1);
     set_gpio_auto_response(true);
     
-    snprintf(response, response_size, 
+    cmd_sink_printf(out, 
             "Factory reset completed. System will restart.\r\n"
             "IP: 192.168.1.100\r\n"
             "Subnet: 255.255.255.0\r\n"
@@ -884,6 +1127,101 @@ cmd_result_t cmd_factory_reset(char* response, size_t response_size) {
     return CMD_SUCCESS;
 }
 
+// 배치 안에서 실행할 수 없는 명령어
+// (응답을 쓰는 도중 실행 중인 소켓을 닫거나 다시 설정함, help는 혼자서 출력 예산을 넘김)
+static const char* const cmd_batch_forbidden[] = {
+    "restart", "factoryreset", "settcpport", "setsocketprofile",
+    "setip", "setsubnet", "setgateway", "setnetwork", "setdhcp",
+    "help", "?",
+};
+
+static bool cmd_batch_is_forbidden(const char* sub) {
+    size_t name_len = strcspn(sub, ", \t");
+    for (size_t i = 0; i < sizeof(cmd_batch_forbidden) / sizeof(cmd_batch_forbidden[0]); i++) {
+        if (strlen(cmd_batch_forbidden[i]) == name_len && strncmp(sub, cmd_batch_forbidden[i], name_len) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// 배치 명령어: batch;cmd1;cmd2;...
+// 하위 명령어를 순서대로 실행하고 출력 변경은 끝에서 한 번에 래치
+// 응답: batch,begin,<개수> / 명령어별 응답 (각각 한 줄 이상) / batch,end,<개수>,<실패 수>
+// 래치는 batch,end를 쓴 뒤에 하므로 출력 변화 알림은 프레임 밖에 나옴
+// (TCP는 명령어 실행 중 알림을 응답 뒤로 미룸), 재시작/네트워크 설정 명령어는 실패 처리
+// 출력이 CMD_BATCH_OUTPUT_MAX를 넘으면 남은 명령어는 실행하지 않고 실패 처리 (batch,end는 항상 전송)
+cmd_result_t cmd_batch(const char* list, cmd_sink_t* out) {
+    size_t start = out->written;
+    int count = 0;
+    for (const char* p = list; *p != '\0'; ) {
+        const char* next = strchr(++p, ';');
+        size_t len = next ? (size_t)(next - p) : strlen(p);
+        if (strspn(p, " \t") < len) {
+            count++;
+        }
+        p += len;
+    }
+
+    if (count == 0) {
+        cmd_sink_printf(out, "Error: Use format 'batch;cmd1;cmd2;...'\r\n");
+        return CMD_ERROR_INVALID;
+    }
+    if (count > CMD_BATCH_MAX) {
+        cmd_sink_printf(out, "Error: Too many commands in batch (max %d)\r\n", CMD_BATCH_MAX);
+        return CMD_ERROR_INVALID;
+    }
+
+    cmd_sink_printf(out, "batch,begin,%d\r\n", count);
+    hct595_batch_begin();
+
+    int failed = 0;
+    for (const char* p = list; *p != '\0'; ) {
+        const char* next = strchr(++p, ';');
+        size_t len = next ? (size_t)(next - p) : strlen(p);
+        const char* seg = p;
+        p += len;
+
+        size_t skip = strspn(seg, " \t");
+        if (skip >= len) {
+            continue;
+        }
+        seg += skip;
+        len -= skip;
+
+        char sub[256];
+        size_t before = out->written;
+        if (out->written - start >= CMD_BATCH_OUTPUT_MAX) {
+            cmd_sink_printf(out, "Error: Batch output limit reached");
+            failed++;
+        } else if (len >= sizeof(sub)) {
+            cmd_sink_printf(out, "Error: Command too long");
+            failed++;
+        } else {
+            memcpy(sub, seg, len);
+            sub[len] = '\0';
+            if (strncmp(sub, "batch", 5) == 0 && (sub[5] == ';' || sub[5] == '\0' || sub[5] == ' ')) {
+                cmd_sink_printf(out, "Error: Nested batch not allowed");
+                failed++;
+            } else if (cmd_batch_is_forbidden(sub)) {
+                cmd_sink_printf(out, "Error: %.*s not allowed in batch", (int)strcspn(sub, ", \t"), sub);
+                failed++;
+            } else if (process_command(sub, out) != CMD_SUCCESS) {
+                failed++;
+            }
+        }
+
+        // 응답이 없거나 줄바꿈으로 끝나지 않으면 줄바꿈 추가 (명령어별 응답 구분)
+        if (out->written == before || out->last != '\n') {
+            cmd_sink_puts(out, "\r\n");
+        }
+    }
+
+    cmd_sink_printf(out, "batch,end,%d,%d", count, failed);
+    hct595_batch_commit();
+    return CMD_SUCCESS;
+}
+
 // ID 확인 유틸리티 함수
 bool check_device_id_match(uint8_t target_id) {
     uint8_t my_id = get_gpio_device_id();
@@ -891,49 +1229,39 @@ bool check_device_id_match(uint8_t target_id) {
 }
 
 // Debug status 조회: getdebug,<category> or getdebug,all
-cmd_result_t cmd_get_debug(const char* param, char* response, size_t response_size) {
+cmd_result_t cmd_get_debug(const char* param, cmd_sink_t* out) {
     if (param == NULL || strlen(param) == 0) {
-        snprintf(response, response_size, "Error: Parameter required. Use: getdebug,<category>|all\r\n");
+        cmd_sink_printf(out, "Error: Parameter required. Use: getdebug,<category>|all\r\n");
         return CMD_ERROR_INVALID;
     }
 
     // support 'all'
     if (strcasecmp(param, "all") == 0) {
         const char* names[] = {"MAIN","NET","TCP","HTTP","UART","JSON","GPIO","DHCP","WIZNET"};
-        char buf[256];
-        size_t off = 0;
         for (size_t i = 0; i < sizeof(names)/sizeof(names[0]); ++i) {
             bool enabled = false;
             if (debug_get_by_name(names[i], &enabled)) {
-                int n = snprintf(buf, sizeof(buf), "%s=%s\r\n", names[i], enabled ? "ON" : "OFF");
-                if (off + (size_t)n < response_size) {
-                    memcpy(response + off, buf, n);
-                    off += n;
-                } else {
-                    break;
-                }
+                cmd_sink_printf(out, "%s=%s\r\n", names[i], enabled ? "ON" : "OFF");
             }
         }
-        if (off < response_size) response[off] = '\0';
-        else response[response_size - 1] = '\0';
         return CMD_SUCCESS;
     }
 
     // single category
     bool enabled = false;
     if (debug_get_by_name(param, &enabled)) {
-        snprintf(response, response_size, "%s=%s\r\n", param, enabled ? "ON" : "OFF");
+        cmd_sink_printf(out, "%s=%s\r\n", param, enabled ? "ON" : "OFF");
         return CMD_SUCCESS;
     } else {
-        snprintf(response, response_size, "Error: Unknown debug category '%s'\r\n", param);
+        cmd_sink_printf(out, "Error: Unknown debug category '%s'\r\n", param);
         return CMD_ERROR_INVALID;
     }
 }
 
 // Debug 설정: setdebug,<category>,on|off  또는 setdebug,all,on|off
-cmd_result_t cmd_set_debug(const char* param, char* response, size_t response_size) {
+cmd_result_t cmd_set_debug(const char* param, cmd_sink_t* out) {
     if (param == NULL || strlen(param) == 0) {
-        snprintf(response, response_size, "Error: Parameters required. Use: setdebug,<category|all>,on|off\r\n");
+        cmd_sink_printf(out, "Error: Parameters required. Use: setdebug,<category|all>,on|off\r\n");
         return CMD_ERROR_INVALID;
     }
 
@@ -945,7 +1273,7 @@ cmd_result_t cmd_set_debug(const char* param, char* response, size_t response_si
     char* val = strtok(NULL, ",");
 
     if (cat == NULL || val == NULL) {
-        snprintf(response, response_size, "Error: Use format setdebug,<category|all>,on|off\r\n");
+        cmd_sink_printf(out, "Error: Use format setdebug,<category|all>,on|off\r\n");
         return CMD_ERROR_INVALID;
     }
 
@@ -956,7 +1284,7 @@ cmd_result_t cmd_set_debug(const char* param, char* response, size_t response_si
     if (strcasecmp(val, "on") == 0 || strcmp(val, "1") == 0) enabled = true;
     else if (strcasecmp(val, "off") == 0 || strcmp(val, "0") == 0) enabled = false;
     else {
-        snprintf(response, response_size, "Error: Unknown value '%s'. Use on/off\r\n", val);
+        cmd_sink_printf(out, "Error: Unknown value '%s'. Use on/off\r\n", val);
         return CMD_ERROR_INVALID;
     }
 
@@ -967,7 +1295,7 @@ cmd_result_t cmd_set_debug(const char* param, char* response, size_t response_si
         }
         // Persist runtime debug settings
         debug_save_to_flash();
-        snprintf(response, response_size, "OK: set all -> %s\r\n", enabled ? "ON" : "OFF");
+        cmd_sink_printf(out, "OK: set all -> %s\r\n", enabled ? "ON" : "OFF");
         return CMD_SUCCESS;
     }
 
@@ -975,18 +1303,18 @@ cmd_result_t cmd_set_debug(const char* param, char* response, size_t response_si
     if (debug_set_by_name(cat, enabled)) {
         // Persist change
         debug_save_to_flash();
-        snprintf(response, response_size, "OK: %s -> %s\r\n", cat, enabled ? "ON" : "OFF");
+        cmd_sink_printf(out, "OK: %s -> %s\r\n", cat, enabled ? "ON" : "OFF");
         return CMD_SUCCESS;
     } else {
-        snprintf(response, response_size, "Error: Unknown debug category '%s'\r\n", cat);
+        cmd_sink_printf(out, "Error: Unknown debug category '%s'\r\n", cat);
         return CMD_ERROR_INVALID;
     }
 }
 
 // 브로드캐스트 모드 설정: setbroadcastmode,multicast|broadcast
-cmd_result_t cmd_set_broadcast_mode(const char* param, char* response, size_t response_size) {
+cmd_result_t cmd_set_broadcast_mode(const char* param, cmd_sink_t* out) {
     if (param == NULL || strlen(param) == 0) {
-        snprintf(response, response_size, "Error: Parameter required. Use: setbroadcastmode,multicast|broadcast\r\n");
+        cmd_sink_printf(out, "Error: Parameter required. Use: setbroadcastmode,multicast|broadcast\r\n");
         return CMD_ERROR_INVALID;
     }
 
@@ -996,18 +1324,224 @@ cmd_result_t cmd_set_broadcast_mode(const char* param, char* response, size_t re
     } else if (strcasecmp(param, "broadcast") == 0) {
         mode = BROADCAST_MODE_BROADCAST;
     } else {
-        snprintf(response, response_size, "Error: Invalid mode '%s'. Use: multicast or broadcast\r\n", param);
+        cmd_sink_printf(out, "Error: Invalid mode '%s'. Use: multicast or broadcast\r\n", param);
         return CMD_ERROR_INVALID;
     }
 
     multicast_set_broadcast_mode(mode);
-    snprintf(response, response_size, "broadcast_mode,%s\r\n", mode == BROADCAST_MODE_MULTICAST ? "multicast" : "broadcast");
+    cmd_sink_printf(out, "broadcast_mode,%s\r\n", mode == BROADCAST_MODE_MULTICAST ? "multicast" : "broadcast");
     return CMD_SUCCESS;
 }
 
 // 브로드캐스트 모드 조회: getbroadcastmode
-cmd_result_t cmd_get_broadcast_mode(char* response, size_t response_size) {
+cmd_result_t cmd_get_broadcast_mode(cmd_sink_t* out) {
     broadcast_mode_t mode = multicast_get_broadcast_mode();
-    snprintf(response, response_size, "broadcast_mode,%s\r\n", mode == BROADCAST_MODE_MULTICAST ? "multicast" : "broadcast");
+    cmd_sink_printf(out, "broadcast_mode,%s\r\n", mode == BROADCAST_MODE_MULTICAST ? "multicast" : "broadcast");
+    return CMD_SUCCESS;
+}
+
+// 입력 변화 기록 설정: sethistory,on|off
+cmd_result_t cmd_set_history(const char* param, cmd_sink_t* out) {
+    if (param == NULL || strlen(param) == 0) {
+        cmd_sink_printf(out, "Error: Parameter required. Use: sethistory,on|off\r\n");
+        return CMD_ERROR_INVALID;
+    }
+
+    bool enabled;
+    if (strcasecmp(param, "on") == 0 || strcmp(param, "1") == 0) {
+        enabled = true;
+    } else if (strcasecmp(param, "off") == 0 || strcmp(param, "0") == 0) {
+        enabled = false;
+    } else {
+        cmd_sink_printf(out, "Error: Invalid value '%s'. Use: on or off\r\n", param);
+        return CMD_ERROR_INVALID;
+    }
+
+    if (!gpio_history_set_enabled(enabled)) {
+        cmd_sink_printf(out, "Error: Failed to save history setting\r\n");
+        return CMD_ERROR_EXECUTION;
+    }
+    cmd_sink_printf(out, "history,%s\r\n", enabled ? "on" : "off");
+    return CMD_SUCCESS;
+}
+
+// 입력 변화 기록 조회: gethistory[,n]
+// 응답: history,<on|off>,<링 전체 엣지 수>,<출력 수> 다음 줄부터 hist,<부팅 경과>,<초.ms>,<채널>,<레벨>
+// 부팅 경과 0 = 현재 부팅, 시간은 해당 부팅의 기록 시작 기준
+cmd_result_t cmd_get_history(const char* param, cmd_sink_t* out) {
+    int count = 20;
+    if (param != NULL && strlen(param) > 0) {
+        count = atoi(param);
+        if (count < 1 || count > GPIO_HISTORY_QUERY_MAX) {
+            cmd_sink_printf(out, "Error: Invalid count. Use 1-%d\r\n", GPIO_HISTORY_QUERY_MAX);
+            return CMD_ERROR_INVALID;
+        }
+    }
+
+    gpio_history_event_t events[GPIO_HISTORY_QUERY_MAX];
+    uint32_t total_edges = 0;
+    size_t shown = gpio_history_query(events, (size_t)count, &total_edges);
+
+    cmd_sink_printf(out, "history,%s,%lu,%u\r\n",
+                    gpio_history_is_enabled() ? "on" : "off",
+                    (unsigned long)total_edges, (unsigned)shown);
+    for (size_t i = 0; i < shown; i++) {
+        cmd_sink_printf(out, "hist,%u,%lu.%03lu,%u,%d\r\n",
+                        events[i].boot_age,
+                        (unsigned long)(events[i].time_ms / 1000),
+                        (unsigned long)(events[i].time_ms % 1000),
+                        events[i].channel, events[i].level ? 1 : 0);
+    }
+    return CMD_SUCCESS;
+}
+
+static const char* tx_policy_name(uint8_t policy) {
+    switch (policy) {
+        case TCP_TX_POLICY_DISCONNECT: return "disconnect";
+        case TCP_TX_POLICY_COALESCE:   return "coalesce";
+        default:                       return "drop";
+    }
+}
+
+// 느린 TCP 클라이언트 처리 정책: settxpolicy,drop|disconnect|coalesce
+cmd_result_t cmd_set_tx_policy(const char* param, cmd_sink_t* out) {
+    if (param == NULL || strlen(param) == 0) {
+        cmd_sink_printf(out, "Error: Parameter required. Use: settxpolicy,drop|disconnect|coalesce\r\n");
+        return CMD_ERROR_INVALID;
+    }
+
+    tcp_tx_policy_t policy;
+    if (strcasecmp(param, "drop") == 0) {
+        policy = TCP_TX_POLICY_DROP_OLDEST;
+    } else if (strcasecmp(param, "disconnect") == 0) {
+        policy = TCP_TX_POLICY_DISCONNECT;
+    } else if (strcasecmp(param, "coalesce") == 0) {
+        policy = TCP_TX_POLICY_COALESCE;
+    } else {
+        cmd_sink_printf(out, "Error: Invalid policy '%s'. Use: drop, disconnect or coalesce\r\n", param);
+        return CMD_ERROR_INVALID;
+    }
+
+    system_config_set_tcp_tx_policy((uint8_t)policy);
+    system_config_save_to_flash();
+    cmd_sink_printf(out, "tx_policy,%s\r\n", tx_policy_name(policy));
+    return CMD_SUCCESS;
+}
+
+cmd_result_t cmd_get_tx_policy(cmd_sink_t* out) {
+    cmd_sink_printf(out, "tx_policy,%s\r\n", tx_policy_name(system_config_get_tcp_tx_policy()));
+    return CMD_SUCCESS;
+}
+
+// TCP 클라이언트 송신 큐 통계: gettxstats
+// 응답: txstats,<정책>,<강제 종료 누적> 다음 줄부터 client,<소켓>,<연결>,<대기>,<최대>,<전송 바이트>,<버림>,<합침>
+cmd_result_t cmd_get_tx_stats(cmd_sink_t* out) {
+    cmd_sink_printf(out, "txstats,%s,%lu\r\n",
+                    tx_policy_name(system_config_get_tcp_tx_policy()),
+                    (unsigned long)tcp_servers_get_tx_disconnects());
+    for (uint8_t i = 0; i < TCP_CLIENT_MAX; i++) {
+        tcp_client_stats_t stats;
+        if (!tcp_servers_get_client_stats(i, &stats)) {
+            continue;
+        }
+        cmd_sink_printf(out, "client,%u,%d,%u,%u,%lu,%lu,%lu\r\n",
+                        stats.socket, stats.connected ? 1 : 0,
+                        stats.tx_queued, stats.tx_peak,
+                        (unsigned long)stats.tx_bytes,
+                        (unsigned long)stats.tx_dropped,
+                        (unsigned long)stats.tx_coalesced);
+    }
+    return CMD_SUCCESS;
+}
+
+// TCP 연결 목록: getclients
+// 응답: clients,<연결 수>,<무활동 종료 초>,<무활동 종료 누적> 다음 줄부터
+//       conn,<소켓>,<ip>:<port>,<연결 초>,<무활동 초>,<수신 바이트>,<명령어>,<전송 바이트>,<응답>,<알림>
+cmd_result_t cmd_get_clients(cmd_sink_t* out) {
+    tcp_client_stats_t stats[TCP_CLIENT_MAX];
+    memset(stats, 0, sizeof(stats));
+    int connected = 0;
+    for (uint8_t i = 0; i < TCP_CLIENT_MAX; i++) {
+        if (tcp_servers_get_client_stats(i, &stats[i]) && stats[i].connected) {
+            connected++;
+        }
+    }
+
+    cmd_sink_printf(out, "clients,%d,%u,%lu\r\n", connected,
+                    system_config_get_tcp_idle_timeout(),
+                    (unsigned long)tcp_servers_get_idle_reaped());
+    for (uint8_t i = 0; i < TCP_CLIENT_MAX; i++) {
+        if (!stats[i].connected) {
+            continue;
+        }
+        cmd_sink_printf(out, "conn,%u,%d.%d.%d.%d:%u,%lu,%lu,%lu,%lu,%lu,%lu,%lu\r\n",
+                        stats[i].socket,
+                        stats[i].peer_ip[0], stats[i].peer_ip[1], stats[i].peer_ip[2], stats[i].peer_ip[3],
+                        stats[i].peer_port,
+                        (unsigned long)(stats[i].connected_ms / 1000),
+                        (unsigned long)(stats[i].idle_ms / 1000),
+                        (unsigned long)stats[i].rx_bytes,
+                        (unsigned long)stats[i].commands,
+                        (unsigned long)stats[i].tx_bytes,
+                        (unsigned long)stats[i].responses,
+                        (unsigned long)stats[i].notifications);
+    }
+    return CMD_SUCCESS;
+}
+
+// TCP 무활동 종료 시간 설정: setidletimeout,<초> (0 = 사용 안 함)
+cmd_result_t cmd_set_idle_timeout(const char* param, cmd_sink_t* out) {
+    if (param == NULL || strlen(param) == 0) {
+        cmd_sink_printf(out, "Error: Parameter required. Use: setidletimeout,seconds (0=off)\r\n");
+        return CMD_ERROR_INVALID;
+    }
+
+    char* end = NULL;
+    unsigned long seconds = strtoul(param, &end, 10);
+    if (end == param || *end != '\0' || seconds > TCP_IDLE_TIMEOUT_MAX) {
+        cmd_sink_printf(out, "Error: Invalid timeout. Use 0-%d seconds\r\n", TCP_IDLE_TIMEOUT_MAX);
+        return CMD_ERROR_INVALID;
+    }
+
+    system_config_set_tcp_idle_timeout((uint16_t)seconds);
+    system_config_save_to_flash();
+    cmd_sink_printf(out, "idle_timeout,%lu\r\n", seconds);
     return CMD_SUCCESS;
-}
\ No newline at end of file
+}
+
+// W5500 소켓 배치 조회: getsockets
+// 응답: sockets,<현재 프로파일>,<저장된 프로파일> 다음 줄부터 sock,<번호>,<역할>,<요청 할당>,<상태>,<TX KB>,<RX KB>
+cmd_result_t cmd_get_sockets(cmd_sink_t* out) {
+    uint8_t tx_kb[SOCKET_POOL_SIZE];
+    uint8_t rx_kb[SOCKET_POOL_SIZE];
+    socket_pool_get_buffer_sizes(tx_kb, rx_kb);
+
+    cmd_sink_printf(out, "sockets,%s,%s\r\n",
+                    socket_pool_profile_name(socket_pool_get_profile()),
+                    socket_pool_profile_name(system_config_get_socket_profile()));
+    for (uint8_t sn = 0; sn < SOCKET_POOL_SIZE; sn++) {
+        cmd_sink_printf(out, "sock,%u,%s,%d,0x%02X,%u,%u\r\n", sn,
+                        socket_pool_role_name(socket_pool_get_role(sn)),
+                        socket_pool_is_dynamic(sn) ? 1 : 0,
+                        getSn_SR(sn), tx_kb[sn], rx_kb[sn]);
+    }
+    return CMD_SUCCESS;
+}
+
+// 소켓 버퍼 프로파일 설정: setsocketprofile,balanced|http|clients (재시작 후 적용)
+cmd_result_t cmd_set_socket_profile(const char* param, cmd_sink_t* out) {
+    uint8_t profile;
+    if (param == NULL || !socket_pool_parse_profile(param, &profile)) {
+        cmd_sink_printf(out, "Error: Use: setsocketprofile,balanced|http|clients\r\n");
+        return CMD_ERROR_INVALID;
+    }
+
+    system_config_set_socket_profile(profile);
+    if (!system_config_save_to_flash()) {
+        cmd_sink_printf(out, "Error: Failed to save socket profile\r\n");
+        return CMD_ERROR_EXECUTION;
+    }
+    cmd_sink_printf(out, "socket_profile,%s,%s\r\n", socket_pool_profile_name(profile),
+                    profile == socket_pool_get_profile() ? "active" : "restart required");
+    return CMD_SUCCESS;
+}
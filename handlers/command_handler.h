@@ -4,6 +4,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include "response_sink.h"
 
 // 명령어 처리 결과
 typedef enum
@@ -25,64 +26,92 @@ typedef struct
     uint8_t etx;       // 0x03
 } gpio_protocol_t;
 
-// 명령어 처리 함수
-cmd_result_t process_command(const char *command, char *response, size_t response_size);
+#define CMD_BATCH_MAX 32   // batch 명령어 하나에 포함 가능한 최대 하위 명령어 수
+#define CMD_BATCH_OUTPUT_MAX 1536  // 이 이상 출력하면 남은 하위 명령어 생략 (+ 최대 하위 응답 gethistory가 TCP_TX_RESPONSE_RESERVE 안에 들어감)
+
+// 명령어 처리 함수 (응답은 out sink로 바로 출력)
+cmd_result_t process_command(const char *command, cmd_sink_t *out);
+
+// 배치 명령어 (batch;cmd1;cmd2;...)
+cmd_result_t cmd_batch(const char *list, cmd_sink_t *out);
 
 // 기존 명령어들
-cmd_result_t cmd_get_ip(char *response, size_t response_size);
+cmd_result_t cmd_get_ip(cmd_sink_t *out);
 
 // GPIO 단일 채널 명령어들
-cmd_result_t cmd_get_input(const char *param, char *response, size_t response_size);
-cmd_result_t cmd_set_output(const char *param, char *response, size_t response_size);
-cmd_result_t cmd_get_output(const char *param, char *response, size_t response_size);
+cmd_result_t cmd_get_input(const char *param, cmd_sink_t *out);
+cmd_result_t cmd_set_output(const char *param, cmd_sink_t *out);
+cmd_result_t cmd_get_output(const char *param, cmd_sink_t *out);
 
 // GPIO 전체 채널 명령어들
-cmd_result_t cmd_get_inputs(const char *param, char *response, size_t response_size);
-cmd_result_t cmd_get_input_channel(const char *param, char *response, size_t response_size);
-cmd_result_t cmd_set_outputs(const char *param, char *response, size_t response_size);
-cmd_result_t cmd_get_outputs(const char *param, char *response, size_t response_size);
+cmd_result_t cmd_get_inputs(const char *param, cmd_sink_t *out);
+cmd_result_t cmd_get_input_channel(const char *param, cmd_sink_t *out);
+cmd_result_t cmd_set_outputs(const char *param, cmd_sink_t *out);
+cmd_result_t cmd_get_outputs(const char *param, cmd_sink_t *out);
+
+// GPIO 출력 파형 (PWM/블링크) 명령어들
+cmd_result_t cmd_set_wave(const char *param, cmd_sink_t *out);
+cmd_result_t cmd_stop_wave(const char *param, cmd_sink_t *out);
+cmd_result_t cmd_get_wave(const char *param, cmd_sink_t *out);
 
 // 새로운 네트워크 설정 명령어들
-cmd_result_t cmd_set_ip(const char *param, char *response, size_t response_size);
-cmd_result_t cmd_set_subnet(const char *param, char *response, size_t response_size);
-cmd_result_t cmd_set_gateway(const char *param, char *response, size_t response_size);
-cmd_result_t cmd_set_network(const char *param, char *response, size_t response_size);
-cmd_result_t cmd_set_tcp_port(const char *param, char *response, size_t response_size);
-cmd_result_t cmd_set_dhcp(const char *param, char *response, size_t response_size);
+cmd_result_t cmd_set_ip(const char *param, cmd_sink_t *out);
+cmd_result_t cmd_set_subnet(const char *param, cmd_sink_t *out);
+cmd_result_t cmd_set_gateway(const char *param, cmd_sink_t *out);
+cmd_result_t cmd_set_network(const char *param, cmd_sink_t *out);
+cmd_result_t cmd_set_tcp_port(const char *param, cmd_sink_t *out);
+cmd_result_t cmd_set_dhcp(const char *param, cmd_sink_t *out);
 
 // UART 설정 명령어들
-cmd_result_t cmd_set_uart_baud(const char *param, char *response, size_t response_size);
-cmd_result_t cmd_get_uart_config(char *response, size_t response_size);
+cmd_result_t cmd_set_uart_baud(const char *param, cmd_sink_t *out);
+cmd_result_t cmd_get_uart_config(cmd_sink_t *out);
 
 // GPIO 디바이스 설정 명령어들
-cmd_result_t cmd_set_gpio_id(const char *param, char *response, size_t response_size);
-cmd_result_t cmd_get_gpio_id(char *response, size_t response_size);
-cmd_result_t cmd_set_gpio_mode(const char *param, char *response, size_t response_size);
-cmd_result_t cmd_get_gpio_mode(char *response, size_t response_size);
-cmd_result_t cmd_get_gpio_config(char *response, size_t response_size);
-cmd_result_t cmd_set_rt_mode(const char *param, char *response, size_t response_size);
-cmd_result_t cmd_get_rt_mode(char *response, size_t response_size);
-cmd_result_t cmd_set_trigger_mode(const char *param, char *response, size_t response_size);
-cmd_result_t cmd_get_trigger_mode(char *response, size_t response_size);
+cmd_result_t cmd_set_gpio_id(const char *param, cmd_sink_t *out);
+cmd_result_t cmd_get_gpio_id(cmd_sink_t *out);
+cmd_result_t cmd_set_gpio_mode(const char *param, cmd_sink_t *out);
+cmd_result_t cmd_get_gpio_mode(cmd_sink_t *out);
+cmd_result_t cmd_get_gpio_config(cmd_sink_t *out);
+cmd_result_t cmd_set_rt_mode(const char *param, cmd_sink_t *out);
+cmd_result_t cmd_get_rt_mode(cmd_sink_t *out);
+cmd_result_t cmd_set_trigger_mode(const char *param, cmd_sink_t *out);
+cmd_result_t cmd_get_trigger_mode(cmd_sink_t *out);
 
 // ID 확인 유틸리티 함수
 bool check_device_id_match(uint8_t target_id);
 
 // 도움말 명령어
-cmd_result_t cmd_help(char *response, size_t response_size);
-cmd_result_t cmd_set_auto_response(const char *param, char *response, size_t response_size);
-cmd_result_t cmd_get_auto_response(char *response, size_t response_size);
-cmd_result_t cmd_factory_reset(char *response, size_t response_size);
-cmd_result_t cmd_restart(char *response, size_t response_size);
+cmd_result_t cmd_help(cmd_sink_t *out);
+cmd_result_t cmd_set_auto_response(const char *param, cmd_sink_t *out);
+cmd_result_t cmd_get_auto_response(cmd_sink_t *out);
+cmd_result_t cmd_factory_reset(cmd_sink_t *out);
+cmd_result_t cmd_restart(cmd_sink_t *out);
 
 // GPIO 프로토콜 처리 함수들
 bool parse_gpio_protocol(const char *input, gpio_protocol_t *protocol);
 bool check_device_id(uint8_t target_id);
-cmd_result_t process_gpio_protocol(const gpio_protocol_t *protocol, char *response, size_t response_size);
+cmd_result_t process_gpio_protocol(const gpio_protocol_t *protocol, cmd_sink_t *out);
+
+cmd_result_t cmd_get_debug(const char *param, cmd_sink_t *out);
+cmd_result_t cmd_set_debug(const char *param, cmd_sink_t *out);
+cmd_result_t cmd_set_broadcast_mode(const char *param, cmd_sink_t *out);
+cmd_result_t cmd_get_broadcast_mode(cmd_sink_t *out);
+
+// 입력 변화 기록 명령어들
+cmd_result_t cmd_set_history(const char *param, cmd_sink_t *out);
+cmd_result_t cmd_get_history(const char *param, cmd_sink_t *out);
+
+// TCP 송신 큐 명령어들
+cmd_result_t cmd_set_tx_policy(const char *param, cmd_sink_t *out);
+cmd_result_t cmd_get_tx_policy(cmd_sink_t *out);
+cmd_result_t cmd_get_tx_stats(cmd_sink_t *out);
+
+// TCP 연결 관리 명령어들
+cmd_result_t cmd_get_clients(cmd_sink_t *out);
+cmd_result_t cmd_set_idle_timeout(const char *param, cmd_sink_t *out);
 
-cmd_result_t cmd_get_debug(const char *param, char *response, size_t response_size);
-cmd_result_t cmd_set_debug(const char *param, char *response, size_t response_size);
-cmd_result_t cmd_set_broadcast_mode(const char *param, char *response, size_t response_size);
-cmd_result_t cmd_get_broadcast_mode(char *response, size_t response_size);
+// W5500 소켓 풀 명령어들
+cmd_result_t cmd_get_sockets(cmd_sink_t *out);
+cmd_result_t cmd_set_socket_profile(const char *param, cmd_sink_t *out);
 
 #endif // COMMAND_HANDLER_H
\ No newline at end of file
@@ -0,0 +1,13 @@
+#include "event_notify.h"
+#include "http/http_server.h"
+
+bool event_has_subscribers(uint8_t event, uint16_t channel_mask) {
+    return tcp_servers_has_subscribers(event, channel_mask) || http_events_has_subscribers(event);
+}
+
+void event_notify(uint8_t event, uint16_t channel_mask, const uint8_t *data, uint16_t len) {
+    if (data != NULL && len > 0) {
+        tcp_servers_notify(event, channel_mask, data, len);
+    }
+    http_events_notify(event);
+}
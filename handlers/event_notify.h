@@ -0,0 +1,18 @@
+#ifndef EVENT_NOTIFY_H
+#define EVENT_NOTIFY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "tcp/tcp_server.h"
+
+// 비동기 이벤트 (입력/출력 변화, 링크 상태, TCP_EVENT_* 비트) 전달
+// TCP 명령어 연결(subscribe)에는 프로토콜 한 줄을, HTTP 이벤트 스트림(/api/events)에는 변화 표시만 전달
+// 이벤트 스트림은 전송 시점의 현재 상태를 보내므로 느린 연결의 변화는 하나로 합쳐짐
+
+// 해당 이벤트를 받을 연결이 있는지 (없으면 메시지 생성 생략 가능)
+bool event_has_subscribers(uint8_t event, uint16_t channel_mask);
+
+// 이벤트 전달 (data가 NULL이면 TCP 알림 없이 상태 변화만 전달)
+void event_notify(uint8_t event, uint16_t channel_mask, const uint8_t *data, uint16_t len);
+
+#endif // EVENT_NOTIFY_H
@@ -0,0 +1,65 @@
+#include "response_sink.h"
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+
+static size_t cmd_sink_buffer_write(cmd_sink_t *sink, const char *data, size_t len) {
+    if (sink->size == 0) {
+        return 0;
+    }
+    size_t room = sink->size - 1 - sink->len;
+    if (len > room) {
+        len = room;
+    }
+    memcpy(sink->buf + sink->len, data, len);
+    sink->len += len;
+    sink->buf[sink->len] = '\0';
+    return len;
+}
+
+void cmd_sink_init(cmd_sink_t *sink, cmd_sink_write_fn write, void *ctx) {
+    memset(sink, 0, sizeof(*sink));
+    sink->write = write;
+    sink->ctx = ctx;
+}
+
+void cmd_sink_init_buffer(cmd_sink_t *sink, char *buf, size_t size) {
+    cmd_sink_init(sink, cmd_sink_buffer_write, NULL);
+    sink->buf = buf;
+    sink->size = size;
+    if (size > 0) {
+        buf[0] = '\0';
+    }
+}
+
+size_t cmd_sink_write(cmd_sink_t *sink, const char *data, size_t len) {
+    if (sink == NULL || sink->write == NULL || len == 0) {
+        return 0;
+    }
+    size_t n = sink->write(sink, data, len);
+    if (n > 0) {
+        sink->written += n;
+        sink->last = data[n - 1];
+    }
+    return n;
+}
+
+size_t cmd_sink_puts(cmd_sink_t *sink, const char *str) {
+    return cmd_sink_write(sink, str, strlen(str));
+}
+
+size_t cmd_sink_printf(cmd_sink_t *sink, const char *fmt, ...) {
+    char tmp[CMD_SINK_PRINTF_MAX];
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(tmp, sizeof(tmp), fmt, args);
+    va_end(args);
+
+    if (n <= 0) {
+        return 0;
+    }
+    if ((size_t)n >= sizeof(tmp)) {
+        n = sizeof(tmp) - 1;
+    }
+    return cmd_sink_write(sink, tmp, (size_t)n);
+}
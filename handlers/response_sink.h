@@ -0,0 +1,37 @@
+#ifndef RESPONSE_SINK_H
+#define RESPONSE_SINK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// 명령어 응답 출력 대상 (전송 경로별로 write 함수를 지정)
+// 핸들러는 응답을 조각 단위로 바로 써 넣으므로 경로마다 큰 응답 버퍼가 필요 없음
+#define CMD_SINK_PRINTF_MAX     320     // cmd_sink_printf 1회 최대 길이
+
+typedef struct cmd_sink cmd_sink_t;
+
+// 실제 출력 함수: 기록한 바이트 수 반환 (공간 부족 시 일부만 기록 가능)
+typedef size_t (*cmd_sink_write_fn)(cmd_sink_t *sink, const char *data, size_t len);
+
+struct cmd_sink {
+    cmd_sink_write_fn write;
+    void *ctx;              // 전송 경로별 상태 (TCP 클라이언트 등)
+    char *buf;              // 버퍼 sink 전용
+    size_t size;
+    size_t len;
+    size_t written;         // 지금까지 출력한 총 바이트
+    char last;              // 마지막으로 출력한 문자 (줄바꿈 보정용)
+};
+
+// 전송 경로 sink 초기화
+void cmd_sink_init(cmd_sink_t *sink, cmd_sink_write_fn write, void *ctx);
+
+// 고정 버퍼 sink 초기화 (넘치는 부분은 잘림, 항상 NUL 종료)
+void cmd_sink_init_buffer(cmd_sink_t *sink, char *buf, size_t size);
+
+size_t cmd_sink_write(cmd_sink_t *sink, const char *data, size_t len);
+size_t cmd_sink_puts(cmd_sink_t *sink, const char *str);
+size_t cmd_sink_printf(cmd_sink_t *sink, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+
+#endif // RESPONSE_SINK_H
@@ -1,228 +1,218 @@
 #include "http_handlers.h"
 #include "system/system_config.h"
 #include "gpio/gpio.h"
+#include "gpio/gpio_history.h"
+#include "gpio/gpio_wave.h"
+#include "http/http_router.h"
+#include "http/http_status.h"
 #include "debug/debug.h"
 // 기본 핸들러 구현
 void http_handler_network_info(const http_request_t *request, http_response_t *response)
 {
     http_init_response(response);
     
-    cJSON *network = cJSON_CreateObject();
-    
-    // MAC 주소와 IP 정보를 각각 처리
-    char mac_str[18], ip_str[16], subnet_str[16], gateway_str[16], dns_str[16];
-    
-    snprintf(mac_str, sizeof(mac_str), "%02X:%02X:%02X:%02X:%02X:%02X",
-    g_net_info.mac[0], g_net_info.mac[1], g_net_info.mac[2],
-    g_net_info.mac[3], g_net_info.mac[4], g_net_info.mac[5]);
-    snprintf(ip_str, sizeof(ip_str), "%d.%d.%d.%d",
-    g_net_info.ip[0], g_net_info.ip[1], g_net_info.ip[2], g_net_info.ip[3]);
-    snprintf(subnet_str, sizeof(subnet_str), "%d.%d.%d.%d",
-    g_net_info.sn[0], g_net_info.sn[1], g_net_info.sn[2], g_net_info.sn[3]);
-    snprintf(gateway_str, sizeof(gateway_str), "%d.%d.%d.%d",
-    g_net_info.gw[0], g_net_info.gw[1], g_net_info.gw[2], g_net_info.gw[3]);
-    snprintf(dns_str, sizeof(dns_str), "%d.%d.%d.%d",
-        g_net_info.dns[0], g_net_info.dns[1], g_net_info.dns[2], g_net_info.dns[3]);
-        
-        cJSON_AddStringToObject(network, "mac", mac_str);
-        cJSON_AddStringToObject(network, "ip", ip_str);
-        cJSON_AddStringToObject(network, "subnet", subnet_str);
-        cJSON_AddStringToObject(network, "gateway", gateway_str);
-        cJSON_AddStringToObject(network, "dns", dns_str);
-        cJSON_AddBoolToObject(network, "dhcp_enabled", g_net_info.dhcp == NETINFO_DHCP);
-        
-        cJSON *root = cJSON_CreateObject();
-        cJSON_AddItemToObject(root, "network", network);
-        cJSON_AddStringToObject(root, "status", "success");
-        
-        http_send_json_object(response, root);
-        
-        cJSON_Delete(root);
-    }
-    
-    // 정적 파일 핸들러 구현 (스트리밍 방식)
-    void http_handler_static_file(const http_request_t *request, http_response_t *response)
-    {
-        size_t file_size = 0;
-        size_t original_size = 0;
-        bool is_compressed = false;
-        const char* stored_content_type = NULL;
-        const char* file_data = get_embedded_file_with_content_type(request->uri, &file_size, &is_compressed, &original_size, &stored_content_type);
-        
-    DBG_HTTP_PRINT("Static file request: %s\n", request->uri);
-        
-        // 응답 구조체 초기화
-        http_init_response(response);
-        
-        if (!file_data || file_size == 0) {
-                DBG_HTTP_PRINT("File not found: %s\n", request->uri);
-            response->status = HTTP_NOT_FOUND;
-            strcpy(response->content_type, "text/plain");
-            response->content_length = 0;
-            return;
+    http_json_t ctx;
+    json_writer_t *json = http_json_begin(response, &ctx);
+    json_writer_begin_object(json, "network");
+    http_status_write_network(json);
+    json_writer_end_object(json);
+    json_writer_string(json, "status", "success");
+    http_json_end(response, &ctx);
+}
+
+// If-None-Match에 ETag가 있는지 ("*", 쉼표로 구분된 목록, 약한 비교 W/ 허용)
+static bool http_etag_matches(const char *if_none_match, const char *etag)
+{
+    size_t etag_len = strlen(etag);
+    const char *p = if_none_match;
+
+    while (*p) {
+        while (*p == ' ' || *p == '\t' || *p == ',') p++;
+        if (*p == '*') {
+            return true;
         }
-        
-     DBG_HTTP_PRINT("File found: %s, size: %zu, original: %zu, compressed: %s, stored_type: %s\n",
-         request->uri, file_size, original_size, is_compressed ? "yes" : "no", stored_content_type ? stored_content_type : "(null)");
-        
-        response->status = HTTP_OK;
-        
-        // Content-Type 설정
-        if (stored_content_type && strlen(stored_content_type) > 0) {
-            strcpy(response->content_type, stored_content_type);
-        } else {
-            strcpy(response->content_type, get_content_type(request->uri));
+        if (strncmp(p, "W/", 2) == 0) {
+            p += 2;
         }
-        
-        // 파일이 작으면 일반 응답으로 처리
-        if (file_size <= MAX_CONTENT_SIZE - 1024) {  // 헤더 공간 확보
-            memcpy(response->content, file_data, file_size);
-            response->content_length = file_size; // 실제 압축된 크기 사용
-            response->stream_required = false;
-            
-            if (is_compressed) {
-                // 압축된 파일인 경우 Content-Encoding 헤더 추가
-                char content_type_with_encoding[128];
-                snprintf(content_type_with_encoding, sizeof(content_type_with_encoding), 
-                "%s|gzip", response->content_type);
-                strcpy(response->content_type, content_type_with_encoding);
-                DBG_HTTP_PRINT("Inline response will include Content-Encoding: gzip for %s\n", request->uri);
-            }
-            
-            // printf("Sending file inline: %s, content_length: %d\n", request->uri, response->content_length);
-        } else {
-            // 큰 파일은 스트리밍으로 처리
-            // printf("File requires streaming: %s, size: %zu (exceeds %d)\n", request->uri, file_size, MAX_CONTENT_SIZE - 1024);
-            response->status = HTTP_OK;
-            response->stream_required = true;
-            response->stream_data = file_data;
-            response->stream_size = file_size;
-            response->stream_compressed = is_compressed;
-            
-            // Content-Type 설정
-            if (stored_content_type && strlen(stored_content_type) > 0) {
-                strcpy(response->content_type, stored_content_type);
-            } else {
-                strcpy(response->content_type, get_content_type(request->uri));
-            }
-            
-            response->content_length = 0; // 스트리밍의 경우 content는 비움
-         DBG_HTTP_PRINT("Stream setup: uri=%s, type=%s, compressed=%s, stream_size=%zu\n",
-         request->uri, response->content_type, is_compressed ? "yes" : "no", response->stream_size);
+        const char *end = strchr(p, ',');
+        size_t len = end ? (size_t)(end - p) : strlen(p);
+        while (len > 0 && (p[len - 1] == ' ' || p[len - 1] == '\t')) len--;
+        if (len == etag_len && strncmp(p, etag, len) == 0) {
+            return true;
         }
+        p += len;
+        while (*p && *p != ',') p++;
     }
-    
-void http_handler_network_setup(const http_request_t *request, http_response_t *response)
+    return false;
+}
+
+// Accept-Encoding으로 허용된 변형 중 가장 작은 것 (br > gzip > identity)
+// 압축하지 않은 변형은 항상 임베드되어 있으므로 압축을 모르는 클라이언트도 올바른 본문을 받음
+static embedded_encoding_t http_select_encoding(const embedded_file_t *file, uint8_t accept_encoding)
 {
+    if ((accept_encoding & HTTP_ENCODING_BR) && file->variants[EMBEDDED_ENCODING_BR].data) {
+        return EMBEDDED_ENCODING_BR;
+    }
+    if ((accept_encoding & HTTP_ENCODING_GZIP) && file->variants[EMBEDDED_ENCODING_GZIP].data) {
+        return EMBEDDED_ENCODING_GZIP;
+    }
+    return EMBEDDED_ENCODING_IDENTITY;
+}
+
+// 정적 파일 핸들러 구현 (스트리밍 방식)
+// Accept-Encoding으로 전송할 변형을 고르고, 변형별 ETag로 캐시 검증 (같으면 본문 없이 304 응답)
+// 미리 만든 헤더의 Keep-Alive timeout이 서버 설정과 다르면 빌드 오류
+#if EMBEDDED_KEEP_ALIVE_TIMEOUT_S != HTTP_KEEP_ALIVE_TIMEOUT_S
+#error "static_files.c keep-alive timeout differs from HTTP_KEEP_ALIVE_TIMEOUT_S (convert_spa_files.py --keep-alive-timeout)"
+#endif
+void http_handler_static_file(const http_request_t *request, http_response_t *response)
+{
+    const embedded_file_t *file = find_embedded_file(request->uri);
+    
+    DBG_HTTP_PRINT("Static file request: %s\n", request->uri);
+    
+    // 응답 구조체 초기화
     http_init_response(response);
-    cJSON *json = cJSON_Parse(request->content);
-    if (!json) {
-        const char *error_ptr = cJSON_GetErrorPtr();
-        http_send_error_response(response, HTTP_BAD_REQUEST, 
-            error_ptr ? error_ptr : "Invalid JSON");
+    
+    if (!file) {
+        DBG_HTTP_PRINT("File not found: %s\n", request->uri);
+        response->status = HTTP_NOT_FOUND;
+        strcpy(response->content_type, "text/plain");
+        response->content_length = 0;
         return;
     }
     
-    cJSON *ip = cJSON_GetObjectItem(json, "ip");
-    cJSON *subnet = cJSON_GetObjectItem(json, "subnet");
-    cJSON *gateway = cJSON_GetObjectItem(json, "gateway");
-    cJSON *dns = cJSON_GetObjectItem(json, "dns");
-    cJSON *dhcp = cJSON_GetObjectItem(json, "dhcp_enabled");
+    embedded_encoding_t encoding = http_select_encoding(file, request->accept_encoding);
+    const embedded_variant_t *variant = &file->variants[encoding];
     
-    bool dhcp_enabled = dhcp && cJSON_IsBool(dhcp) && cJSON_IsTrue(dhcp);
+    DBG_HTTP_PRINT("File found: %s, size: %zu, original: %zu, encoding: %s, stored_type: %s\n",
+        request->uri, variant->size, file->original_size, embedded_encoding_name(encoding), file->content_type);
     
-    // 네트워크 설정 변경 (API 호출 시 무조건 재시작)
-    bool network_changed = true;  // API 접근 시 항상 재시작
+    // 헤더(캐시 정책, ETag, Content-Encoding 포함)는 빌드 시 만들어 둔 블록을 그대로 전송
+    response->static_headers = variant->headers;
+    
+    if (variant->etag && http_etag_matches(request->if_none_match, variant->etag)) {
+        DBG_HTTP_PRINT("Not modified: %s (%s)\n", request->uri, variant->etag);
+        response->status = HTTP_NOT_MODIFIED;
+        return;
+    }
+    
+    // 본문은 크기와 관계없이 플래시에서 바로 스트리밍 (응답 버퍼로 복사하지 않음)
+    response->status = HTTP_OK;
+    response->stream_required = true;
+    response->stream_data = (const char *)variant->data;
+    response->stream_size = variant->size;
+}
+
+// 본문 JSON을 스키마대로 바인딩 (문법 오류면 400 응답 후 false)
+static bool http_bind_json(const http_request_t *request, http_response_t *response,
+                           const json_field_t *fields, uint8_t field_count, uint32_t *bound, uint32_t *invalid)
+{
+    json_reader_result_t result = json_reader_bind(request->content, request->content_length,
+                                                   fields, field_count, bound, invalid);
+    if (result != JSON_READER_OK) {
+        DBG_HTTP_PRINT("JSON body rejected (%d)\n", result);
+        http_send_error_response(response, HTTP_BAD_REQUEST,
+            result == JSON_READER_NOT_OBJECT ? "JSON object expected" : "Invalid JSON");
+        return false;
+    }
+    return true;
+}
+
+void http_handler_network_setup(const http_request_t *request, http_response_t *response)
+{
+    http_init_response(response);
+    
+    bool dhcp_enabled = false;
+    uint8_t addrs[NETWORK_FIELD_COUNT][4];
+    const json_field_t fields[] = {
+        { "dhcp_enabled", JSON_FIELD_BOOL, &dhcp_enabled },
+        { "ip",           JSON_FIELD_IPV4, addrs[0] },
+        { "subnet",       JSON_FIELD_IPV4, addrs[1] },
+        { "gateway",      JSON_FIELD_IPV4, addrs[2] },
+        { "dns",          JSON_FIELD_IPV4, addrs[3] },
+    };
+    uint32_t bound, invalid;
+    if (!http_bind_json(request, response, fields, sizeof(fields) / sizeof(fields[0]), &bound, &invalid)) {
+        return;
+    }
+
+    // 형식이 잘못된 주소가 하나라도 있으면 아무것도 저장하지 않음 (IP는 1-239.x.x.x)
+    if (invalid != 0 || ((bound & (1u << 1)) && (addrs[0][0] == 0 || addrs[0][0] >= 240))) {
+        http_send_error_response(response, HTTP_BAD_REQUEST, "Invalid address");
+        return;
+    }
     
     if (dhcp_enabled) {
         g_net_info.dhcp = NETINFO_DHCP;  // DHCP 플래그 명시적 설정
     } else {
         g_net_info.dhcp = NETINFO_STATIC;  // Static 플래그 명시적 설정
-        const char *fields[] = NETWORK_FIELDS;
         uint8_t *targets[] = {g_net_info.ip, g_net_info.sn, g_net_info.gw, g_net_info.dns};
-        cJSON *objs[] = {ip, subnet, gateway, dns};
-        // IP 주소 값 설정 (유효성 검사와 함께)
+        // 전달된 주소만 설정 (빠진 필드는 기존 값 유지)
         for (int i = 0; i < NETWORK_FIELD_COUNT; ++i) {
-            if (objs[i] && cJSON_IsString(objs[i])) {
-                uint8_t new_addr[4];
-                int parsed = PARSE_IP_ADDRESS(objs[i]->valuestring, new_addr);
-                if (parsed != 4) {
-                    // printf("Invalid IP format for %s: %s\n", fields[i], objs[i]->valuestring);
-                    continue;
-                }
-                if (i == 0 && (new_addr[0] == 0 || new_addr[0] >= 240)) {  // IP 주소
-                    // printf("Invalid IP address: %d.%d.%d.%d\n", new_addr[0], new_addr[1], new_addr[2], new_addr[3]);
-                    continue;
-                }
-                memcpy(targets[i], new_addr, 4);
+            if (bound & (1u << (i + 1))) {
+                memcpy(targets[i], addrs[i], 4);
             }
         }
     }
     // 플래시 메모리에 저장
     network_config_save_to_flash(&g_net_info);
-    // 리부팅 플래그
-    system_restart_request();
+    // 재부팅 없이 적용 (응답 전송 후)
+    network_apply_request(NETWORK_APPLY_ADDRESS);
     // 단순화된 응답: {"result":true}
-    cJSON *result = cJSON_CreateObject();
-    cJSON_AddBoolToObject(result, "result", true);
-    http_send_json_object(response, result);
-    cJSON_Delete(result);
-    cJSON_Delete(json);
-}void http_handler_control_info(const http_request_t *request, http_response_t *response)
+    http_send_result_response(response);
+}
+
+void http_handler_control_info(const http_request_t *request, http_response_t *response)
 {
     http_init_response(response);
     extern uint16_t tcp_port;
     extern uint32_t uart_rs232_1_baud;
     
-    cJSON *root = cJSON_CreateObject();
-    cJSON_AddNumberToObject(root, "tcp_port", tcp_port);
-    cJSON_AddNumberToObject(root, "rs232_1_baud", uart_rs232_1_baud);
-    cJSON_AddBoolToObject(root, "auto_response", get_gpio_auto_response());
-    cJSON_AddNumberToObject(root, "device_id", get_gpio_device_id());
-    
-    http_send_json_object(response, root);
-    
-    cJSON_Delete(root);
+    http_json_t ctx;
+    json_writer_t *json = http_json_begin(response, &ctx);
+    json_writer_uint(json, "tcp_port", tcp_port);
+    json_writer_uint(json, "rs232_1_baud", uart_rs232_1_baud);
+    json_writer_bool(json, "auto_response", get_gpio_auto_response());
+    json_writer_uint(json, "device_id", get_gpio_device_id());
+    http_json_end(response, &ctx);
 }
 
 // 빌드 에러 방지용 더미 핸들러 구현
 void http_handler_control_setup(const http_request_t *request, http_response_t *response) {
     http_init_response(response);
-    cJSON *json = cJSON_Parse(request->content);
-    if (!json) {
-        http_send_error_response(response, HTTP_BAD_REQUEST, "Invalid JSON");
-        return;
-    }
 
     extern uint16_t tcp_port;
     extern uint32_t uart_rs232_1_baud;
 
-    cJSON *tcp_port_item = cJSON_GetObjectItem(json, "tcp_port");
-    cJSON *rs232_1_baud_item = cJSON_GetObjectItem(json, "rs232_1_baud");
-
-    bool valid = true;
-    if (tcp_port_item && cJSON_IsNumber(tcp_port_item)) {
-        tcp_port = (uint16_t)tcp_port_item->valueint;
-        save_tcp_port_to_flash(tcp_port);
-    } else {
-        valid = false;
-    }
-    if (rs232_1_baud_item && cJSON_IsNumber(rs232_1_baud_item)) {
-        uart_rs232_1_baud = (uint32_t)rs232_1_baud_item->valuedouble;
-    } else {
-        valid = false;
+    uint32_t new_port = 0;
+    uint32_t new_baud = 0;
+    const json_field_t fields[] = {
+        { "tcp_port",     JSON_FIELD_UINT, &new_port },
+        { "rs232_1_baud", JSON_FIELD_UINT, &new_baud },
+    };
+    uint32_t bound, invalid;
+    if (!http_bind_json(request, response, fields, sizeof(fields) / sizeof(fields[0]), &bound, &invalid)) {
+        return;
     }
-    if (valid) {
-        save_uart_rs232_baud_to_flash();
-        system_restart_request();
-        cJSON *result = cJSON_CreateObject();
-        cJSON_AddBoolToObject(result, "result", true);
-        http_send_json_object(response, result);
-        cJSON_Delete(result);
-    } else {
+
+    // 두 필드 모두 필요 (포트는 1-65535, 보드레이트는 setuartbaud와 같은 9600-115200)
+    if (bound != 0x3 || invalid != 0 || new_port == 0 || new_port > UINT16_MAX ||
+        new_baud < 9600 || new_baud > 115200) {
         http_send_error_response(response, HTTP_BAD_REQUEST, "Missing or invalid fields");
+        return;
+    }
+
+    if ((uint16_t)new_port != tcp_port) {
+        tcp_port = (uint16_t)new_port;
+        network_apply_request(NETWORK_APPLY_TCP_PORT);
     }
-    cJSON_Delete(json);
+    save_tcp_port_to_flash(tcp_port);
+
+    uart_rs232_1_baud = new_baud;
+    save_uart_rs232_baud_to_flash();
+    uart_rs232_set_baud(RS232_PORT_1, uart_rs232_1_baud);
+    http_send_result_response(response);
 }
 
 // GPIO 설정 정보 조회 API
@@ -234,38 +224,41 @@ void http_handler_gpio_config_info(const http_request_t *request, http_response_
     bool auto_resp = get_gpio_auto_response();
     gpio_rt_mode_t rt_mode = get_gpio_rt_mode();
     
-    cJSON *root = cJSON_CreateObject();
-    cJSON_AddNumberToObject(root, "device_id", device_id);
-    cJSON_AddStringToObject(root, "comm_mode", rt_mode == GPIO_RT_MODE_CHANNEL ? "text" : "json");
-    cJSON_AddStringToObject(root, "rt_mode", rt_mode == GPIO_RT_MODE_CHANNEL ? "channel" : "bytes");
-    cJSON_AddStringToObject(root, "trigger_mode", get_gpio_trigger_mode() == GPIO_MODE_TRIGGER ? "trigger" : "toggle");
-    cJSON_AddBoolToObject(root, "auto_response", auto_resp);
-
-    http_send_json_object(response, root);
-    
-    cJSON_Delete(root);
+    http_json_t ctx;
+    json_writer_t *json = http_json_begin(response, &ctx);
+    json_writer_uint(json, "device_id", device_id);
+    json_writer_string(json, "comm_mode", rt_mode == GPIO_RT_MODE_CHANNEL ? "text" : "json");
+    json_writer_string(json, "rt_mode", rt_mode == GPIO_RT_MODE_CHANNEL ? "channel" : "bytes");
+    json_writer_string(json, "trigger_mode", get_gpio_trigger_mode() == GPIO_MODE_TRIGGER ? "trigger" : "toggle");
+    json_writer_bool(json, "auto_response", auto_resp);
+    http_json_end(response, &ctx);
 }
 
 // GPIO 설정 변경 API
 void http_handler_gpio_config_setup(const http_request_t *request, http_response_t *response) {
     http_init_response(response);
-    cJSON *json = cJSON_Parse(request->content);
-    if (!json) {
-        http_send_error_response(response, HTTP_BAD_REQUEST, "Invalid JSON");
-        return;
-    }
 
-    DBG_HTTP_PRINT("JSON parsed successfully\n");
     DBG_HTTP_PRINT("Raw JSON: %s\n", request->content);
 
-    cJSON *device_id_item = cJSON_GetObjectItem(json, "device_id");
-    cJSON *comm_mode_item = cJSON_GetObjectItem(json, "comm_mode");
-    cJSON *rt_mode_item = cJSON_GetObjectItem(json, "rt_mode");
-    cJSON *trigger_mode_item = cJSON_GetObjectItem(json, "trigger_mode");
-    cJSON *auto_response_item = cJSON_GetObjectItem(json, "auto_response");
+    uint32_t new_id = 0;
+    char comm_mode_str[8];
+    char rt_mode_str[8];
+    char trigger_mode_str[8];
+    bool new_auto_response = false;
+    enum { FIELD_DEVICE_ID, FIELD_COMM_MODE, FIELD_RT_MODE, FIELD_TRIGGER_MODE, FIELD_AUTO_RESPONSE };
+    const json_field_t fields[] = {
+        [FIELD_DEVICE_ID]     = { "device_id",     JSON_FIELD_UINT,   &new_id },
+        [FIELD_COMM_MODE]     = { "comm_mode",     JSON_FIELD_STRING, comm_mode_str, sizeof(comm_mode_str) },
+        [FIELD_RT_MODE]       = { "rt_mode",       JSON_FIELD_STRING, rt_mode_str, sizeof(rt_mode_str) },
+        [FIELD_TRIGGER_MODE]  = { "trigger_mode",  JSON_FIELD_STRING, trigger_mode_str, sizeof(trigger_mode_str) },
+        [FIELD_AUTO_RESPONSE] = { "auto_response", JSON_FIELD_BOOL,   &new_auto_response },
+    };
+    uint32_t bound, invalid;
+    if (!http_bind_json(request, response, fields, sizeof(fields) / sizeof(fields[0]), &bound, &invalid)) {
+        return;
+    }
 
-    DBG_HTTP_PRINT("device_id_item: %p, comm_mode_item: %p, rt_mode_item: %p, trigger_mode_item: %p, auto_response_item: %p\n", 
-        device_id_item, comm_mode_item, rt_mode_item, trigger_mode_item, auto_response_item);
+    DBG_HTTP_PRINT("JSON fields bound: 0x%02lX, invalid: 0x%02lX\n", (unsigned long)bound, (unsigned long)invalid);
 
     // 현재 설정값 가져오기
     uint8_t device_id = get_gpio_device_id();
@@ -273,37 +266,34 @@ void http_handler_gpio_config_setup(const http_request_t *request, http_response
     gpio_trigger_mode_t trigger_mode = get_gpio_trigger_mode();
     bool auto_response = get_gpio_auto_response();
 
-    bool valid = true;
+    // 형식이 맞지 않는 필드 (음수 ID, 너무 긴 문자열 등)
+    bool valid = invalid == 0;
 
     // 디바이스 ID 파싱
-    if (device_id_item && cJSON_IsNumber(device_id_item)) {
-        int new_id = (int)device_id_item->valuedouble;
-    DBG_HTTP_PRINT("device_id_item found, valuedouble: %f, converted: %d\n", device_id_item->valuedouble, new_id);
+    if (bound & (1u << FIELD_DEVICE_ID)) {
         if (new_id >= 1 && new_id <= 254) {
             device_id = (uint8_t)new_id;
             DBG_HTTP_PRINT("device_id updated to: %d\n", device_id);
         } else {
-            DBG_HTTP_PRINT("device_id out of range: %d\n", new_id);
+            DBG_HTTP_PRINT("device_id out of range: %lu\n", (unsigned long)new_id);
             valid = false;
         }
     }
 
     // 통신 모드 파싱 (comm_mode: "text" -> channel, "json" -> bytes)
-    if (comm_mode_item && cJSON_IsString(comm_mode_item)) {
-        const char* mode_str = comm_mode_item->valuestring;
-        if (strcmp(mode_str, "json") == 0) {
+    if (bound & (1u << FIELD_COMM_MODE)) {
+        if (strcmp(comm_mode_str, "json") == 0) {
             rt_mode = GPIO_RT_MODE_BYTES;
-        } else if (strcmp(mode_str, "text") == 0) {
+        } else if (strcmp(comm_mode_str, "text") == 0) {
             rt_mode = GPIO_RT_MODE_CHANNEL;
         }
     }
 
     // RT 모드 파싱 (기존 필드 유지)
-    if (rt_mode_item && cJSON_IsString(rt_mode_item)) {
-        const char* mode_str = rt_mode_item->valuestring;
-        if (strcmp(mode_str, "bytes") == 0) {
+    if (bound & (1u << FIELD_RT_MODE)) {
+        if (strcmp(rt_mode_str, "bytes") == 0) {
             rt_mode = GPIO_RT_MODE_BYTES;
-        } else if (strcmp(mode_str, "channel") == 0) {
+        } else if (strcmp(rt_mode_str, "channel") == 0) {
             rt_mode = GPIO_RT_MODE_CHANNEL;
         } else {
             valid = false;
@@ -311,11 +301,10 @@ void http_handler_gpio_config_setup(const http_request_t *request, http_response
     }
 
     // Trigger 모드 파싱
-    if (trigger_mode_item && cJSON_IsString(trigger_mode_item)) {
-        const char* mode_str = trigger_mode_item->valuestring;
-        if (strcmp(mode_str, "toggle") == 0) {
+    if (bound & (1u << FIELD_TRIGGER_MODE)) {
+        if (strcmp(trigger_mode_str, "toggle") == 0) {
             trigger_mode = GPIO_MODE_TOGGLE;
-        } else if (strcmp(mode_str, "trigger") == 0) {
+        } else if (strcmp(trigger_mode_str, "trigger") == 0) {
             trigger_mode = GPIO_MODE_TRIGGER;
         } else {
             valid = false;
@@ -323,111 +312,197 @@ void http_handler_gpio_config_setup(const http_request_t *request, http_response
     }
 
     // 자동 응답 파싱
-    if (auto_response_item && cJSON_IsBool(auto_response_item)) {
-        auto_response = cJSON_IsTrue(auto_response_item);
+    if (bound & (1u << FIELD_AUTO_RESPONSE)) {
+        auto_response = new_auto_response;
     }
 
     // 유효성 검사 통과 시 설정 갱신
     if (valid) {
         // 모든 설정을 한 번에 업데이트
         if (update_gpio_config(device_id, auto_response, rt_mode, trigger_mode)) {
-            cJSON *result = cJSON_CreateObject();
-            cJSON_AddBoolToObject(result, "result", true);
-            http_send_json_object(response, result);
-            cJSON_Delete(result);
+            http_send_result_response(response);
         } else {
             http_send_error_response(response, HTTP_INTERNAL_ERROR, "Failed to save configuration");
         }
     } else {
         http_send_error_response(response, HTTP_BAD_REQUEST, "Invalid field values");
     }
-    
-    cJSON_Delete(json);
 }
 
 // 전체 시스템 상태 반환 API
+// 웹 UI가 계속 조회하므로 캐시된 문서를 복사 (바뀐 섹션만 다시 생성, http_status.c)
 void http_handler_get_status(const http_request_t *request, http_response_t *response) {
     http_init_response(response);
     
-    cJSON *root = cJSON_CreateObject();
-    
-    // 1. 네트워크 정보
-    cJSON *network = cJSON_CreateObject();
-    char mac_str[18], ip_str[16], subnet_str[16], gateway_str[16], dns_str[16];
-    
-    snprintf(mac_str, sizeof(mac_str), "%02X:%02X:%02X:%02X:%02X:%02X",
-        g_net_info.mac[0], g_net_info.mac[1], g_net_info.mac[2],
-        g_net_info.mac[3], g_net_info.mac[4], g_net_info.mac[5]);
-    snprintf(ip_str, sizeof(ip_str), "%d.%d.%d.%d",
-        g_net_info.ip[0], g_net_info.ip[1], g_net_info.ip[2], g_net_info.ip[3]);
-    snprintf(subnet_str, sizeof(subnet_str), "%d.%d.%d.%d",
-        g_net_info.sn[0], g_net_info.sn[1], g_net_info.sn[2], g_net_info.sn[3]);
-    snprintf(gateway_str, sizeof(gateway_str), "%d.%d.%d.%d",
-        g_net_info.gw[0], g_net_info.gw[1], g_net_info.gw[2], g_net_info.gw[3]);
-    snprintf(dns_str, sizeof(dns_str), "%d.%d.%d.%d",
-        g_net_info.dns[0], g_net_info.dns[1], g_net_info.dns[2], g_net_info.dns[3]);
-    
-    cJSON_AddStringToObject(network, "mac", mac_str);
-    cJSON_AddStringToObject(network, "ip", ip_str);
-    cJSON_AddStringToObject(network, "subnet", subnet_str);
-    cJSON_AddStringToObject(network, "gateway", gateway_str);
-    cJSON_AddStringToObject(network, "dns", dns_str);
-    cJSON_AddBoolToObject(network, "dhcp_enabled", g_net_info.dhcp == NETINFO_DHCP);
-    cJSON_AddBoolToObject(network, "connected", network_is_connected());
-    cJSON_AddItemToObject(root, "network", network);
-    
-    // 2. GPIO 설정 정보
-    cJSON *gpio = cJSON_CreateObject();
-    gpio_config_t* gpio_cfg = system_config_get_gpio();
-    cJSON_AddNumberToObject(gpio, "device_id", gpio_cfg->device_id);
-    cJSON_AddBoolToObject(gpio, "auto_response", gpio_cfg->auto_response);
-    cJSON_AddStringToObject(gpio, "comm_mode", 
-        gpio_cfg->rt_mode == GPIO_RT_MODE_CHANNEL ? "text" : "json");
-    cJSON_AddStringToObject(gpio, "rt_mode", 
-        gpio_cfg->rt_mode == GPIO_RT_MODE_CHANNEL ? "channel" : "bytes");
-    cJSON_AddStringToObject(gpio, "trigger_mode",
-        gpio_cfg->trigger_mode == GPIO_MODE_TRIGGER ? "trigger" : "toggle");
-    
-    // GPIO 입출력 상태
-    cJSON_AddNumberToObject(gpio, "input", gpio_input_data);
-    cJSON_AddNumberToObject(gpio, "output", gpio_output_data);
-    cJSON_AddItemToObject(root, "gpio", gpio);
-    
-    // 3. TCP 서버 정보
-    cJSON *tcp = cJSON_CreateObject();
-    cJSON_AddNumberToObject(tcp, "port", tcp_port);
-    cJSON_AddItemToObject(root, "tcp", tcp);
-    
-    // 4. UART 정보
-    cJSON *uart = cJSON_CreateObject();
-    cJSON_AddNumberToObject(uart, "baud_rate", uart_rs232_1_baud);
-    cJSON_AddItemToObject(root, "uart", uart);
-    
-    // 5. 멀티캐스트 정보
-    cJSON *multicast = cJSON_CreateObject();
-    cJSON_AddBoolToObject(multicast, "enabled", system_config_get_multicast_enabled());
-    cJSON_AddItemToObject(root, "multicast", multicast);
-    
-    // 6. 시스템 정보
-    cJSON *system = cJSON_CreateObject();
-    cJSON_AddStringToObject(system, "board", PICO_BOARD);
-    cJSON_AddStringToObject(system, "version", PICO_PROGRAM_VERSION_STRING);
-    cJSON_AddItemToObject(root, "system", system);
-    
-    cJSON_AddStringToObject(root, "status", "success");
-    
-    http_send_json_object(response, root);
-    cJSON_Delete(root);
+    uint16_t len;
+    const char *doc = http_status_document(&len);
+    memcpy(response->content, doc, len);
+    response->content[len] = '\0';
+    response->content_length = len;
+    response->status = HTTP_OK;
+    strcpy(response->content_type, "application/json");
 }
 
 void http_handler_restart(const http_request_t *request, http_response_t *response) {
     http_init_response(response);
     // printf("Restart request received, initiating system restart...\n");
     system_restart_request();
-    cJSON *result = cJSON_CreateObject();
-    cJSON_AddBoolToObject(result, "result", true);
-    http_send_json_object(response, result);
-    cJSON_Delete(result);
+    http_send_result_response(response);
+}
+
+// 입력 변화 기록 다운로드: 스테이징 페이지를 먼저 기록한 뒤 링 영역 전체를 전송
+// 섹터 헤더의 seq 순으로 정렬하면 시간 순 레코드가 됨 (형식은 gpio_history.h 참고)
+void http_handler_history(const http_request_t *request, http_response_t *response) {
+    http_init_response(response);
+
+    gpio_history_flush();
+
+    size_t size = 0;
+    const uint8_t *data = gpio_history_raw(&size);
+
+    response->status = HTTP_OK;
+    strcpy(response->content_type, "application/octet-stream");
+    response->stream_required = true;
+    response->stream_data = (const char *)data;
+    response->stream_size = size;
+    response->stream_no_cache = true;
+    response->content_length = 0;
+}
+
+// TCP 명령어 연결 목록 (getclients 명령어의 JSON 버전)
+void http_handler_clients(const http_request_t *request, http_response_t *response) {
+    http_init_response(response);
+
+    http_json_t ctx;
+    json_writer_t *json = http_json_begin(response, &ctx);
+    json_writer_uint(json, "idle_timeout", system_config_get_tcp_idle_timeout());
+    json_writer_uint(json, "idle_reaped", tcp_servers_get_idle_reaped());
+    json_writer_uint(json, "tx_disconnects", tcp_servers_get_tx_disconnects());
+
+    json_writer_begin_array(json, "clients");
+    for (uint8_t i = 0; i < TCP_CLIENT_MAX; i++) {
+        tcp_client_stats_t stats;
+        if (!tcp_servers_get_client_stats(i, &stats)) {
+            continue;
+        }
+        json_writer_begin_object(json, NULL);
+        json_writer_uint(json, "socket", stats.socket);
+        json_writer_bool(json, "connected", stats.connected);
+        if (stats.connected) {
+            json_writer_ipv4(json, "ip", stats.peer_ip);
+            json_writer_uint(json, "port", stats.peer_port);
+            json_writer_uint(json, "connected_s", stats.connected_ms / 1000);
+            json_writer_uint(json, "idle_s", stats.idle_ms / 1000);
+            json_writer_uint(json, "rx_bytes", stats.rx_bytes);
+            json_writer_uint(json, "commands", stats.commands);
+            json_writer_uint(json, "tx_bytes", stats.tx_bytes);
+            json_writer_uint(json, "responses", stats.responses);
+            json_writer_uint(json, "notifications", stats.notifications);
+            json_writer_uint(json, "tx_queued", stats.tx_queued);
+        }
+        json_writer_end_object(json);
+    }
+    json_writer_end_array(json);
+    json_writer_string(json, "status", "success");
+    http_json_end(response, &ctx);
+}
+
+// 경로의 출력 채널 번호 (1-16, 잘못되면 400 응답)
+static bool http_output_channel(const http_request_t *request, http_response_t *response, uint8_t *channel)
+{
+    uint32_t ch;
+    if (!http_request_param_uint(request, "ch", &ch) || ch < 1 || ch > 16) {
+        http_send_error_response(response, HTTP_BAD_REQUEST, "Invalid channel. Use 1-16");
+        return false;
+    }
+    *channel = (uint8_t)ch;
+    return true;
+}
+
+static void http_send_output_channel(http_response_t *response, uint8_t channel)
+{
+    http_json_t ctx;
+    json_writer_t *json = http_json_begin(response, &ctx);
+    json_writer_uint(json, "channel", channel);
+    json_writer_uint(json, "value", (gpio_output_data >> (channel - 1)) & 1);
+    json_writer_string(json, "status", "success");
+    http_json_end(response, &ctx);
+}
+
+// 출력 채널 하나 읽기 (getoutput 명령어의 JSON 버전)
+void http_handler_gpio_output_get(const http_request_t *request, http_response_t *response)
+{
+    http_init_response(response);
+    uint8_t channel;
+    if (!http_output_channel(request, response, &channel)) {
+        return;
+    }
+    http_send_output_channel(response, channel);
+}
+
+// 출력 채널 하나 설정 (본문: {"value": 0|1 또는 true|false}, setoutput 명령어와 같이 파형 정지)
+void http_handler_gpio_output_set(const http_request_t *request, http_response_t *response)
+{
+    http_init_response(response);
+    uint8_t channel;
+    if (!http_output_channel(request, response, &channel)) {
+        return;
+    }
+
+    bool value = false;
+    const json_field_t fields[] = {
+        { "value", JSON_FIELD_BOOL, &value },
+    };
+    uint32_t bound, invalid;
+    if (!http_bind_json(request, response, fields, 1, &bound, &invalid)) {
+        return;
+    }
+
+    if (!bound) {
+        http_send_error_response(response, HTTP_BAD_REQUEST, "Invalid value. Use 0 or 1");
+        return;
+    }
+
+    uint16_t mask = (uint16_t)(1u << (channel - 1));
+    gpio_wave_stop(mask);
+    hct595_write(value ? (gpio_output_data | mask) : (gpio_output_data & ~mask));
+
+    http_send_output_channel(response, channel);
+}
+
+// 이벤트 스트림 (text/event-stream): 입력/출력/링크 상태가 바뀔 때마다 바뀐 항목만 전송
+// 쿼리로 이벤트 선택 (/api/events?events=input,output, 생략 시 전체)
+// 예: data: {"input":65534}
+void http_handler_events(const http_request_t *request, http_response_t *response)
+{
+    http_init_response(response);
+    
+    uint8_t mask = TCP_EVENT_ALL;
+    const char *events = strstr(request->query, "events=");
+    if (events != NULL && (events == request->query || events[-1] == '&')) {
+        mask = 0;
+        const char *p = events + 7;
+        while (*p != '\0' && *p != '&') {
+            size_t len = strcspn(p, ",&");
+            if (len == 5 && strncmp(p, "input", 5) == 0) {
+                mask |= TCP_EVENT_INPUT;
+            } else if (len == 6 && strncmp(p, "output", 6) == 0) {
+                mask |= TCP_EVENT_OUTPUT;
+            } else if (len == 4 && strncmp(p, "link", 4) == 0) {
+                mask |= TCP_EVENT_LINK;
+            }
+            p += len;
+            if (*p == ',') p++;
+        }
+        if (mask == 0) {
+            http_send_error_response(response, HTTP_BAD_REQUEST, "Unknown events. Use input, output, link");
+            return;
+        }
+    }
+    
+    response->status = HTTP_OK;
+    response->event_stream = true;
+    response->event_mask = mask;
 }
 
 // 헬퍼 함수 구현
@@ -435,28 +510,49 @@ void http_init_response(http_response_t *response) {
     memset(response, 0, sizeof(http_response_t));
 }
 
-void http_send_json_object(http_response_t *response, cJSON *json) {
-    char *json_string = cJSON_PrintUnformatted(json);
-    response->status = HTTP_OK;
+// JSON 응답 시작: response->content에 직접 기록하는 작성기 반환 (최상위 객체 '{' 기록됨)
+json_writer_t *http_json_begin(http_response_t *response, http_json_t *ctx) {
+    cmd_sink_init_buffer(&ctx->sink, response->content, sizeof(response->content));
+    json_writer_init(&ctx->writer, &ctx->sink);
+    json_writer_begin_object(&ctx->writer, NULL);
+    return &ctx->writer;
+}
+
+// JSON 응답 완료 (상태 코드를 미리 정하지 않았으면 200)
+// 본문이 버퍼를 넘으면 잘린 JSON 대신 500 응답
+void http_json_end(http_response_t *response, http_json_t *ctx) {
+    json_writer_end_object(&ctx->writer);
+    if (!json_writer_ok(&ctx->writer)) {
+        DBG_HTTP_PRINT("JSON response truncated at %u bytes\n", (unsigned)ctx->sink.len);
+        http_send_error_response(response, HTTP_INTERNAL_ERROR, "Response too large");
+        return;
+    }
+    if (response->status == 0) {
+        response->status = HTTP_OK;
+    }
     strcpy(response->content_type, "application/json");
-    strncpy(response->content, json_string, sizeof(response->content) - 1);
-    response->content[sizeof(response->content) - 1] = '\0';
-    response->content_length = strlen(response->content);
-    free(json_string);
+    response->content_length = (uint16_t)ctx->sink.len;
 }
 
 void http_send_error_response(http_response_t *response, http_status_t status, const char *message) {
-    cJSON *error_json = cJSON_CreateObject();
-    cJSON_AddStringToObject(error_json, "status", "error");
-    cJSON_AddStringToObject(error_json, "message", message);
+    http_json_t ctx;
     response->status = status;
-    http_send_json_object(response, error_json);
-    cJSON_Delete(error_json);
+    json_writer_t *json = http_json_begin(response, &ctx);
+    json_writer_string(json, "status", "error");
+    json_writer_string(json, "message", message);
+    http_json_end(response, &ctx);
 }
 
 void http_send_success_response(http_response_t *response) {
-    cJSON *success_json = cJSON_CreateObject();
-    cJSON_AddStringToObject(success_json, "status", "success");
-    http_send_json_object(response, success_json);
-    cJSON_Delete(success_json);
-}
\ No newline at end of file
+    http_json_t ctx;
+    json_writer_t *json = http_json_begin(response, &ctx);
+    json_writer_string(json, "status", "success");
+    http_json_end(response, &ctx);
+}
+
+void http_send_result_response(http_response_t *response) {
+    http_json_t ctx;
+    json_writer_t *json = http_json_begin(response, &ctx);
+    json_writer_bool(json, "result", true);
+    http_json_end(response, &ctx);
+}
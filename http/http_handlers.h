@@ -8,7 +8,8 @@
 #include "http/http_server.h"
 #include "static_files.h"
 #include "main.h"
-#include "cJSON.h"
+#include "json/json_reader.h"
+#include "json/json_writer.h"
 
 #include "tcp/tcp_server.h"
 #include "uart/uart_rs232.h"
@@ -22,11 +23,6 @@
 #define NETWORK_INFO_KEYS {"mac", "ip", "subnet", "gateway", "dns"}
 #define NETWORK_INFO_COUNT 5
 
-// 유틸리티 매크로
-#define PARSE_IP_ADDRESS(ip_str, target_array) \
-    sscanf(ip_str, "%hhu.%hhu.%hhu.%hhu", \
-           &target_array[0], &target_array[1], &target_array[2], &target_array[3])
-
 // HTTP 핸들러 함수 선언
 void http_handler_network_info(const http_request_t *request, http_response_t *response);
 void http_handler_static_file(const http_request_t *request, http_response_t *response);
@@ -43,10 +39,31 @@ void http_handler_get_status(const http_request_t *request, http_response_t *res
 
 void http_handler_restart(const http_request_t *request, http_response_t *response);
 
+// 입력 변화 기록 원본 다운로드 (플래시 링 그대로 스트리밍)
+void http_handler_history(const http_request_t *request, http_response_t *response);
+
+// TCP 명령어 연결 목록 및 통계
+void http_handler_clients(const http_request_t *request, http_response_t *response);
+
+// 출력 채널 하나 읽기/설정 (/api/gpio/output/{ch}, ch: 1-16)
+void http_handler_gpio_output_get(const http_request_t *request, http_response_t *response);
+void http_handler_gpio_output_set(const http_request_t *request, http_response_t *response);
+
+// 입력/출력/링크 상태 변화 이벤트 스트림 (/api/events, SSE)
+void http_handler_events(const http_request_t *request, http_response_t *response);
+
+// JSON 응답 작성 상태 (핸들러 스택에 둠, 본문은 response->content에 바로 기록)
+typedef struct {
+    cmd_sink_t sink;
+    json_writer_t writer;
+} http_json_t;
+
 // 헬퍼 함수들
 void http_init_response(http_response_t *response);
-void http_send_json_object(http_response_t *response, cJSON *json);
+json_writer_t *http_json_begin(http_response_t *response, http_json_t *ctx);
+void http_json_end(http_response_t *response, http_json_t *ctx);
 void http_send_error_response(http_response_t *response, http_status_t status, const char *message);
 void http_send_success_response(http_response_t *response);
+void http_send_result_response(http_response_t *response);     // {"result":true}
 
 #endif // HTTP_HANDLERS_H
@@ -1,5 +1,6 @@
 #include "http_parser.h"
 #include <string.h>
+#include <strings.h>
 #include <stdio.h>
 
 // HTTP 메소드 문자열을 enum으로 변환
@@ -12,55 +13,272 @@ http_method_t http_parse_method(const char* method_str)
     return HTTP_UNKNOWN;
 }
 
-// HTTP 요청을 파싱하여 구조체에 저장
-void http_parse_request(const char* raw_request, http_request_t* request)
+void http_parser_init(http_parser_t* parser)
 {
-    char method_str[16] = {0};
-    char version[16] = {0};
-
-    // 첫 번째 줄 파싱: "METHOD URI HTTP/1.1"
-    sscanf(raw_request, "%15s %511s %15s", method_str, request->uri, version);
-    request->method = http_parse_method(method_str);
-
-    // Keep-Alive 헤더 확인
-    const char* connection_header = strstr(raw_request, "Connection:");
-    if (connection_header) {
-        if (strstr(connection_header, "keep-alive") || strstr(connection_header, "Keep-Alive")) {
-            // Keep-Alive 요청 감지 (현재는 무시하고 close로 처리)
+    memset(parser, 0, sizeof(*parser));
+    parser->state = HTTP_PARSE_REQUEST_LINE;
+    parser->method = HTTP_UNKNOWN;
+}
+
+// 헤더 값에 토큰이 있는지 (쉼표로 구분된 목록, 대소문자 구분 없음)
+static bool http_value_has_token(const char* value, uint16_t len, const char* token)
+{
+    size_t token_len = strlen(token);
+    uint16_t i = 0;
+
+    while (i < len) {
+        while (i < len && (value[i] == ' ' || value[i] == '\t' || value[i] == ',')) i++;
+        uint16_t start = i;
+        while (i < len && value[i] != ',') i++;
+        uint16_t end = i;
+        while (end > start && (value[end - 1] == ' ' || value[end - 1] == '\t')) end--;
+        if (end - start == token_len && strncasecmp(value + start, token, token_len) == 0) {
+            return true;
         }
     }
+    return false;
+}
 
-    // Content-Length 찾기 (POST 요청용) - 대소문자 구분 없이
-    const char* content_length_str = strstr(raw_request, "Content-Length:");
-    if (!content_length_str) {
-        content_length_str = strstr(raw_request, "content-length:");
+// q 값이 0인지 ("0", "0.0", "0.000" 등)
+static bool http_qvalue_is_zero(const char* value, uint16_t len)
+{
+    uint16_t i = 0;
+    while (i < len && (value[i] == ' ' || value[i] == '\t')) i++;
+    if (i == len || value[i] != '0') {
+        return false;
     }
-    if (!content_length_str) {
-        content_length_str = strstr(raw_request, "Content-length:");
+    for (i++; i < len && value[i] != ' ' && value[i] != '\t'; i++) {
+        if (value[i] != '.' && value[i] != '0') {
+            return false;
+        }
     }
+    return true;
+}
 
-    if(content_length_str) {
-        sscanf(content_length_str, "%*[^:]: %hu", &request->content_length);
-        const char* body_start = strstr(raw_request, "\r\n\r\n");
-        if (!body_start) {
-            body_start = strstr(raw_request, "\n\n");
-            if (body_start) body_start += 2;
-        } else {
-            body_start += 4;
+// Accept-Encoding 값을 HTTP_ENCODING_* 비트로 변환
+// "gzip, deflate, br", "br;q=1.0, gzip;q=0.8, *;q=0.1" 등. q=0은 거부, "*"는 명시하지 않은 인코딩 허용
+static uint8_t http_parse_accept_encoding(const char* value, uint16_t len)
+{
+    uint8_t accepted = 0;
+    uint8_t refused = 0;
+    bool wildcard = false;
+    uint16_t i = 0;
+
+    while (i < len) {
+        while (i < len && (value[i] == ' ' || value[i] == '\t' || value[i] == ',')) i++;
+        uint16_t start = i;
+        while (i < len && value[i] != ',' && value[i] != ';' && value[i] != ' ' && value[i] != '\t') i++;
+        uint16_t token_len = (uint16_t)(i - start);
+
+        // 파라미터 중 q 값만 확인
+        bool zero = false;
+        while (i < len && value[i] != ',') {
+            if (value[i] == ';') {
+                i++;
+                while (i < len && (value[i] == ' ' || value[i] == '\t')) i++;
+                if (i + 1 < len && (value[i] == 'q' || value[i] == 'Q') && value[i + 1] == '=') {
+                    uint16_t q_start = (uint16_t)(i + 2);
+                    uint16_t q_end = q_start;
+                    while (q_end < len && value[q_end] != ',' && value[q_end] != ';') q_end++;
+                    zero = http_qvalue_is_zero(value + q_start, (uint16_t)(q_end - q_start));
+                    i = q_end;
+                    continue;
+                }
+            }
+            i++;
         }
-        if(body_start && request->content_length > 0) {
-            uint16_t copy_length = request->content_length;
-            if(copy_length > MAX_CONTENT_SIZE - 1)
-                copy_length = MAX_CONTENT_SIZE - 1;
 
-            strncpy(request->content, body_start, copy_length);
-            request->content[copy_length] = '\0';
+        uint8_t bit = 0;
+        if ((token_len == 4 && strncasecmp(value + start, "gzip", 4) == 0) ||
+            (token_len == 6 && strncasecmp(value + start, "x-gzip", 6) == 0)) {
+            bit = HTTP_ENCODING_GZIP;
+        } else if (token_len == 2 && strncasecmp(value + start, "br", 2) == 0) {
+            bit = HTTP_ENCODING_BR;
+        } else if (token_len == 1 && value[start] == '*') {
+            wildcard = !zero;
+            continue;
+        }
+        if (zero) {
+            refused |= bit;
         } else {
-            // printf("No body found or content length is 0\n");
+            accepted |= bit;
+        }
+    }
+
+    if (wildcard) {
+        accepted |= HTTP_ENCODING_GZIP | HTTP_ENCODING_BR;
+    }
+    return (uint8_t)(accepted & ~refused);
+}
+
+// 요청 줄: "METHOD SP URI SP HTTP/x.y"
+static bool http_parse_request_line(http_parser_t* parser, const char* line, uint16_t len)
+{
+    const char* sp1 = memchr(line, ' ', len);
+    if (sp1 == NULL) {
+        return false;
+    }
+    const char* uri = sp1 + 1;
+    const char* sp2 = memchr(uri, ' ', (size_t)(line + len - uri));
+    if (sp2 == NULL || sp2 == uri || sp2 - uri >= MAX_URI_SIZE) {
+        return false;
+    }
+    const char* version = sp2 + 1;
+    uint16_t version_len = (uint16_t)(line + len - version);
+
+    char method_str[8] = {0};
+    size_t method_len = (size_t)(sp1 - line);
+    if (method_len == 0 || method_len >= sizeof(method_str)) {
+        return false;
+    }
+    memcpy(method_str, line, method_len);
+    parser->method = http_parse_method(method_str);
+
+    parser->uri_start = (uint16_t)(uri - line) + parser->line_start;
+    parser->uri_len = (uint16_t)(sp2 - uri);
+    parser->keep_alive = (version_len == 8 && strncmp(version, "HTTP/1.1", 8) == 0);
+    return version_len >= 8 && strncmp(version, "HTTP/", 5) == 0;
+}
+
+// 헤더 한 줄 (Content-Length, Connection, If-None-Match, Accept-Encoding만 사용)
+static bool http_parse_header_line(http_parser_t* parser, const char* line, uint16_t len)
+{
+    const char* colon = memchr(line, ':', len);
+    if (colon == NULL) {
+        return true;  // 형식이 틀린 헤더는 무시
+    }
+    uint16_t name_len = (uint16_t)(colon - line);
+    const char* value = colon + 1;
+    uint16_t value_len = (uint16_t)(line + len - value);
+    while (value_len > 0 && (*value == ' ' || *value == '\t')) {
+        value++;
+        value_len--;
+    }
+
+    if (name_len == 14 && strncasecmp(line, "Content-Length", 14) == 0) {
+        uint32_t n = 0;
+        uint16_t i = 0;
+        for (; i < value_len && value[i] >= '0' && value[i] <= '9'; i++) {
+            n = n * 10 + (uint32_t)(value[i] - '0');
+            if (n > HTTP_BUF_SIZE) {
+                return false;  // 버퍼에 담을 수 없는 본문
+            }
         }
+        if (i == 0) {
+            return false;
+        }
+        parser->content_length = n;
+    } else if (name_len == 13 && strncasecmp(line, "If-None-Match", 13) == 0) {
+        while (value_len > 0 && (value[value_len - 1] == ' ' || value[value_len - 1] == '\t')) {
+            value_len--;
+        }
+        parser->if_none_match_start = (uint16_t)(value - line) + parser->line_start;
+        parser->if_none_match_len = value_len;
+    } else if (name_len == 15 && strncasecmp(line, "Accept-Encoding", 15) == 0) {
+        parser->accept_encoding = http_parse_accept_encoding(value, value_len);
+    } else if (name_len == 10 && strncasecmp(line, "Connection", 10) == 0) {
+        if (http_value_has_token(value, value_len, "close")) {
+            parser->keep_alive = false;
+        } else if (http_value_has_token(value, value_len, "keep-alive")) {
+            parser->keep_alive = true;
+        }
+    }
+    return true;
+}
+
+http_parse_state_t http_parser_feed(http_parser_t* parser, const char* buf, uint16_t len, uint16_t max_len)
+{
+    // 줄 단위 처리: 새로 받은 바이트에서 줄바꿈만 찾음
+    while (parser->state == HTTP_PARSE_REQUEST_LINE || parser->state == HTTP_PARSE_HEADERS) {
+        const char* eol = NULL;
+        if (parser->pos < len) {
+            eol = memchr(buf + parser->pos, '\n', len - parser->pos);
+        }
+        if (eol == NULL) {
+            parser->pos = len;
+            // 헤더가 끝나지 않았는데 버퍼가 가득 참
+            if (len >= max_len) {
+                parser->state = HTTP_PARSE_ERROR;
+            }
+            return parser->state;
+        }
+
+        uint16_t next = (uint16_t)(eol - buf) + 1;
+        const char* line = buf + parser->line_start;
+        uint16_t line_len = (uint16_t)(eol - line);
+        if (line_len > 0 && line[line_len - 1] == '\r') {
+            line_len--;
+        }
+
+        if (parser->state == HTTP_PARSE_REQUEST_LINE) {
+            // 앞선 요청 뒤에 붙은 빈 줄은 건너뜀
+            if (line_len > 0) {
+                if (!http_parse_request_line(parser, line, line_len)) {
+                    parser->state = HTTP_PARSE_ERROR;
+                    return parser->state;
+                }
+                parser->state = HTTP_PARSE_HEADERS;
+            }
+        } else if (line_len == 0) {
+            // 빈 줄: 헤더 끝
+            parser->body_start = next;
+            parser->state = HTTP_PARSE_BODY;
+        } else if (!http_parse_header_line(parser, line, line_len)) {
+            parser->state = HTTP_PARSE_ERROR;
+            return parser->state;
+        }
+
+        parser->pos = next;
+        parser->line_start = next;
+    }
+
+    if (parser->state == HTTP_PARSE_BODY) {
+        uint32_t total = (uint32_t)parser->body_start + parser->content_length;
+        if (total > max_len) {
+            parser->state = HTTP_PARSE_ERROR;
+        } else if (len >= total) {
+            parser->state = HTTP_PARSE_DONE;
+        }
+        parser->pos = len;
+    }
+    return parser->state;
+}
+
+uint16_t http_parser_request_length(const http_parser_t* parser)
+{
+    return (uint16_t)(parser->body_start + parser->content_length);
+}
+
+void http_parser_build_request(const http_parser_t* parser, char* buf, http_request_t* request)
+{
+    request->method = parser->method;
+    request->keep_alive = parser->keep_alive;
+    request->accept_encoding = parser->accept_encoding;
+    request->param_count = 0;
+
+    // URI 뒤의 공백, If-None-Match 뒤의 줄바꿈은 이미 처리한 요청 안의 바이트이므로 NUL로 바꿔도 됨
+    request->uri = buf + parser->uri_start;
+    buf[parser->uri_start + parser->uri_len] = '\0';
+
+    // 쿼리 문자열 분리 (라우팅과 정적 파일 검색은 경로만 사용)
+    char* query = memchr(buf + parser->uri_start, '?', parser->uri_len);
+    if (query != NULL) {
+        *query = '\0';
+        request->query = query + 1;
     } else {
-        // printf("No Content-Length header found\n");
-        request->content_length = 0;
-        request->content[0] = '\0';
+        request->query = buf + parser->uri_start + parser->uri_len;
     }
-}
\ No newline at end of file
+
+    if (parser->if_none_match_len > 0) {
+        request->if_none_match = buf + parser->if_none_match_start;
+        buf[parser->if_none_match_start + parser->if_none_match_len] = '\0';
+    } else {
+        request->if_none_match = "";
+    }
+
+    // 본문 뒤 바이트는 다음 파이프라인 요청의 시작일 수 있음 (호출자가 저장 후 복원)
+    uint16_t body_end = http_parser_request_length(parser);
+    request->content = buf + parser->body_start;
+    request->content_length = (uint16_t)parser->content_length;
+    buf[body_end] = '\0';
+}
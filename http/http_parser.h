@@ -5,8 +5,44 @@
 #include <stdbool.h>
 #include "http_server.h"
 
+// 요청 파싱 상태 (연결별로 유지, 수신된 바이트만 이어서 검사)
+typedef enum {
+    HTTP_PARSE_REQUEST_LINE = 0,    // "METHOD URI VERSION" 줄 대기
+    HTTP_PARSE_HEADERS,             // 헤더 줄 (빈 줄이면 헤더 끝)
+    HTTP_PARSE_BODY,                // Content-Length만큼 본문 대기
+    HTTP_PARSE_DONE,                // 요청 하나 완성
+    HTTP_PARSE_ERROR                // 잘못된 요청 또는 버퍼보다 큰 요청
+} http_parse_state_t;
+
+typedef struct {
+    http_parse_state_t state;
+    uint16_t pos;               // 다음에 검사할 위치 (이미 검사한 바이트는 다시 보지 않음)
+    uint16_t line_start;        // 현재 줄 시작 위치
+    uint16_t uri_start;         // 요청 줄의 URI 위치
+    uint16_t uri_len;
+    uint16_t body_start;        // 헤더 끝 (본문 시작 위치)
+    uint32_t content_length;
+    uint16_t if_none_match_start;   // If-None-Match 값 위치 (길이 0이면 없음)
+    uint16_t if_none_match_len;
+    uint8_t accept_encoding;    // HTTP_ENCODING_* (헤더가 없으면 0: 압축하지 않은 본문만 허용)
+    http_method_t method;
+    bool keep_alive;            // HTTP/1.1 기본 유지, Connection 헤더 반영
+} http_parser_t;
+
 // HTTP 요청 파싱 함수들
 http_method_t http_parse_method(const char* method_str);
-void http_parse_request(const char* raw_request, http_request_t* request);
 
-#endif // HTTP_PARSER_H
\ No newline at end of file
+void http_parser_init(http_parser_t* parser);
+
+// buf[0..len) 중 새로 받은 부분을 검사 (버퍼 앞쪽의 요청 하나 기준), 반환값: 현재 상태
+http_parse_state_t http_parser_feed(http_parser_t* parser, const char* buf, uint16_t len, uint16_t max_len);
+
+// 완성된 요청의 전체 길이 (헤더 + 본문)
+uint16_t http_parser_request_length(const http_parser_t* parser);
+
+// 완성된 요청을 buf 안을 가리키는 뷰로 변환 (복사 없음)
+// URI, 쿼리, If-None-Match, 본문을 제자리에서 NUL 종료하며 buf[요청 길이]도 덮어씀:
+// 뒤따르는 파이프라인 요청의 첫 바이트일 수 있으므로 호출자가 저장해 두고 처리 후 복원
+void http_parser_build_request(const http_parser_t* parser, char* buf, http_request_t* request);
+
+#endif // HTTP_PARSER_H
@@ -8,10 +8,8 @@
 // HTTP 상태 코드 텍스트 변환 함수
 const char* http_get_status_text(http_status_t status);
 
-// HTTP 응답 전송 함수들
-void http_send_response(uint8_t sock, const http_response_t *response);
-void http_send_404(uint8_t sock);
-void http_send_large_file_stream(uint8_t sock, const char* file_data, size_t file_size,
-                                const char* content_type, bool is_compressed);
+// 응답 헤더 작성, 반환값: 헤더 길이
+// 본문은 stream_required면 stream_data, 아니면 content (전송은 서버가 연결별 커서로 나눠 처리)
+uint16_t http_build_response_header(char* header, size_t size, const http_response_t *response);
 
 #endif // HTTP_RESPONSE_H
\ No newline at end of file
@@ -2,69 +2,161 @@
 #include "http_handlers.h"
 #include <string.h>
 
-// 간단한 핸들러 테이블 (실제 구현에서는 더 동적인 방식 사용 가능)
-typedef struct {
-    char uri[64];
-    http_method_t method;
-    http_handler_t handler;
-} http_route_t;
-
-#define MAX_ROUTES 10
-static http_route_t routes[MAX_ROUTES];
-static uint8_t route_count = 0;
-
-// 라우터 초기화
-void http_router_init(void)
-{
-    route_count = 0;
+// 라우트 트리 (빌드 시 고정, 런타임 등록 없음)
+// 경로를 '/' 단위 세그먼트로 나눠 노드를 따라 내려가므로 검색 비용은 경로 깊이와
+// 노드별 하위 항목 수에만 비례하고 전체 라우트 수와는 무관함
+// 고정 세그먼트가 매개변수 세그먼트("{ch}" 등)보다 우선
+#define HTTP_ROUTE_METHOD_COUNT     HTTP_UNKNOWN    // GET, POST, PUT, DELETE
+
+typedef struct http_route_node http_route_node_t;
+
+struct http_route_node {
+    const char* segment;                // 고정 세그먼트 (NULL이면 매개변수 세그먼트)
+    uint8_t segment_len;
+    const char* param;                  // 매개변수 이름 (매개변수 세그먼트만)
+    http_handler_t handlers[HTTP_ROUTE_METHOD_COUNT];   // 메소드별 핸들러 (NULL이면 허용 안 함)
+    const http_route_node_t* children;
+    uint8_t child_count;
+};
+
+#define HTTP_ROUTE_SEGMENT(s)       .segment = (s), .segment_len = sizeof(s) - 1
+#define HTTP_ROUTE_PARAM(name)      .param = (name)
+#define HTTP_ROUTE_CHILDREN(nodes)  .children = (nodes), .child_count = sizeof(nodes) / sizeof((nodes)[0])
 
-    // API 라우트 등록
+// /api/gpio/output/{ch}: 출력 채널 하나 읽기/설정
+static const http_route_node_t route_gpio_output[] = {
+    { HTTP_ROUTE_PARAM("ch"),
+      .handlers = { [HTTP_GET] = http_handler_gpio_output_get, [HTTP_POST] = http_handler_gpio_output_set } },
+};
+
+static const http_route_node_t route_gpio[] = {
+    { HTTP_ROUTE_SEGMENT("output"), HTTP_ROUTE_CHILDREN(route_gpio_output) },
+};
+
+static const http_route_node_t route_api[] = {
     // 네트워크 설정
-    http_router_register("/api/network", HTTP_GET, http_handler_network_info);
-    http_router_register("/api/network", HTTP_POST, http_handler_network_setup);
-    
+    { HTTP_ROUTE_SEGMENT("network"),
+      .handlers = { [HTTP_GET] = http_handler_network_info, [HTTP_POST] = http_handler_network_setup } },
     // 제어 설정 (TCP/UART)
-    http_router_register("/api/control", HTTP_GET, http_handler_control_info);
-    http_router_register("/api/control", HTTP_POST, http_handler_control_setup);
-    
-    // GPIO 설정
-    http_router_register("/api/gpio", HTTP_GET, http_handler_gpio_config_info);
-    http_router_register("/api/gpio", HTTP_POST, http_handler_gpio_config_setup);
-    
+    { HTTP_ROUTE_SEGMENT("control"),
+      .handlers = { [HTTP_GET] = http_handler_control_info, [HTTP_POST] = http_handler_control_setup } },
+    // GPIO 설정, 채널별 출력
+    { HTTP_ROUTE_SEGMENT("gpio"),
+      .handlers = { [HTTP_GET] = http_handler_gpio_config_info, [HTTP_POST] = http_handler_gpio_config_setup },
+      HTTP_ROUTE_CHILDREN(route_gpio) },
     // 전체 시스템 상태
-    http_router_register("/api/status", HTTP_GET, http_handler_get_status);
-    
+    { HTTP_ROUTE_SEGMENT("status"), .handlers = { [HTTP_GET] = http_handler_get_status } },
     // 시스템 재시작
-    http_router_register("/api/restart", HTTP_GET, http_handler_restart);
+    { HTTP_ROUTE_SEGMENT("restart"), .handlers = { [HTTP_GET] = http_handler_restart } },
+    // 입력 변화 기록 (플래시 링 원본)
+    { HTTP_ROUTE_SEGMENT("history"), .handlers = { [HTTP_GET] = http_handler_history } },
+    // TCP 명령어 연결 목록
+    { HTTP_ROUTE_SEGMENT("clients"), .handlers = { [HTTP_GET] = http_handler_clients } },
+    // 상태 변화 이벤트 스트림 (SSE)
+    { HTTP_ROUTE_SEGMENT("events"), .handlers = { [HTTP_GET] = http_handler_events } },
+};
+
+static const http_route_node_t route_top[] = {
+    { HTTP_ROUTE_SEGMENT("api"), HTTP_ROUTE_CHILDREN(route_api) },
+};
+
+static const http_route_node_t route_root = { HTTP_ROUTE_CHILDREN(route_top) };
+
+// 세그먼트에 맞는 하위 노드 (고정 세그먼트 우선)
+static const http_route_node_t* http_route_child(const http_route_node_t* node, const char* seg, size_t len,
+                                                 const http_route_node_t** param)
+{
+    *param = NULL;
+    for (uint8_t i = 0; i < node->child_count; i++) {
+        const http_route_node_t* child = &node->children[i];
+        if (child->segment == NULL) {
+            *param = child;
+        } else if (child->segment_len == len && memcmp(child->segment, seg, len) == 0) {
+            return child;
+        }
+    }
+    return NULL;
 }
 
-// 라우트 등록 함수
-bool http_router_register(const char* uri, http_method_t method, http_handler_t handler)
+// 경로로 핸들러 찾기 ("//"와 끝의 '/'는 무시)
+http_route_result_t http_router_match(http_request_t* request, http_handler_t* handler)
 {
-    if(route_count < MAX_ROUTES)
-    {
-        strncpy(routes[route_count].uri, uri, sizeof(routes[route_count].uri) - 1);
-        routes[route_count].method = method;
-        routes[route_count].handler = handler;
-        route_count++;
-        return true;
+    const http_route_node_t* node = &route_root;
+    const char* p = request->uri;
+
+    request->param_count = 0;
+    *handler = NULL;
+    if (*p != '/') {
+        return HTTP_ROUTE_NOT_FOUND;
+    }
+
+    while (*p == '/') {
+        const char* seg = ++p;
+        while (*p != '\0' && *p != '/') p++;
+        size_t len = (size_t)(p - seg);
+        if (len == 0) {
+            continue;
+        }
+
+        const http_route_node_t* param;
+        const http_route_node_t* next = http_route_child(node, seg, len, &param);
+        if (next == NULL && param != NULL && request->param_count < HTTP_ROUTE_MAX_PARAMS && len <= UINT8_MAX) {
+            http_route_param_t* value = &request->params[request->param_count++];
+            value->name = param->param;
+            value->value = seg;
+            value->len = (uint8_t)len;
+            next = param;
+        }
+        if (next == NULL) {
+            return HTTP_ROUTE_NOT_FOUND;
+        }
+        node = next;
+    }
+
+    // 핸들러가 하나도 없는 중간 노드("/api" 등)는 없는 경로로 처리
+    bool has_handler = false;
+    for (uint8_t m = 0; m < HTTP_ROUTE_METHOD_COUNT; m++) {
+        has_handler |= node->handlers[m] != NULL;
+    }
+    if (!has_handler) {
+        return HTTP_ROUTE_NOT_FOUND;
     }
-    return false;
+    if (request->method >= HTTP_ROUTE_METHOD_COUNT || node->handlers[request->method] == NULL) {
+        return HTTP_ROUTE_METHOD_NOT_ALLOWED;
+    }
+    *handler = node->handlers[request->method];
+    return HTTP_ROUTE_FOUND;
 }
 
-// 핸들러 찾기 함수
-http_handler_t http_router_find_handler(const char* uri, http_method_t method)
+const char* http_request_param(const http_request_t* request, const char* name, uint8_t* len)
 {
-    for(uint8_t i = 0; i < route_count; i++)
-    {
-        if(strcmp(routes[i].uri, uri) == 0 && routes[i].method == method)
-        {
-            return routes[i].handler;
+    for (uint8_t i = 0; i < request->param_count; i++) {
+        if (strcmp(request->params[i].name, name) == 0) {
+            *len = request->params[i].len;
+            return request->params[i].value;
         }
     }
     return NULL;
 }
 
+bool http_request_param_uint(const http_request_t* request, const char* name, uint32_t* value)
+{
+    uint8_t len;
+    const char* str = http_request_param(request, name, &len);
+    if (str == NULL || len == 0 || len > 9) {
+        return false;
+    }
+    uint32_t n = 0;
+    for (uint8_t i = 0; i < len; i++) {
+        if (str[i] < '0' || str[i] > '9') {
+            return false;
+        }
+        n = n * 10 + (uint32_t)(str[i] - '0');
+    }
+    *value = n;
+    return true;
+}
+
 // 기본 라우트 처리 함수
 void http_router_handle_default(const http_request_t* request, http_response_t* response)
 {
@@ -78,7 +170,7 @@ void http_router_handle_default(const http_request_t* request, http_response_t*
     else if(strcmp(request->uri, "/") == 0) {
         // 루트 경로는 index.html로 처리
         http_request_t index_request = *request;
-        strcpy(index_request.uri, "/index.html");
+        index_request.uri = "/index.html";
         http_handler_static_file(&index_request, response);
     }
     else {
@@ -91,7 +183,7 @@ void http_router_handle_default(const http_request_t* request, http_response_t*
             if (!file_ext || strcmp(file_ext, ".html") == 0) {
                 // SPA 라우트로 판단되면 index.html로 폴백
                 http_request_t fallback_request = *request;
-                strcpy(fallback_request.uri, "/index.html");
+                fallback_request.uri = "/index.html";
                 http_handler_static_file(&fallback_request, response);
             }
         }
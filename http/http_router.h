@@ -5,16 +5,23 @@
 #include <stdbool.h>
 #include "http_server.h"
 
-// 라우트 등록 함수
-bool http_router_register(const char* uri, http_method_t method, http_handler_t handler);
+// 라우트 검색 결과
+typedef enum {
+    HTTP_ROUTE_FOUND = 0,
+    HTTP_ROUTE_NOT_FOUND,               // 등록되지 않은 경로 (정적 파일, SPA 폴백으로 처리)
+    HTTP_ROUTE_METHOD_NOT_ALLOWED       // 경로는 있지만 메소드 핸들러 없음
+} http_route_result_t;
 
-// 핸들러 찾기 함수
-http_handler_t http_router_find_handler(const char* uri, http_method_t method);
+// 경로로 핸들러 찾기 (세그먼트 단위 트리 탐색, 경로 매개변수는 request->params에 기록)
+http_route_result_t http_router_match(http_request_t* request, http_handler_t* handler);
+
+// 경로 매개변수 값 (없으면 NULL, len에 길이; request->uri 안을 가리킴)
+const char* http_request_param(const http_request_t* request, const char* name, uint8_t* len);
+
+// 경로 매개변수를 10진 정수로 변환 (없거나 숫자가 아니면 false)
+bool http_request_param_uint(const http_request_t* request, const char* name, uint32_t* value);
 
 // 기본 라우트 처리 함수
 void http_router_handle_default(const http_request_t* request, http_response_t* response);
 
-// 라우터 초기화 함수
-void http_router_init(void);
-
-#endif // HTTP_ROUTER_H
\ No newline at end of file
+#endif // HTTP_ROUTER_H
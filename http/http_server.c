@@ -10,6 +10,8 @@
 #include "http_response.h"
 #include "http_handlers.h"
 #include "../network/network_config.h"
+#include "../network/socket_pool.h"
+#include "../gpio/gpio.h"
 
 // 디버그 매크로
 
@@ -18,10 +20,48 @@
 #undef HTTP_DEBUG
 #define HTTP_DEBUG(fmt, ...)
 
+// 연결별 상태 (소켓마다 수신 버퍼와 처리 상태를 따로 가짐)
+typedef struct {
+    uint8_t sn;
+    bool attached;                  // 소켓이 할당된 슬롯
+    http_process_state_t state;     // HTTP 처리 상태
+    uint16_t buf_len;               // 수신했지만 아직 처리하지 않은 바이트 (파이프라이닝된 요청 포함)
+    http_parser_t parser;           // buf 앞쪽 요청의 파싱 상태 (수신할 때마다 이어서 검사)
+    uint16_t requests;              // 현재 연결에서 처리한 요청 수
+    uint32_t last_activity_ms;
+    bool keep_alive;                // 마지막 응답 후 연결 유지 여부
+    uint8_t buf[HTTP_BUF_SIZE];
+    
+    // 스트리밍 응답 커서 (루프마다 TX 여유 공간만큼 보내고 다른 처리에 양보)
+    const char* stream_data;
+    size_t stream_size;
+    size_t stream_pos;
+    const char* stream_header;      // 전송할 헤더 (stream_header_buf 또는 정적 파일의 미리 만든 헤더)
+    uint16_t stream_header_len;
+    uint16_t stream_header_pos;
+    char stream_header_buf[HTTP_STREAM_HEADER_SIZE];
+    
+    // 이벤트 스트림 (STATE_HTTP_EVENTS): 변화 표시만 쌓아 두고 보낼 때 현재 상태를 읽음
+    uint8_t events;                 // 구독한 이벤트 (TCP_EVENT_* 비트, 0이면 일반 연결)
+    uint8_t events_pending;         // 아직 보내지 않은 변화
+} http_conn_t;
+
+// 이벤트 스트림 응답 헤더 (길이 없이 연결이 끝날 때까지 전송)
+static const char http_events_header[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: text/event-stream\r\n"
+    "Cache-Control: no-store\r\n"
+    "Connection: keep-alive\r\n"
+    "\r\n";
+
 // 전역 변수
-static uint8_t http_buf[HTTP_BUF_SIZE];
+static http_conn_t http_conns[HTTP_MAX_CONNECTIONS];
+
+// 응답 버퍼 (연결 슬롯마다 하나, http_conns와 같은 순서)
+// 일반 응답의 본문(content)은 전송이 끝날 때까지 버퍼에 남으므로 연결별로 두어
+// 느린 연결이 다른 연결의 요청 처리를 막지 않게 함
+static http_response_t http_responses[HTTP_MAX_CONNECTIONS];
 static uint16_t http_port = HTTP_SERVER_PORT;
-static http_process_state_t http_process_state = STATE_HTTP_IDLE;  // HTTP 처리 상태 추가
 
 // 타임아웃 관리 (ioLibrary 스타일)
 volatile uint32_t http_server_tick_1s = 0;
@@ -30,9 +70,43 @@ volatile uint32_t http_server_tick_1s = 0;
 static http_server_mcu_reset_callback http_server_mcu_reset_cb = NULL;
 static http_server_wdt_reset_callback http_server_wdt_reset_cb = NULL;
 
-#define KEEP_ALIVE_TIMEOUT_MS 5000  // 5초 Keep-Alive 타임아웃
-
 // 내부 함수 선언
+static void http_conn_reset(http_conn_t* conn);
+static void http_conn_close(http_conn_t* conn);
+static void http_conn_process(http_conn_t* conn);
+static void http_handle_request(http_conn_t* conn);
+static void http_reject_request(http_conn_t* conn);
+static bool http_stream_continue(http_conn_t* conn);
+static bool http_events_continue(http_conn_t* conn);
+static void http_server_grow(void);
+
+// 연결 슬롯의 응답 버퍼
+static http_response_t* http_conn_response(const http_conn_t* conn)
+{
+    return &http_responses[conn - http_conns];
+}
+
+static http_conn_t* http_conn_attach(uint8_t sn)
+{
+    for (uint8_t k = 0; k < HTTP_MAX_CONNECTIONS; k++) {
+        http_conn_t* conn = &http_conns[k];
+        if (!conn->attached) {
+            conn->sn = sn;
+            conn->attached = true;
+            http_conn_reset(conn);
+            return conn;
+        }
+    }
+    return NULL;
+}
+
+// 소켓을 닫고 슬롯 해제 (요청 시 할당받은 소켓은 풀에 반환)
+static void http_conn_detach(http_conn_t* conn)
+{
+    close(conn->sn);
+    socket_pool_release(conn->sn);
+    conn->attached = false;
+}
 
 bool http_server_init(uint16_t port)
 {
@@ -40,38 +114,101 @@ bool http_server_init(uint16_t port)
 
     http_port = port;
 
-    // 라우터 초기화
-    http_router_init();
+    // 소켓 풀에서 HTTP 역할 소켓을 받아 연결 슬롯에 배치 (나머지는 필요할 때 할당)
+    uint8_t sockets[SOCKET_POOL_SIZE];
+    uint8_t count = socket_pool_list(SOCKET_ROLE_HTTP, sockets, SOCKET_POOL_SIZE);
+    memset(http_conns, 0, sizeof(http_conns));
+    for (uint8_t i = 0; i < count; i++) {
+        if (http_conn_attach(sockets[i]) == NULL) {
+            break;
+        }
+    }
 
     // printf("HTTP 서버 초기화 완료 (포트: %d)\n", port);
-    return true;
+    return count > 0;
 }
 
 void http_server_process(void)
 {
-    uint8_t sock = HTTP_SOCKET_NUM;
-    uint16_t size = 0;
-    uint8_t current_status = getSn_SR(sock);
+    // 네트워크가 연결되지 않은 경우 서버 처리 중단
+    if (!network_is_connected()) {
+        return;
+    }
     
-    // 네트워크 연결 상태 확인 - 재시작 로직 제거
-    bool network_connected = network_is_connected();
+    for (uint8_t k = 0; k < HTTP_MAX_CONNECTIONS; k++) {
+        if (http_conns[k].attached) {
+            http_conn_process(&http_conns[k]);
+        }
+    }
     
-    // 네트워크가 연결되지 않은 경우 서버 처리 중단
-    if (!network_connected) {
+    http_server_grow();
+}
+
+// 모든 연결을 닫음 (고정 소켓은 다음 처리에서 다시 대기, 추가 소켓은 풀에 반환)
+void http_server_restart(void)
+{
+    for (uint8_t k = 0; k < HTTP_MAX_CONNECTIONS; k++) {
+        http_conn_t* conn = &http_conns[k];
+        if (!conn->attached) {
+            continue;
+        }
+        if (socket_pool_is_dynamic(conn->sn)) {
+            http_conn_detach(conn);
+            continue;
+        }
+        close(conn->sn);
+        http_conn_reset(conn);
+    }
+}
+
+// 대기 중인 소켓이 없으면 (모두 연결됨) 빈 소켓을 받아 추가 연결 수용
+static void http_server_grow(void)
+{
+    for (uint8_t k = 0; k < HTTP_MAX_CONNECTIONS; k++) {
+        if (!http_conns[k].attached) {
+            continue;
+        }
+        uint8_t status = getSn_SR(http_conns[k].sn);
+        if (status == SOCK_LISTEN || status == SOCK_INIT || status == SOCK_CLOSED) {
+            return;
+        }
+    }
+
+    int8_t sn = socket_pool_acquire(SOCKET_ROLE_HTTP);
+    if (sn < 0) {
         return;
     }
+    if (http_conn_attach((uint8_t)sn) == NULL) {
+        socket_pool_release((uint8_t)sn);
+        return;
+    }
+    if (socket((uint8_t)sn, Sn_MR_TCP, http_port, 0x00) == sn) {
+        listen((uint8_t)sn);
+    }
+    DBG_HTTP_PRINT("HTTP 추가 소켓 대기 (소켓: %d)\n", sn);
+}
+
+static void http_conn_process(http_conn_t* conn)
+{
+    uint8_t sock = conn->sn;
+    uint16_t size = 0;
+    uint8_t current_status = getSn_SR(sock);
     
     switch(current_status)
     {
         case SOCK_CLOSED:
-            if(socket(sock, Sn_MR_TCP, http_port, 0x00) == sock) {
-                http_process_state = STATE_HTTP_IDLE;
+            if (socket_pool_is_dynamic(sock)) {
+                // 추가 소켓은 연결이 끝나면 풀에 반환
+                http_conn_detach(conn);
+                break;
             }
+            http_conn_reset(conn);
+            socket(sock, Sn_MR_TCP, http_port, 0x00);
             break;
             
         case SOCK_INIT:
             if(listen(sock) == SOCK_OK) {
-                http_process_state = STATE_HTTP_IDLE;
+                conn->state = STATE_HTTP_IDLE;
             }
             break;
             
@@ -80,96 +217,81 @@ void http_server_process(void)
             break;
             
         case SOCK_ESTABLISHED:
+            // 새 연결: 이전 연결의 남은 데이터와 요청 수 초기화
+            if (getSn_IR(sock) & Sn_IR_CON) {
+                setSn_IR(sock, Sn_IR_CON);
+                http_conn_reset(conn);
+                conn->last_activity_ms = to_ms_since_boot(get_absolute_time());
+            }
+            
             // HTTP Process states (ioLibrary 스타일)
-            switch(http_process_state)
+            switch(conn->state)
             {
-                case STATE_HTTP_IDLE:
-                    if ((size = getSn_RX_RSR(sock)) > 0) {
+                case STATE_HTTP_IDLE: {
+                    uint32_t now = to_ms_since_boot(get_absolute_time());
+                    
+                    // 새 데이터를 아직 처리하지 않은 데이터 뒤에 이어서 수신
+                    if ((size = getSn_RX_RSR(sock)) > 0 && conn->buf_len < HTTP_BUF_SIZE - 1) {
                         // HTTP 요청 수신 시 LED 깜빡임
                         status_led_activity_blink();
                         
-                        if(size > HTTP_BUF_SIZE) size = HTTP_BUF_SIZE - 1;
+                        uint16_t room = HTTP_BUF_SIZE - 1 - conn->buf_len;
+                        if (size > room) size = room;
                         
-                        size = recv(sock, http_buf, size);
-                        http_buf[size] = '\0';
-                        
-                        // POST 요청 처리 로직 (기존 코드 유지)
-                        char* method_check = strstr((char*)http_buf, "POST");
-                        char* content_length_check = strstr((char*)http_buf, "Content-Length:");
-                        if (!content_length_check) {
-                            content_length_check = strstr((char*)http_buf, "content-length:");
-                        }
-                        
-                        if (method_check && content_length_check) {
-                            uint16_t expected_length = 0;
-                            sscanf(content_length_check, "%*[^:]: %hu", &expected_length);
-                            
-                            char* header_end = strstr((char*)http_buf, "\r\n\r\n");
-                            if (!header_end) {
-                                header_end = strstr((char*)http_buf, "\n\n");
-                            }
-                            
-                            if (header_end) {
-                                int header_length = header_end - (char*)http_buf + (strstr((char*)http_buf, "\r\n\r\n") ? 4 : 2);
-                                int received_body_length = size - header_length;
-                                
-                                if (received_body_length < expected_length) {
-                                    int remaining = expected_length - received_body_length;
-                                    sleep_ms(10);
-                                    int additional_size = getSn_RX_RSR(sock);
-                                    if (additional_size > 0) {
-                                        if (size + additional_size > HTTP_BUF_SIZE - 1) {
-                                            additional_size = HTTP_BUF_SIZE - 1 - size;
-                                        }
-                                        int extra = recv(sock, http_buf + size, additional_size);
-                                        size += extra;
-                                        http_buf[size] = '\0';
-                                    }
-                                }
-                            }
-                        }
-                        
-                        // HTTP 요청 파싱 및 처리
-                        http_request_t request;
-                        http_response_t response;
-                        
-                        http_parse_request((char*)http_buf, &request);
-                        
-                        // 핸들러 실행 또는 기본 처리
-                        http_handler_t handler = http_router_find_handler(request.uri, request.method);
-                        if(handler) {
-                            handler(&request, &response);
-                        }
-                        else {
-                            http_router_handle_default(&request, &response);
-                        }
-                        
-                        // 응답 전송
-                        http_send_response(sock, &response);
-                        
-                        // 파일 스트리밍이 필요한 경우 상태 변경
-                        if (response.stream_required && response.stream_size > 0) {
-                            http_process_state = STATE_HTTP_RES_INPROC;
-                        } else {
-                            http_process_state = STATE_HTTP_RES_DONE;
+                        int32_t received = recv(sock, conn->buf + conn->buf_len, size);
+                        if (received > 0) {
+                            conn->buf_len += (uint16_t)received;
+                            conn->last_activity_ms = now;
                         }
                     }
+                    
+                    // 새로 받은 부분만 이어서 파싱, 완성된 요청은 하나씩 순서대로 처리 (나머지는 다음 루프에서)
+                    http_parse_state_t parse_state = http_parser_feed(&conn->parser, (const char*)conn->buf,
+                                                                      conn->buf_len, HTTP_BUF_SIZE - 1);
+                    if (parse_state == HTTP_PARSE_DONE) {
+                        http_handle_request(conn);
+                        break;
+                    }
+                    if (parse_state == HTTP_PARSE_ERROR) {
+                        // 잘못된 요청 또는 버퍼보다 큰 요청: 400 응답 후 연결 종료
+                        DBG_HTTP_PRINT("HTTP bad request, closing connection (socket %d)\n", sock);
+                        http_reject_request(conn);
+                        break;
+                    }
+                    
+                    if (now - conn->last_activity_ms > HTTP_KEEP_ALIVE_TIMEOUT_S * 1000u) {
+                        // 요청 없이 유지 시간 초과 (요청 일부만 받은 경우 포함)
+                        http_conn_close(conn);
+                    }
                     break;
+                }
                     
                 case STATE_HTTP_RES_INPROC:
-                    // 스트리밍이 완료되었는지 확인하고 처리
-                    // 현재는 간단하게 바로 완료로 처리 (추후 개선)
-                    http_process_state = STATE_HTTP_RES_DONE;
+                    // 스트리밍 응답: 이번 루프에 보낼 수 있는 만큼만 전송
+                    if (http_stream_continue(conn)) {
+                        // 이벤트 스트림은 헤더 전송 후 연결 유지 (전송 중단 시 종료)
+                        conn->state = (conn->events && conn->keep_alive) ? STATE_HTTP_EVENTS : STATE_HTTP_RES_DONE;
+                    }
+                    break;
+                    
+                case STATE_HTTP_EVENTS:
+                    if (!http_events_continue(conn)) {
+                        http_conn_close(conn);
+                    }
                     break;
                     
                 case STATE_HTTP_RES_DONE:
-                    // 연결 종료 (간단한 HTTP/1.0 방식)
-                    disconnect(sock);
-                    http_process_state = STATE_HTTP_IDLE;
+                    if (conn->keep_alive) {
+                        // 연결 유지: 다음 요청 대기 (이미 받은 파이프라인 요청은 바로 처리됨)
+                        conn->last_activity_ms = to_ms_since_boot(get_absolute_time());
+                        conn->state = STATE_HTTP_IDLE;
+                    } else {
+                        http_conn_close(conn);
+                    }
                     break;
                     
                 default:
-                    http_process_state = STATE_HTTP_IDLE;
+                    conn->state = STATE_HTTP_IDLE;
                     break;
             }
             break;
@@ -178,10 +300,9 @@ void http_server_process(void)
             if((size = getSn_RX_RSR(sock)) > 0)
             {
                 if(size > HTTP_BUF_SIZE) size = HTTP_BUF_SIZE - 1;
-                recv(sock, http_buf, size);
+                recv(sock, conn->buf, size);
             }
-            disconnect(sock);
-            http_process_state = STATE_HTTP_IDLE;
+            http_conn_close(conn);
             break;
             
         default:
@@ -189,15 +310,290 @@ void http_server_process(void)
     }
 }
 
+// 연결 상태 초기화 (남은 수신 데이터 폐기)
+static void http_conn_reset(http_conn_t* conn)
+{
+    conn->buf_len = 0;
+    http_parser_init(&conn->parser);
+    conn->requests = 0;
+    conn->keep_alive = false;
+    conn->state = STATE_HTTP_IDLE;
+    conn->stream_data = NULL;
+    conn->stream_size = 0;
+    conn->stream_pos = 0;
+    conn->stream_header = NULL;
+    conn->stream_header_len = 0;
+    conn->stream_header_pos = 0;
+    conn->events = 0;
+    conn->events_pending = 0;
+}
 
+// 연결 종료 (DISCON만 요청하고 대기하지 않음, CLOSED 처리에서 다시 대기)
+static void http_conn_close(http_conn_t* conn)
+{
+    setSn_CR(conn->sn, Sn_CR_DISCON);
+    while (getSn_CR(conn->sn));
+    http_conn_reset(conn);
+}
 
+// 일반 응답 (content): 헤더와 본문 모두 연결별 버퍼에서 나눠 전송
+// send()는 이전 SEND가 끝나지 않았거나 TX 공간이 모자라면 일부만 보내므로 STATE_HTTP_RES_INPROC에서 이어서 전송
+static void http_start_plain_response(http_conn_t* conn, http_response_t* response)
+{
+    conn->stream_header = conn->stream_header_buf;
+    conn->stream_header_len = http_build_response_header(conn->stream_header_buf,
+                                                         sizeof(conn->stream_header_buf), response);
+    conn->stream_header_pos = 0;
+    conn->stream_data = response->content_length > 0 ? response->content : NULL;
+    conn->stream_size = response->content_length;
+    conn->stream_pos = 0;
+    conn->last_activity_ms = to_ms_since_boot(get_absolute_time());
+    conn->state = STATE_HTTP_RES_INPROC;
+}
 
+// 잘못된 요청: 남은 수신 데이터는 버리고 400 응답 후 연결 종료
+static void http_reject_request(http_conn_t* conn)
+{
+    http_response_t* response = http_conn_response(conn);
+    http_init_response(response);
+    http_send_error_response(response, HTTP_BAD_REQUEST, "Bad request");
+    
+    conn->buf_len = 0;
+    http_parser_init(&conn->parser);
+    conn->keep_alive = false;
+    response->keep_alive = false;
+    http_start_plain_response(conn, response);
+}
 
+// 핸들러 결과 전송 시작 (모든 응답은 연결별 커서로 STATE_HTTP_RES_INPROC에서 나눠 전송)
+static void http_start_response(http_conn_t* conn, http_response_t* response)
+{
+    // 이벤트 스트림: 헤더를 보낸 뒤 STATE_HTTP_EVENTS에서 상태 변화 전송 (첫 이벤트는 전체 상태)
+    if (response->event_stream) {
+        uint8_t streams = 0;
+        for (uint8_t k = 0; k < HTTP_MAX_CONNECTIONS; k++) {
+            if (http_conns[k].attached && http_conns[k].events) {
+                streams++;
+            }
+        }
+        if (streams >= HTTP_EVENTS_MAX) {
+            // 일반 요청용 연결을 남겨 둠
+            http_init_response(response);
+            http_send_error_response(response, HTTP_SERVICE_UNAVAILABLE, "Too many event streams");
+            response->keep_alive = conn->keep_alive;
+            http_start_plain_response(conn, response);
+            return;
+        }
+        conn->keep_alive = true;
+        conn->events = response->event_mask;
+        conn->events_pending = response->event_mask;
+        conn->stream_header = http_events_header;
+        conn->stream_header_len = sizeof(http_events_header) - 1;
+        conn->stream_header_pos = 0;
+        conn->stream_data = NULL;
+        conn->stream_size = 0;
+        conn->stream_pos = 0;
+        conn->last_activity_ms = to_ms_since_boot(get_absolute_time());
+        conn->state = STATE_HTTP_RES_INPROC;
+        DBG_HTTP_PRINT("Event stream opened (socket %d, events 0x%02X)\n", conn->sn, conn->events);
+        return;
+    }
+    
+    // 정적 파일은 미리 만든 헤더를 그대로 사용 (304는 본문 없음)
+    if (response->static_headers) {
+        bool not_modified = response->status == HTTP_NOT_MODIFIED;
+        embedded_header_kind_t kind = not_modified
+            ? (conn->keep_alive ? EMBEDDED_HEADER_NOT_MODIFIED_KEEP_ALIVE : EMBEDDED_HEADER_NOT_MODIFIED)
+            : (conn->keep_alive ? EMBEDDED_HEADER_OK_KEEP_ALIVE : EMBEDDED_HEADER_OK);
+        conn->stream_header = response->static_headers[kind].data;
+        conn->stream_header_len = response->static_headers[kind].len;
+        conn->stream_header_pos = 0;
+        conn->stream_data = not_modified ? NULL : response->stream_data;
+        conn->stream_size = not_modified ? 0 : response->stream_size;
+        conn->stream_pos = 0;
+        conn->last_activity_ms = to_ms_since_boot(get_absolute_time());
+        conn->state = STATE_HTTP_RES_INPROC;
+    } else if (response->stream_required && response->stream_data) {
+        // 파일 스트리밍은 헤더를 만들어 두고 STATE_HTTP_RES_INPROC에서 나눠 전송
+        conn->stream_data = response->stream_data;
+        conn->stream_size = response->stream_size;
+        conn->stream_pos = 0;
+        conn->stream_header = conn->stream_header_buf;
+        conn->stream_header_len = http_build_response_header(conn->stream_header_buf,
+                                                             sizeof(conn->stream_header_buf), response);
+        conn->stream_header_pos = 0;
+        conn->last_activity_ms = to_ms_since_boot(get_absolute_time());
+        conn->state = STATE_HTTP_RES_INPROC;
+    } else {
+        http_start_plain_response(conn, response);
+    }
+}
 
+// 버퍼 앞쪽의 완성된 요청 하나를 처리하고 버퍼에서 제거
+static void http_handle_request(http_conn_t* conn)
+{
+    http_request_t request;
+    http_response_t* response = http_conn_response(conn);
+    
+    // 요청은 수신 버퍼 안의 뷰 (본문 뒤 한 바이트는 NUL 종료에 쓰이므로 처리 후 복원)
+    uint16_t request_len = http_parser_request_length(&conn->parser);
+    uint8_t next_byte = conn->buf[request_len];
+    http_parser_build_request(&conn->parser, (char*)conn->buf, &request);
+    conn->requests++;
+    
+    // 핸들러 실행 또는 기본 처리 (정적 파일, SPA 폴백)
+    http_init_response(response);
+    http_handler_t handler;
+    switch (http_router_match(&request, &handler)) {
+        case HTTP_ROUTE_FOUND:
+            handler(&request, response);
+            break;
+        case HTTP_ROUTE_METHOD_NOT_ALLOWED:
+            http_send_error_response(response, HTTP_METHOD_NOT_ALLOWED, "Method not allowed");
+            break;
+        default:
+            http_router_handle_default(&request, response);
+            break;
+    }
+    
+    // 연결 유지 여부 결정 후 응답 전송
+    conn->keep_alive = request.keep_alive && conn->requests < HTTP_KEEP_ALIVE_MAX;
+    response->keep_alive = conn->keep_alive;
+    http_start_response(conn, response);
+    
+    // 처리한 요청을 버퍼에서 제거, 뒤따르는 파이프라인 요청은 처음부터 다시 파싱
+    // (이벤트 스트림으로 바뀐 연결은 이후 요청을 처리하지 않음)
+    conn->buf[request_len] = next_byte;
+    if (conn->events) {
+        conn->buf_len = 0;
+    } else {
+        memmove(conn->buf, conn->buf + request_len, conn->buf_len - request_len);
+        conn->buf_len -= request_len;
+    }
+    http_parser_init(&conn->parser);
+}
+
+// 스트리밍 응답 이어서 전송 (블로킹 없음), 반환값: 전송 완료 또는 중단
+// TX 여유 공간만큼만 send()하므로 대기하지 않으며, 이전 SEND가 진행 중이면 다음 루프에서 재시도
+static bool http_stream_continue(http_conn_t* conn)
+{
+    uint8_t sock = conn->sn;
+    uint32_t now = to_ms_since_boot(get_absolute_time());
+    uint16_t free_size = getSn_TX_FSR(sock);
+    
+    if (conn->stream_header_pos >= conn->stream_header_len && conn->stream_pos >= conn->stream_size) {
+        // 모두 기록함: 연결을 닫을 경우 TX 메모리가 비워질 때까지 (상대가 받을 때까지) 대기
+        if (!conn->keep_alive && free_size < getSn_TxMAX(sock) && now - conn->last_activity_ms <= HTTP_MAX_TIMEOUT_SEC * 1000u) {
+            return false;
+        }
+        DBG_HTTP_PRINT("Streaming complete: sent %zu bytes (socket %d)\n", conn->stream_pos, sock);
+        return true;
+    }
+    
+    int32_t ret = SOCK_BUSY;
+    if (free_size > 0) {
+        if (conn->stream_header_pos < conn->stream_header_len) {
+            uint16_t n = conn->stream_header_len - conn->stream_header_pos;
+            if (n > free_size) n = free_size;
+            ret = send(sock, (uint8_t*)conn->stream_header + conn->stream_header_pos, n);
+            if (ret > 0) conn->stream_header_pos += (uint16_t)ret;
+        } else {
+            size_t n = conn->stream_size - conn->stream_pos;
+            if (n > free_size) n = free_size;
+            if (n > STREAM_CHUNK_SIZE) n = STREAM_CHUNK_SIZE;
+            ret = send(sock, (uint8_t*)(conn->stream_data + conn->stream_pos), (uint16_t)n);
+            if (ret > 0) conn->stream_pos += (size_t)ret;
+        }
+    }
+    
+    if (ret > 0) {
+        conn->last_activity_ms = now;
+        return false;
+    }
+    if (ret != SOCK_BUSY || now - conn->last_activity_ms > HTTP_MAX_TIMEOUT_SEC * 1000u) {
+        // 전송 실패 또는 상대가 받지 않음: 연결 종료
+        DBG_HTTP_PRINT("Streaming aborted: sent %zu of %zu bytes (socket %d, ret %ld)\n",
+                       conn->stream_pos, conn->stream_size, sock, (long)ret);
+        conn->keep_alive = false;
+        return true;
+    }
+    return false;
+}
+
+// 이벤트 스트림 이어서 처리 (블로킹 없음), 반환값: false면 연결 종료
+// 쌓인 변화는 TX 여유가 있을 때 한 건으로 전송 (현재 상태를 읽으므로 밀린 변화는 합쳐짐)
+static bool http_events_continue(http_conn_t* conn)
+{
+    uint8_t sock = conn->sn;
+    uint32_t now = to_ms_since_boot(get_absolute_time());
+    
+    // 클라이언트가 보내는 데이터는 사용하지 않음
+    uint16_t size = getSn_RX_RSR(sock);
+    if (size > 0) {
+        if (size > HTTP_BUF_SIZE) size = HTTP_BUF_SIZE;
+        recv(sock, conn->buf, size);
+    }
+    
+    char msg[HTTP_EVENTS_MSG_SIZE];
+    int len = 0;
+    uint8_t pending = conn->events_pending & conn->events;
+    if (pending) {
+        len = snprintf(msg, sizeof(msg), "data: {");
+        const char* sep = "";
+        if (pending & TCP_EVENT_INPUT) {
+            len += snprintf(msg + len, sizeof(msg) - len, "\"input\":%u", (unsigned)gpio_input_data);
+            sep = ",";
+        }
+        if (pending & TCP_EVENT_OUTPUT) {
+            len += snprintf(msg + len, sizeof(msg) - len, "%s\"output\":%u", sep, (unsigned)gpio_output_data);
+            sep = ",";
+        }
+        if (pending & TCP_EVENT_LINK) {
+            len += snprintf(msg + len, sizeof(msg) - len, "%s\"link\":%s", sep,
+                            network_is_cable_connected() ? "true" : "false");
+        }
+        len += snprintf(msg + len, sizeof(msg) - len, "}\n\n");
+    } else if (now - conn->last_activity_ms >= HTTP_EVENTS_PING_S * 1000u) {
+        // 변화가 없을 때 주석 줄 (끊긴 연결은 전송 실패로 감지)
+        len = snprintf(msg, sizeof(msg), ": ping\n\n");
+    } else {
+        return true;
+    }
+    
+    if (getSn_TX_FSR(sock) < (uint16_t)len) {
+        // 상대가 받지 않음: 마지막 전송 후 ping 주기와 제한 시간이 모두 지나면 종료
+        return now - conn->last_activity_ms <= (HTTP_EVENTS_PING_S + HTTP_MAX_TIMEOUT_SEC) * 1000u;
+    }
+    int32_t ret = send(sock, (uint8_t*)msg, (uint16_t)len);
+    if (ret == SOCK_BUSY) {
+        return true;
+    }
+    if (ret <= 0) {
+        return false;
+    }
+    conn->events_pending &= (uint8_t)~pending;
+    conn->last_activity_ms = now;
+    return true;
+}
 
-void http_register_handler(const char* uri, http_method_t method, http_handler_t handler)
+bool http_events_has_subscribers(uint8_t event)
 {
-    http_router_register(uri, method, handler);
+    for (uint8_t k = 0; k < HTTP_MAX_CONNECTIONS; k++) {
+        if (http_conns[k].attached && (http_conns[k].events & event)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void http_events_notify(uint8_t event)
+{
+    for (uint8_t k = 0; k < HTTP_MAX_CONNECTIONS; k++) {
+        http_conn_t* conn = &http_conns[k];
+        if (conn->attached && (conn->events & event)) {
+            conn->events_pending |= event;
+        }
+    }
 }
 
 // 콜백 함수 등록 (ioLibrary 스타일)
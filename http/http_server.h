@@ -20,11 +20,22 @@
 // HTTP 서버 설정
 // ========================
 #define HTTP_SERVER_PORT        80
-#define HTTP_SOCKET_NUM         1       // W5500 소켓 1번 사용 (8KB TX/RX 버퍼)
+#define HTTP_MAX_CONNECTIONS    3       // 동시 연결 수 (소켓 1번 + 모두 연결 중이면 소켓 풀의 빈 소켓)
 #define HTTP_BUF_SIZE           8192
 #define MAX_URI_SIZE            512
 #define MAX_CONTENT_SIZE        4096    // 안전한 크기로 설정 (W5500 버퍼의 절반)
-#define STREAM_CHUNK_SIZE       2048    // 스트리밍 전송 시 청크 크기 (안전한 크기)
+#define STREAM_CHUNK_SIZE       2048    // 스트리밍 시 루프 1회에 보내는 최대 크기 (나머지는 다음 루프에서)
+#define HTTP_STREAM_HEADER_SIZE 384     // 스트리밍 응답 헤더 버퍼 (연결별)
+#define HTTP_KEEP_ALIVE_TIMEOUT_S   5       // 요청 사이 무활동이 이 시간(초)을 넘으면 연결 종료
+#define HTTP_KEEP_ALIVE_MAX         100     // 연결 하나에서 처리할 최대 요청 수
+#define HTTP_ROUTE_MAX_PARAMS       2       // 경로 매개변수 최대 개수 (/api/gpio/output/{ch} 등)
+#define HTTP_EVENTS_MAX             2       // 동시 이벤트 스트림 (/api/events) 수, 나머지 연결은 일반 요청용
+#define HTTP_EVENTS_PING_S          15      // 이벤트가 없을 때 주석 줄을 보내 끊긴 연결 감지
+#define HTTP_EVENTS_MSG_SIZE        96      // 이벤트 한 건 최대 길이 (TX 여유가 이보다 적으면 다음 루프에서 전송)
+
+// Accept-Encoding으로 허용된 압축 방식 (http_request_t.accept_encoding 비트)
+#define HTTP_ENCODING_GZIP      0x01
+#define HTTP_ENCODING_BR        0x02
 
 // 디버그 모드 (ioLibrary 스타일로 개선)
 #define _HTTP_SERVER_DEBUG_
@@ -51,10 +62,12 @@ typedef enum {
 
 typedef enum {
     HTTP_OK = 200,
+    HTTP_NOT_MODIFIED = 304,
     HTTP_BAD_REQUEST = 400,
     HTTP_NOT_FOUND = 404,
     HTTP_METHOD_NOT_ALLOWED = 405,
-    HTTP_INTERNAL_ERROR = 500
+    HTTP_INTERNAL_ERROR = 500,
+    HTTP_SERVICE_UNAVAILABLE = 503
 } http_status_t;
 
 typedef enum {
@@ -70,17 +83,33 @@ typedef enum {
     STATE_HTTP_REQ_INPROC,         /* Received HTTP request from HTTP client */
     STATE_HTTP_REQ_DONE,           /* The end of HTTP request parse */
     STATE_HTTP_RES_INPROC,         /* Sending the HTTP response to HTTP client (in progress) */
-    STATE_HTTP_RES_DONE            /* The end of HTTP response send (HTTP transaction ended) */
+    STATE_HTTP_RES_DONE,           /* The end of HTTP response send (HTTP transaction ended) */
+    STATE_HTTP_EVENTS              /* Event stream (text/event-stream) open, pushing state changes */
 } http_process_state_t;
 
 // ========================
 // HTTP 구조체
 // ========================
+// 경로 매개변수 (라우터가 채움, 값은 uri 안을 가리키며 NUL 종료 아님)
+typedef struct {
+    const char* name;
+    const char* value;
+    uint8_t len;
+} http_route_param_t;
+
+// 요청: 연결의 수신 버퍼 안을 가리키는 뷰 (복사 없음, 각 문자열은 제자리에서 NUL 종료)
+// 핸들러가 실행되는 동안만 유효
 typedef struct {
     http_method_t method;
-    char uri[MAX_URI_SIZE];
-    char content[MAX_CONTENT_SIZE];
+    const char* uri;            // 경로 (쿼리 제외)
+    const char* content;        // 본문
     uint16_t content_length;
+    bool keep_alive;        // 응답 후 연결 유지 요청 (HTTP/1.1 기본, Connection 헤더 반영)
+    const char* if_none_match;  // If-None-Match 헤더 (없으면 빈 문자열)
+    uint8_t accept_encoding;    // Accept-Encoding 헤더 (HTTP_ENCODING_* 비트)
+    const char* query;          // '?' 뒤 쿼리 문자열 (uri에서 분리, 없으면 빈 문자열)
+    http_route_param_t params[HTTP_ROUTE_MAX_PARAMS];
+    uint8_t param_count;
 } http_request_t;
 
 typedef struct {
@@ -93,7 +122,17 @@ typedef struct {
     bool stream_required;
     const char* stream_data;
     size_t stream_size;
-    bool stream_compressed;
+    bool stream_no_cache;   // 동적 데이터 스트리밍 (캐시 금지)
+    
+    bool keep_alive;        // Connection 헤더 값 (서버가 전송 직전에 결정)
+    
+    // 정적 파일: 빌드 시 만든 헤더 블록 (embedded_header_kind_t 순서, NULL이면 런타임 작성)
+    // 서버가 상태 코드(200/304)와 keep_alive로 하나를 골라 그대로 전송
+    const embedded_header_t* static_headers;
+    
+    // 이벤트 스트림 (/api/events): 응답 후 연결을 유지하며 상태 변화를 전송
+    bool event_stream;
+    uint8_t event_mask;     // 전송할 이벤트 (TCP_EVENT_* 비트)
 } http_response_t;
 
 // ========================
@@ -115,10 +154,14 @@ typedef void (*http_server_wdt_reset_callback)(void);
 // ========================
 bool http_server_init(uint16_t port);
 void http_server_process(void);
+void http_server_restart(void);     // 모든 연결 종료 (주소 변경 시)
+
+// 이벤트 스트림 (event_notify에서 호출, TCP_EVENT_* 비트)
+bool http_events_has_subscribers(uint8_t event);
+void http_events_notify(uint8_t event);
 void http_server_stop(void);
 void http_server_cleanup(void);
 http_server_state_t http_server_get_state(void);
-void http_register_handler(const char* uri, http_method_t method, http_handler_t handler);
 
 // 콜백 함수 등록 (ioLibrary 스타일)
 void http_server_register_callbacks(http_server_mcu_reset_callback mcu_reset_cb, 
@@ -128,16 +171,6 @@ void http_server_register_callbacks(http_server_mcu_reset_callback mcu_reset_cb,
 void http_server_time_handler(void);
 uint32_t http_server_get_timecount(void);
 
-// ========================
-// HTTP 응답 전송 함수
-// ========================
-void http_send_response(uint8_t sock, const http_response_t *response);
-void http_send_json_response(uint8_t sock, http_status_t status, const char* json_data);
-void http_send_html_response(uint8_t sock, http_status_t status, const char* html_data);
-void http_send_404(uint8_t sock);
-void http_send_large_file_stream(uint8_t sock, const char* file_data, size_t file_size, 
-                                const char* content_type, bool is_compressed);
-
 // ========================
 // API 핸들러 함수
 // ========================
@@ -149,6 +182,11 @@ void http_handler_control_setup(const http_request_t *request, http_response_t *
 void http_handler_gpio_config_info(const http_request_t *request, http_response_t *response);
 void http_handler_gpio_config_setup(const http_request_t *request, http_response_t *response);
 void http_handler_restart(const http_request_t *request, http_response_t *response);
+void http_handler_history(const http_request_t *request, http_response_t *response);
+void http_handler_clients(const http_request_t *request, http_response_t *response);
+void http_handler_gpio_output_get(const http_request_t *request, http_response_t *response);
+void http_handler_gpio_output_set(const http_request_t *request, http_response_t *response);
+void http_handler_events(const http_request_t *request, http_response_t *response);
 
 // ========================
 // 정적 파일 처리 함수
@@ -0,0 +1,220 @@
+#include "http_status.h"
+#include "http_server.h"
+#include "network/network_config.h"
+#include "system/system_config.h"
+#include "gpio/gpio.h"
+#include "tcp/tcp_server.h"
+#include "uart/uart_rs232.h"
+#include "debug/debug.h"
+#include <string.h>
+
+_Static_assert(HTTP_STATUS_DOC_SIZE <= MAX_CONTENT_SIZE, "status document must fit in the response buffer");
+
+// 섹션별 원본 상태 (마지막으로 만든 JSON의 기준값, 달라지면 해당 섹션 dirty)
+// 상태 값은 명령어, DHCP, HTTP 핸들러 등 여러 곳에서 직접 바뀌므로 요청 시 기준값과 비교
+typedef struct {
+    wiz_NetInfo net_info;
+    bool connected;
+} status_network_src_t;
+
+typedef struct {
+    uint8_t device_id;
+    bool auto_response;
+    uint8_t rt_mode;
+    uint8_t trigger_mode;
+    uint16_t input;
+    uint16_t output;
+} status_gpio_src_t;
+
+static status_network_src_t status_network_src;
+static status_gpio_src_t status_gpio_src;
+static uint16_t status_tcp_src;
+static uint32_t status_uart_src;
+static bool status_multicast_src;
+
+// 기준값 갱신 (바뀌었으면 true)
+#define STATUS_UPDATE_SRC(dst, src) \
+    (memcmp(&(dst), &(src), sizeof(dst)) != 0 ? (memcpy(&(dst), &(src), sizeof(dst)), true) : false)
+
+void http_status_write_network(json_writer_t *json)
+{
+    json_writer_mac(json, "mac", g_net_info.mac);
+    json_writer_ipv4(json, "ip", g_net_info.ip);
+    json_writer_ipv4(json, "subnet", g_net_info.sn);
+    json_writer_ipv4(json, "gateway", g_net_info.gw);
+    json_writer_ipv4(json, "dns", g_net_info.dns);
+    json_writer_bool(json, "dhcp_enabled", g_net_info.dhcp == NETINFO_DHCP);
+}
+
+// 1. 네트워크 정보
+static bool status_network_changed(void)
+{
+    status_network_src_t src;
+    memset(&src, 0, sizeof(src));
+    memcpy(&src.net_info, &g_net_info, sizeof(src.net_info));
+    src.connected = network_is_connected();
+    return STATUS_UPDATE_SRC(status_network_src, src);
+}
+
+static void status_network_write(json_writer_t *json)
+{
+    http_status_write_network(json);
+    json_writer_bool(json, "connected", status_network_src.connected);
+}
+
+// 2. GPIO 설정 정보, 입출력 상태
+static bool status_gpio_changed(void)
+{
+    gpio_config_t *cfg = system_config_get_gpio();
+    status_gpio_src_t src;
+    memset(&src, 0, sizeof(src));
+    src.device_id = cfg->device_id;
+    src.auto_response = cfg->auto_response;
+    src.rt_mode = (uint8_t)cfg->rt_mode;
+    src.trigger_mode = (uint8_t)cfg->trigger_mode;
+    src.input = gpio_input_data;
+    src.output = gpio_output_data;
+    return STATUS_UPDATE_SRC(status_gpio_src, src);
+}
+
+static void status_gpio_write(json_writer_t *json)
+{
+    const status_gpio_src_t *gpio = &status_gpio_src;
+    json_writer_uint(json, "device_id", gpio->device_id);
+    json_writer_bool(json, "auto_response", gpio->auto_response);
+    json_writer_string(json, "comm_mode", gpio->rt_mode == GPIO_RT_MODE_CHANNEL ? "text" : "json");
+    json_writer_string(json, "rt_mode", gpio->rt_mode == GPIO_RT_MODE_CHANNEL ? "channel" : "bytes");
+    json_writer_string(json, "trigger_mode", gpio->trigger_mode == GPIO_MODE_TRIGGER ? "trigger" : "toggle");
+    json_writer_uint(json, "input", gpio->input);
+    json_writer_uint(json, "output", gpio->output);
+}
+
+// 3. TCP 서버 정보
+static bool status_tcp_changed(void)
+{
+    uint16_t src = tcp_port;
+    return STATUS_UPDATE_SRC(status_tcp_src, src);
+}
+
+static void status_tcp_write(json_writer_t *json)
+{
+    json_writer_uint(json, "port", status_tcp_src);
+}
+
+// 4. UART 정보
+static bool status_uart_changed(void)
+{
+    uint32_t src = uart_rs232_1_baud;
+    return STATUS_UPDATE_SRC(status_uart_src, src);
+}
+
+static void status_uart_write(json_writer_t *json)
+{
+    json_writer_uint(json, "baud_rate", status_uart_src);
+}
+
+// 5. 멀티캐스트 정보
+static bool status_multicast_changed(void)
+{
+    bool src = system_config_get_multicast_enabled();
+    return STATUS_UPDATE_SRC(status_multicast_src, src);
+}
+
+static void status_multicast_write(json_writer_t *json)
+{
+    json_writer_bool(json, "enabled", status_multicast_src);
+}
+
+// 6. 시스템 정보 (빌드 시 고정, 처음 한 번만 생성)
+static bool status_system_changed(void)
+{
+    return false;
+}
+
+static void status_system_write(json_writer_t *json)
+{
+    json_writer_string(json, "board", PICO_BOARD);
+    json_writer_string(json, "version", PICO_PROGRAM_VERSION_STRING);
+}
+
+typedef struct {
+    const char *key;
+    bool (*changed)(void);
+    void (*write)(json_writer_t *json);
+} status_section_t;
+
+static const status_section_t status_sections[] = {
+    { "network",   status_network_changed,   status_network_write },
+    { "gpio",      status_gpio_changed,      status_gpio_write },
+    { "tcp",       status_tcp_changed,       status_tcp_write },
+    { "uart",      status_uart_changed,      status_uart_write },
+    { "multicast", status_multicast_changed, status_multicast_write },
+    { "system",    status_system_changed,    status_system_write },
+};
+
+#define STATUS_SECTION_COUNT    (sizeof(status_sections) / sizeof(status_sections[0]))
+
+static char status_section_json[STATUS_SECTION_COUNT][HTTP_STATUS_SECTION_SIZE];
+static uint16_t status_section_len[STATUS_SECTION_COUNT];
+static uint8_t status_dirty = (1u << STATUS_SECTION_COUNT) - 1;    // 처음에는 전체 생성
+
+static char status_doc[HTTP_STATUS_DOC_SIZE];
+static uint16_t status_doc_len;
+
+static void status_render_section(uint8_t index)
+{
+    cmd_sink_t sink;
+    json_writer_t json;
+    cmd_sink_init_buffer(&sink, status_section_json[index], HTTP_STATUS_SECTION_SIZE);
+    json_writer_init(&json, &sink);
+    json_writer_begin_object(&json, NULL);
+    status_sections[index].write(&json);
+    json_writer_end_object(&json);
+
+    if (!json_writer_ok(&json)) {
+        DBG_HTTP_PRINT("Status section '%s' truncated\n", status_sections[index].key);
+        strcpy(status_section_json[index], "null");
+        sink.len = 4;
+    }
+    status_section_len[index] = (uint16_t)sink.len;
+}
+
+// 섹션을 이어 붙여 문서 조립 ({"network":{...},...,"status":"success"})
+static void status_assemble(void)
+{
+    cmd_sink_t sink;
+    cmd_sink_init_buffer(&sink, status_doc, sizeof(status_doc));
+    cmd_sink_write(&sink, "{", 1);
+    for (uint8_t i = 0; i < STATUS_SECTION_COUNT; i++) {
+        cmd_sink_write(&sink, "\"", 1);
+        cmd_sink_puts(&sink, status_sections[i].key);
+        cmd_sink_write(&sink, "\":", 2);
+        cmd_sink_write(&sink, status_section_json[i], status_section_len[i]);
+        cmd_sink_write(&sink, ",", 1);
+    }
+    cmd_sink_puts(&sink, "\"status\":\"success\"}");
+    status_doc_len = (uint16_t)sink.len;
+}
+
+const char *http_status_document(uint16_t *len)
+{
+    for (uint8_t i = 0; i < STATUS_SECTION_COUNT; i++) {
+        if (status_sections[i].changed()) {
+            status_dirty |= (uint8_t)(1u << i);
+        }
+    }
+
+    if (status_dirty) {
+        for (uint8_t i = 0; i < STATUS_SECTION_COUNT; i++) {
+            if (status_dirty & (1u << i)) {
+                status_render_section(i);
+            }
+        }
+        status_assemble();
+        DBG_HTTP_PRINT("Status document rebuilt (sections 0x%02X, %u bytes)\n", status_dirty, status_doc_len);
+        status_dirty = 0;
+    }
+
+    *len = status_doc_len;
+    return status_doc;
+}
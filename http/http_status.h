@@ -0,0 +1,19 @@
+#ifndef HTTP_STATUS_H
+#define HTTP_STATUS_H
+
+#include <stdint.h>
+#include "json/json_writer.h"
+
+// /api/status 문서 캐시
+// 섹션(network, gpio, tcp, uart, multicast, system)별로 미리 만든 JSON을 보관하고,
+// 원본 상태가 바뀐 섹션만 다시 만든 뒤 문서를 조립함 (상태가 그대로면 저장된 문서를 그대로 사용)
+#define HTTP_STATUS_SECTION_SIZE    192     // 섹션 하나의 최대 JSON 길이
+#define HTTP_STATUS_DOC_SIZE        1280    // 조립한 문서 최대 길이
+
+// 상태 문서 (NUL 종료, 다음 호출 전까지 유효), *len에 길이
+const char *http_status_document(uint16_t *len);
+
+// 네트워크 주소 정보 필드 (/api/network와 status의 network 섹션 공용)
+void http_status_write_network(json_writer_t *json);
+
+#endif // HTTP_STATUS_H
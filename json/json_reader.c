@@ -0,0 +1,415 @@
+#include "json_reader.h"
+#include <string.h>
+
+typedef struct {
+    const char *js;
+    size_t len;
+    size_t pos;
+    json_token_t *tokens;
+    uint8_t max_tokens;
+    uint8_t count;
+    uint8_t depth;
+} json_reader_t;
+
+static json_reader_result_t json_parse_value(json_reader_t *r);
+
+static void json_skip_ws(json_reader_t *r) {
+    while (r->pos < r->len) {
+        char c = r->js[r->pos];
+        if (c != ' ' && c != '\t' && c != '\r' && c != '\n') {
+            break;
+        }
+        r->pos++;
+    }
+}
+
+static bool json_is_hex(char c) {
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+static json_token_t *json_alloc_token(json_reader_t *r, json_token_type_t type, size_t start) {
+    if (r->count >= r->max_tokens) {
+        return NULL;
+    }
+    json_token_t *token = &r->tokens[r->count++];
+    token->type = (uint8_t)type;
+    token->size = 0;
+    token->start = (uint16_t)start;
+    token->end = (uint16_t)start;
+    return token;
+}
+
+static json_reader_result_t json_parse_string(json_reader_t *r) {
+    json_token_t *token = json_alloc_token(r, JSON_TOKEN_STRING, ++r->pos);
+    if (token == NULL) {
+        return JSON_READER_NO_TOKENS;
+    }
+    while (r->pos < r->len) {
+        unsigned char c = (unsigned char)r->js[r->pos];
+        if (c == '"') {
+            token->end = (uint16_t)r->pos++;
+            return JSON_READER_OK;
+        }
+        if (c < 0x20) {
+            return JSON_READER_INVALID;
+        }
+        if (c == '\\') {
+            if (++r->pos >= r->len) {
+                return JSON_READER_INVALID;
+            }
+            c = (unsigned char)r->js[r->pos];
+            if (c == 'u') {
+                if (r->pos + 4 >= r->len) {
+                    return JSON_READER_INVALID;
+                }
+                for (uint8_t i = 1; i <= 4; i++) {
+                    if (!json_is_hex(r->js[r->pos + i])) {
+                        return JSON_READER_INVALID;
+                    }
+                }
+                r->pos += 4;
+            } else if (strchr("\"\\/bfnrt", c) == NULL) {
+                return JSON_READER_INVALID;
+            }
+        }
+        r->pos++;
+    }
+    return JSON_READER_INVALID;
+}
+
+static size_t json_skip_digits(json_reader_t *r) {
+    size_t start = r->pos;
+    while (r->pos < r->len && r->js[r->pos] >= '0' && r->js[r->pos] <= '9') {
+        r->pos++;
+    }
+    return r->pos - start;
+}
+
+static json_reader_result_t json_parse_primitive(json_reader_t *r) {
+    static const char *const literals[] = { "true", "false", "null" };
+    json_token_t *token = json_alloc_token(r, JSON_TOKEN_PRIMITIVE, r->pos);
+    if (token == NULL) {
+        return JSON_READER_NO_TOKENS;
+    }
+
+    for (uint8_t i = 0; i < 3; i++) {
+        size_t n = strlen(literals[i]);
+        if (r->len - r->pos >= n && memcmp(r->js + r->pos, literals[i], n) == 0) {
+            r->pos += n;
+            token->end = (uint16_t)r->pos;
+            return JSON_READER_OK;
+        }
+    }
+
+    // 숫자: -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+    if (r->pos < r->len && r->js[r->pos] == '-') {
+        r->pos++;
+    }
+    size_t int_start = r->pos;
+    size_t digits = json_skip_digits(r);
+    if (digits == 0 || (digits > 1 && r->js[int_start] == '0')) {
+        return JSON_READER_INVALID;
+    }
+    if (r->pos < r->len && r->js[r->pos] == '.') {
+        r->pos++;
+        if (json_skip_digits(r) == 0) {
+            return JSON_READER_INVALID;
+        }
+    }
+    if (r->pos < r->len && (r->js[r->pos] == 'e' || r->js[r->pos] == 'E')) {
+        r->pos++;
+        if (r->pos < r->len && (r->js[r->pos] == '+' || r->js[r->pos] == '-')) {
+            r->pos++;
+        }
+        if (json_skip_digits(r) == 0) {
+            return JSON_READER_INVALID;
+        }
+    }
+    token->end = (uint16_t)r->pos;
+    return JSON_READER_OK;
+}
+
+// 객체/배열 (토큰 포인터 대신 인덱스 보관: 하위 값 파싱 중에도 유효)
+static json_reader_result_t json_parse_container(json_reader_t *r, bool object) {
+    char close = object ? '}' : ']';
+    json_token_t *token = json_alloc_token(r, object ? JSON_TOKEN_OBJECT : JSON_TOKEN_ARRAY, r->pos++);
+    if (token == NULL) {
+        return JSON_READER_NO_TOKENS;
+    }
+    if (++r->depth > JSON_READER_MAX_DEPTH) {
+        return JSON_READER_TOO_DEEP;
+    }
+    uint8_t index = (uint8_t)(r->count - 1);
+
+    json_skip_ws(r);
+    if (r->pos < r->len && r->js[r->pos] == close) {
+        r->pos++;
+    } else {
+        for (;;) {
+            json_reader_result_t result;
+            if (object) {
+                json_skip_ws(r);
+                if (r->pos >= r->len || r->js[r->pos] != '"') {
+                    return JSON_READER_INVALID;
+                }
+                if ((result = json_parse_string(r)) != JSON_READER_OK) {
+                    return result;
+                }
+                json_skip_ws(r);
+                if (r->pos >= r->len || r->js[r->pos] != ':') {
+                    return JSON_READER_INVALID;
+                }
+                r->pos++;
+            }
+            if ((result = json_parse_value(r)) != JSON_READER_OK) {
+                return result;
+            }
+            if (r->tokens[index].size == UINT8_MAX) {
+                return JSON_READER_NO_TOKENS;
+            }
+            r->tokens[index].size++;
+
+            json_skip_ws(r);
+            if (r->pos >= r->len) {
+                return JSON_READER_INVALID;
+            }
+            char c = r->js[r->pos++];
+            if (c == close) {
+                break;
+            }
+            if (c != ',') {
+                return JSON_READER_INVALID;
+            }
+        }
+    }
+    r->tokens[index].end = (uint16_t)r->pos;
+    r->depth--;
+    return JSON_READER_OK;
+}
+
+static json_reader_result_t json_parse_value(json_reader_t *r) {
+    json_skip_ws(r);
+    if (r->pos >= r->len) {
+        return JSON_READER_INVALID;
+    }
+    switch (r->js[r->pos]) {
+        case '{':   return json_parse_container(r, true);
+        case '[':   return json_parse_container(r, false);
+        case '"':   return json_parse_string(r);
+        default:    return json_parse_primitive(r);
+    }
+}
+
+json_reader_result_t json_reader_parse(const char *js, size_t len, json_token_t *tokens, uint8_t max_tokens,
+                                       uint8_t *count) {
+    json_reader_t r = {
+        .js = js,
+        .len = len > UINT16_MAX ? UINT16_MAX : len,
+        .tokens = tokens,
+        .max_tokens = max_tokens,
+    };
+    *count = 0;
+
+    json_reader_result_t result = json_parse_value(&r);
+    if (result != JSON_READER_OK) {
+        return result;
+    }
+    json_skip_ws(&r);
+    if (r.pos != r.len) {
+        return JSON_READER_INVALID;     // 값 뒤에 남은 문자
+    }
+    *count = r.count;
+    return JSON_READER_OK;
+}
+
+// 값 토큰 다음 형제 토큰 위치 (하위 토큰 건너뜀)
+static uint8_t json_next_sibling(const json_token_t *tokens, uint8_t count, uint8_t index) {
+    uint16_t end = tokens[index].end;
+    uint8_t next = (uint8_t)(index + 1);
+    while (next < count && tokens[next].start < end) {
+        next++;
+    }
+    return next;
+}
+
+static bool json_token_equals(const char *js, const json_token_t *token, const char *str) {
+    size_t len = (size_t)(token->end - token->start);
+    return strlen(str) == len && memcmp(js + token->start, str, len) == 0;
+}
+
+static bool json_bind_uint(const char *js, const json_token_t *token, uint32_t *value) {
+    if (token->type != JSON_TOKEN_PRIMITIVE) {
+        return false;
+    }
+    uint32_t n = 0;
+    for (uint16_t i = token->start; i < token->end; i++) {
+        char c = js[i];
+        if (c < '0' || c > '9') {
+            return false;           // 음수, 소수, 지수, true/false
+        }
+        uint32_t digit = (uint32_t)(c - '0');
+        if (n > (UINT32_MAX - digit) / 10) {
+            return false;
+        }
+        n = n * 10 + digit;
+    }
+    *value = n;
+    return true;
+}
+
+static bool json_bind_bool(const char *js, const json_token_t *token, bool *value) {
+    if (token->type != JSON_TOKEN_PRIMITIVE) {
+        return false;
+    }
+    if (json_token_equals(js, token, "true") || json_token_equals(js, token, "1")) {
+        *value = true;
+    } else if (json_token_equals(js, token, "false") || json_token_equals(js, token, "0")) {
+        *value = false;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// 문자열 이스케이프 해제 (\uXXXX는 UTF-8로 변환, 서로게이트 쌍과 \u0000은 지원하지 않음)
+// buf가 NULL이면 길이만 계산 (넘치는 값으로 target을 덮어쓰지 않도록 먼저 확인)
+static int32_t json_unescape(const char *js, const json_token_t *token, char *buf) {
+    int32_t out = 0;
+    for (uint16_t i = token->start; i < token->end; i++) {
+        char utf8[3] = { js[i] };
+        uint8_t n = 1;
+        if (js[i] == '\\') {
+            char c = js[++i];
+            switch (c) {
+                case 'b':   utf8[0] = '\b'; break;
+                case 'f':   utf8[0] = '\f'; break;
+                case 'n':   utf8[0] = '\n'; break;
+                case 'r':   utf8[0] = '\r'; break;
+                case 't':   utf8[0] = '\t'; break;
+                case 'u': {
+                    uint16_t cp = 0;
+                    for (uint8_t k = 0; k < 4; k++) {
+                        char h = js[++i];
+                        cp = (uint16_t)(cp << 4 | (h <= '9' ? h - '0' : (h | 0x20) - 'a' + 10));
+                    }
+                    if (cp == 0 || (cp >= 0xD800 && cp <= 0xDFFF)) {
+                        return -1;
+                    }
+                    if (cp < 0x80) {
+                        utf8[0] = (char)cp;
+                    } else if (cp < 0x800) {
+                        utf8[0] = (char)(0xC0 | cp >> 6);
+                        utf8[1] = (char)(0x80 | (cp & 0x3F));
+                        n = 2;
+                    } else {
+                        utf8[0] = (char)(0xE0 | cp >> 12);
+                        utf8[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+                        utf8[2] = (char)(0x80 | (cp & 0x3F));
+                        n = 3;
+                    }
+                    break;
+                }
+                default:    utf8[0] = c; break;     // \" \\ \/
+            }
+        }
+        if (buf != NULL) {
+            memcpy(buf + out, utf8, n);
+        }
+        out += n;
+    }
+    return out;
+}
+
+static bool json_bind_string(const char *js, const json_token_t *token, char *buf, uint16_t size) {
+    if (token->type != JSON_TOKEN_STRING) {
+        return false;
+    }
+    int32_t len = json_unescape(js, token, NULL);
+    if (len < 0 || len >= (int32_t)size) {
+        return false;
+    }
+    json_unescape(js, token, buf);
+    buf[len] = '\0';
+    return true;
+}
+
+// "a.b.c.d" (각 0-255, 앞자리 0 없는 10진수)
+static bool json_bind_ipv4(const char *js, const json_token_t *token, uint8_t *addr) {
+    if (token->type != JSON_TOKEN_STRING) {
+        return false;
+    }
+    uint8_t parsed[4];
+    uint16_t i = token->start;
+    for (uint8_t part = 0; part < 4; part++) {
+        uint16_t start = i;
+        uint16_t value = 0;
+        while (i < token->end && js[i] >= '0' && js[i] <= '9' && i - start < 3) {
+            value = (uint16_t)(value * 10 + (js[i++] - '0'));
+        }
+        if (i == start || value > 255 || (i - start > 1 && js[start] == '0')) {
+            return false;
+        }
+        parsed[part] = (uint8_t)value;
+        if (part < 3) {
+            if (i >= token->end || js[i] != '.') {
+                return false;
+            }
+            i++;
+        }
+    }
+    if (i != token->end) {
+        return false;
+    }
+    memcpy(addr, parsed, sizeof(parsed));
+    return true;
+}
+
+static bool json_bind_field(const char *js, const json_token_t *token, const json_field_t *field) {
+    switch (field->type) {
+        case JSON_FIELD_BOOL:   return json_bind_bool(js, token, (bool *)field->target);
+        case JSON_FIELD_UINT:   return json_bind_uint(js, token, (uint32_t *)field->target);
+        case JSON_FIELD_STRING: return json_bind_string(js, token, (char *)field->target, field->size);
+        case JSON_FIELD_IPV4:   return json_bind_ipv4(js, token, (uint8_t *)field->target);
+        default:                return false;
+    }
+}
+
+json_reader_result_t json_reader_bind(const char *js, size_t len, const json_field_t *fields, uint8_t field_count,
+                                      uint32_t *bound, uint32_t *invalid) {
+    json_token_t tokens[JSON_READER_MAX_TOKENS];
+    uint8_t count;
+
+    *bound = 0;
+    *invalid = 0;
+    json_reader_result_t result = json_reader_parse(js, len, tokens, JSON_READER_MAX_TOKENS, &count);
+    if (result != JSON_READER_OK) {
+        return result;
+    }
+    if (tokens[0].type != JSON_TOKEN_OBJECT) {
+        return JSON_READER_NOT_OBJECT;
+    }
+
+    // 최상위 객체의 키/값 쌍 순회 (키 토큰 바로 뒤가 값 토큰)
+    uint8_t key = 1;
+    for (uint8_t n = 0; n < tokens[0].size; n++) {
+        const json_token_t *value = &tokens[key + 1];
+        for (uint8_t f = 0; f < field_count && f < 32; f++) {
+            if (!json_token_equals(js, &tokens[key], fields[f].name)) {
+                continue;
+            }
+            uint32_t bit = 1u << f;
+            if (value->type == JSON_TOKEN_PRIMITIVE && json_token_equals(js, value, "null")) {
+                break;
+            }
+            if (json_bind_field(js, value, &fields[f])) {
+                *bound |= bit;
+                *invalid &= ~bit;
+            } else {
+                *invalid |= bit;
+            }
+            break;
+        }
+        key = json_next_sibling(tokens, count, (uint8_t)(key + 1));
+    }
+    return JSON_READER_OK;
+}
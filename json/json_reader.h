@@ -0,0 +1,62 @@
+#ifndef JSON_READER_H
+#define JSON_READER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// 할당 없는 JSON 파서 (jsmn 방식)
+// 본문을 복사하지 않고 토큰(종류, 시작/끝 위치)만 호출자 배열에 기록
+// 잘못된 본문이나 토큰/중첩 초과는 오류로 끝나며 힙을 사용하지 않음
+#define JSON_READER_MAX_TOKENS  32      // 요청 본문 하나에 허용하는 토큰 수 (바인더 스택 사용량)
+#define JSON_READER_MAX_DEPTH   8
+
+typedef enum {
+    JSON_TOKEN_OBJECT = 0,
+    JSON_TOKEN_ARRAY,
+    JSON_TOKEN_STRING,      // start/end는 따옴표 안쪽 (이스케이프는 그대로)
+    JSON_TOKEN_PRIMITIVE    // 숫자, true, false, null
+} json_token_type_t;
+
+typedef struct {
+    uint8_t type;           // json_token_type_t
+    uint8_t size;           // 객체: 키 개수, 배열: 요소 개수
+    uint16_t start;
+    uint16_t end;           // 끝 다음 위치 (객체/배열은 닫는 괄호 다음)
+} json_token_t;
+
+typedef enum {
+    JSON_READER_OK = 0,
+    JSON_READER_INVALID,        // JSON 문법 오류
+    JSON_READER_NO_TOKENS,      // 토큰 배열 부족
+    JSON_READER_TOO_DEEP,       // 중첩 초과
+    JSON_READER_NOT_OBJECT      // 바인더: 최상위가 객체가 아님
+} json_reader_result_t;
+
+// 토큰화 (성공 시 *count에 토큰 수, 첫 토큰이 최상위 값)
+json_reader_result_t json_reader_parse(const char *js, size_t len, json_token_t *tokens, uint8_t max_tokens,
+                                       uint8_t *count);
+
+// 스키마 기반 필드 바인딩
+// 최상위 객체의 키를 스키마와 비교해 값을 변환 후 target에 기록
+// 스키마에 없는 키는 무시하고, null 값은 생략된 것으로 처리
+typedef enum {
+    JSON_FIELD_BOOL = 0,    // true/false (0/1도 허용) -> bool
+    JSON_FIELD_UINT,        // 음이 아닌 정수 -> uint32_t (소수, 지수, 범위 초과는 invalid)
+    JSON_FIELD_STRING,      // 문자열 -> char[size] (이스케이프 해제, 넘치면 invalid)
+    JSON_FIELD_IPV4         // "a.b.c.d" -> uint8_t[4]
+} json_field_type_t;
+
+typedef struct {
+    const char *name;
+    json_field_type_t type;
+    void *target;
+    uint16_t size;          // JSON_FIELD_STRING 버퍼 크기 (NUL 포함)
+} json_field_t;
+
+// 바인딩 (최대 32필드, 비트 i = fields[i])
+// bound: 값을 기록한 필드, invalid: 키는 있지만 형식이 맞지 않아 기록하지 않은 필드
+json_reader_result_t json_reader_bind(const char *js, size_t len, const json_field_t *fields, uint8_t field_count,
+                                      uint32_t *bound, uint32_t *invalid);
+
+#endif // JSON_READER_H
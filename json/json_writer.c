@@ -0,0 +1,174 @@
+#include "json_writer.h"
+#include <string.h>
+
+static void json_writer_raw(json_writer_t *json, const char *data, size_t len) {
+    if (json->overflow) {
+        return;
+    }
+    if (cmd_sink_write(json->sink, data, len) != len) {
+        json->overflow = true;
+    }
+}
+
+// 10진 변환 (뒤에서부터 채움, 반환값: 시작 위치)
+static char *json_format_uint(char *end, uint32_t value) {
+    char *p = end;
+    do {
+        *--p = (char)('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    return p;
+}
+
+static void json_writer_quoted(json_writer_t *json, const char *str);
+
+// 값 앞 구분자와 키 ("key":)
+static void json_writer_prefix(json_writer_t *json, const char *key) {
+    uint8_t bit = (uint8_t)(1u << (json->depth & 7));
+    if (json->depth > 0) {
+        if (json->has_member & bit) {
+            json_writer_raw(json, ",", 1);
+        }
+        json->has_member |= bit;
+    }
+    if (key != NULL) {
+        json_writer_quoted(json, key);
+        json_writer_raw(json, ":", 1);
+    }
+}
+
+static void json_writer_open(json_writer_t *json, const char *key, char bracket) {
+    json_writer_prefix(json, key);
+    json_writer_raw(json, &bracket, 1);
+    if (json->depth >= JSON_WRITER_MAX_DEPTH) {
+        json->overflow = true;
+        return;
+    }
+    json->depth++;
+    json->has_member &= (uint8_t)~(1u << (json->depth & 7));
+}
+
+static void json_writer_close(json_writer_t *json, char bracket) {
+    if (json->depth == 0) {
+        json->overflow = true;
+        return;
+    }
+    json->depth--;
+    json_writer_raw(json, &bracket, 1);
+}
+
+void json_writer_init(json_writer_t *json, cmd_sink_t *sink) {
+    memset(json, 0, sizeof(*json));
+    json->sink = sink;
+}
+
+void json_writer_begin_object(json_writer_t *json, const char *key) {
+    json_writer_open(json, key, '{');
+}
+
+void json_writer_end_object(json_writer_t *json) {
+    json_writer_close(json, '}');
+}
+
+void json_writer_begin_array(json_writer_t *json, const char *key) {
+    json_writer_open(json, key, '[');
+}
+
+void json_writer_end_array(json_writer_t *json) {
+    json_writer_close(json, ']');
+}
+
+// 따옴표로 감싼 문자열 (", \, 제어 문자만 이스케이프, UTF-8은 그대로)
+static void json_writer_quoted(json_writer_t *json, const char *str) {
+    static const char hex[] = "0123456789abcdef";
+
+    json_writer_raw(json, "\"", 1);
+    const char *run = str;
+    for (const char *p = str; ; p++) {
+        unsigned char c = (unsigned char)*p;
+        if (c != '\0' && c != '"' && c != '\\' && c >= 0x20) {
+            continue;
+        }
+        json_writer_raw(json, run, (size_t)(p - run));
+        if (c == '\0') {
+            break;
+        }
+        char esc[6] = { '\\', (char)c };
+        size_t esc_len = 2;
+        switch (c) {
+            case '"': case '\\':    break;
+            case '\n':  esc[1] = 'n'; break;
+            case '\r':  esc[1] = 'r'; break;
+            case '\t':  esc[1] = 't'; break;
+            default:
+                esc[1] = 'u'; esc[2] = '0'; esc[3] = '0';
+                esc[4] = hex[c >> 4]; esc[5] = hex[c & 0x0F];
+                esc_len = 6;
+                break;
+        }
+        json_writer_raw(json, esc, esc_len);
+        run = p + 1;
+    }
+    json_writer_raw(json, "\"", 1);
+}
+
+void json_writer_string(json_writer_t *json, const char *key, const char *value) {
+    json_writer_prefix(json, key);
+    json_writer_quoted(json, value);
+}
+
+void json_writer_uint(json_writer_t *json, const char *key, uint32_t value) {
+    char buf[10];
+    char *p = json_format_uint(buf + sizeof(buf), value);
+    json_writer_prefix(json, key);
+    json_writer_raw(json, p, (size_t)(buf + sizeof(buf) - p));
+}
+
+void json_writer_int(json_writer_t *json, const char *key, int32_t value) {
+    char buf[11];
+    uint32_t magnitude = value < 0 ? 0u - (uint32_t)value : (uint32_t)value;
+    char *p = json_format_uint(buf + sizeof(buf), magnitude);
+    if (value < 0) {
+        *--p = '-';
+    }
+    json_writer_prefix(json, key);
+    json_writer_raw(json, p, (size_t)(buf + sizeof(buf) - p));
+}
+
+void json_writer_bool(json_writer_t *json, const char *key, bool value) {
+    json_writer_prefix(json, key);
+    if (value) {
+        json_writer_raw(json, "true", 4);
+    } else {
+        json_writer_raw(json, "false", 5);
+    }
+}
+
+void json_writer_ipv4(json_writer_t *json, const char *key, const uint8_t ip[4]) {
+    char buf[16];
+    char *out = buf;
+    for (uint8_t i = 0; i < 4; i++) {
+        char digits[3];
+        char *p = json_format_uint(digits + sizeof(digits), ip[i]);
+        size_t len = (size_t)(digits + sizeof(digits) - p);
+        memcpy(out, p, len);
+        out += len;
+        *out++ = i < 3 ? '.' : '\0';
+    }
+    json_writer_string(json, key, buf);
+}
+
+void json_writer_mac(json_writer_t *json, const char *key, const uint8_t mac[6]) {
+    static const char hex[] = "0123456789ABCDEF";
+    char buf[18];
+    for (uint8_t i = 0; i < 6; i++) {
+        buf[i * 3] = hex[mac[i] >> 4];
+        buf[i * 3 + 1] = hex[mac[i] & 0x0F];
+        buf[i * 3 + 2] = i < 5 ? ':' : '\0';
+    }
+    json_writer_string(json, key, buf);
+}
+
+bool json_writer_ok(const json_writer_t *json) {
+    return !json->overflow && json->depth == 0;
+}
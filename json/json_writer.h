@@ -0,0 +1,40 @@
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "handlers/response_sink.h"
+
+// 스트리밍 JSON 작성기 (힙 할당 없음)
+// 값을 만드는 즉시 sink에 기록하므로 cJSON 트리나 문자열 사본이 필요 없음
+// 정수는 double을 거치지 않고 직접 변환
+// key는 객체 안에서만 사용 (배열 요소와 최상위 값은 NULL)
+#define JSON_WRITER_MAX_DEPTH   8
+
+typedef struct {
+    cmd_sink_t *sink;
+    uint8_t depth;
+    uint8_t has_member;     // 깊이별 비트: 이미 값을 쓴 객체/배열 (다음 값 앞에 ',')
+    bool overflow;          // sink 공간 부족 또는 중첩 초과 (결과 JSON이 잘림)
+} json_writer_t;
+
+void json_writer_init(json_writer_t *json, cmd_sink_t *sink);
+
+void json_writer_begin_object(json_writer_t *json, const char *key);
+void json_writer_end_object(json_writer_t *json);
+void json_writer_begin_array(json_writer_t *json, const char *key);
+void json_writer_end_array(json_writer_t *json);
+
+void json_writer_string(json_writer_t *json, const char *key, const char *value);
+void json_writer_uint(json_writer_t *json, const char *key, uint32_t value);
+void json_writer_int(json_writer_t *json, const char *key, int32_t value);
+void json_writer_bool(json_writer_t *json, const char *key, bool value);
+
+// 주소 문자열 ("192.168.0.10", "00:08:DC:12:34:56")
+void json_writer_ipv4(json_writer_t *json, const char *key, const uint8_t ip[4]);
+void json_writer_mac(json_writer_t *json, const char *key, const uint8_t mac[6]);
+
+// 모든 객체/배열이 닫혔고 잘린 부분이 없는지
+bool json_writer_ok(const json_writer_t *json);
+
+#endif // JSON_WRITER_H
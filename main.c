@@ -34,6 +34,14 @@ void system_restart(void) {
 // USB CDC 명령 처리
 // =============================================================================
 
+// 명령어 응답 sink: stdio(USB CDC)로 바로 출력
+static size_t usb_sink_write(cmd_sink_t *sink, const char *data, size_t len)
+{
+    (void)sink;
+    fwrite(data, 1, len, stdout);
+    return len;
+}
+
 void process_usb_cdc_commands(void)
 {
     static char usb_line[512];
@@ -45,35 +53,16 @@ void process_usb_cdc_commands(void)
             if (usb_pos > 0) {
                 usb_line[usb_pos] = '\0';
                 
-                // 명령 처리
-                char response[2048] = {0};
-                cmd_result_t res = process_command(usb_line, response, sizeof(response));
+                // 명령 처리 (응답은 sink로 바로 출력)
+                cmd_sink_t sink;
+                cmd_sink_init(&sink, usb_sink_write, NULL);
+                process_command(usb_line, &sink);
                 
-                // 응답 출력 (청크 단위)
-                if (response[0] != '\0') {
-                    size_t rlen = strlen(response);
-                    const char *p = response;
-                    const size_t CHUNK_SIZE = 256;
-                    size_t sent = 0;
-                    
-                    while (sent < rlen) {
-                        size_t to_send = rlen - sent;
-                        if (to_send > CHUNK_SIZE) {
-                            to_send = CHUNK_SIZE;
-                        }
-                        
-                        printf("%.*s", (int)to_send, p + sent);
-                        fflush(stdout);
-                        sent += to_send;
-                        sleep_ms(1);
-                    }
-                    
-                    // 줄바꿈 확인
-                    if (rlen == 0 || response[rlen - 1] != '\n') {
-                        printf("\n");
-                        fflush(stdout);
-                    }
+                // 줄바꿈 확인
+                if (sink.written > 0 && sink.last != '\n') {
+                    printf("\n");
                 }
+                fflush(stdout);
                 usb_pos = 0;
             }
         } else if (usb_pos + 1 < sizeof(usb_line)) {
@@ -142,6 +131,9 @@ int main()
     hct595_write(0x0000);
     DBG_MAIN_PRINT("GPIO outputs initialized (all OFF)\n");
     
+    // 입력 변화 기록기 (설정에서 활성화된 경우)
+    gpio_history_init();
+    
     // 시스템 준비 완료: 녹색 LED 계속 켜짐
     status_led_set_state(STATUS_LED_GREEN_ON);
     DBG_MAIN_PRINT("System ready - Status LED green\n");
@@ -185,6 +177,7 @@ int main()
         
         // GPIO 입력 읽기
         hct165_read();
+        gpio_history_process();
         
         // UART 데이터 처리
         uart_rs232_process();
@@ -17,6 +17,7 @@
 #include "tcp/tcp_server.h"
 #include "uart/uart_rs232.h"
 #include "gpio/gpio.h"
+#include "gpio/gpio_history.h"
 
 // SPI CONFIGURATION
 #define SPI_PORT spi0
@@ -3,6 +3,8 @@
 #include "debug/debug.h"
 #include "../uart/uart_rs232.h"
 #include "../tcp/tcp_server.h"
+#include "../handlers/event_notify.h"
+#include "socket_pool.h"
 
 // =============================================================================
 // IP Address Utility Functions
@@ -89,6 +91,10 @@ wiz_NetInfo g_net_info = {
 // DHCP configuration flag
 bool dhcp_configured = false;
 
+// 재부팅 없이 적용할 설정 (NETWORK_APPLY_*)
+static uint8_t apply_pending = 0;
+static uint32_t apply_due_ms = 0;
+
 // Ethernet buffer for network operations
 uint8_t g_ethernet_buf[2048];
 
@@ -272,9 +278,10 @@ w5500_init_result_t w5500_initialize(void) {
     DBG_WIZNET_PRINT("Method 2 (VDM mode): 0x%02X\n", ver2);
     sleep_ms(50);
     
-    // W5500 소켓 버퍼 초기화 및 설정 (최적화 - HTTP 서버에 더 많은 버퍼 할당)
-    uint8_t tx_sizes[8] = {2, 2, 2, 2, 2, 2, 2, 2};
-    uint8_t rx_sizes[8] = {2, 2, 2, 2, 2, 2, 2, 2};
+    // W5500 소켓 버퍼 초기화 및 설정 (소켓 풀 프로파일에 따라 분배)
+    uint8_t tx_sizes[SOCKET_POOL_SIZE];
+    uint8_t rx_sizes[SOCKET_POOL_SIZE];
+    socket_pool_get_buffer_sizes(tx_sizes, rx_sizes);
     DBG_WIZNET_PRINT("Initializing WIZchip buffers...\n");
     
     int init_result = wizchip_init(tx_sizes, rx_sizes);
@@ -525,6 +532,9 @@ void network_init(void) {
     DBG_NET_PRINT("Loading network configuration from flash...\n");
     network_config_load_from_flash(&g_net_info);
     
+    // 소켓 역할/버퍼 프로파일 (W5500 초기화 전에 적용)
+    socket_pool_init(system_config_get_socket_profile());
+    
     // W5500 및 네트워크 초기화
     if (w5500_initialize() == W5500_INIT_SUCCESS) {
         DBG_WIZNET_PRINT("W5500 initialization successful\n");
@@ -539,8 +549,66 @@ void network_init(void) {
     w5500_print_network_status();
 }
 
+void network_apply_request(uint8_t what) {
+    apply_pending |= what;
+    apply_due_ms = to_ms_since_boot(get_absolute_time()) + NETWORK_APPLY_DELAY_MS;
+}
+
+// 주소 설정을 W5500 레지스터에 바로 반영
+// IP가 바뀌면 이전 주소로 맺어진 연결은 쓸 수 없으므로 닫고 (대기 소켓은 다시 열림),
+// DHCP로 전환하면 IP를 비워 network_process의 DHCP 절차가 시작되도록 함
+static void network_apply_address(void) {
+    wiz_NetInfo current;
+    wizchip_getnetinfo(&current);
+
+    if (g_net_info.dhcp == NETINFO_DHCP) {
+        if (current.dhcp == NETINFO_DHCP && dhcp_configured) {
+            return;  // 이미 DHCP로 주소를 받은 상태
+        }
+        DBG_NET_PRINT("Switching to DHCP without restart\n");
+        memset(current.ip, 0, 4);
+        current.dhcp = NETINFO_DHCP;
+        apply_network_config(&current);
+        dhcp_configured = false;
+        tcp_servers_restart();
+        http_server_restart();
+        return;
+    }
+
+    bool ip_changed = memcmp(current.ip, g_net_info.ip, 4) != 0;
+    apply_network_config(&g_net_info);
+    dhcp_configured = false;
+    if (ip_changed) {
+        tcp_servers_restart();
+        http_server_restart();
+    }
+    DBG_NET_PRINT("Network configuration applied without restart (IP %s)\n",
+        ip_changed ? "changed" : "unchanged");
+}
+
+static void network_apply_process(void) {
+    if (apply_pending == 0 ||
+        (int32_t)(to_ms_since_boot(get_absolute_time()) - apply_due_ms) < 0) {
+        return;
+    }
+    uint8_t what = apply_pending;
+    apply_pending = 0;
+
+    if (what & NETWORK_APPLY_ADDRESS) {
+        network_apply_address();
+    }
+    // 주소 변경 시 이미 새 포트로 다시 열었으므로 포트만 바뀐 경우에만 재시작
+    if ((what & NETWORK_APPLY_TCP_PORT) && !(what & NETWORK_APPLY_ADDRESS)) {
+        tcp_servers_restart();
+        DBG_NET_PRINT("TCP port %u applied without restart\n", tcp_port);
+    }
+}
+
 // 네트워크 처리 함수 (메인 루프에서 호출)
 void network_process(void) {
+    // 설정 변경 적용 (재부팅 대신)
+    network_apply_process();
+    
     // 케이블 연결 상태 모니터링
     bool cable_connected = network_is_cable_connected();
     static bool last_cable_state = false;
@@ -552,7 +620,7 @@ void network_process(void) {
             printf("%s", conn_msg);
             DBG_WIZNET_PRINT("%s", conn_msg);
             uart_rs232_write(RS232_PORT_1, (const uint8_t*)conn_msg, (uint32_t)strlen(conn_msg));
-            tcp_servers_broadcast((const uint8_t*)conn_msg, (uint16_t)strlen(conn_msg));
+            event_notify(TCP_EVENT_LINK, 0, (const uint8_t*)conn_msg, (uint16_t)strlen(conn_msg));
             // 케이블이 연결되면 DHCP 플래그 리셋하여 IP 배분 재시도 가능하도록 함
             dhcp_configured = false;
         } else {
@@ -560,7 +628,7 @@ void network_process(void) {
             printf("%s", disc_msg);
             DBG_WIZNET_PRINT("%s", disc_msg);
             uart_rs232_write(RS232_PORT_1, (const uint8_t*)disc_msg, (uint32_t)strlen(disc_msg));
-            tcp_servers_broadcast((const uint8_t*)disc_msg, (uint16_t)strlen(disc_msg));
+            event_notify(TCP_EVENT_LINK, 0, (const uint8_t*)disc_msg, (uint16_t)strlen(disc_msg));
             // 케이블이 연결 해제되면 DHCP 플래그 리셋
             dhcp_configured = false;
         }
@@ -80,4 +80,11 @@ void apply_network_config(const wiz_NetInfo* config);
 void network_init(void);
 void network_process(void);
 
+// 변경된 설정을 재부팅 없이 적용
+// 설정 명령의 응답이 이전 주소/포트로 먼저 나가도록 NETWORK_APPLY_DELAY_MS 후 network_process에서 적용
+#define NETWORK_APPLY_DELAY_MS  200
+#define NETWORK_APPLY_ADDRESS   0x01    // IP/서브넷/게이트웨이/DNS, DHCP 모드 (g_net_info)
+#define NETWORK_APPLY_TCP_PORT  0x02    // TCP 명령어 서버 포트 (tcp_port)
+void network_apply_request(uint8_t what);
+
 #endif // NETWORK_CONFIG_H
@@ -0,0 +1,131 @@
+#include "socket_pool.h"
+#include "debug/debug.h"
+#include <string.h>
+#include <strings.h>
+
+typedef struct {
+    const char *name;
+    uint8_t tx_kb[SOCKET_POOL_SIZE];
+    uint8_t rx_kb[SOCKET_POOL_SIZE];
+    uint8_t role[SOCKET_POOL_SIZE];     // 초기 역할
+} socket_profile_def_t;
+
+#define D SOCKET_ROLE_DHCP
+#define H SOCKET_ROLE_HTTP
+#define T SOCKET_ROLE_TCP
+#define F SOCKET_ROLE_FREE
+#define M SOCKET_ROLE_MULTICAST
+
+// 소켓별 크기는 0/1/2/4/8/16KB, TX와 RX 각각 합계 16KB 이하
+static const socket_profile_def_t socket_profiles[SOCKET_PROFILE_COUNT] = {
+    [SOCKET_PROFILE_BALANCED] = {
+        .name  = "balanced",
+        .tx_kb = { 2, 2, 2, 2, 2, 2, 2, 2 },
+        .rx_kb = { 2, 2, 2, 2, 2, 2, 2, 2 },
+        .role  = { D, H, T, T, T, T, F, M },
+    },
+    [SOCKET_PROFILE_HTTP] = {
+        .name  = "http",
+        .tx_kb = { 1, 8, 1, 1, 1, 1, 2, 1 },
+        .rx_kb = { 1, 4, 2, 2, 2, 2, 2, 1 },
+        .role  = { D, H, T, T, T, T, F, M },
+    },
+    [SOCKET_PROFILE_CLIENTS] = {
+        .name  = "clients",
+        .tx_kb = { 1, 4, 2, 2, 2, 2, 2, 1 },
+        .rx_kb = { 1, 4, 2, 2, 2, 2, 2, 1 },
+        .role  = { D, H, T, T, T, T, T, M },
+    },
+};
+
+#undef D
+#undef H
+#undef T
+#undef F
+#undef M
+
+static uint8_t pool_profile = SOCKET_PROFILE_BALANCED;
+static uint8_t pool_role[SOCKET_POOL_SIZE];
+static uint8_t pool_dynamic = 0;   // acquire로 할당된 소켓 비트
+
+void socket_pool_init(uint8_t profile) {
+    if (profile >= SOCKET_PROFILE_COUNT) {
+        profile = SOCKET_PROFILE_BALANCED;
+    }
+    pool_profile = profile;
+    memcpy(pool_role, socket_profiles[profile].role, sizeof(pool_role));
+    pool_dynamic = 0;
+    DBG_WIZNET_PRINT("Socket profile: %s\n", socket_profiles[profile].name);
+}
+
+uint8_t socket_pool_get_profile(void) {
+    return pool_profile;
+}
+
+void socket_pool_get_buffer_sizes(uint8_t tx_kb[SOCKET_POOL_SIZE], uint8_t rx_kb[SOCKET_POOL_SIZE]) {
+    memcpy(tx_kb, socket_profiles[pool_profile].tx_kb, SOCKET_POOL_SIZE);
+    memcpy(rx_kb, socket_profiles[pool_profile].rx_kb, SOCKET_POOL_SIZE);
+}
+
+int8_t socket_pool_acquire(socket_role_t role) {
+    for (uint8_t sn = 0; sn < SOCKET_POOL_SIZE; sn++) {
+        if (pool_role[sn] == SOCKET_ROLE_FREE && socket_profiles[pool_profile].tx_kb[sn] > 0) {
+            pool_role[sn] = (uint8_t)role;
+            pool_dynamic |= (uint8_t)(1u << sn);
+            DBG_WIZNET_PRINT("Socket %d acquired as %s\n", sn, socket_pool_role_name(role));
+            return (int8_t)sn;
+        }
+    }
+    return -1;
+}
+
+void socket_pool_release(uint8_t sn) {
+    if (sn >= SOCKET_POOL_SIZE || !(pool_dynamic & (1u << sn))) {
+        return;
+    }
+    DBG_WIZNET_PRINT("Socket %d released (%s)\n", sn, socket_pool_role_name((socket_role_t)pool_role[sn]));
+    pool_role[sn] = SOCKET_ROLE_FREE;
+    pool_dynamic &= (uint8_t)~(1u << sn);
+}
+
+uint8_t socket_pool_list(socket_role_t role, uint8_t *sockets, uint8_t max) {
+    uint8_t count = 0;
+    for (uint8_t sn = 0; sn < SOCKET_POOL_SIZE && count < max; sn++) {
+        if (pool_role[sn] == role) {
+            sockets[count++] = sn;
+        }
+    }
+    return count;
+}
+
+socket_role_t socket_pool_get_role(uint8_t sn) {
+    return sn < SOCKET_POOL_SIZE ? (socket_role_t)pool_role[sn] : SOCKET_ROLE_FREE;
+}
+
+bool socket_pool_is_dynamic(uint8_t sn) {
+    return sn < SOCKET_POOL_SIZE && (pool_dynamic & (1u << sn)) != 0;
+}
+
+const char *socket_pool_profile_name(uint8_t profile) {
+    return profile < SOCKET_PROFILE_COUNT ? socket_profiles[profile].name : "unknown";
+}
+
+bool socket_pool_parse_profile(const char *name, uint8_t *profile) {
+    for (uint8_t i = 0; i < SOCKET_PROFILE_COUNT; i++) {
+        if (strcasecmp(name, socket_profiles[i].name) == 0) {
+            *profile = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+const char *socket_pool_role_name(socket_role_t role) {
+    switch (role) {
+        case SOCKET_ROLE_DHCP:      return "dhcp";
+        case SOCKET_ROLE_HTTP:      return "http";
+        case SOCKET_ROLE_TCP:       return "tcp";
+        case SOCKET_ROLE_MULTICAST: return "multicast";
+        default:                    return "free";
+    }
+}
@@ -0,0 +1,52 @@
+#ifndef SOCKET_POOL_H
+#define SOCKET_POOL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// W5500 소켓 관리자
+// 소켓 0(DHCP), 1(HTTP), 7(UDP 멀티캐스트)은 모든 프로파일에서 고정,
+// 2-6번은 프로파일에 따라 TCP 명령어 소켓 또는 빈 소켓(요청 시 역할별로 할당)으로 사용.
+// 빈 소켓은 대기 소켓이 모두 연결 중일 때 TCP 명령어 서버나 HTTP 서버가 추가 연결용으로 받아 감.
+// 소켓 버퍼(TX 16KB + RX 16KB)는 프로파일에 따라 나눔 (W5500 초기화 시 적용)
+#define SOCKET_POOL_SIZE        8
+#define SOCKET_POOL_DHCP        0
+#define SOCKET_POOL_HTTP        1
+#define SOCKET_POOL_MULTICAST   7
+
+typedef enum {
+    SOCKET_ROLE_FREE = 0,       // 사용 가능 (socket_pool_acquire로 할당)
+    SOCKET_ROLE_DHCP,
+    SOCKET_ROLE_HTTP,
+    SOCKET_ROLE_TCP,            // TCP 명령어 서버
+    SOCKET_ROLE_MULTICAST
+} socket_role_t;
+
+typedef enum {
+    SOCKET_PROFILE_BALANCED = 0,  // 모든 소켓 2KB, TCP 명령어 4개 + 빈 소켓 1개 (기존 배치)
+    SOCKET_PROFILE_HTTP,          // HTTP TX 8KB/RX 4KB (웹 UI, 기록 다운로드 스트리밍), TCP 명령어 TX 1KB
+    SOCKET_PROFILE_CLIENTS,       // TCP 명령어 5개 + HTTP 각 2KB 이상 (컨트롤러가 많은 설치 환경)
+    SOCKET_PROFILE_COUNT
+} socket_profile_t;
+
+// 프로파일 적용 (W5500 초기화 전에 호출, 요청 시 할당 상태는 초기화됨)
+void socket_pool_init(uint8_t profile);
+uint8_t socket_pool_get_profile(void);
+
+// 현재 프로파일의 소켓별 버퍼 크기 (KB, wizchip_init 인자)
+void socket_pool_get_buffer_sizes(uint8_t tx_kb[SOCKET_POOL_SIZE], uint8_t rx_kb[SOCKET_POOL_SIZE]);
+
+// 빈 소켓을 역할에 할당 (없으면 -1), 사용 후 release로 반환
+int8_t socket_pool_acquire(socket_role_t role);
+void socket_pool_release(uint8_t sn);
+
+// 해당 역할의 소켓 목록 (반환값: 개수)
+uint8_t socket_pool_list(socket_role_t role, uint8_t *sockets, uint8_t max);
+socket_role_t socket_pool_get_role(uint8_t sn);
+bool socket_pool_is_dynamic(uint8_t sn);   // acquire로 할당된 소켓인지
+
+const char *socket_pool_profile_name(uint8_t profile);
+bool socket_pool_parse_profile(const char *name, uint8_t *profile);
+const char *socket_pool_role_name(socket_role_t role);
+
+#endif // SOCKET_POOL_H
@@ -1,680 +1,4028 @@
 #include "static_files.h"
 
-// Original size: 42906 bytes, Compressed size: 7922 bytes (ratio: 5.42x)
-const uint8_t index_html_data[] = {
-    0x1F, 0x8B, 0x08, 0x00, 0x3D, 0xF3, 0x5E, 0x69, 0x02, 0xFF, 0xED, 0x3D,
-    0x6B, 0x77, 0xDB, 0xC6, 0x95, 0xDF, 0x7B, 0x4E, 0xFF, 0xC3, 0x44, 0x4E,
-    0x0E, 0xC9, 0x2D, 0x01, 0xE1, 0xFD, 0x50, 0x24, 0xB7, 0xB6, 0xEC, 0x24,
-    0xDE, 0xE3, 0xD7, 0xB1, 0xD5, 0x3D, 0xAD, 0x93, 0xAC, 0x17, 0x24, 0x20,
-    0x12, 0x35, 0x08, 0x50, 0x00, 0x28, 0x59, 0x75, 0xFC, 0xDF, 0xF7, 0xDE,
-    0x19, 0x00, 0xC4, 0x00, 0x03, 0x10, 0x94, 0xE4, 0xC6, 0x75, 0x6D, 0x8B,
-    0x12, 0x39, 0x98, 0xB9, 0x73, 0xDF, 0x8F, 0xC1, 0x60, 0x78, 0xFC, 0x8D,
-    0x24, 0x91, 0xBF, 0x9C, 0x27, 0xE9, 0xCA, 0xCB, 0x89, 0x24, 0xDD, 0xFF,
-    0xE3, 0x1F, 0xFE, 0xF8, 0x87, 0xE3, 0x6F, 0x1E, 0xBD, 0x38, 0x3D, 0xFB,
-    0xFB, 0xCB, 0xC7, 0x64, 0x99, 0xAF, 0x22, 0x68, 0x3A, 0xC6, 0xBF, 0x24,
-    0xF2, 0xE2, 0xC5, 0xC9, 0x41, 0x10, 0x1F, 0x40, 0x0B, 0x21, 0xC7, 0xCB,
-    0xC0, 0xF3, 0xE9, 0x3B, 0x78, 0xBF, 0x0A, 0x72, 0x8F, 0xCC, 0x97, 0x5E,
-    0x9A, 0x05, 0xF9, 0xC9, 0xC1, 0x5F, 0xCF, 0x7E, 0x90, 0x9C, 0x03, 0x72,
-    0x58, 0xBF, 0xCA, 0xDE, 0x12, 0x12, 0x7B, 0xAB, 0xE0, 0xE4, 0xE0, 0x32,
-    0x0C, 0xAE, 0xD6, 0x49, 0x9A, 0x1F, 0x94, 0xCD, 0xF3, 0x24, 0xCE, 0x83,
-    0x18, 0xC6, 0x5E, 0x85, 0x7E, 0xBE, 0x3C, 0xF1, 0x83, 0xCB, 0x70, 0x1E,
-    0x48, 0xF4, 0xC3, 0x94, 0x84, 0x71, 0x98, 0x87, 0x5E, 0x24, 0x65, 0x73,
-    0x2F, 0x0A, 0x4E, 0x54, 0x59, 0xA9, 0xC1, 0xCE, 0xC3, 0x3C, 0x0A, 0xEE,
-    0xBF, 0x0C, 0xE7, 0x09, 0x39, 0x05, 0x18, 0x69, 0x12, 0x1D, 0x1F, 0xB2,
-    0xB6, 0xA2, 0x43, 0x96, 0x5F, 0x57, 0x1F, 0x08, 0x39, 0x4A, 0x93, 0x24,
-    0x27, 0x1F, 0xCA, 0x8F, 0x04, 0x48, 0x5E, 0xA7, 0xE1, 0xCA, 0x4B, 0xAF,
-    0x8F, 0xC8, 0x3D, 0xD5, 0xB5, 0x2D, 0x5F, 0xFB, 0xBE, 0x7E, 0x31, 0x0B,
-    0x00, 0x33, 0x9F, 0x5D, 0xD6, 0x2C, 0xCF, 0x72, 0x3D, 0xEE, 0xF2, 0x3A,
-    0xC9, 0x00, 0xB5, 0xCB, 0x00, 0xAF, 0xAA, 0x33, 0xCF, 0x30, 0xB9, 0xAB,
-    0x71, 0xB0, 0xF0, 0x8A, 0xAB, 0x73, 0x55, 0x51, 0x54, 0xFE, 0xEA, 0x6C,
-    0x21, 0x2D, 0xD2, 0x00, 0x01, 0x9F, 0x9B, 0xF8, 0x9F, 0xBF, 0x98, 0xA4,
-    0x7E, 0x90, 0x4A, 0xF3, 0x24, 0x4A, 0x52, 0xE8, 0x11, 0x28, 0xF8, 0x9F,
-    0xEB, 0xE1, 0xA7, 0xDE, 0x15, 0xF4, 0xA0, 0x2C, 0x3A, 0x22, 0x9A, 0xA9,
-    0xAC, 0xDF, 0x73, 0xD7, 0x51, 0x3C, 0x70, 0x7D, 0x19, 0x84, 0x8B, 0x65,
-    0x7E, 0x44, 0xB8, 0xEB, 0x1F, 0xCB, 0x37, 0xFF, 0x55, 0x67, 0xC5, 0x2C,
-    0x79, 0x2F, 0x65, 0xE1, 0x3F, 0xC3, 0x78, 0x71, 0x44, 0x8A, 0xF9, 0xA1,
-    0xA9, 0x06, 0x14, 0xD8, 0xB4, 0x08, 0xE3, 0x23, 0x52, 0x47, 0x64, 0xED,
-    0xF9, 0x3E, 0x1D, 0xA1, 0xB4, 0xA1, 0xCF, 0x12, 0xFF, 0xBA, 0x3E, 0xC1,
-    0x39, 0x08, 0x48, 0x3A, 0xF7, 0x56, 0x61, 0x04, 0x54, 0x3F, 0x48, 0x41,
-    0xA4, 0x53, 0x92, 0x79, 0x71, 0x06, 0x5C, 0x4E, 0xC3, 0xF3, 0x1A, 0xD0,
-    0x99, 0x37, 0x7F, 0xB7, 0x48, 0x93, 0x4D, 0xEC, 0x97, 0x1C, 0xB8, 0xF4,
-    0xD2, 0x71, 0xC5, 0xB2, 0x49, 0xAD, 0x6B, 0xC9, 0x21, 0x5D, 0xD7, 0x6B,
-    0xAD, 0x25, 0xD5, 0xC0, 0xF5, 0xCB, 0x65, 0xAD, 0xDD, 0x0F, 0xB3, 0x75,
-    0xE4, 0xC1, 0xEC, 0xE7, 0x51, 0x50, 0xA7, 0x0C, 0x3F, 0x4A, 0x7E, 0x98,
-    0x06, 0xF3, 0x3C, 0x4C, 0x80, 0x42, 0x80, 0xBA, 0x59, 0xC5, 0xB5, 0x0E,
-    0xC9, 0x65, 0x90, 0x9E, 0x47, 0xC9, 0xD5, 0x11, 0x59, 0x86, 0xBE, 0x1F,
-    0xD4, 0x2F, 0x51, 0xAA, 0x80, 0x6F, 0x20, 0x66, 0x45, 0x76, 0xD2, 0x60,
-    0xD5, 0x66, 0x84, 0x0C, 0x73, 0x26, 0x1B, 0x4E, 0xEF, 0xFA, 0x30, 0x01,
-    0xBC, 0x05, 0xB4, 0x80, 0xF2, 0xCF, 0xC7, 0x94, 0x20, 0x22, 0x15, 0xFC,
-    0xE0, 0x64, 0x3C, 0x99, 0xB4, 0x27, 0x66, 0x1D, 0xEA, 0xF3, 0x96, 0xD0,
-    0x44, 0x00, 0x06, 0x48, 0xA0, 0x30, 0x16, 0x91, 0x04, 0xCE, 0xCF, 0xCF,
-    0x07, 0x70, 0xDA, 0x8B, 0xC2, 0x45, 0x2C, 0x85, 0x79, 0xB0, 0xCA, 0x80,
-    0x24, 0x30, 0xF9, 0x20, 0x15, 0x6A, 0x13, 0x51, 0x2D, 0x4E, 0xA1, 0xA9,
-    0x72, 0x2E, 0x3D, 0x1F, 0x45, 0xA0, 0x10, 0x6D, 0xFD, 0x9E, 0x18, 0xF0,
-    0x92, 0x54, 0xF8, 0x95, 0x2E, 0x66, 0xDE, 0x58, 0x99, 0x92, 0xE2, 0x47,
-    0xD6, 0xEA, 0xD8, 0xFD, 0x53, 0x0A, 0x63, 0x9F, 0xB2, 0x54, 0xA0, 0xA0,
-    0x72, 0x41, 0xFF, 0x2C, 0x8F, 0x39, 0x43, 0xA8, 0x88, 0x3F, 0x22, 0x71,
-    0x12, 0x07, 0x1C, 0x1A, 0x68, 0x17, 0xAD, 0xE6, 0xF9, 0x26, 0xCD, 0x90,
-    0x09, 0xEB, 0x24, 0xEC, 0xA2, 0xC8, 0x69, 0x90, 0x43, 0xED, 0x2B, 0xF5,
-    0xFC, 0x70, 0x93, 0xA1, 0x75, 0x7E, 0xD7, 0xB2, 0x33, 0x29, 0x2D, 0x74,
-    0x98, 0x67, 0xC4, 0xCD, 0x18, 0xFB, 0x8F, 0x4D, 0x96, 0x87, 0xE7, 0xD7,
-    0x52, 0xE1, 0x67, 0x5B, 0x3D, 0x44, 0x2C, 0x39, 0x5A, 0xA2, 0xD6, 0x8B,
-    0x19, 0x53, 0x6A, 0x45, 0x93, 0xF7, 0x8A, 0x39, 0xE9, 0x86, 0x49, 0xFD,
-    0x72, 0xCB, 0x21, 0x30, 0xD3, 0x51, 0x65, 0xB3, 0x6E, 0x3A, 0xC5, 0xB5,
-    0xAB, 0x42, 0x5B, 0x67, 0x49, 0xE4, 0xF7, 0x18, 0x49, 0x6B, 0xA6, 0x95,
-    0x37, 0xEF, 0x98, 0x47, 0x91, 0x6D, 0x7E, 0x1E, 0x91, 0xFA, 0x56, 0xF0,
-    0xBC, 0x2C, 0xF4, 0x39, 0x8C, 0x0B, 0x77, 0xCB, 0x8C, 0xA1, 0xEE, 0x82,
-    0xFB, 0x8D, 0xA7, 0x61, 0x1C, 0xA5, 0xF4, 0x0B, 0x01, 0x83, 0x0E, 0x67,
-    0x49, 0x14, 0xFA, 0xA5, 0x97, 0xAB, 0xF9, 0xFE, 0x3A, 0xD8, 0x3C, 0x05,
-    0x5F, 0x19, 0x32, 0x07, 0x45, 0xDF, 0x63, 0xD4, 0x06, 0x82, 0xF4, 0x8C,
-    0x04, 0x5E, 0x56, 0x57, 0x47, 0x16, 0x96, 0xB0, 0x5F, 0x1A, 0x44, 0x34,
-    0x04, 0x89, 0x7D, 0xE3, 0x77, 0x22, 0x43, 0x31, 0x05, 0x6C, 0x8D, 0xBD,
-    0x4B, 0x29, 0x0A, 0x33, 0xCE, 0x83, 0xE1, 0x67, 0x89, 0x46, 0xD7, 0x96,
-    0x39, 0xD4, 0x95, 0x5E, 0x14, 0x18, 0x28, 0x3C, 0x54, 0xD5, 0x3A, 0xBC,
-    0x6A, 0x90, 0x8A, 0xD6, 0x7D, 0x27, 0x5A, 0xDF, 0x6D, 0x96, 0x75, 0x5E,
-    0x36, 0xC5, 0x85, 0x2E, 0x24, 0xDB, 0x11, 0x62, 0xDA, 0xA4, 0xDC, 0x9D,
-    0xB5, 0x94, 0x10, 0x65, 0x6F, 0x8E, 0xA2, 0xAB, 0x83, 0xDC, 0xE5, 0x8B,
-    0x3B, 0xA6, 0xD4, 0xCC, 0x29, 0x51, 0x55, 0x67, 0x4A, 0x34, 0x95, 0xCE,
-    0xAB, 0x76, 0x4E, 0x0B, 0xFE, 0xA1, 0x3E, 0x5F, 0xAF, 0x27, 0x2A, 0x53,
-    0x0F, 0x83, 0x6B, 0x2D, 0xD5, 0xAB, 0xD1, 0x7C, 0x1E, 0x46, 0xD1, 0x11,
-    0x0A, 0x24, 0x05, 0x21, 0x9D, 0x22, 0x6E, 0xDF, 0x0F, 0x25, 0xAB, 0xA1,
-    0x86, 0xDE, 0x2C, 0x88, 0x86, 0x46, 0xD2, 0x9E, 0x98, 0x2E, 0x80, 0x0A,
-    0x6E, 0x23, 0x8C, 0x3B, 0xFD, 0x86, 0xDB, 0xE3, 0x9F, 0x4C, 0x45, 0xE9,
-    0x05, 0x9C, 0x6D, 0x66, 0xDD, 0xFE, 0xC8, 0x14, 0x3B, 0x24, 0xDB, 0xC4,
-    0xFF, 0x6D, 0xB0, 0x2D, 0x24, 0x5B, 0x19, 0x43, 0x65, 0x49, 0x0D, 0x19,
-    0x94, 0x49, 0x8C, 0x04, 0xCC, 0xF2, 0x36, 0x79, 0x22, 0x40, 0x79, 0xED,
-    0x2D, 0x82, 0xC1, 0xCC, 0xBD, 0x4A, 0xBD, 0xF5, 0x11, 0xC1, 0xDF, 0xB5,
-    0x2B, 0x0B, 0x6C, 0x6B, 0x4C, 0xCC, 0x59, 0x29, 0x1D, 0x9A, 0xE5, 0x5E,
-    0x9A, 0x0B, 0xE6, 0x9F, 0x7B, 0xA9, 0xDF, 0x15, 0x8A, 0x3B, 0x9C, 0x68,
-    0x11, 0x42, 0x9D, 0x9E, 0x74, 0x01, 0x3D, 0xAC, 0xB9, 0x2B, 0x53, 0x28,
-    0x74, 0x7D, 0x96, 0xE4, 0x79, 0xB2, 0x6A, 0x91, 0xB0, 0xF2, 0xDE, 0x97,
-    0xB9, 0xB6, 0xA1, 0xF0, 0xB9, 0x76, 0x21, 0x00, 0xF8, 0xDF, 0xBC, 0xD2,
-    0x99, 0x35, 0xF2, 0x04, 0x4B, 0xED, 0x34, 0x6D, 0xEB, 0x0C, 0xEF, 0xC2,
-    0x0F, 0x56, 0xD9, 0x3C, 0x23, 0x6D, 0x1B, 0x70, 0xEE, 0x05, 0xE7, 0xF8,
-    0xBF, 0x29, 0xBE, 0x66, 0xEE, 0x25, 0x88, 0x67, 0x1A, 0xFE, 0xEF, 0xA2,
-    0xA7, 0x37, 0xD0, 0x0F, 0x34, 0xA3, 0x9B, 0xD2, 0x4A, 0x09, 0x70, 0x44,
-    0xC5, 0x0E, 0xC3, 0xAD, 0x59, 0x94, 0x70, 0x9C, 0x66, 0xBF, 0x7A, 0x46,
-    0x7B, 0xD4, 0x99, 0x64, 0x42, 0x00, 0x4E, 0x39, 0x7E, 0xA0, 0xCC, 0x5A,
-    0x39, 0x19, 0xB5, 0x8C, 0x20, 0xF6, 0x87, 0x51, 0x83, 0xD1, 0x5F, 0x42,
-    0xB1, 0xAC, 0x05, 0x1E, 0xBB, 0x14, 0x75, 0xCF, 0xD0, 0x34, 0xB9, 0x1A,
-    0x62, 0xE9, 0x7B, 0xE6, 0x95, 0xD9, 0xDA, 0x83, 0xC2, 0x7D, 0x16, 0xE4,
-    0x57, 0x01, 0x57, 0x25, 0x0D, 0xC1, 0xAB, 0xDB, 0xB5, 0xCF, 0xA2, 0x64,
-    0xFE, 0x6E, 0x18, 0xB4, 0xDD, 0x41, 0x72, 0x40, 0xC1, 0x16, 0xC6, 0xEB,
-    0x4D, 0xFE, 0x73, 0x7E, 0xBD, 0x0E, 0x4E, 0x46, 0x79, 0xF0, 0x3E, 0x1F,
-    0xFD, 0x3A, 0x15, 0x5D, 0x8A, 0x37, 0xAB, 0x59, 0x90, 0xD6, 0x2E, 0x66,
-    0x41, 0x04, 0xE1, 0x46, 0x90, 0x30, 0x36, 0x92, 0x2D, 0x5E, 0x67, 0x14,
-    0x41, 0x69, 0xC0, 0x59, 0xE9, 0x7C, 0x3E, 0xEF, 0x76, 0x7C, 0x8D, 0x38,
-    0xDB, 0x13, 0xB2, 0x78, 0x67, 0xCA, 0x5B, 0x70, 0x23, 0x25, 0xAA, 0xA5,
-    0xA0, 0x7C, 0x3A, 0xC4, 0xB3, 0xE8, 0xE8, 0x3C, 0x99, 0x6F, 0xB2, 0x06,
-    0xF9, 0xAC, 0xB1, 0xCE, 0x04, 0xA8, 0x7D, 0xA3, 0x30, 0x0E, 0x3A, 0xAA,
-    0x29, 0x69, 0x78, 0x56, 0xD3, 0x95, 0xA7, 0x33, 0x64, 0x40, 0x5D, 0xBC,
-    0x59, 0x14, 0xF8, 0x82, 0x8C, 0xE9, 0x9E, 0xEB, 0xBA, 0x5D, 0x10, 0x1B,
-    0x8B, 0x2B, 0x5B, 0x33, 0xC9, 0x93, 0xC5, 0x22, 0x0A, 0xA4, 0xEC, 0x2A,
-    0xCC, 0xE7, 0x4B, 0xCE, 0xE4, 0xFB, 0xF2, 0xEB, 0x4A, 0x69, 0xC3, 0x18,
-    0x89, 0x96, 0x9A, 0xBA, 0x5B, 0x45, 0x11, 0x71, 0xDA, 0xA4, 0x09, 0x2D,
-    0x96, 0x47, 0x85, 0x92, 0xCB, 0x31, 0x18, 0xAC, 0x2E, 0xCC, 0xAF, 0xF9,
-    0xA5, 0x99, 0x62, 0x22, 0x45, 0x30, 0x8B, 0x88, 0xDA, 0x0C, 0x54, 0xAD,
-    0x11, 0x84, 0x2A, 0x32, 0xBD, 0x19, 0x68, 0xE2, 0x26, 0x1F, 0x56, 0xF2,
-    0xE6, 0xC9, 0x9A, 0x9F, 0x35, 0x0A, 0xCE, 0x73, 0xBE, 0x25, 0x6D, 0xA2,
-    0x81, 0xBA, 0xC0, 0x6C, 0x59, 0xE9, 0x0F, 0x3C, 0xBC, 0x29, 0xD4, 0x75,
-    0x56, 0x91, 0x8D, 0xAC, 0xDB, 0x4A, 0x74, 0x43, 0xC8, 0x57, 0x46, 0xF4,
-    0xD1, 0x2C, 0x00, 0x97, 0x18, 0x0C, 0xA7, 0xBD, 0xF4, 0x76, 0xA3, 0x91,
-    0xA8, 0xB0, 0x12, 0xA6, 0xC9, 0x8D, 0x56, 0xC6, 0x13, 0xBD, 0x61, 0xF9,
-    0x8C, 0x05, 0xFA, 0x8E, 0xE8, 0x7B, 0xB5, 0x0C, 0x39, 0x74, 0x86, 0x73,
-    0xA1, 0xBE, 0xCE, 0xD0, 0x30, 0x9E, 0xF9, 0x32, 0x98, 0xBF, 0x03, 0xDB,
-    0xF9, 0x93, 0x48, 0x13, 0x06, 0x2F, 0x07, 0xED, 0x02, 0x2A, 0xE0, 0x74,
-    0x55, 0xCA, 0x16, 0x55, 0x2D, 0x18, 0x54, 0xF0, 0xB7, 0xB1, 0x0A, 0x9E,
-    0x51, 0x54, 0x02, 0x34, 0x97, 0x6A, 0xC4, 0xEB, 0x31, 0xBD, 0x2E, 0xB2,
-    0x15, 0xB0, 0xBF, 0xBF, 0x65, 0xC6, 0x7F, 0x57, 0x85, 0x66, 0xD3, 0x73,
-    0xDC, 0xE9, 0x0A, 0x4F, 0x6F, 0x2E, 0x01, 0x5C, 0x2D, 0x65, 0x79, 0x23,
-    0xB1, 0x77, 0xAD, 0x02, 0xB6, 0xD3, 0x70, 0x5D, 0x90, 0x86, 0xAB, 0xE6,
-    0xA4, 0x1F, 0xA7, 0x21, 0xB5, 0xF5, 0x3D, 0xD5, 0xB4, 0xCC, 0xB9, 0xD2,
-    0xBB, 0x64, 0x68, 0xF5, 0xD7, 0x00, 0xFC, 0xDC, 0xC1, 0xFB, 0xB5, 0x17,
-    0xFB, 0x82, 0x58, 0xDE, 0xE1, 0xB9, 0x1B, 0xCD, 0x82, 0x85, 0xF1, 0x1D,
-    0xCB, 0x7E, 0x3D, 0x6B, 0xCC, 0xD4, 0xE2, 0x25, 0x9A, 0x5B, 0xA1, 0xAE,
-    0x73, 0x25, 0x97, 0x10, 0x6B, 0xFA, 0x1E, 0x33, 0x17, 0x3E, 0x37, 0xAC,
-    0x6A, 0x98, 0x3A, 0x52, 0xC2, 0xE0, 0xD1, 0x83, 0x4C, 0x5D, 0xA5, 0xBD,
-    0x28, 0x12, 0xAC, 0x40, 0x89, 0x50, 0x6A, 0xCB, 0xB0, 0x40, 0x85, 0xAB,
-    0x44, 0xF9, 0x25, 0x60, 0x5C, 0xE2, 0x55, 0xC4, 0xF9, 0x51, 0xC5, 0x43,
-    0x8D, 0xBF, 0x4A, 0x95, 0xDC, 0xEA, 0x54, 0x72, 0x0E, 0x97, 0x5D, 0x4C,
-    0x52, 0x9B, 0xE5, 0x5C, 0xC9, 0x28, 0xB5, 0x03, 0xFA, 0x39, 0xF8, 0xAE,
-    0x81, 0x0B, 0xC9, 0x43, 0x97, 0x3C, 0x4A, 0xB0, 0x83, 0x97, 0x97, 0x06,
-    0xAD, 0xF5, 0x34, 0xD7, 0x79, 0xEE, 0x6A, 0x29, 0x87, 0x9F, 0x41, 0xCA,
-    0x56, 0xA2, 0x49, 0x3A, 0x12, 0x1F, 0x45, 0x9C, 0xF8, 0x80, 0x78, 0x44,
-    0xAE, 0x69, 0x28, 0xFF, 0x98, 0xF6, 0x0A, 0x8B, 0x0A, 0x94, 0x08, 0xF9,
-    0x26, 0x5C, 0xE1, 0x8D, 0x48, 0x2F, 0x16, 0xAC, 0x46, 0xDC, 0x03, 0x1A,
-    0xCE, 0x43, 0x28, 0x95, 0x56, 0x89, 0xEF, 0x45, 0x32, 0xFD, 0x2D, 0xCE,
-    0x11, 0xCE, 0xC3, 0xF7, 0x81, 0xBF, 0x5F, 0x0A, 0x24, 0x2E, 0x0C, 0x3A,
-    0x16, 0x67, 0x77, 0x2F, 0x25, 0xEA, 0x66, 0x33, 0x63, 0xF6, 0xD3, 0x64,
-    0x2D, 0x81, 0xAC, 0x72, 0x8C, 0x8F, 0xB3, 0x68, 0x93, 0x8E, 0xF5, 0x7A,
-    0x48, 0xFD, 0x54, 0x77, 0x12, 0x6A, 0x2B, 0xC9, 0x6E, 0x3D, 0xE9, 0xDE,
-    0x8A, 0x84, 0xF2, 0xB1, 0x1C, 0x7F, 0xF7, 0x8B, 0x3D, 0xE8, 0x34, 0x50,
-    0x99, 0xDA, 0x2C, 0x9A, 0x0C, 0x5B, 0xCF, 0x29, 0x9A, 0x5D, 0x4E, 0x02,
-    0x5E, 0x0C, 0x2A, 0xC6, 0x84, 0x4D, 0xF1, 0x7F, 0x8D, 0xE9, 0xCC, 0x93,
-    0xB8, 0xCF, 0xF9, 0xFD, 0xE5, 0x5D, 0x70, 0x7D, 0x9E, 0x7A, 0xAB, 0x20,
-    0xE3, 0x87, 0xD4, 0xD7, 0x45, 0xD2, 0x84, 0x33, 0x91, 0x0E, 0x67, 0x2C,
-    0x4E, 0x92, 0xFE, 0x3E, 0x96, 0x90, 0xCE, 0x3A, 0x55, 0x1F, 0xEB, 0x2A,
-    0xD8, 0x01, 0x58, 0x1D, 0x00, 0x58, 0x11, 0x02, 0x6D, 0x8A, 0xB0, 0x67,
-    0xD9, 0x8A, 0x0A, 0xA0, 0xE1, 0x37, 0x7A, 0x56, 0xA1, 0x82, 0xE0, 0x6E,
-    0xD6, 0x7D, 0x54, 0x71, 0xF5, 0xC4, 0xA1, 0xBB, 0xD4, 0xDB, 0xEB, 0x25,
-    0x3C, 0xBB, 0xB9, 0xDB, 0x52, 0xAA, 0x66, 0xEE, 0xBD, 0xF0, 0xCB, 0xE6,
-    0xEB, 0x5C, 0x69, 0xD2, 0x8C, 0x1E, 0x2C, 0xE9, 0xA8, 0xF5, 0x2E, 0x14,
-    0xCB, 0xA4, 0xC7, 0xB2, 0xAC, 0xBA, 0x97, 0xC1, 0xAC, 0xB1, 0x72, 0x21,
-    0xB2, 0xD9, 0x39, 0x49, 0xDF, 0x32, 0x16, 0x5D, 0xC2, 0x6A, 0x88, 0xEE,
-    0xD6, 0x4B, 0x58, 0x9C, 0x60, 0x2A, 0x55, 0xA0, 0x6E, 0xB2, 0x43, 0x0F,
-    0xB6, 0x28, 0x0F, 0x5C, 0xA8, 0x6A, 0xAE, 0xF7, 0xC3, 0x30, 0x51, 0x5C,
-    0x42, 0xF5, 0x91, 0x98, 0xF6, 0xD4, 0xA1, 0xF6, 0x29, 0xD7, 0x76, 0x74,
-    0x49, 0x6F, 0xB1, 0xBE, 0x55, 0x07, 0x30, 0x70, 0x25, 0x6C, 0x0B, 0x0B,
-    0xF8, 0xD2, 0x08, 0x90, 0xDD, 0x09, 0xFA, 0xBD, 0x28, 0xF1, 0x50, 0x3A,
-    0x12, 0x26, 0x01, 0x40, 0xFC, 0xEF, 0x1D, 0x85, 0x8E, 0xA8, 0xAA, 0x79,
-    0xA9, 0xB4, 0x40, 0x8F, 0x0C, 0xE4, 0x8E, 0xEB, 0x3E, 0x45, 0xD5, 0x4D,
-    0x3F, 0x58, 0x4C, 0xEB, 0x4D, 0xC2, 0xD4, 0xC4, 0x9C, 0x10, 0xE5, 0x3B,
-    0x41, 0x37, 0x15, 0xBA, 0x29, 0xF8, 0xCB, 0xD5, 0x8A, 0x6E, 0x88, 0xC8,
-    0xB6, 0xDF, 0xEE, 0x48, 0xE7, 0xF0, 0x6E, 0xB1, 0xB6, 0x09, 0x60, 0xD0,
-    0x0A, 0xF3, 0xCE, 0xED, 0x20, 0xB7, 0x0D, 0x91, 0xB5, 0x68, 0x52, 0x48,
-    0xF4, 0x07, 0x6F, 0x8F, 0x70, 0xC2, 0x8F, 0xD9, 0x3F, 0x9E, 0xEC, 0x1B,
-    0x26, 0x04, 0x11, 0x20, 0x5B, 0x87, 0x71, 0xDC, 0xB5, 0x5C, 0x24, 0x58,
-    0x15, 0x2B, 0x14, 0xCD, 0x12, 0x27, 0x7F, 0x96, 0x38, 0xF9, 0x2B, 0x26,
-    0x39, 0x2A, 0x56, 0x0D, 0xA6, 0xED, 0x0B, 0xDE, 0x79, 0xC3, 0x8E, 0xC5,
-    0x4B, 0x33, 0xBD, 0xAB, 0x39, 0x43, 0xD6, 0x48, 0x9A, 0xA8, 0x08, 0xF2,
-    0xDA, 0x21, 0xA4, 0xD5, 0x56, 0x77, 0x95, 0xCA, 0xED, 0x15, 0xB6, 0x01,
-    0xC6, 0xB1, 0xFD, 0xD5, 0xC8, 0x56, 0x6A, 0xFA, 0xB2, 0xDE, 0x44, 0x59,
-    0x80, 0xCE, 0x9D, 0xE9, 0x09, 0x68, 0xB6, 0x84, 0x5B, 0x8B, 0x42, 0xC8,
-    0x54, 0xE3, 0xFA, 0xB2, 0xD0, 0xC7, 0x01, 0xCC, 0xBA, 0x2D, 0xE6, 0x34,
-    0x63, 0x58, 0x7B, 0x58, 0x07, 0x08, 0x9D, 0xFB, 0x80, 0xED, 0x0F, 0x1D,
-    0x5D, 0x6A, 0x04, 0x23, 0xFA, 0x44, 0xCD, 0xA0, 0xE0, 0x98, 0x85, 0x73,
-    0xF0, 0xA7, 0xFF, 0x0C, 0x83, 0x74, 0xAC, 0xC8, 0x16, 0xF8, 0x11, 0x09,
-    0x9C, 0x03, 0x65, 0x96, 0x66, 0xA1, 0x6B, 0x81, 0x0F, 0x93, 0x1E, 0x46,
-    0xD4, 0x0C, 0x88, 0xC2, 0xAC, 0x31, 0x42, 0xF9, 0x8E, 0xB7, 0x82, 0x5A,
-    0x56, 0x94, 0x26, 0x39, 0xA4, 0x44, 0x63, 0x05, 0x3C, 0x5A, 0x47, 0xA6,
-    0x85, 0xCE, 0x69, 0xD7, 0x70, 0xDD, 0xEA, 0x04, 0x20, 0xC2, 0x8F, 0x09,
-    0x99, 0x43, 0x70, 0x3A, 0x70, 0x42, 0xBA, 0x49, 0x72, 0xAC, 0x4E, 0xBE,
-    0x1F, 0x6E, 0xD5, 0x04, 0x75, 0x7E, 0x17, 0x40, 0xB9, 0x0B, 0xA4, 0x22,
-    0x9B, 0xBD, 0x64, 0x55, 0xB1, 0x0B, 0x08, 0xCB, 0x1A, 0xB7, 0x97, 0x3B,
-    0x16, 0x34, 0x6F, 0x74, 0xBB, 0x30, 0x0A, 0x72, 0x50, 0x6F, 0xBA, 0x48,
-    0xC2, 0xD6, 0x0F, 0x64, 0x93, 0xBF, 0x09, 0xBD, 0x55, 0x29, 0x2C, 0x2A,
-    0x7F, 0x8C, 0x20, 0xAD, 0xD8, 0xC3, 0x8C, 0x6A, 0xD2, 0xA9, 0x86, 0xEF,
-    0x21, 0x20, 0x2C, 0x63, 0xB7, 0x35, 0x0A, 0x5B, 0xD4, 0xE8, 0xB0, 0x7C,
-    0x73, 0x32, 0x54, 0x48, 0x4D, 0xA0, 0x5A, 0x37, 0x50, 0xA7, 0x5F, 0xF7,
-    0xEE, 0xE5, 0x89, 0x97, 0xE5, 0x34, 0x62, 0x79, 0x61, 0xA7, 0x5F, 0x17,
-    0x26, 0x18, 0x8D, 0x7A, 0x9E, 0xE5, 0x18, 0xFC, 0xCA, 0x96, 0x78, 0x89,
-    0x57, 0x82, 0x4E, 0xC2, 0x28, 0xAD, 0x29, 0x8A, 0xF8, 0x76, 0x8C, 0x97,
-    0x75, 0xD7, 0x8B, 0xFC, 0x06, 0x50, 0xB1, 0x57, 0xE1, 0xB7, 0x18, 0x89,
-    0xCB, 0x13, 0xF1, 0x9A, 0x71, 0xE3, 0x86, 0x63, 0x63, 0x49, 0xEA, 0x36,
-    0x15, 0x8B, 0xD2, 0x53, 0xCA, 0xEA, 0x43, 0xF6, 0x2D, 0xD4, 0xF4, 0xFA,
-    0x7C, 0x9B, 0x44, 0x4C, 0xE9, 0x87, 0x17, 0xA0, 0xD2, 0x34, 0xA5, 0xD0,
-    0x64, 0x3B, 0x03, 0xE3, 0x49, 0xAF, 0xBC, 0xD4, 0xCF, 0xBA, 0x78, 0x2B,
-    0x97, 0xDB, 0x99, 0x07, 0xAD, 0x01, 0x17, 0x7D, 0x27, 0x9D, 0xD0, 0xCA,
-    0xED, 0xCF, 0x43, 0xA0, 0x95, 0x7D, 0x27, 0xBD, 0x86, 0x77, 0xEE, 0x7D,
-    0x21, 0x05, 0x74, 0x83, 0xA6, 0x17, 0xFC, 0xDD, 0xBC, 0x1E, 0xA2, 0xD4,
-    0x3D, 0x71, 0x55, 0xFA, 0xD1, 0x58, 0x05, 0x7E, 0xE8, 0x91, 0x71, 0x6D,
-    0x31, 0xC4, 0xC2, 0xC5, 0x90, 0x09, 0x57, 0x19, 0x35, 0xF7, 0x40, 0x76,
-    0xDA, 0x33, 0xBA, 0xBD, 0x0E, 0x66, 0x36, 0x37, 0x2D, 0x55, 0x16, 0xD5,
-    0x2E, 0x49, 0x9A, 0x68, 0x1E, 0x1F, 0x6E, 0xB7, 0xF0, 0x1F, 0x1F, 0x56,
-    0x4F, 0x1D, 0x1C, 0x63, 0xA1, 0x5C, 0x6E, 0xF2, 0xF7, 0xC3, 0xCB, 0xEA,
-    0xC6, 0x93, 0x7F, 0x72, 0xD0, 0xA8, 0x96, 0xB6, 0x4F, 0x19, 0x44, 0x5E,
-    0x96, 0x9D, 0x1C, 0xB0, 0x35, 0xC1, 0x83, 0xEA, 0xA1, 0x00, 0x1C, 0x5E,
-    0x5E, 0x2B, 0x92, 0xA5, 0x83, 0xFB, 0xC7, 0x87, 0xD0, 0xCA, 0x75, 0xD9,
-    0xA2, 0x58, 0x9F, 0xA3, 0x88, 0x6A, 0x07, 0xDB, 0xAB, 0x14, 0xDD, 0x93,
-    0x83, 0x82, 0x40, 0xEA, 0x23, 0x2D, 0xF4, 0x26, 0xAD, 0xE0, 0xB5, 0xC5,
-    0x80, 0x90, 0xA7, 0x0C, 0x9C, 0x2C, 0xCB, 0xD5, 0x94, 0x35, 0x04, 0xB8,
-    0xF7, 0x88, 0x2D, 0x62, 0xD0, 0x70, 0xD9, 0x3C, 0xCA, 0x4D, 0x96, 0x70,
-    0x4B, 0x99, 0x4D, 0x86, 0xB0, 0x95, 0xCD, 0x3E, 0xB6, 0x70, 0x6B, 0x76,
-    0x75, 0xBC, 0xDB, 0x9D, 0xD8, 0x32, 0x4B, 0xBD, 0x0F, 0x3E, 0x85, 0x71,
-    0xB9, 0x28, 0x7B, 0xD1, 0xB5, 0xE7, 0xFA, 0xB2, 0x2E, 0x20, 0xBE, 0x81,
-    0x6C, 0x67, 0x99, 0x06, 0xE7, 0x27, 0x07, 0xF7, 0xD6, 0xC9, 0x15, 0xA3,
-    0x05, 0xDA, 0xE0, 0x37, 0x0C, 0xE4, 0x21, 0x2D, 0xF5, 0xFB, 0xA7, 0x8C,
-    0x16, 0xF2, 0x2A, 0x98, 0x25, 0x49, 0x0E, 0x3A, 0xA1, 0xD7, 0x11, 0xE2,
-    0xE4, 0x26, 0x42, 0x10, 0x15, 0xA7, 0x81, 0xDE, 0xFA, 0xFE, 0x03, 0xC8,
-    0xE9, 0xAF, 0x93, 0x0D, 0xC9, 0x36, 0xC5, 0x9B, 0x2B, 0x2F, 0xCE, 0xD1,
-    0xAE, 0x52, 0x3A, 0x09, 0xC9, 0x97, 0x01, 0xC9, 0xAE, 0x33, 0x70, 0xE5,
-    0x7F, 0x3E, 0x3E, 0x5C, 0xEF, 0x35, 0x5F, 0xB1, 0xD8, 0xD2, 0x98, 0x72,
-    0xB6, 0x81, 0x50, 0x12, 0xD7, 0x9B, 0x98, 0xA0, 0x0A, 0x4E, 0x7B, 0xF1,
-    0x3C, 0x88, 0x0E, 0xF8, 0xCB, 0x05, 0x54, 0xBC, 0x05, 0x5A, 0xDE, 0x16,
-    0xE0, 0x81, 0x12, 0x72, 0x4A, 0xC7, 0x71, 0x13, 0x1D, 0xB2, 0x99, 0xF6,
-    0x9A, 0x9D, 0x31, 0xB8, 0x7F, 0xFA, 0x4A, 0x7A, 0x7C, 0x2F, 0x26, 0x94,
-    0x1D, 0x18, 0x34, 0x8C, 0xAB, 0x4B, 0xD3, 0x99, 0x2A, 0x6D, 0xFB, 0x31,
-    0x38, 0x95, 0x19, 0x57, 0x3B, 0xD5, 0x39, 0x85, 0x6C, 0xA8, 0x1A, 0xAF,
-    0x5D, 0x51, 0xB2, 0x48, 0x34, 0xB1, 0x76, 0xB5, 0xD0, 0xAC, 0x4B, 0xB2,
-    0xBE, 0x83, 0xFD, 0xE0, 0xFE, 0xB3, 0x27, 0xA7, 0xE4, 0xF4, 0xC5, 0xF3,
-    0xB3, 0x57, 0x2F, 0x9E, 0xF6, 0xB9, 0x09, 0x7E, 0xEC, 0xCA, 0x9B, 0x1F,
-    0xF0, 0x2E, 0xA4, 0x76, 0xA1, 0x46, 0xC0, 0xF3, 0xC3, 0x07, 0x62, 0xC6,
-    0x70, 0xDC, 0xA8, 0x23, 0xC7, 0x9E, 0x2E, 0xA9, 0x19, 0x2E, 0x73, 0xD9,
-    0x38, 0x05, 0xBE, 0x99, 0x79, 0x9C, 0x35, 0x1E, 0x6F, 0xA2, 0x72, 0x60,
-    0xB9, 0xAD, 0xBB, 0xA1, 0x9A, 0x51, 0x28, 0x14, 0x7C, 0xB5, 0x69, 0x9B,
-    0xED, 0x4B, 0x6E, 0x68, 0x87, 0xEF, 0xE5, 0x9E, 0x84, 0xDB, 0x47, 0x61,
-    0xD2, 0xCD, 0x4A, 0xA4, 0x19, 0x75, 0xC9, 0x94, 0x9B, 0x8D, 0x79, 0xE9,
-    0x2C, 0x93, 0x55, 0xD0, 0x6D, 0xFA, 0x3C, 0xD1, 0xD5, 0xE6, 0xDA, 0xE6,
-    0x34, 0x38, 0xD1, 0xDA, 0x8B, 0x5B, 0xFD, 0xE8, 0xEE, 0xDE, 0x83, 0xFB,
-    0x3F, 0xC1, 0x1C, 0x00, 0x1B, 0x7A, 0x0C, 0x1D, 0x97, 0x6D, 0x66, 0x07,
-    0xF7, 0x5F, 0x43, 0x19, 0xB7, 0xC9, 0xC8, 0x6B, 0x46, 0x9A, 0x10, 0x40,
-    0xD3, 0x13, 0x60, 0x4B, 0x14, 0xEE, 0xC5, 0xDA, 0x1E, 0x9E, 0x42, 0x75,
-    0x03, 0xF1, 0x21, 0xDB, 0x9F, 0xA9, 0xDB, 0x91, 0x9F, 0x96, 0xB1, 0xAF,
-    0x8B, 0x79, 0x6E, 0xC2, 0x5C, 0xEA, 0x58, 0x09, 0xF5, 0xEB, 0x8B, 0x4D,
-    0x4A, 0xB3, 0xD9, 0x9B, 0xB1, 0x18, 0x48, 0x8C, 0x6A, 0x16, 0x4D, 0x0D,
-    0x61, 0xFB, 0x19, 0x11, 0x6D, 0xB8, 0xEA, 0x3A, 0x2C, 0x34, 0x18, 0xE4,
-    0xB6, 0x54, 0x2A, 0x70, 0xFD, 0x62, 0x81, 0x39, 0x5E, 0x6F, 0x98, 0x4B,
-    0x8D, 0x77, 0xB8, 0x47, 0xF4, 0xA0, 0x87, 0xB7, 0xB5, 0xDD, 0xBE, 0x22,
-    0xEE, 0x0E, 0x0E, 0x92, 0xBB, 0x0C, 0xA5, 0xC1, 0xEE, 0xED, 0xA6, 0xDC,
-    0x8A, 0xD7, 0x4C, 0x9F, 0x07, 0x32, 0x59, 0x40, 0x44, 0x3B, 0x88, 0x36,
-    0xBB, 0x6D, 0xF7, 0xA7, 0xB6, 0xFB, 0xA1, 0x25, 0xA0, 0xF8, 0xEF, 0x3F,
-    0x0F, 0xF2, 0xAB, 0x24, 0x7D, 0x07, 0x52, 0xA4, 0x1F, 0x05, 0xFD, 0x1A,
-    0x32, 0x6A, 0x24, 0x59, 0xA2, 0x4B, 0x8D, 0x1D, 0x3E, 0xE5, 0xAB, 0x51,
-    0xEE, 0x71, 0x76, 0xD6, 0x51, 0xBF, 0xD5, 0xFF, 0xED, 0x5C, 0x13, 0xAE,
-    0xFF, 0x13, 0xDD, 0xF3, 0xD8, 0xFE, 0x13, 0xF1, 0x83, 0xE7, 0x1D, 0xDE,
-    0xF2, 0xE0, 0xEE, 0x54, 0x34, 0x6E, 0x3C, 0x88, 0x21, 0x14, 0x52, 0xBF,
-    0xFF, 0xEC, 0xC1, 0x29, 0x79, 0xE0, 0xFB, 0x29, 0x64, 0xA6, 0x1D, 0xC6,
-    0x58, 0xF6, 0xCE, 0xD3, 0x24, 0x5E, 0xB0, 0x40, 0xB1, 0x59, 0xB1, 0x40,
-    0xB4, 0x4D, 0x44, 0x31, 0xF1, 0xC6, 0xEB, 0x62, 0x6C, 0x05, 0x4A, 0x72,
-    0xD7, 0x74, 0x3C, 0xFA, 0xE9, 0xF4, 0xE5, 0x5E, 0x04, 0xF8, 0xCB, 0xF9,
-    0xFA, 0xB3, 0xA2, 0xE0, 0xC9, 0xCB, 0x1B, 0x09, 0x22, 0xFC, 0xBC, 0xA8,
-    0x00, 0x23, 0x5D, 0x79, 0xD9, 0xBB, 0x3D, 0x75, 0x29, 0x7B, 0xF7, 0x59,
-    0x11, 0xF1, 0x23, 0xD4, 0xA8, 0x57, 0xDE, 0xF5, 0x5E, 0x44, 0x2C, 0xD8,
-    0x98, 0xCF, 0xCB, 0x28, 0x9E, 0xBF, 0xDE, 0xCF, 0x26, 0xB0, 0xF2, 0xB8,
-    0x25, 0xFE, 0xE2, 0xF6, 0x8E, 0xD6, 0x7D, 0x43, 0xC0, 0x69, 0xB2, 0x5A,
-    0x6D, 0xE2, 0x70, 0x5E, 0x44, 0xFD, 0xAF, 0x81, 0xE0, 0xEE, 0x74, 0xE5,
-    0xEC, 0xF4, 0x25, 0x79, 0x99, 0xA4, 0xF9, 0x5E, 0x0A, 0x93, 0x7F, 0x66,
-    0x3E, 0xF4, 0xA1, 0xB7, 0xF1, 0xC9, 0x2B, 0xB0, 0xC4, 0xBD, 0xA8, 0x98,
-    0xC1, 0xA8, 0xCF, 0x5B, 0xEF, 0x7F, 0x7C, 0xF9, 0xE4, 0xC5, 0xF6, 0xCC,
-    0x8A, 0xAF, 0x6A, 0x7F, 0x87, 0x2E, 0x92, 0x9E, 0x1E, 0x42, 0x9E, 0x3C,
-    0xDA, 0x2F, 0xE8, 0xFA, 0x9F, 0x95, 0xDA, 0x3F, 0x4B, 0xFC, 0xFD, 0x34,
-    0x7E, 0x05, 0x03, 0xFE, 0x85, 0x1A, 0x2F, 0x2A, 0xC5, 0x1A, 0x2B, 0x61,
-    0x82, 0x95, 0x31, 0x71, 0xB9, 0x55, 0x56, 0xA8, 0x1D, 0xF5, 0x56, 0x6B,
-    0x65, 0xF2, 0x5F, 0x59, 0x76, 0x09, 0x78, 0x54, 0x2B, 0xC4, 0x62, 0x56,
-    0xBF, 0x48, 0x31, 0x65, 0x3E, 0x2B, 0xC8, 0xDA, 0xDC, 0xDB, 0xAB, 0x40,
-    0x2B, 0x4A, 0xA2, 0xBD, 0x2B, 0x34, 0x7A, 0x1A, 0x00, 0xF2, 0xB4, 0xC4,
-    0x09, 0x1B, 0xFA, 0x4B, 0xB4, 0x9E, 0x4A, 0x4E, 0xE0, 0xD0, 0x40, 0x9F,
-    0x6F, 0x60, 0xB9, 0x6C, 0x9B, 0x53, 0xB7, 0xAE, 0x5F, 0x2E, 0xC4, 0x57,
-    0x48, 0x5D, 0x26, 0xB8, 0x51, 0x8A, 0x13, 0x4B, 0xD7, 0x98, 0xC2, 0x2D,
-    0xB2, 0x2D, 0xCA, 0xFC, 0xE6, 0xE0, 0x2E, 0x14, 0x78, 0x81, 0x7A, 0x3E,
-    0x5A, 0x69, 0x97, 0x28, 0xFB, 0x04, 0xBA, 0x47, 0xE5, 0xD2, 0xE3, 0x3F,
-    0xD8, 0x33, 0x90, 0x05, 0xE9, 0xDC, 0x53, 0x5F, 0x9D, 0x2C, 0xA4, 0x8F,
-    0xDA, 0x74, 0xD1, 0x46, 0x1F, 0x54, 0x3C, 0xA0, 0xCF, 0xE1, 0xCC, 0x92,
-    0xF7, 0x9D, 0x7C, 0x2B, 0xF4, 0x86, 0x55, 0x50, 0xD5, 0xE9, 0x4A, 0x42,
-    0xE2, 0xAA, 0x3B, 0x25, 0xF4, 0x81, 0x1E, 0xE4, 0x54, 0x0F, 0x9D, 0x9D,
-    0x61, 0xAD, 0xCB, 0xFF, 0x0C, 0x8E, 0xA2, 0x55, 0x1C, 0xAD, 0xD7, 0x58,
-    0x5D, 0xD3, 0xF5, 0x73, 0x89, 0xF1, 0x08, 0xF5, 0xAB, 0x83, 0x3F, 0x25,
-    0x77, 0xA0, 0x2E, 0x13, 0x77, 0x48, 0x83, 0x8B, 0x0D, 0x84, 0x46, 0xBF,
-    0x2B, 0x1C, 0xE3, 0xCE, 0x84, 0xF8, 0xE4, 0xE0, 0x7F, 0xC7, 0x63, 0xCD,
-    0xFC, 0x59, 0x91, 0xCC, 0x5F, 0x7F, 0x1B, 0x6B, 0xF0, 0xD7, 0xF8, 0xF5,
-    0x37, 0xF5, 0x17, 0xFF, 0xB7, 0x9F, 0x55, 0xC9, 0xFD, 0xF5, 0xB7, 0xC9,
-    0x2F, 0xFE, 0xE4, 0x17, 0xF9, 0xCF, 0xBF, 0xCC, 0x26, 0x1F, 0x8C, 0x8F,
-    0xDF, 0x8A, 0x85, 0x70, 0x87, 0x6C, 0xAB, 0x8A, 0xBA, 0x4F, 0xCC, 0x33,
-    0x5A, 0x08, 0x7E, 0x31, 0x5C, 0xAB, 0xAA, 0xC8, 0x4F, 0xCC, 0xB5, 0xB2,
-    0xF2, 0xFC, 0x62, 0x18, 0x47, 0xCB, 0xD6, 0x4F, 0xCC, 0x34, 0x2C, 0x75,
-    0x3F, 0x47, 0x86, 0xED, 0x2E, 0x18, 0xEA, 0x67, 0x0B, 0x08, 0x63, 0xB1,
-    0xE8, 0x7E, 0x5D, 0x9D, 0x3B, 0xD9, 0x66, 0xB6, 0x0A, 0xC5, 0xFC, 0x11,
-    0xDF, 0xB6, 0x23, 0xDB, 0xA7, 0xA1, 0x3A, 0xE4, 0xD6, 0x19, 0x99, 0xEB,
-    0x37, 0xD7, 0xC4, 0x3D, 0xB8, 0x28, 0xCC, 0x36, 0x77, 0x71, 0x4F, 0xFF,
-    0x70, 0x0F, 0xFD, 0x74, 0xC6, 0xB5, 0x5A, 0x54, 0xA6, 0xF1, 0xEB, 0xED,
-    0x3C, 0x4C, 0xE7, 0x51, 0xD0, 0x17, 0x9B, 0xBB, 0x23, 0x33, 0x17, 0xBA,
-    0xCA, 0xE7, 0xBE, 0x0E, 0xEE, 0x3F, 0x58, 0xAF, 0xA3, 0xEE, 0x35, 0x21,
-    0xE1, 0xBD, 0xD3, 0xEE, 0x84, 0x18, 0x4D, 0xA1, 0x37, 0x23, 0xFE, 0x7D,
-    0x6E, 0x16, 0xF0, 0x29, 0xCD, 0x9E, 0xD9, 0x68, 0x63, 0x75, 0x66, 0xEF,
-    0x64, 0x74, 0x0E, 0xE3, 0xEF, 0x3C, 0x13, 0xED, 0x73, 0x37, 0x1D, 0xF5,
-    0x32, 0xD9, 0x95, 0xA0, 0xF6, 0x6A, 0x72, 0xFB, 0xBC, 0x89, 0x7F, 0x9B,
-    0x84, 0x16, 0x48, 0x5C, 0x85, 0xB1, 0x17, 0xDD, 0x36, 0xA5, 0xA5, 0x6B,
-    0x49, 0x2F, 0x5E, 0x9D, 0xDD, 0x2C, 0xAD, 0xDD, 0xE9, 0xDE, 0xD9, 0x51,
-    0x1A, 0x3D, 0x0E, 0x9E, 0x2A, 0x12, 0xAE, 0x4D, 0xDD, 0xC4, 0xC3, 0x03,
-    0x07, 0x4E, 0x0E, 0xD4, 0x8E, 0xA1, 0x2B, 0xEF, 0xFD, 0xC9, 0x81, 0x65,
-    0x9A, 0xBA, 0xF9, 0x09, 0xA3, 0xE0, 0x57, 0xB5, 0xFC, 0x34, 0x6A, 0xF9,
-    0xEA, 0xB5, 0xA6, 0x6B, 0x37, 0xD3, 0xC9, 0xE2, 0xB0, 0x96, 0x4A, 0xB9,
-    0xD8, 0x92, 0x61, 0xC7, 0x64, 0xC9, 0x1A, 0x1D, 0x20, 0x90, 0x1A, 0x6D,
-    0x80, 0x6E, 0xD7, 0xC2, 0xDD, 0x5B, 0xF8, 0xFB, 0xF8, 0x90, 0x5D, 0x19,
-    0x36, 0x4E, 0x75, 0x35, 0x1C, 0x48, 0xFF, 0xEC, 0x37, 0x52, 0x77, 0x0C,
-    0x1C, 0x49, 0xFF, 0xEC, 0x37, 0xD2, 0xB4, 0x29, 0xB2, 0xF4, 0xCF, 0x9E,
-    0xD8, 0xAA, 0x26, 0x43, 0x97, 0xFE, 0xED, 0x1D, 0x0B, 0x12, 0xA0, 0xDC,
-    0xFC, 0x9A, 0x13, 0x7D, 0xCD, 0x89, 0xBE, 0xF8, 0x9C, 0x88, 0xAE, 0xDC,
-    0xF7, 0x6E, 0x77, 0xE9, 0xCF, 0x89, 0x16, 0xEB, 0x30, 0xF9, 0x9A, 0x13,
-    0x7D, 0x01, 0xC1, 0xE7, 0xD1, 0xE3, 0xFF, 0x79, 0x72, 0xFA, 0xB8, 0xFF,
-    0x46, 0xC3, 0x27, 0x4D, 0x8A, 0xA8, 0x26, 0x85, 0xFE, 0x8E, 0x9C, 0xE8,
-    0x6B, 0x56, 0xF3, 0xEF, 0xA6, 0x58, 0xCF, 0x5E, 0x3C, 0x7A, 0x7C, 0xEB,
-    0xA4, 0x86, 0x2A, 0x07, 0xBB, 0x2B, 0x34, 0x28, 0xDC, 0x33, 0xEF, 0x7F,
-    0xF6, 0xF8, 0x6F, 0x67, 0xFB, 0xA5, 0x09, 0xFF, 0xC8, 0x70, 0xCB, 0xE1,
-    0x7F, 0xBF, 0x7E, 0xF1, 0xFC, 0x6E, 0x53, 0x84, 0xAF, 0xBA, 0xF8, 0x59,
-    0xE8, 0xE2, 0x83, 0xBF, 0x9E, 0xBD, 0x20, 0xAF, 0x1E, 0xBF, 0x7E, 0xF9,
-    0xE2, 0xF9, 0xEB, 0x3B, 0x52, 0x4A, 0x3C, 0xF2, 0x67, 0xA8, 0x52, 0xA6,
-    0x1B, 0xD0, 0xDF, 0xC7, 0xCF, 0x1F, 0x3C, 0x7C, 0xFA, 0xF8, 0xD1, 0x7E,
-    0x7A, 0x79, 0xEE, 0x45, 0x19, 0x8C, 0x7D, 0xF4, 0xE4, 0xF5, 0xEE, 0xC1,
-    0x5F, 0xF3, 0xD7, 0xAF, 0xF9, 0xEB, 0xBF, 0x53, 0xFE, 0x3A, 0x64, 0x53,
-    0xF7, 0xEE, 0x4D, 0xC0, 0x0F, 0x98, 0x76, 0x7E, 0xCA, 0x5D, 0xC0, 0x37,
-    0xD9, 0x04, 0x71, 0xE3, 0xFB, 0xC9, 0x4D, 0x06, 0xB6, 0x9C, 0xED, 0x00,
-    0xB5, 0xE4, 0x9E, 0x3F, 0xBA, 0x81, 0x3E, 0xDE, 0x7F, 0xF5, 0xF8, 0xE1,
-    0x8B, 0x17, 0x67, 0x3D, 0xFA, 0xD7, 0x11, 0xEB, 0xBA, 0xDD, 0x01, 0xFA,
-    0x4D, 0x54, 0x6F, 0xF6, 0x28, 0xD2, 0x17, 0xEB, 0x10, 0x6E, 0xCB, 0xF9,
-    0xB6, 0x27, 0x28, 0x1F, 0x10, 0xBB, 0x1B, 0x57, 0xB0, 0xDF, 0x7E, 0x97,
-    0xE3, 0xC3, 0xDA, 0xD3, 0x06, 0xDC, 0x83, 0x3C, 0x35, 0x9E, 0xBF, 0x5F,
-    0x45, 0x31, 0x3E, 0x21, 0x94, 0xE7, 0xEB, 0xA3, 0xC3, 0xC3, 0xAB, 0xAB,
-    0x2B, 0xF9, 0x4A, 0x97, 0x93, 0x74, 0x71, 0x88, 0x8F, 0x40, 0x23, 0xB5,
-    0x15, 0xEF, 0x0B, 0x6E, 0x73, 0x87, 0x97, 0xD5, 0x9E, 0xF8, 0xC9, 0xAE,
-    0x57, 0xB3, 0x24, 0x6A, 0x3E, 0xA1, 0x88, 0xCF, 0x3A, 0x6D, 0xDB, 0xF0,
-    0x4B, 0x97, 0x1E, 0x26, 0xEF, 0x4F, 0x0E, 0xE8, 0xA3, 0xE2, 0x26, 0xFC,
-    0x70, 0x8F, 0x05, 0xAD, 0xBD, 0x7C, 0x59, 0x27, 0x0F, 0x20, 0x3C, 0xB3,
-    0x65, 0x57, 0x33, 0x74, 0x43, 0xD3, 0xEC, 0xA9, 0x2B, 0x9B, 0x8A, 0x6D,
-    0x29, 0xAA, 0x65, 0x93, 0xA7, 0xAA, 0x2E, 0xAB, 0x96, 0x05, 0x3F, 0x53,
-    0xD5, 0x96, 0x55, 0x5B, 0xD5, 0x5D, 0xDD, 0x20, 0x4F, 0xA1, 0x11, 0xDE,
-    0xA9, 0xAA, 0x42, 0x9B, 0x0D, 0xDD, 0x34, 0x6D, 0x47, 0x25, 0x4F, 0xC5,
-    0x30, 0xDE, 0x70, 0x5A, 0x85, 0x3B, 0x95, 0xDE, 0x01, 0x79, 0xF7, 0x14,
-    0xE5, 0xA1, 0x63, 0xB8, 0xDC, 0x35, 0x54, 0x30, 0xF1, 0x95, 0xEA, 0x31,
-    0x54, 0x4C, 0x13, 0x8A, 0xC7, 0x50, 0xC7, 0x8E, 0xAC, 0x58, 0x8E, 0xE5,
-    0xE8, 0x53, 0x02, 0x58, 0x6A, 0xA6, 0x62, 0xBA, 0xEA, 0xA4, 0x3C, 0x85,
-    0xC1, 0x55, 0x64, 0x85, 0xFE, 0x9B, 0x6C, 0x9F, 0x5B, 0x1D, 0x4B, 0xDB,
-    0x11, 0xD2, 0x76, 0x08, 0xEA, 0x21, 0x72, 0x64, 0x17, 0x87, 0x54, 0x00,
-    0x69, 0xC0, 0x68, 0xC3, 0x9D, 0x3A, 0xB2, 0x01, 0xEF, 0x54, 0xCD, 0x76,
-    0xC9, 0x53, 0x4D, 0x91, 0x75, 0x5B, 0x71, 0x0D, 0x5B, 0x9D, 0xAA, 0xD0,
-    0xAE, 0xB9, 0xAA, 0x6D, 0x59, 0xC0, 0x38, 0x45, 0xD6, 0x34, 0x55, 0x35,
-    0x0D, 0x1D, 0x9B, 0x6D, 0x4D, 0x57, 0xA1, 0x07, 0x6D, 0x16, 0x00, 0xE9,
-    0x64, 0x91, 0xAE, 0x59, 0x86, 0x98, 0x45, 0xAD, 0x2B, 0x42, 0x16, 0xA9,
-    0xA6, 0x6C, 0xEA, 0x0E, 0xB0, 0x81, 0xF2, 0x48, 0x75, 0x1C, 0xD5, 0xD0,
-    0x2A, 0x1E, 0x69, 0xB6, 0x90, 0x49, 0xB5, 0x31, 0xD2, 0x76, 0xD0, 0x50,
-    0x2E, 0x69, 0x86, 0x6C, 0x98, 0xB6, 0xA9, 0xEB, 0xEE, 0x54, 0x91, 0x81,
-    0x2F, 0x9A, 0xE3, 0x6A, 0x3A, 0x70, 0xC9, 0x90, 0x6D, 0xC3, 0x32, 0x4C,
-    0xCB, 0x45, 0x76, 0x98, 0x00, 0xD1, 0xB0, 0x4C, 0x68, 0xD6, 0x65, 0x57,
-    0x77, 0x6C, 0xCD, 0x30, 0xB1, 0xD9, 0xD2, 0x5C, 0x4B, 0xB7, 0x1C, 0xDA,
-    0x6C, 0x1B, 0xAE, 0x61, 0x3A, 0xEE, 0x54, 0x93, 0x0D, 0x0B, 0x80, 0x98,
-    0x6E, 0x6F, 0xB3, 0x65, 0xEB, 0x8A, 0xAB, 0xEA, 0xD0, 0x6C, 0x6A, 0x96,
-    0xAE, 0x2A, 0x9A, 0x4D, 0x4E, 0xA1, 0x59, 0x35, 0x55, 0xD7, 0xD4, 0xB1,
-    0xB7, 0x0B, 0x92, 0x30, 0x81, 0xD7, 0xE0, 0xA2, 0x10, 0x2B, 0xE8, 0x62,
-    0x4F, 0x01, 0x25, 0xDD, 0x35, 0x60, 0x46, 0x9B, 0xC0, 0xE4, 0x20, 0x2D,
-    0xC3, 0x72, 0xCC, 0xA9, 0x25, 0x9B, 0xAE, 0xED, 0x98, 0xA6, 0x82, 0xD2,
-    0xB2, 0xB1, 0x8B, 0xE3, 0x2A, 0x2A, 0x34, 0xBB, 0x40, 0x96, 0x0B, 0xEA,
-    0x43, 0x4E, 0x55, 0x4B, 0x76, 0x40, 0xE3, 0x81, 0xB8, 0xA9, 0x2D, 0x83,
-    0x71, 0x98, 0xBA, 0x6A, 0x19, 0x04, 0xF8, 0xE6, 0x3A, 0xA6, 0x66, 0x3B,
-    0x28, 0x5A, 0x0D, 0x44, 0xAC, 0x3A, 0xA6, 0x8E, 0xAD, 0x9A, 0x02, 0x52,
-    0xA6, 0xAD, 0x8E, 0x89, 0xFA, 0x67, 0xE8, 0x00, 0xC2, 0x00, 0x6A, 0x61,
-    0x3A, 0x0D, 0x2C, 0x45, 0x73, 0x74, 0xD3, 0xB1, 0x6C, 0x8B, 0x40, 0xA3,
-    0xE2, 0xBA, 0xC0, 0x70, 0x0B, 0x5A, 0x2D, 0x98, 0x40, 0xB1, 0x15, 0x1B,
-    0x05, 0x67, 0x01, 0x4A, 0xAE, 0x33, 0x45, 0xE5, 0x51, 0x2C, 0xD3, 0xD1,
-    0x1D, 0x6A, 0x98, 0x9A, 0xA9, 0xAA, 0x8E, 0x6B, 0x60, 0xB3, 0xAE, 0x6A,
-    0x2A, 0x8C, 0xEC, 0x6B, 0x56, 0x6C, 0xD5, 0x80, 0xF7, 0xD8, 0x6C, 0x18,
-    0x16, 0x88, 0x02, 0xAC, 0x5B, 0x93, 0x2D, 0x47, 0x03, 0x25, 0xD4, 0xCD,
-    0xA9, 0x0E, 0x42, 0xB7, 0x91, 0xA3, 0x68, 0xF4, 0xB2, 0x66, 0x18, 0x36,
-    0xD8, 0x89, 0x4A, 0xF9, 0x6C, 0x6A, 0x8A, 0xAA, 0x73, 0xAD, 0x54, 0x84,
-    0xBA, 0x6D, 0x28, 0xD0, 0x0C, 0xE0, 0x40, 0xD8, 0x20, 0x08, 0xCD, 0x29,
-    0x64, 0x68, 0xDA, 0xC8, 0x3B, 0xD0, 0x7F, 0xD3, 0x00, 0x3D, 0x77, 0x6D,
-    0x03, 0x34, 0xC1, 0x01, 0xEE, 0xDB, 0x70, 0xC9, 0x21, 0xA7, 0xC0, 0x1C,
-    0xDD, 0x30, 0x74, 0xCD, 0xB6, 0x81, 0xA9, 0x20, 0x6E, 0xD7, 0x30, 0x5C,
-    0x93, 0xA8, 0x1A, 0x38, 0x1A, 0x45, 0x47, 0xD9, 0x52, 0x8E, 0x58, 0xE0,
-    0x68, 0x0C, 0x6C, 0xD5, 0x41, 0x13, 0x2D, 0x1D, 0x1A, 0x01, 0x69, 0xE0,
-    0x22, 0x08, 0xFC, 0x14, 0x5A, 0x81, 0x07, 0xAA, 0x6B, 0xD1, 0xAE, 0x30,
-    0x8B, 0xE3, 0x00, 0xA3, 0x2D, 0xD9, 0xB6, 0x80, 0x76, 0xDB, 0xA2, 0x60,
-    0x5D, 0x53, 0x71, 0x1D, 0x83, 0x74, 0xAB, 0xA3, 0xA0, 0xB9, 0xCB, 0x0C,
-    0xE1, 0x9A, 0xAE, 0x0B, 0xCD, 0x90, 0x5D, 0x69, 0x9A, 0x06, 0x84, 0x21,
-    0xEA, 0xA4, 0xFB, 0x9D, 0x36, 0x7D, 0xB2, 0x4B, 0xE8, 0xB3, 0x25, 0xD7,
-    0x52, 0x48, 0xF1, 0x3A, 0xD8, 0x6D, 0x70, 0x8A, 0x04, 0x31, 0x64, 0xA9,
-    0x6A, 0xCA, 0xA5, 0x04, 0x1F, 0x96, 0xF0, 0xBA, 0xC4, 0xBF, 0xB4, 0x41,
-    0xB7, 0x94, 0xA7, 0x86, 0xA3, 0x48, 0x20, 0x2B, 0x82, 0x3D, 0x4D, 0x4B,
-    0xB9, 0x84, 0xB6, 0x37, 0x2B, 0xC9, 0x51, 0x88, 0x03, 0x1D, 0xE0, 0x62,
-    0xA4, 0x6B, 0x0A, 0x8E, 0x24, 0xF0, 0x17, 0x3B, 0x5D, 0x42, 0xDB, 0x4F,
-    0x66, 0x09, 0x0E, 0x3A, 0x22, 0xB8, 0x9F, 0x54, 0x1C, 0x85, 0x3D, 0x75,
-    0x53, 0x79, 0x53, 0xBF, 0x7D, 0x36, 0x8C, 0x5A, 0x6E, 0xFB, 0xE4, 0x1D,
-    0x50, 0x0D, 0x88, 0x38, 0xCA, 0x85, 0x04, 0x0A, 0xA5, 0x48, 0xAE, 0x2B,
-    0x19, 0x6A, 0x0E, 0x2F, 0x78, 0x77, 0xA1, 0x60, 0x1B, 0x7D, 0x9B, 0xD3,
-    0xF6, 0x0B, 0xD5, 0xC1, 0xF3, 0x35, 0x4C, 0x62, 0xC8, 0x66, 0xAE, 0x6B,
-    0xA8, 0x52, 0x66, 0xA4, 0x9A, 0x3A, 0xF8, 0x39, 0xFD, 0x52, 0x82, 0x18,
-    0x76, 0x21, 0x19, 0x06, 0x38, 0x3A, 0xC9, 0xD6, 0x24, 0x03, 0xC2, 0xD6,
-    0x99, 0x6E, 0x50, 0x76, 0xB5, 0x01, 0xE1, 0x5C, 0xC4, 0x75, 0xA1, 0x2D,
-    0x37, 0x54, 0x82, 0x53, 0x11, 0xC3, 0x91, 0x34, 0x87, 0x38, 0x00, 0xFA,
-    0x0C, 0x18, 0x26, 0x59, 0x8A, 0x75, 0x09, 0x10, 0x01, 0x3C, 0xBA, 0x03,
-    0xFD, 0x42, 0x35, 0x25, 0x87, 0xE8, 0xAA, 0x6C, 0x4A, 0x38, 0xEB, 0x19,
-    0x40, 0x45, 0x81, 0x88, 0x00, 0x99, 0x8E, 0x44, 0xDF, 0xE6, 0x12, 0x6D,
-    0x17, 0x13, 0x06, 0x94, 0xC0, 0x4C, 0x20, 0x80, 0x1C, 0xC1, 0x49, 0xBA,
-    0x46, 0x45, 0x0B, 0xAE, 0x94, 0xE8, 0x86, 0x0E, 0x88, 0xD8, 0x17, 0x0E,
-    0x4C, 0x4B, 0x29, 0x04, 0x59, 0xE6, 0x06, 0xFE, 0x31, 0xDB, 0xC0, 0xDF,
-    0xAC, 0x4C, 0xC6, 0x3D, 0xC8, 0x0C, 0x80, 0x04, 0x04, 0x05, 0x8E, 0xCE,
-    0x3C, 0x03, 0x7F, 0x23, 0x01, 0x5F, 0x61, 0x22, 0x8D, 0xB5, 0x48, 0x46,
-    0x89, 0xB5, 0x86, 0xBC, 0xC6, 0xEE, 0xB4, 0x89, 0xD0, 0xEE, 0x96, 0x53,
-    0x74, 0xC7, 0x0C, 0x03, 0x5B, 0x48, 0xD5, 0x1D, 0x75, 0xE5, 0x19, 0xE2,
-    0x66, 0xB5, 0x67, 0x31, 0x2B, 0xF6, 0x72, 0xB3, 0x60, 0x6F, 0x40, 0xA0,
-    0x35, 0x8B, 0xA1, 0x15, 0xDD, 0xF9, 0x59, 0x0A, 0xE0, 0x6F, 0xA8, 0x22,
-    0xC0, 0x74, 0xCD, 0x59, 0x34, 0x47, 0x48, 0x0B, 0xF6, 0x16, 0xD1, 0x02,
-    0x10, 0x44, 0xB4, 0x14, 0xC0, 0x6F, 0xA0, 0xEE, 0xC5, 0x5D, 0x87, 0xDB,
-    0x2B, 0x3A, 0x12, 0x4A, 0x75, 0x06, 0x53, 0x39, 0x87, 0x0A, 0x5F, 0x07,
-    0xAD, 0x32, 0x51, 0x3D, 0xD1, 0x16, 0xE1, 0x6D, 0x2E, 0xD1, 0x76, 0xD0,
-    0x19, 0xE8, 0x03, 0xEF, 0x41, 0xE8, 0x39, 0x7C, 0x26, 0x0E, 0x95, 0x3D,
-    0xD5, 0x7D, 0xE8, 0x44, 0xDB, 0xDF, 0xAC, 0x80, 0x42, 0xA4, 0x1F, 0x1C,
-    0x26, 0x90, 0x66, 0x5A, 0x12, 0x6A, 0xE7, 0x99, 0xEA, 0xDA, 0x12, 0xBC,
-    0x00, 0x82, 0x81, 0x3F, 0x8E, 0x49, 0x35, 0xD6, 0x3E, 0x43, 0xED, 0x72,
-    0x90, 0x89, 0xD0, 0x9D, 0xA9, 0xB1, 0x69, 0xD1, 0xCE, 0xB6, 0xA5, 0x5F,
-    0xD0, 0xBE, 0xA0, 0x6C, 0x36, 0xED, 0xCF, 0x04, 0x08, 0x9D, 0x11, 0x32,
-    0x68, 0xA1, 0x45, 0x07, 0x9C, 0x41, 0xC7, 0xA2, 0x33, 0x81, 0x1F, 0xEC,
-    0x48, 0x28, 0xE0, 0x12, 0x32, 0x71, 0x74, 0x8A, 0x02, 0x8E, 0xA0, 0x9D,
-    0x0B, 0x34, 0xA0, 0x37, 0x62, 0x40, 0xB6, 0xA0, 0xC1, 0xFB, 0x50, 0xA5,
-    0x55, 0x21, 0x01, 0x05, 0x22, 0x60, 0x5A, 0x57, 0xCF, 0x5D, 0x50, 0x7B,
-    0xCD, 0x46, 0xD3, 0xD0, 0x0D, 0x89, 0x7D, 0xC8, 0x25, 0x76, 0xED, 0x42,
-    0xA2, 0x3D, 0xF1, 0x13, 0x81, 0x9E, 0xD0, 0x42, 0x68, 0x57, 0x82, 0xCD,
-    0xEC, 0x43, 0xCE, 0xAE, 0x21, 0x60, 0x70, 0x6C, 0x37, 0x90, 0x32, 0xB7,
-    0xB0, 0x71, 0x6B, 0x59, 0xAF, 0xC0, 0x92, 0x25, 0x48, 0x81, 0x40, 0x42,
-    0x9A, 0x84, 0x2F, 0x10, 0x0F, 0xFC, 0x68, 0x1A, 0xB4, 0x68, 0x16, 0xB8,
-    0x2A, 0x83, 0xBE, 0x80, 0xB5, 0xF0, 0xA3, 0xDA, 0x0A, 0xBE, 0xC0, 0x96,
-    0xE1, 0xAA, 0x6A, 0x7D, 0x95, 0xE8, 0x1D, 0x49, 0xB4, 0x79, 0x1A, 0xC7,
-    0x4D, 0x65, 0xA9, 0xEB, 0x16, 0x7A, 0x1A, 0xC8, 0xE9, 0x80, 0x6C, 0xCC,
-    0x64, 0x8A, 0x17, 0x93, 0x69, 0xAD, 0x95, 0xBE, 0xAF, 0x5A, 0xAB, 0x16,
-    0xD6, 0x4A, 0x25, 0xBD, 0x6D, 0x2D, 0x20, 0xC0, 0x0F, 0x73, 0xAF, 0x5F,
-    0x2D, 0xF9, 0xAE, 0xE4, 0x5E, 0x2D, 0xA1, 0xDF, 0xDE, 0x63, 0x63, 0x2C,
-    0xC1, 0x88, 0x24, 0xE9, 0x28, 0x19, 0x13, 0xEA, 0x09, 0x09, 0x4A, 0x11,
-    0x0C, 0xAF, 0x98, 0x4F, 0x5D, 0x16, 0x72, 0x80, 0x8B, 0xD8, 0x4A, 0xAF,
-    0xD3, 0xF0, 0x03, 0xC1, 0x6F, 0x69, 0x41, 0xA0, 0xC3, 0x51, 0x04, 0x5B,
-    0x09, 0x1B, 0x85, 0xC9, 0x9B, 0x46, 0x73, 0x32, 0xA0, 0x58, 0xD7, 0x29,
-    0x2C, 0x7A, 0x9D, 0xC6, 0x6B, 0x18, 0xC9, 0x32, 0x33, 0x04, 0x80, 0xE3,
-    0x01, 0xBE, 0x42, 0x9B, 0x2E, 0xE1, 0xEF, 0x9B, 0x95, 0x0A, 0xD1, 0x96,
-    0xA6, 0x7D, 0xA8, 0x4C, 0xAA, 0x02, 0x52, 0x51, 0x8C, 0xF2, 0x45, 0x4C,
-    0x9B, 0xB6, 0x5A, 0xF8, 0x15, 0xAC, 0x14, 0x14, 0xA1, 0xA0, 0x54, 0x50,
-    0x5B, 0x80, 0xE3, 0xB0, 0x54, 0x12, 0x72, 0x41, 0x98, 0xFB, 0x06, 0x2C,
-    0x15, 0x3C, 0xEB, 0x73, 0x63, 0x63, 0xB2, 0x91, 0x3C, 0xC0, 0x10, 0x34,
-    0xC9, 0x41, 0x75, 0x90, 0x80, 0xA7, 0x06, 0x55, 0xED, 0x33, 0x5D, 0xB1,
-    0x81, 0x27, 0x66, 0x04, 0xBE, 0xD1, 0x85, 0x68, 0xF7, 0xD4, 0x76, 0x24,
-    0xDD, 0x86, 0x0C, 0x0F, 0x68, 0xB5, 0xB1, 0xAF, 0x04, 0x06, 0x81, 0x75,
-    0xAC, 0x09, 0xE9, 0x2C, 0xEA, 0x17, 0x72, 0x96, 0x35, 0x60, 0x57, 0xD3,
-    0x81, 0xAE, 0x2A, 0x80, 0x76, 0x81, 0x78, 0x0A, 0xE0, 0x42, 0x55, 0x21,
-    0x69, 0xD3, 0x30, 0x3F, 0xCC, 0x35, 0x54, 0xDD, 0x88, 0x4D, 0xBB, 0x84,
-    0x64, 0x00, 0xDE, 0x12, 0xC4, 0x00, 0xCA, 0x21, 0x13, 0x4B, 0x0B, 0x34,
-    0x01, 0x50, 0x3D, 0xAA, 0xF4, 0x00, 0xC6, 0xC5, 0x08, 0x0C, 0xD0, 0x08,
-    0x40, 0x03, 0x06, 0xEB, 0x04, 0x10, 0x50, 0x89, 0x8D, 0x5F, 0x18, 0x87,
-    0xF3, 0x53, 0x9D, 0xA5, 0xEA, 0x40, 0x3F, 0x47, 0xAC, 0x87, 0x54, 0x0D,
-    0x50, 0x01, 0x1D, 0x50, 0x1B, 0x55, 0x25, 0x90, 0x55, 0x62, 0xE5, 0x08,
-    0x06, 0x80, 0x66, 0xF9, 0xD4, 0x74, 0x91, 0xFC, 0x9F, 0x74, 0x74, 0xF7,
-    0x94, 0x13, 0x4B, 0xDB, 0x8D, 0x30, 0x1A, 0x28, 0xD6, 0x85, 0x8E, 0xD8,
-    0x9A, 0x76, 0xA9, 0x64, 0x96, 0xEE, 0x82, 0x05, 0xD8, 0x11, 0x4D, 0xF4,
-    0x08, 0x7C, 0xB0, 0x1C, 0xC9, 0xB1, 0x24, 0xCB, 0xBC, 0x00, 0x66, 0x19,
-    0x04, 0x58, 0x05, 0x29, 0x6E, 0xAE, 0x51, 0x4B, 0xBD, 0xA0, 0x1C, 0x65,
-    0xEF, 0x73, 0x89, 0x5D, 0x8A, 0x68, 0x67, 0x89, 0x0D, 0x44, 0x20, 0x1A,
-    0xE4, 0x4A, 0x10, 0x8D, 0x74, 0x50, 0x5B, 0x4C, 0x39, 0x1D, 0xCC, 0xE0,
-    0x40, 0x0B, 0x2D, 0xD7, 0x88, 0x50, 0x0E, 0x80, 0xC2, 0x52, 0x02, 0x6C,
-    0x10, 0x38, 0xA2, 0x03, 0xC0, 0x00, 0x7B, 0xC4, 0x87, 0xA9, 0xAF, 0xAE,
-    0xA9, 0x92, 0xA5, 0xEB, 0x11, 0x4B, 0x65, 0x01, 0x2E, 0x81, 0xFA, 0x1E,
-    0x6A, 0x68, 0xCB, 0x00, 0xDF, 0x00, 0x24, 0x4A, 0x36, 0xD1, 0x15, 0xA0,
-    0x13, 0xF2, 0x55, 0x34, 0x68, 0x88, 0x65, 0xE0, 0x6D, 0x72, 0x6C, 0x8C,
-    0x24, 0xEC, 0x06, 0x49, 0x0B, 0x1D, 0x82, 0xC3, 0xB5, 0x0B, 0x4D, 0x03,
-    0xA8, 0x04, 0x31, 0x21, 0x14, 0x13, 0x03, 0xFC, 0x83, 0x66, 0x59, 0x11,
-    0xC8, 0x03, 0x26, 0x7F, 0x03, 0x01, 0x14, 0x72, 0xE4, 0x2A, 0xBF, 0x96,
-    0x68, 0x7E, 0x5D, 0xD6, 0x04, 0x2C, 0x8B, 0xCE, 0x19, 0x22, 0x30, 0xB9,
-    0x4B, 0xF3, 0x6B, 0xCC, 0xF4, 0x54, 0x48, 0xF9, 0xB5, 0xC2, 0x89, 0x61,
-    0xCA, 0xAF, 0x40, 0x23, 0x4D, 0xFA, 0xE9, 0x45, 0x28, 0x95, 0x00, 0xAA,
-    0x71, 0x13, 0x0B, 0x60, 0xCB, 0x9C, 0x77, 0x93, 0x03, 0xDE, 0xC4, 0xD5,
-    0x1B, 0x95, 0xAB, 0x2F, 0xBA, 0x83, 0x5B, 0x8E, 0x68, 0xF8, 0xC0, 0x9A,
-    0x87, 0x40, 0x4C, 0xB1, 0x90, 0x95, 0xAA, 0xA2, 0x51, 0x0F, 0xC4, 0x38,
-    0xD0, 0x72, 0xAA, 0x1D, 0x7E, 0xDA, 0xB2, 0x4B, 0x13, 0x84, 0xD8, 0x00,
-    0x36, 0x08, 0xAF, 0x88, 0xBA, 0x19, 0x3E, 0x42, 0x58, 0x85, 0x0F, 0xDB,
-    0x3F, 0x46, 0x48, 0xAC, 0x5A, 0x02, 0x87, 0x06, 0x55, 0x28, 0x14, 0xA1,
-    0x06, 0x2B, 0x46, 0xFB, 0xE4, 0x50, 0x5F, 0x36, 0x3E, 0xCE, 0xE6, 0x69,
-    0xB8, 0xDE, 0xDE, 0xE6, 0x9B, 0x27, 0x71, 0x96, 0x43, 0x51, 0xEF, 0xE5,
-    0x01, 0x39, 0x21, 0x1F, 0x48, 0x51, 0x90, 0x1E, 0x91, 0x0F, 0x1F, 0xA7,
-    0x04, 0x77, 0x05, 0xB2, 0x77, 0x78, 0xD7, 0x12, 0xDF, 0x6D, 0x0F, 0xA7,
-    0x3B, 0xDF, 0xC4, 0xF4, 0xE6, 0x09, 0xC9, 0x96, 0xC9, 0x55, 0xF1, 0xD0,
-    0xE5, 0x78, 0x95, 0x2D, 0x00, 0xCA, 0x68, 0xFB, 0x0C, 0xE6, 0x88, 0x3B,
-    0x49, 0xCF, 0x4F, 0xE6, 0x9B, 0x55, 0x10, 0xE7, 0xF2, 0x22, 0xC8, 0x1F,
-    0x47, 0x01, 0xBE, 0x7D, 0x78, 0xFD, 0xC4, 0x1F, 0x8F, 0x1A, 0x67, 0xC9,
-    0x8D, 0x26, 0xF4, 0x6B, 0x2F, 0x4E, 0x8B, 0x6F, 0x48, 0x38, 0x21, 0x00,
-    0x77, 0x0F, 0x28, 0xC5, 0xA9, 0x77, 0x00, 0x85, 0x2E, 0x88, 0x3F, 0x0D,
-    0xB3, 0x5C, 0x4E, 0x83, 0x15, 0x34, 0x8F, 0x47, 0xEC, 0x49, 0xCA, 0xD1,
-    0xA4, 0x75, 0x14, 0x60, 0x45, 0x0F, 0xF4, 0x08, 0x4A, 0x7A, 0xF6, 0xC3,
-    0x5E, 0x34, 0xAF, 0xE7, 0xFB, 0x43, 0x26, 0x45, 0x26, 0x9E, 0xE1, 0x71,
-    0x76, 0xE3, 0x82, 0x05, 0x53, 0x7A, 0x0F, 0x14, 0x99, 0x59, 0x9E, 0x33,
-    0xC9, 0xB3, 0x92, 0xC9, 0x6D, 0x7B, 0x5C, 0xE9, 0x49, 0x37, 0x7A, 0x8D,
-    0x63, 0xF2, 0xB6, 0x68, 0x94, 0x50, 0xD8, 0xB9, 0xA2, 0x35, 0x08, 0xF3,
-    0x34, 0x00, 0x7D, 0x28, 0x80, 0x8C, 0x47, 0x7E, 0x78, 0x59, 0x1F, 0xC4,
-    0x0E, 0xB7, 0xA4, 0x24, 0x3E, 0xF7, 0x56, 0x88, 0xE3, 0xFF, 0x31, 0x08,
-    0xDF, 0x7E, 0x40, 0x9C, 0x3F, 0xFE, 0x5F, 0x13, 0x3E, 0xDE, 0x43, 0x79,
-    0xE2, 0x43, 0x3F, 0x46, 0xD2, 0x49, 0x9D, 0x28, 0xF2, 0x67, 0x32, 0xAA,
-    0xD7, 0x0B, 0x23, 0x72, 0x04, 0x0D, 0x34, 0xDD, 0x1C, 0x35, 0xA7, 0xA4,
-    0x07, 0x13, 0xFE, 0x74, 0xF6, 0xEC, 0x29, 0x4E, 0x29, 0xB8, 0xD5, 0x75,
-    0xC0, 0xDD, 0x92, 0xA1, 0x77, 0x64, 0xF8, 0x9B, 0x86, 0xDF, 0x7E, 0x60,
-    0xA8, 0x7C, 0xE4, 0xEF, 0x1A, 0xB2, 0xDB, 0x56, 0xDF, 0x7E, 0x28, 0x58,
-    0xFF, 0xB1, 0xB8, 0x5F, 0xC2, 0xD3, 0xC1, 0x98, 0x27, 0x7B, 0xEB, 0x75,
-    0x10, 0xFB, 0xA7, 0xCB, 0x30, 0xF2, 0xC7, 0x14, 0xAB, 0x1A, 0x63, 0x20,
-    0xB4, 0x9F, 0x85, 0xAB, 0x20, 0xD9, 0xE4, 0x63, 0xD0, 0x9C, 0x93, 0xFB,
-    0x05, 0xDA, 0x85, 0xEA, 0x4D, 0xA6, 0x04, 0x17, 0xED, 0x76, 0x28, 0x41,
-    0x71, 0xB4, 0xDF, 0x33, 0x3C, 0x86, 0x6E, 0x2C, 0x90, 0x38, 0x3B, 0xA9,
-    0xB0, 0x47, 0xDA, 0xDC, 0x39, 0x87, 0x75, 0xB1, 0xB1, 0xEF, 0x70, 0xD9,
-    0x6D, 0x11, 0x95, 0x6E, 0x51, 0x21, 0x3C, 0xCC, 0xE3, 0xBE, 0xD9, 0xEA,
-    0x87, 0xF5, 0x09, 0x40, 0x30, 0x5C, 0x86, 0xC1, 0x60, 0x7D, 0xDB, 0x40,
-    0x96, 0x5E, 0xEC, 0x47, 0x01, 0x3B, 0xD7, 0x0F, 0xC0, 0x30, 0xCE, 0xF2,
-    0x27, 0x69, 0x36, 0x28, 0x13, 0xDA, 0x1C, 0xBB, 0xA7, 0x17, 0x78, 0xF1,
-    0x66, 0x3D, 0x9E, 0x08, 0x8F, 0xE8, 0xE4, 0xA6, 0x2B, 0x4E, 0x58, 0x3C,
-    0x21, 0x5E, 0x76, 0x1D, 0xCF, 0xEF, 0x7A, 0x56, 0xC2, 0x79, 0xCD, 0x11,
-    0xBB, 0x4D, 0x07, 0x6F, 0x8B, 0x13, 0x16, 0xA9, 0xE3, 0xE4, 0xEF, 0x62,
-    0x5C, 0xF3, 0x93, 0x97, 0xD8, 0xA6, 0x41, 0x86, 0x38, 0x5E, 0x79, 0x61,
-    0x4E, 0xCE, 0x83, 0x7C, 0xBE, 0x1C, 0x8F, 0x0E, 0xBD, 0x75, 0x78, 0x08,
-    0xED, 0xF8, 0x05, 0xC3, 0x3C, 0x14, 0x08, 0xBF, 0xE7, 0x64, 0xFC, 0x0D,
-    0x5C, 0x93, 0x93, 0x77, 0x13, 0x92, 0x2F, 0xF1, 0xDE, 0x72, 0x1C, 0x5C,
-    0x91, 0xC7, 0x69, 0x9A, 0xA4, 0xE3, 0xD1, 0x0F, 0x5E, 0x18, 0x05, 0x7E,
-    0x73, 0xCC, 0xD6, 0x35, 0x8D, 0x8A, 0xBB, 0xE6, 0x61, 0x56, 0x1C, 0x0A,
-    0x59, 0xF8, 0xF8, 0x69, 0xDD, 0x49, 0x35, 0x06, 0x6F, 0x4D, 0xA2, 0x93,
-    0x91, 0xF8, 0xAF, 0x46, 0xC1, 0x83, 0x28, 0x1A, 0x4F, 0x9A, 0xD7, 0x39,
-    0xA7, 0xCC, 0x5F, 0x84, 0xE8, 0x64, 0xD6, 0xED, 0x8A, 0xB6, 0x81, 0xF6,
-    0xE2, 0xF7, 0x44, 0x8E, 0x83, 0x34, 0x9D, 0x34, 0x67, 0xAB, 0x11, 0xC4,
-    0x28, 0xDE, 0x9E, 0x72, 0x89, 0xA4, 0x94, 0x27, 0xF1, 0x36, 0x49, 0xE9,
-    0x44, 0xE1, 0x63, 0x8F, 0x36, 0x15, 0xB2, 0x17, 0xEB, 0x6D, 0x65, 0x61,
-    0x85, 0x2D, 0x3E, 0xBE, 0x04, 0x9B, 0x40, 0x5D, 0x0A, 0xC0, 0xD3, 0x80,
-    0x25, 0x47, 0xE1, 0xFC, 0x1D, 0x60, 0x54, 0x37, 0x00, 0x5E, 0xB1, 0x2A,
-    0xF3, 0x1A, 0x04, 0x80, 0xF5, 0x9E, 0xB4, 0x75, 0x78, 0xC0, 0xE0, 0x87,
-    0xC5, 0xB7, 0x4C, 0x9C, 0x62, 0xEB, 0x6E, 0xF3, 0xE1, 0xBA, 0x23, 0xF1,
-    0x41, 0x9B, 0x7A, 0xD4, 0xC5, 0x40, 0x06, 0x2D, 0x05, 0x7F, 0x40, 0x83,
-    0x02, 0x45, 0xA6, 0x25, 0xAD, 0x3A, 0xF5, 0x83, 0xF8, 0x5E, 0x31, 0x15,
-    0x0C, 0x72, 0x3F, 0x8E, 0xD6, 0xF8, 0xB9, 0x73, 0x6C, 0x8B, 0x99, 0x8C,
-    0x95, 0xBB, 0xC6, 0x89, 0xF9, 0xD8, 0x0E, 0x05, 0xEC, 0xC1, 0xF7, 0xE2,
-    0x24, 0x84, 0x27, 0xB8, 0x4D, 0x36, 0x1B, 0x97, 0xDF, 0xEE, 0xCA, 0xB1,
-    0xE8, 0xFB, 0x9F, 0x47, 0xEC, 0xC1, 0x6C, 0xA6, 0xBA, 0xEC, 0x71, 0xE3,
-    0xF2, 0x7D, 0xF1, 0x10, 0x6D, 0xF9, 0xD1, 0x8F, 0xB3, 0xD1, 0xAF, 0xF8,
-    0xDD, 0xC7, 0x8F, 0x3D, 0x70, 0x14, 0xE3, 0xD0, 0x17, 0xA8, 0x24, 0x15,
-    0x62, 0xD0, 0x17, 0x61, 0x60, 0x58, 0x4B, 0x8C, 0x20, 0xB6, 0x20, 0x92,
-    0xAB, 0xAF, 0x9F, 0x3D, 0x21, 0xE5, 0xDB, 0x9A, 0x88, 0xDA, 0xD4, 0x32,
-    0x8F, 0x50, 0xD1, 0x4C, 0xAD, 0xBF, 0x20, 0x99, 0x0F, 0x7D, 0x2D, 0xF7,
-    0xD7, 0xEF, 0xFC, 0x8A, 0x1C, 0x76, 0x34, 0x69, 0x0F, 0xC1, 0x03, 0x25,
-    0xAB, 0x31, 0xE8, 0x08, 0x71, 0xEF, 0x66, 0xC3, 0x33, 0x63, 0x2E, 0x2C,
-    0x17, 0x30, 0x90, 0x14, 0x18, 0x52, 0x7D, 0xFC, 0xED, 0x37, 0x48, 0x82,
-    0xDB, 0x60, 0x97, 0xAB, 0xBE, 0x00, 0xB7, 0x3D, 0xE6, 0x74, 0xD4, 0x62,
-    0xDD, 0x72, 0x35, 0x81, 0xD1, 0x8D, 0x74, 0x97, 0x43, 0x41, 0x86, 0x71,
-    0x38, 0xEF, 0xE8, 0xF9, 0xE1, 0x83, 0x51, 0x7B, 0xEA, 0xD8, 0xEF, 0x9B,
-    0xBA, 0x3C, 0xD2, 0xA0, 0x3D, 0x71, 0xEC, 0xB7, 0x4C, 0x2D, 0xF6, 0xE5,
-    0xF2, 0xFB, 0x4A, 0x9B, 0x38, 0x20, 0x8C, 0xB7, 0x41, 0xDC, 0x90, 0x69,
-    0x0D, 0x8B, 0x70, 0x17, 0x16, 0xE1, 0xBA, 0xE9, 0x50, 0x8B, 0x91, 0xAB,
-    0x5D, 0x23, 0xA9, 0x46, 0x8B, 0xC7, 0x2E, 0x76, 0x8D, 0x2D, 0x2D, 0x40,
-    0x3C, 0xDC, 0x8F, 0x77, 0xF2, 0x0E, 0x4C, 0x46, 0x10, 0x43, 0xE3, 0x70,
-    0x02, 0x24, 0xCB, 0x74, 0x9F, 0x65, 0x8B, 0x57, 0xE1, 0x9A, 0x8A, 0x6B,
-    0x24, 0x18, 0x06, 0xC2, 0x8E, 0x57, 0x1D, 0xC3, 0xB2, 0xCD, 0x0C, 0xDE,
-    0x76, 0x0E, 0x5D, 0xC0, 0xD0, 0x45, 0xC7, 0xD0, 0x82, 0xCA, 0xCE, 0xB1,
-    0x7E, 0x3C, 0x41, 0x62, 0x3B, 0x46, 0x03, 0x8D, 0xA2, 0x91, 0x22, 0x17,
-    0xD4, 0xAD, 0x14, 0x5D, 0x9E, 0xB9, 0xAA, 0x30, 0x7B, 0x15, 0x84, 0x9D,
-    0xF9, 0xD7, 0x56, 0xD2, 0x0C, 0xF8, 0x9C, 0x85, 0xBD, 0xD6, 0x51, 0x70,
-    0x5B, 0x6C, 0x1C, 0xD9, 0x6A, 0xD7, 0xAC, 0x42, 0xA3, 0xCC, 0x40, 0x4E,
-    0xD9, 0x6D, 0x8C, 0x32, 0xF3, 0x77, 0xCD, 0x2B, 0x36, 0xCA, 0xCC, 0x6F,
-    0xE6, 0x4F, 0x7E, 0x2F, 0x16, 0x75, 0x09, 0x60, 0x25, 0xF5, 0x98, 0xBD,
-    0xA5, 0x45, 0xD4, 0xA3, 0xC2, 0x05, 0x0B, 0xD9, 0x02, 0x26, 0xB5, 0x9B,
-    0x33, 0x4D, 0xB3, 0x63, 0xAC, 0x81, 0xE6, 0x09, 0x83, 0xD0, 0x8B, 0x5A,
-    0x4D, 0x9D, 0x3B, 0x78, 0xB4, 0xD8, 0x85, 0x81, 0xD0, 0x78, 0x29, 0x12,
-    0x60, 0x0C, 0xD9, 0xA2, 0x77, 0xFA, 0xBA, 0x49, 0x74, 0xC9, 0x28, 0xDE,
-    0x29, 0xA4, 0xA6, 0xF5, 0x33, 0x19, 0x81, 0x35, 0xC1, 0xAF, 0x7E, 0xC1,
-    0x14, 0x36, 0xC5, 0x4F, 0xBD, 0x4D, 0x4B, 0x27, 0xED, 0x78, 0x96, 0x44,
-    0x81, 0x1C, 0xD0, 0x44, 0x3C, 0x68, 0x55, 0x0A, 0xAD, 0x74, 0x95, 0x86,
-    0xBB, 0x72, 0xB1, 0xA6, 0x2B, 0x6B, 0xFD, 0x38, 0x28, 0xE2, 0xE2, 0x03,
-    0xEE, 0xB7, 0x0A, 0xB7, 0x73, 0x76, 0x84, 0xDB, 0xAD, 0xC2, 0x2D, 0xAE,
-    0x34, 0x15, 0xB1, 0xB6, 0x0D, 0x65, 0x9E, 0xF7, 0x17, 0xBC, 0xEC, 0xB9,
-    0xE8, 0xB6, 0xA4, 0xE6, 0xF9, 0x04, 0xC6, 0x56, 0x5E, 0x8F, 0x06, 0x72,
-    0xE8, 0xF8, 0x16, 0xBF, 0xEF, 0x54, 0x30, 0xCB, 0x6C, 0xE7, 0x2C, 0xF8,
-    0x80, 0xAC, 0x60, 0x9A, 0x19, 0x4C, 0x33, 0xE3, 0xA7, 0x49, 0x33, 0x4D,
-    0xD7, 0xDE, 0xAA, 0x6F, 0x71, 0x84, 0x40, 0xF5, 0xF2, 0x5D, 0x9A, 0x27,
-    0xA4, 0x27, 0x03, 0x7A, 0xA0, 0xD0, 0xE4, 0xF5, 0x6E, 0x07, 0x55, 0xD9,
-    0x6C, 0xD7, 0x54, 0x62, 0xA2, 0x32, 0x20, 0x2A, 0x9B, 0x89, 0xE6, 0x12,
-    0x93, 0x76, 0x03, 0xD5, 0x1E, 0xA6, 0x9E, 0x3F, 0xAE, 0xC3, 0xE4, 0x56,
-    0xEA, 0x89, 0x4B, 0x97, 0xB7, 0xD2, 0x4D, 0x04, 0xD0, 0xA9, 0x9B, 0x8B,
-    0xDE, 0xB8, 0x56, 0x3C, 0x9E, 0xD6, 0x66, 0xEF, 0x02, 0x02, 0xDB, 0x22,
-    0xE4, 0x75, 0xC6, 0xA7, 0xA7, 0xF6, 0xBD, 0x0D, 0x05, 0x0A, 0xB3, 0x58,
-    0xED, 0x9C, 0x05, 0x9F, 0x73, 0x12, 0xCC, 0x03, 0x91, 0x6C, 0xB1, 0xE2,
-    0xE7, 0x41, 0x55, 0x7E, 0x8B, 0xDD, 0x05, 0xF3, 0x78, 0x3B, 0xE7, 0xC1,
-    0x47, 0x57, 0x04, 0xF3, 0x78, 0x30, 0x8F, 0xC7, 0xCF, 0x83, 0x3D, 0xDF,
-    0x02, 0x63, 0xD7, 0x00, 0x1A, 0x0A, 0xBD, 0xE4, 0x75, 0x9E, 0xB6, 0x6A,
-    0xE7, 0x32, 0x39, 0xD8, 0x19, 0x2F, 0x45, 0x4C, 0xCC, 0xB0, 0x82, 0x81,
-    0x5F, 0x22, 0x2D, 0xED, 0x61, 0x66, 0x86, 0xB4, 0xEF, 0x8C, 0x7E, 0x42,
-    0x76, 0xD2, 0xA1, 0x13, 0x06, 0x41, 0x34, 0x6B, 0xC5, 0x5A, 0x20, 0xF7,
-    0xAF, 0xEB, 0x75, 0x90, 0x9E, 0x7A, 0x59, 0xC0, 0x2D, 0x37, 0x7D, 0x2A,
-    0x33, 0xA1, 0xAB, 0x26, 0xDC, 0xB7, 0xD6, 0x50, 0xBD, 0x7E, 0x99, 0x26,
-    0xAB, 0x10, 0xB8, 0xEF, 0xC1, 0xE5, 0x9F, 0xF9, 0x02, 0x6B, 0x5A, 0x77,
-    0xFF, 0xD3, 0xBA, 0xB1, 0xFD, 0xDA, 0x2E, 0xD5, 0x2A, 0x5E, 0x5D, 0x6C,
-    0x82, 0xF4, 0xFA, 0x35, 0x7D, 0x54, 0x28, 0x49, 0x71, 0xD2, 0x91, 0x5C,
-    0x9E, 0xDD, 0x3F, 0x9A, 0xD4, 0x6A, 0x4B, 0xF8, 0xDC, 0xAC, 0x2E, 0xB1,
-    0xAD, 0xA7, 0x40, 0x16, 0x2C, 0x90, 0x94, 0xB3, 0xF2, 0x39, 0x51, 0x3F,
-    0x0E, 0x8D, 0xBE, 0x15, 0x46, 0x31, 0x05, 0x1F, 0x0B, 0x16, 0x40, 0xD9,
-    0xB7, 0x39, 0x8C, 0x26, 0xBC, 0xB4, 0x11, 0xD9, 0xC6, 0xE2, 0x5E, 0xD9,
-    0xB1, 0xAD, 0x52, 0xF4, 0x90, 0xC6, 0x13, 0x36, 0x08, 0x15, 0x21, 0x0B,
-    0x72, 0x19, 0xDB, 0x6E, 0x46, 0xCC, 0x9A, 0xDE, 0x02, 0xE9, 0x22, 0x64,
-    0x4D, 0x09, 0x59, 0x77, 0xAD, 0x3C, 0x4E, 0x44, 0x73, 0xB6, 0x54, 0x9C,
-    0x1E, 0x3B, 0x39, 0x22, 0x7F, 0xA2, 0x98, 0x4F, 0x06, 0xAD, 0x0A, 0xD7,
-    0x0A, 0xF8, 0x49, 0x53, 0x2D, 0xB6, 0xBD, 0x44, 0x55, 0x54, 0x75, 0x18,
-    0x63, 0x1D, 0x9C, 0x40, 0x13, 0xD8, 0xF3, 0x5E, 0xA0, 0x0A, 0xC5, 0x52,
-    0xA1, 0x60, 0xD1, 0x28, 0x90, 0xD7, 0x69, 0x80, 0xA3, 0x1E, 0x05, 0xE7,
-    0xDE, 0x26, 0xCA, 0x7B, 0x16, 0x55, 0xE9, 0x53, 0x50, 0xB8, 0xA6, 0x5A,
-    0x9D, 0x27, 0x59, 0xDC, 0x79, 0x6F, 0xAD, 0xAE, 0x16, 0xF1, 0x00, 0x72,
-    0xE9, 0x61, 0xA5, 0x74, 0x59, 0x25, 0x8B, 0xF4, 0xE0, 0x1A, 0x6F, 0x06,
-    0xE1, 0x9D, 0xB4, 0xC6, 0x17, 0x59, 0xD4, 0x12, 0xF5, 0x23, 0xFA, 0x69,
-    0xDA, 0xA8, 0xD3, 0xD6, 0xAC, 0x19, 0xB3, 0x78, 0x4C, 0xDF, 0x77, 0xD6,
-    0xD2, 0xCC, 0xD7, 0x36, 0xA0, 0xB0, 0xA4, 0x7B, 0x0F, 0x48, 0x2C, 0xC9,
-    0x17, 0xC2, 0x2A, 0x32, 0xE8, 0x3D, 0x80, 0x55, 0xF9, 0xBA, 0x10, 0x1E,
-    0xA4, 0xC4, 0x7B, 0xC0, 0xA2, 0xA9, 0xB7, 0x10, 0x0E, 0x54, 0x5E, 0x47,
-    0xED, 0x62, 0xAC, 0xB3, 0xFC, 0xDC, 0x7B, 0xE9, 0x7C, 0x9B, 0x54, 0xB7,
-    0x56, 0xA9, 0x57, 0x41, 0xBE, 0x4C, 0x40, 0x7E, 0xA3, 0x97, 0x2F, 0x5E,
-    0x9F, 0x8D, 0xA6, 0xAD, 0x45, 0x6A, 0xBA, 0xCE, 0x03, 0x54, 0x7E, 0x20,
-    0xA3, 0x22, 0x30, 0x48, 0x67, 0xD7, 0xEB, 0x60, 0x04, 0x23, 0x3C, 0xD0,
-    0xC6, 0xE2, 0x10, 0xA9, 0x43, 0x4C, 0x34, 0x46, 0xE4, 0x63, 0x6B, 0x3C,
-    0x3E, 0x4C, 0x76, 0x44, 0xF0, 0x39, 0x62, 0x39, 0xA3, 0xB1, 0x32, 0x3C,
-    0xBF, 0x1E, 0x17, 0x2A, 0xD5, 0x5C, 0xF4, 0xBE, 0xDB, 0x85, 0xFD, 0xD2,
-    0x44, 0xCA, 0xCD, 0x29, 0x64, 0xB3, 0x06, 0x37, 0x16, 0xF8, 0xDF, 0x7C,
-    0x11, 0x6B, 0xFB, 0x8C, 0x98, 0x5D, 0xD5, 0xD2, 0xE0, 0x35, 0xFE, 0x96,
-    0xF7, 0xEB, 0x73, 0x15, 0x82, 0x78, 0xB7, 0xF4, 0x62, 0xF0, 0xEF, 0x53,
-    0x81, 0x7F, 0x13, 0x2D, 0xB9, 0x94, 0x4B, 0xE4, 0xA5, 0xD3, 0xE9, 0xF1,
-    0xC2, 0x2D, 0x3C, 0xB6, 0xCF, 0xCC, 0x89, 0x31, 0xE9, 0x8A, 0xBC, 0xED,
-    0x1B, 0x91, 0x37, 0x72, 0xFD, 0xD5, 0xD1, 0x67, 0xBF, 0x8F, 0xDF, 0x2F,
-    0x8E, 0x16, 0xDF, 0xE5, 0xF7, 0x3B, 0x7D, 0x76, 0x59, 0x54, 0x1D, 0x41,
-    0x97, 0x34, 0x0B, 0x9E, 0xC4, 0xF9, 0x78, 0x40, 0x11, 0xCA, 0x7C, 0xD6,
-    0xA4, 0x61, 0xDC, 0xF5, 0xA2, 0x69, 0x30, 0x3C, 0x56, 0x99, 0x15, 0x00,
-    0xEF, 0xCE, 0xC1, 0x95, 0xF5, 0xFA, 0x7F, 0x92, 0x83, 0x2B, 0x75, 0xE1,
-    0x8B, 0x76, 0x70, 0x5B, 0xC1, 0xDE, 0xB1, 0x83, 0xEB, 0xB1, 0xF1, 0xEA,
-    0x28, 0x9F, 0xDF, 0xC7, 0xC6, 0xB9, 0x93, 0x88, 0xF6, 0x35, 0xF0, 0xAA,
-    0x46, 0x1C, 0x62, 0x91, 0x55, 0x29, 0xDF, 0x61, 0xE0, 0x39, 0xAD, 0xFB,
-    0x8E, 0x06, 0x55, 0xE9, 0xC2, 0xBC, 0x86, 0x2B, 0x97, 0x8F, 0x06, 0x55,
-    0xE1, 0x65, 0xBD, 0x8D, 0x3B, 0x6A, 0xF0, 0x9C, 0x88, 0xD1, 0xDD, 0x39,
-    0x09, 0xBA, 0x6A, 0xF2, 0x9F, 0xE4, 0x21, 0xA8, 0x26, 0xED, 0xE1, 0x1E,
-    0x6E, 0x6C, 0xA5, 0x38, 0x51, 0xB7, 0x89, 0x7E, 0x24, 0xE7, 0xB8, 0xE1,
-    0x3A, 0x6A, 0x89, 0x6B, 0x3F, 0xCB, 0xBD, 0x0A, 0x63, 0x3F, 0xB9, 0x12,
-    0xD8, 0xE1, 0xA3, 0x17, 0xCF, 0x0A, 0xB9, 0x20, 0x30, 0xE0, 0xC8, 0xB4,
-    0x6B, 0x87, 0x0B, 0x67, 0x70, 0x3F, 0xA0, 0x6A, 0xD0, 0x0D, 0x2A, 0xF4,
-    0x50, 0xFE, 0x86, 0xA5, 0x75, 0x3B, 0x40, 0x21, 0xD6, 0x25, 0x9A, 0xC7,
-    0x87, 0xB5, 0xCD, 0x88, 0xC7, 0x87, 0xC5, 0xF7, 0xD9, 0x1E, 0x1F, 0x2E,
-    0xF3, 0x15, 0x6E, 0x5D, 0xFC, 0x7F, 0x7F, 0x1F, 0xEE, 0x7A, 0x9A, 0xA7,
-    0x00, 0x00
+// assets_app_85d26ff2_css: original size 8671 bytes
+const uint8_t assets_app_85d26ff2_css_identity_data[] = {
+    0x3A, 0x72, 0x6F, 0x6F, 0x74, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x2D, 0x2D,
+    0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x3A, 0x20, 0x23, 0x31, 0x39,
+    0x37, 0x36, 0x64, 0x32, 0x3B, 0x0A, 0x20, 0x20, 0x2D, 0x2D, 0x73, 0x65,
+    0x63, 0x6F, 0x6E, 0x64, 0x61, 0x72, 0x79, 0x3A, 0x20, 0x23, 0x32, 0x36,
+    0x61, 0x36, 0x39, 0x61, 0x3B, 0x0A, 0x20, 0x20, 0x2D, 0x2D, 0x70, 0x6F,
+    0x73, 0x69, 0x74, 0x69, 0x76, 0x65, 0x3A, 0x20, 0x23, 0x32, 0x31, 0x62,
+    0x61, 0x34, 0x35, 0x3B, 0x0A, 0x20, 0x20, 0x2D, 0x2D, 0x6E, 0x65, 0x67,
+    0x61, 0x74, 0x69, 0x76, 0x65, 0x3A, 0x20, 0x23, 0x63, 0x31, 0x30, 0x30,
+    0x31, 0x35, 0x3B, 0x0A, 0x20, 0x20, 0x2D, 0x2D, 0x62, 0x67, 0x2D, 0x67,
+    0x72, 0x65, 0x79, 0x3A, 0x20, 0x23, 0x66, 0x35, 0x66, 0x35, 0x66, 0x35,
+    0x3B, 0x0A, 0x20, 0x20, 0x2D, 0x2D, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72,
+    0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x65, 0x30, 0x65,
+    0x30, 0x65, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x2D, 0x2D, 0x64, 0x72, 0x61,
+    0x77, 0x65, 0x72, 0x2D, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x32,
+    0x35, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x2D, 0x2D, 0x68, 0x65,
+    0x61, 0x64, 0x65, 0x72, 0x2D, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A,
+    0x20, 0x35, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x7D, 0x0A, 0x2A, 0x20, 0x7B,
+    0x0A, 0x20, 0x20, 0x62, 0x6F, 0x78, 0x2D, 0x73, 0x69, 0x7A, 0x69, 0x6E,
+    0x67, 0x3A, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x62, 0x6F,
+    0x78, 0x3B, 0x0A, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x3A,
+    0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E,
+    0x67, 0x3A, 0x20, 0x30, 0x3B, 0x0A, 0x7D, 0x0A, 0x62, 0x6F, 0x64, 0x79,
+    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x66, 0x61,
+    0x6D, 0x69, 0x6C, 0x79, 0x3A, 0x20, 0x41, 0x72, 0x69, 0x61, 0x6C, 0x2C,
+    0x20, 0x73, 0x61, 0x6E, 0x73, 0x2D, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3B,
+    0x0A, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E,
+    0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72,
+    0x28, 0x2D, 0x2D, 0x62, 0x67, 0x2D, 0x67, 0x72, 0x65, 0x79, 0x29, 0x3B,
+    0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x33,
+    0x33, 0x33, 0x3B, 0x0A, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74,
+    0x3A, 0x20, 0x31, 0x30, 0x30, 0x76, 0x68, 0x3B, 0x0A, 0x20, 0x20, 0x64,
+    0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65, 0x78,
+    0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x2D, 0x64, 0x69, 0x72,
+    0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x63, 0x6F, 0x6C, 0x75,
+    0x6D, 0x6E, 0x3B, 0x0A, 0x20, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x66, 0x6C,
+    0x6F, 0x77, 0x3A, 0x20, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6E, 0x3B, 0x0A,
+    0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x3A,
+    0x20, 0x30, 0x2E, 0x38, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E,
+    0x6C, 0x61, 0x79, 0x6F, 0x75, 0x74, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x64,
+    0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65, 0x78,
+    0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x3A, 0x20, 0x31, 0x3B,
+    0x0A, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x63,
+    0x61, 0x6C, 0x63, 0x28, 0x31, 0x30, 0x30, 0x76, 0x68, 0x20, 0x2D, 0x20,
+    0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72,
+    0x2D, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x29, 0x29, 0x3B, 0x0A, 0x7D,
+    0x0A, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20,
+    0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28,
+    0x2D, 0x2D, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x2D, 0x68, 0x65, 0x69,
+    0x67, 0x68, 0x74, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B,
+    0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72,
+    0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D,
+    0x61, 0x72, 0x79, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F,
+    0x72, 0x3A, 0x20, 0x23, 0x66, 0x66, 0x66, 0x3B, 0x0A, 0x20, 0x20, 0x64,
+    0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65, 0x78,
+    0x3B, 0x0A, 0x20, 0x20, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x2D, 0x69, 0x74,
+    0x65, 0x6D, 0x73, 0x3A, 0x20, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x3B,
+    0x0A, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20,
+    0x30, 0x20, 0x31, 0x36, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x62, 0x6F,
+    0x78, 0x2D, 0x73, 0x68, 0x61, 0x64, 0x6F, 0x77, 0x3A, 0x20, 0x30, 0x20,
+    0x32, 0x70, 0x78, 0x20, 0x34, 0x70, 0x78, 0x20, 0x2D, 0x31, 0x70, 0x78,
+    0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20,
+    0x30, 0x2C, 0x20, 0x30, 0x2E, 0x32, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x7A,
+    0x2D, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x3A, 0x20, 0x31, 0x30, 0x3B, 0x0A,
+    0x7D, 0x0A, 0x2E, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x2D, 0x62, 0x74,
+    0x6E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72,
+    0x6F, 0x75, 0x6E, 0x64, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x0A,
+    0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x20, 0x6E, 0x6F,
+    0x6E, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6F, 0x72,
+    0x3A, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x3B, 0x0A, 0x20,
+    0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x38, 0x70,
+    0x78, 0x3B, 0x0A, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D,
+    0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x35, 0x30, 0x25, 0x3B,
+    0x0A, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x72, 0x69,
+    0x67, 0x68, 0x74, 0x3A, 0x20, 0x31, 0x36, 0x70, 0x78, 0x3B, 0x0A, 0x20,
+    0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C,
+    0x65, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x2D,
+    0x69, 0x74, 0x65, 0x6D, 0x73, 0x3A, 0x20, 0x63, 0x65, 0x6E, 0x74, 0x65,
+    0x72, 0x3B, 0x0A, 0x20, 0x20, 0x6A, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79,
+    0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x3A, 0x20, 0x63, 0x65,
+    0x6E, 0x74, 0x65, 0x72, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x68, 0x65, 0x61,
+    0x64, 0x65, 0x72, 0x2D, 0x62, 0x74, 0x6E, 0x3A, 0x68, 0x6F, 0x76, 0x65,
+    0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72,
+    0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20,
+    0x72, 0x67, 0x62, 0x61, 0x28, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30,
+    0x2C, 0x20, 0x30, 0x2E, 0x30, 0x35, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E,
+    0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x2D, 0x74, 0x69, 0x74, 0x6C, 0x65,
+    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73, 0x69,
+    0x7A, 0x65, 0x3A, 0x20, 0x31, 0x2E, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A,
+    0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x77, 0x65, 0x69, 0x67, 0x68,
+    0x74, 0x3A, 0x20, 0x62, 0x6F, 0x6C, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x66,
+    0x6C, 0x65, 0x78, 0x3A, 0x20, 0x31, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x68,
+    0x65, 0x61, 0x64, 0x65, 0x72, 0x2D, 0x6D, 0x61, 0x63, 0x20, 0x7B, 0x0A,
+    0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x3A,
+    0x20, 0x30, 0x2E, 0x37, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x63,
+    0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x66, 0x66, 0x66, 0x3B, 0x0A,
+    0x7D, 0x0A, 0x61, 0x73, 0x69, 0x64, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20,
+    0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D,
+    0x2D, 0x64, 0x72, 0x61, 0x77, 0x65, 0x72, 0x2D, 0x77, 0x69, 0x64, 0x74,
+    0x68, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72,
+    0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20,
+    0x23, 0x66, 0x66, 0x66, 0x3B, 0x0A, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64,
+    0x65, 0x72, 0x2D, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x31, 0x70,
+    0x78, 0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64, 0x20, 0x76, 0x61, 0x72, 0x28,
+    0x2D, 0x2D, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x63, 0x6F, 0x6C,
+    0x6F, 0x72, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73,
+    0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73,
+    0x66, 0x6F, 0x72, 0x6D, 0x20, 0x30, 0x2E, 0x33, 0x73, 0x20, 0x65, 0x61,
+    0x73, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69,
+    0x6F, 0x6E, 0x3A, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65,
+    0x3B, 0x0A, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20,
+    0x31, 0x30, 0x30, 0x25, 0x3B, 0x0A, 0x20, 0x20, 0x7A, 0x2D, 0x69, 0x6E,
+    0x64, 0x65, 0x78, 0x3A, 0x20, 0x35, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x6E,
+    0x61, 0x76, 0x2D, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x7B, 0x0A, 0x20, 0x20,
+    0x6C, 0x69, 0x73, 0x74, 0x2D, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3A, 0x20,
+    0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64,
+    0x69, 0x6E, 0x67, 0x3A, 0x20, 0x38, 0x70, 0x78, 0x20, 0x30, 0x3B, 0x0A,
+    0x7D, 0x0A, 0x2E, 0x6E, 0x61, 0x76, 0x2D, 0x69, 0x74, 0x65, 0x6D, 0x20,
+    0x7B, 0x0A, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A,
+    0x20, 0x31, 0x32, 0x70, 0x78, 0x20, 0x31, 0x36, 0x70, 0x78, 0x3B, 0x0A,
+    0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66,
+    0x6C, 0x65, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x61, 0x6C, 0x69, 0x67, 0x6E,
+    0x2D, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x3A, 0x20, 0x63, 0x65, 0x6E, 0x74,
+    0x65, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6F, 0x72,
+    0x3A, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x3B, 0x0A, 0x20,
+    0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A,
+    0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D,
+    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x30, 0x2E, 0x32, 0x73, 0x3B, 0x0A,
+    0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x33, 0x33,
+    0x33, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x6E, 0x61, 0x76, 0x2D, 0x69, 0x74,
+    0x65, 0x6D, 0x3A, 0x68, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20,
+    0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D,
+    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x72, 0x67, 0x62, 0x61, 0x28,
+    0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x30,
+    0x35, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x6E, 0x61, 0x76, 0x2D, 0x69,
+    0x74, 0x65, 0x6D, 0x2E, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x7B,
+    0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61,
+    0x72, 0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x29,
+    0x3B, 0x0A, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75,
+    0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x72, 0x67,
+    0x62, 0x61, 0x28, 0x32, 0x35, 0x2C, 0x20, 0x31, 0x31, 0x38, 0x2C, 0x20,
+    0x32, 0x31, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x31, 0x29, 0x3B, 0x0A, 0x7D,
+    0x0A, 0x2E, 0x6E, 0x61, 0x76, 0x2D, 0x69, 0x63, 0x6F, 0x6E, 0x20, 0x7B,
+    0x0A, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x72, 0x69,
+    0x67, 0x68, 0x74, 0x3A, 0x20, 0x31, 0x36, 0x70, 0x78, 0x3B, 0x0A, 0x20,
+    0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x32, 0x34, 0x70, 0x78,
+    0x3B, 0x0A, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20,
+    0x32, 0x34, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x69, 0x6C, 0x6C,
+    0x3A, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6C,
+    0x6F, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
+    0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61,
+    0x72, 0x79, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x6E, 0x61, 0x76, 0x2D,
+    0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x64, 0x69,
+    0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x3B,
+    0x0A, 0x20, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x2D, 0x64, 0x69, 0x72, 0x65,
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x63, 0x6F, 0x6C, 0x75, 0x6D,
+    0x6E, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x6E, 0x61, 0x76, 0x2D, 0x6C, 0x61,
+    0x62, 0x65, 0x6C, 0x2D, 0x6D, 0x61, 0x69, 0x6E, 0x20, 0x7B, 0x0A, 0x20,
+    0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x3A, 0x20,
+    0x30, 0x2E, 0x39, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6F,
+    0x6E, 0x74, 0x2D, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x35,
+    0x30, 0x30, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x6E, 0x61, 0x76, 0x2D, 0x6C,
+    0x61, 0x62, 0x65, 0x6C, 0x2D, 0x73, 0x75, 0x62, 0x20, 0x7B, 0x0A, 0x20,
+    0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x3A, 0x20,
+    0x30, 0x2E, 0x37, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x63,
+    0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x37, 0x35, 0x37, 0x35, 0x37,
+    0x35, 0x3B, 0x0A, 0x7D, 0x0A, 0x6D, 0x61, 0x69, 0x6E, 0x20, 0x7B, 0x0A,
+    0x20, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x3A, 0x20, 0x31, 0x3B, 0x0A, 0x20,
+    0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x32, 0x34,
+    0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x66, 0x6C,
+    0x6F, 0x77, 0x2D, 0x79, 0x3A, 0x20, 0x61, 0x75, 0x74, 0x6F, 0x3B, 0x0A,
+    0x7D, 0x0A, 0x2E, 0x70, 0x61, 0x67, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20,
+    0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65,
+    0x78, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x2D, 0x77, 0x72,
+    0x61, 0x70, 0x3A, 0x20, 0x77, 0x72, 0x61, 0x70, 0x3B, 0x0A, 0x20, 0x20,
+    0x67, 0x61, 0x70, 0x3A, 0x20, 0x32, 0x34, 0x70, 0x78, 0x3B, 0x0A, 0x20,
+    0x20, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x2D, 0x69, 0x74, 0x65, 0x6D, 0x73,
+    0x3A, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x2D, 0x73, 0x74, 0x61, 0x72, 0x74,
+    0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x63, 0x61, 0x72, 0x64, 0x20, 0x7B, 0x0A,
+    0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64,
+    0x3A, 0x20, 0x23, 0x66, 0x66, 0x66, 0x3B, 0x0A, 0x20, 0x20, 0x62, 0x6F,
+    0x72, 0x64, 0x65, 0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A,
+    0x20, 0x38, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x62, 0x6F, 0x78, 0x2D,
+    0x73, 0x68, 0x61, 0x64, 0x6F, 0x77, 0x3A, 0x20, 0x30, 0x20, 0x31, 0x70,
+    0x78, 0x20, 0x35, 0x70, 0x78, 0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 0x30,
+    0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x32, 0x29,
+    0x3B, 0x0A, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x62,
+    0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x32, 0x34, 0x70, 0x78, 0x3B,
+    0x0A, 0x20, 0x20, 0x6D, 0x61, 0x78, 0x2D, 0x77, 0x69, 0x64, 0x74, 0x68,
+    0x3A, 0x20, 0x34, 0x30, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x66,
+    0x6C, 0x65, 0x78, 0x3A, 0x20, 0x31, 0x20, 0x31, 0x20, 0x34, 0x30, 0x30,
+    0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x66, 0x6C,
+    0x6F, 0x77, 0x3A, 0x20, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6E, 0x3B, 0x0A,
+    0x7D, 0x0A, 0x2E, 0x63, 0x61, 0x72, 0x64, 0x2D, 0x68, 0x65, 0x61, 0x64,
+    0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69,
+    0x6E, 0x67, 0x3A, 0x20, 0x31, 0x36, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20,
+    0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65,
+    0x78, 0x3B, 0x0A, 0x20, 0x20, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x2D, 0x69,
+    0x74, 0x65, 0x6D, 0x73, 0x3A, 0x20, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72,
+    0x3B, 0x0A, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x62,
+    0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73,
+    0x6F, 0x6C, 0x69, 0x64, 0x20, 0x23, 0x65, 0x66, 0x65, 0x66, 0x65, 0x66,
+    0x3B, 0x0A, 0x20, 0x20, 0x67, 0x61, 0x70, 0x3A, 0x20, 0x31, 0x36, 0x70,
+    0x78, 0x3B, 0x0A, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F,
+    0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23,
+    0x66, 0x32, 0x66, 0x32, 0x66, 0x32, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x63,
+    0x61, 0x72, 0x64, 0x2D, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x20, 0x7B, 0x0A,
+    0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x3A,
+    0x20, 0x31, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6F, 0x6E,
+    0x74, 0x2D, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x35, 0x30,
+    0x30, 0x3B, 0x0A, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79,
+    0x3A, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x61, 0x6C,
+    0x69, 0x67, 0x6E, 0x2D, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x3A, 0x20, 0x63,
+    0x65, 0x6E, 0x74, 0x65, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x67, 0x61, 0x70,
+    0x3A, 0x20, 0x38, 0x70, 0x78, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x63, 0x61,
+    0x72, 0x64, 0x2D, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x7B, 0x0A, 0x20, 0x20,
+    0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x31, 0x36, 0x70,
+    0x78, 0x20, 0x31, 0x36, 0x70, 0x78, 0x20, 0x38, 0x70, 0x78, 0x3B, 0x0A,
+    0x7D, 0x0A, 0x2E, 0x63, 0x61, 0x72, 0x64, 0x2D, 0x61, 0x63, 0x74, 0x69,
+    0x6F, 0x6E, 0x73, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64,
+    0x69, 0x6E, 0x67, 0x3A, 0x20, 0x38, 0x70, 0x78, 0x20, 0x31, 0x36, 0x70,
+    0x78, 0x20, 0x31, 0x36, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x64, 0x69,
+    0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x3B,
+    0x0A, 0x20, 0x20, 0x6A, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2D, 0x63,
+    0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x3A, 0x20, 0x66, 0x6C, 0x65, 0x78,
+    0x2D, 0x65, 0x6E, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x67, 0x61, 0x70, 0x3A,
+    0x20, 0x38, 0x70, 0x78, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x66, 0x6F, 0x72,
+    0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x20, 0x7B, 0x0A, 0x20, 0x20,
+    0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x62, 0x6F, 0x74, 0x74, 0x6F,
+    0x6D, 0x3A, 0x20, 0x38, 0x70, 0x78, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x66,
+    0x6F, 0x72, 0x6D, 0x2D, 0x72, 0x6F, 0x77, 0x20, 0x7B, 0x0A, 0x20, 0x20,
+    0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65,
+    0x78, 0x3B, 0x0A, 0x20, 0x20, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x2D, 0x69,
+    0x74, 0x65, 0x6D, 0x73, 0x3A, 0x20, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72,
+    0x3B, 0x0A, 0x20, 0x20, 0x6A, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2D,
+    0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x3A, 0x20, 0x73, 0x70, 0x61,
+    0x63, 0x65, 0x2D, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x3B, 0x0A,
+    0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x62, 0x6F, 0x74,
+    0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x38, 0x70, 0x78, 0x3B, 0x0A, 0x7D, 0x0A,
+    0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x64, 0x69,
+    0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B,
+    0x3B, 0x0A, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x62,
+    0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x38, 0x70, 0x78, 0x3B, 0x0A,
+    0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72,
+    0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x29, 0x3B,
+    0x0A, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x7A, 0x65,
+    0x3A, 0x20, 0x30, 0x2E, 0x38, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x7D, 0x0A,
+    0x69, 0x6E, 0x70, 0x75, 0x74, 0x5B, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x27,
+    0x74, 0x65, 0x78, 0x74, 0x27, 0x5D, 0x2C, 0x0A, 0x69, 0x6E, 0x70, 0x75,
+    0x74, 0x5B, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x27, 0x6E, 0x75, 0x6D, 0x62,
+    0x65, 0x72, 0x27, 0x5D, 0x2C, 0x0A, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74,
+    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20,
+    0x31, 0x30, 0x30, 0x25, 0x3B, 0x0A, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64,
+    0x69, 0x6E, 0x67, 0x3A, 0x20, 0x38, 0x70, 0x78, 0x20, 0x31, 0x30, 0x70,
+    0x78, 0x3B, 0x0A, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A,
+    0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6F, 0x6C, 0x69, 0x64, 0x20, 0x23,
+    0x63, 0x63, 0x63, 0x3B, 0x0A, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65,
+    0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x34, 0x70,
+    0x78, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73, 0x69,
+    0x7A, 0x65, 0x3A, 0x20, 0x30, 0x2E, 0x39, 0x72, 0x65, 0x6D, 0x3B, 0x0A,
+    0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64,
+    0x3A, 0x20, 0x23, 0x66, 0x32, 0x66, 0x32, 0x66, 0x32, 0x3B, 0x0A, 0x20,
+    0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A,
+    0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x63, 0x6F, 0x6C, 0x6F,
+    0x72, 0x20, 0x30, 0x2E, 0x32, 0x73, 0x3B, 0x0A, 0x7D, 0x0A, 0x69, 0x6E,
+    0x70, 0x75, 0x74, 0x3A, 0x66, 0x6F, 0x63, 0x75, 0x73, 0x2C, 0x0A, 0x73,
+    0x65, 0x6C, 0x65, 0x63, 0x74, 0x3A, 0x66, 0x6F, 0x63, 0x75, 0x73, 0x20,
+    0x7B, 0x0A, 0x20, 0x20, 0x6F, 0x75, 0x74, 0x6C, 0x69, 0x6E, 0x65, 0x3A,
+    0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x62, 0x6F, 0x72,
+    0x64, 0x65, 0x72, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76,
+    0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79,
+    0x29, 0x3B, 0x0A, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F,
+    0x75, 0x6E, 0x64, 0x3A, 0x20, 0x23, 0x66, 0x66, 0x66, 0x3B, 0x0A, 0x7D,
+    0x0A, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x3A, 0x64, 0x69, 0x73, 0x61, 0x62,
+    0x6C, 0x65, 0x64, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F,
+    0x72, 0x3A, 0x20, 0x23, 0x39, 0x39, 0x39, 0x3B, 0x0A, 0x20, 0x20, 0x62,
+    0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x3A, 0x20, 0x23,
+    0x65, 0x30, 0x65, 0x30, 0x65, 0x30, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x74,
+    0x6F, 0x67, 0x67, 0x6C, 0x65, 0x2D, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68,
+    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F,
+    0x6E, 0x3A, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 0x3B,
+    0x0A, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20,
+    0x69, 0x6E, 0x6C, 0x69, 0x6E, 0x65, 0x2D, 0x62, 0x6C, 0x6F, 0x63, 0x6B,
+    0x3B, 0x0A, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x34,
+    0x30, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68,
+    0x74, 0x3A, 0x20, 0x32, 0x32, 0x70, 0x78, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E,
+    0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x2D, 0x73, 0x77, 0x69, 0x74, 0x63,
+    0x68, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x7B, 0x0A, 0x20, 0x20,
+    0x6F, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3A, 0x20, 0x30, 0x3B, 0x0A,
+    0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x30, 0x3B, 0x0A,
+    0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x30, 0x3B,
+    0x0A, 0x7D, 0x0A, 0x2E, 0x73, 0x6C, 0x69, 0x64, 0x65, 0x72, 0x20, 0x7B,
+    0x0A, 0x20, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A,
+    0x20, 0x61, 0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65, 0x3B, 0x0A, 0x20,
+    0x20, 0x63, 0x75, 0x72, 0x73, 0x6F, 0x72, 0x3A, 0x20, 0x70, 0x6F, 0x69,
+    0x6E, 0x74, 0x65, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x74, 0x6F, 0x70, 0x3A,
+    0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x6C, 0x65, 0x66, 0x74, 0x3A, 0x20,
+    0x30, 0x3B, 0x0A, 0x20, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20,
+    0x30, 0x3B, 0x0A, 0x20, 0x20, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A,
+    0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72,
+    0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20,
+    0x23, 0x63, 0x63, 0x63, 0x3B, 0x0A, 0x20, 0x20, 0x74, 0x72, 0x61, 0x6E,
+    0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x30, 0x2E, 0x34, 0x73,
+    0x3B, 0x0A, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x72,
+    0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x33, 0x34, 0x70, 0x78, 0x3B,
+    0x0A, 0x7D, 0x0A, 0x2E, 0x73, 0x6C, 0x69, 0x64, 0x65, 0x72, 0x3A, 0x62,
+    0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x70, 0x6F,
+    0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x61, 0x62, 0x73, 0x6F,
+    0x6C, 0x75, 0x74, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74,
+    0x65, 0x6E, 0x74, 0x3A, 0x20, 0x27, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x68,
+    0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x31, 0x36, 0x70, 0x78, 0x3B,
+    0x0A, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x31, 0x36,
+    0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x6C, 0x65, 0x66, 0x74, 0x3A, 0x20,
+    0x33, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x62, 0x6F, 0x74, 0x74, 0x6F,
+    0x6D, 0x3A, 0x20, 0x33, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x62, 0x61,
+    0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C,
+    0x6F, 0x72, 0x3A, 0x20, 0x77, 0x68, 0x69, 0x74, 0x65, 0x3B, 0x0A, 0x20,
+    0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A,
+    0x20, 0x30, 0x2E, 0x34, 0x73, 0x3B, 0x0A, 0x20, 0x20, 0x62, 0x6F, 0x72,
+    0x64, 0x65, 0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x20,
+    0x35, 0x30, 0x25, 0x3B, 0x0A, 0x7D, 0x0A, 0x69, 0x6E, 0x70, 0x75, 0x74,
+    0x3A, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x20, 0x2B, 0x20, 0x2E,
+    0x73, 0x6C, 0x69, 0x64, 0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x62,
+    0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F,
+    0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70,
+    0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x69,
+    0x6E, 0x70, 0x75, 0x74, 0x3A, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64,
+    0x20, 0x2B, 0x20, 0x2E, 0x73, 0x6C, 0x69, 0x64, 0x65, 0x72, 0x3A, 0x62,
+    0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x74, 0x72,
+    0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x3A, 0x20, 0x74, 0x72, 0x61,
+    0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x58, 0x28, 0x31, 0x38, 0x70, 0x78,
+    0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x62, 0x74, 0x6E, 0x20, 0x7B, 0x0A,
+    0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x20, 0x6E, 0x6F,
+    0x6E, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72,
+    0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x34, 0x70, 0x78,
+    0x3B, 0x0A, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A,
+    0x20, 0x38, 0x70, 0x78, 0x20, 0x31, 0x36, 0x70, 0x78, 0x3B, 0x0A, 0x20,
+    0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x3A, 0x20,
+    0x30, 0x2E, 0x39, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6F,
+    0x6E, 0x74, 0x2D, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x35,
+    0x30, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6F, 0x72,
+    0x3A, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x3B, 0x0A, 0x20,
+    0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A,
+    0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D,
+    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x20, 0x30, 0x2E, 0x32, 0x73, 0x3B, 0x0A,
+    0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x69,
+    0x6E, 0x6C, 0x69, 0x6E, 0x65, 0x2D, 0x66, 0x6C, 0x65, 0x78, 0x3B, 0x0A,
+    0x20, 0x20, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x2D, 0x69, 0x74, 0x65, 0x6D,
+    0x73, 0x3A, 0x20, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x3B, 0x0A, 0x20,
+    0x20, 0x6A, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2D, 0x63, 0x6F, 0x6E,
+    0x74, 0x65, 0x6E, 0x74, 0x3A, 0x20, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72,
+    0x3B, 0x0A, 0x20, 0x20, 0x67, 0x61, 0x70, 0x3A, 0x20, 0x38, 0x70, 0x78,
+    0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x62, 0x74, 0x6E, 0x2D, 0x70, 0x72, 0x69,
+    0x6D, 0x61, 0x72, 0x79, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x62, 0x61, 0x63,
+    0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F,
+    0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69,
+    0x6D, 0x61, 0x72, 0x79, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6C,
+    0x6F, 0x72, 0x3A, 0x20, 0x23, 0x66, 0x66, 0x66, 0x3B, 0x0A, 0x20, 0x20,
+    0x62, 0x6F, 0x78, 0x2D, 0x73, 0x68, 0x61, 0x64, 0x6F, 0x77, 0x3A, 0x20,
+    0x30, 0x20, 0x31, 0x70, 0x78, 0x20, 0x33, 0x70, 0x78, 0x20, 0x72, 0x67,
+    0x62, 0x61, 0x28, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20,
+    0x30, 0x2E, 0x31, 0x35, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x62, 0x74,
+    0x6E, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x3A, 0x68, 0x6F,
+    0x76, 0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B,
+    0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72,
+    0x3A, 0x20, 0x23, 0x31, 0x35, 0x36, 0x35, 0x63, 0x30, 0x3B, 0x0A, 0x20,
+    0x20, 0x62, 0x6F, 0x78, 0x2D, 0x73, 0x68, 0x61, 0x64, 0x6F, 0x77, 0x3A,
+    0x20, 0x30, 0x20, 0x32, 0x70, 0x78, 0x20, 0x36, 0x70, 0x78, 0x20, 0x72,
+    0x67, 0x62, 0x61, 0x28, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2C,
+    0x20, 0x30, 0x2E, 0x32, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x62, 0x74,
+    0x6E, 0x2D, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x20, 0x7B, 0x0A, 0x20,
+    0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x34, 0x30, 0x70, 0x78,
+    0x3B, 0x0A, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20,
+    0x34, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64,
+    0x69, 0x6E, 0x67, 0x3A, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x62, 0x6F,
+    0x72, 0x64, 0x65, 0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A,
+    0x20, 0x35, 0x30, 0x25, 0x3B, 0x0A, 0x20, 0x20, 0x6F, 0x76, 0x65, 0x72,
+    0x66, 0x6C, 0x6F, 0x77, 0x3A, 0x20, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6E,
+    0x3B, 0x0A, 0x20, 0x20, 0x77, 0x68, 0x69, 0x74, 0x65, 0x2D, 0x73, 0x70,
+    0x61, 0x63, 0x65, 0x3A, 0x20, 0x6E, 0x6F, 0x77, 0x72, 0x61, 0x70, 0x3B,
+    0x0A, 0x7D, 0x0A, 0x2E, 0x62, 0x74, 0x6E, 0x2D, 0x65, 0x78, 0x70, 0x61,
+    0x6E, 0x64, 0x20, 0x2E, 0x62, 0x74, 0x6E, 0x2D, 0x74, 0x65, 0x78, 0x74,
+    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x6D, 0x61, 0x78, 0x2D, 0x77, 0x69, 0x64,
+    0x74, 0x68, 0x3A, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x6F, 0x70, 0x61,
+    0x63, 0x69, 0x74, 0x79, 0x3A, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x6F,
+    0x76, 0x65, 0x72, 0x66, 0x6C, 0x6F, 0x77, 0x3A, 0x20, 0x68, 0x69, 0x64,
+    0x64, 0x65, 0x6E, 0x3B, 0x0A, 0x20, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73,
+    0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x30,
+    0x2E, 0x33, 0x73, 0x20, 0x65, 0x61, 0x73, 0x65, 0x3B, 0x0A, 0x7D, 0x0A,
+    0x2E, 0x62, 0x74, 0x6E, 0x2D, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x3A,
+    0x68, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x77, 0x69,
+    0x64, 0x74, 0x68, 0x3A, 0x20, 0x61, 0x75, 0x74, 0x6F, 0x3B, 0x0A, 0x20,
+    0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x30, 0x20,
+    0x31, 0x34, 0x70, 0x78, 0x20, 0x30, 0x20, 0x31, 0x30, 0x70, 0x78, 0x3B,
+    0x0A, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x72, 0x61,
+    0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x32, 0x30, 0x70, 0x78, 0x3B, 0x0A,
+    0x20, 0x20, 0x67, 0x61, 0x70, 0x3A, 0x20, 0x36, 0x70, 0x78, 0x3B, 0x0A,
+    0x7D, 0x0A, 0x2E, 0x62, 0x74, 0x6E, 0x2D, 0x65, 0x78, 0x70, 0x61, 0x6E,
+    0x64, 0x3A, 0x68, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x2E, 0x62, 0x74, 0x6E,
+    0x2D, 0x74, 0x65, 0x78, 0x74, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x6D, 0x61,
+    0x78, 0x2D, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x31, 0x30, 0x30,
+    0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x6F, 0x70, 0x61, 0x63, 0x69, 0x74,
+    0x79, 0x3A, 0x20, 0x31, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x62, 0x74, 0x6E,
+    0x2D, 0x66, 0x6C, 0x61, 0x74, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x62, 0x61,
+    0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x3A, 0x20, 0x6E, 0x6F,
+    0x6E, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A,
+    0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61,
+    0x72, 0x79, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x62, 0x74, 0x6E, 0x2D,
+    0x66, 0x6C, 0x61, 0x74, 0x3A, 0x68, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x7B,
+    0x0A, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E,
+    0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x72, 0x67, 0x62,
+    0x61, 0x28, 0x32, 0x35, 0x2C, 0x20, 0x31, 0x31, 0x38, 0x2C, 0x20, 0x32,
+    0x31, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x31, 0x29, 0x3B, 0x0A, 0x7D, 0x0A,
+    0x2E, 0x69, 0x63, 0x6F, 0x6E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x77, 0x69,
+    0x64, 0x74, 0x68, 0x3A, 0x20, 0x32, 0x34, 0x70, 0x78, 0x3B, 0x0A, 0x20,
+    0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x32, 0x34, 0x70,
+    0x78, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x69, 0x6C, 0x6C, 0x3A, 0x20, 0x63,
+    0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x43, 0x6F, 0x6C, 0x6F, 0x72, 0x3B,
+    0x0A, 0x7D, 0x0A, 0x2E, 0x69, 0x63, 0x6F, 0x6E, 0x2D, 0x73, 0x6D, 0x20,
+    0x7B, 0x0A, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x32,
+    0x30, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68,
+    0x74, 0x3A, 0x20, 0x32, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E,
+    0x74, 0x65, 0x78, 0x74, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79,
+    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20,
+    0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72,
+    0x79, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x68, 0x69, 0x64, 0x64, 0x65,
+    0x6E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61,
+    0x79, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x20, 0x21, 0x69, 0x6D, 0x70,
+    0x6F, 0x72, 0x74, 0x61, 0x6E, 0x74, 0x3B, 0x0A, 0x7D, 0x0A, 0x23, 0x63,
+    0x6F, 0x6E, 0x66, 0x69, 0x72, 0x6D, 0x2D, 0x6D, 0x6F, 0x64, 0x61, 0x6C,
+    0x2E, 0x6D, 0x6F, 0x64, 0x61, 0x6C, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x70,
+    0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x66, 0x69, 0x78,
+    0x65, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x74, 0x6F, 0x70, 0x3A, 0x20, 0x30,
+    0x3B, 0x0A, 0x20, 0x20, 0x6C, 0x65, 0x66, 0x74, 0x3A, 0x20, 0x30, 0x3B,
+    0x0A, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x31, 0x30,
+    0x30, 0x25, 0x3B, 0x0A, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74,
+    0x3A, 0x20, 0x31, 0x30, 0x30, 0x25, 0x3B, 0x0A, 0x20, 0x20, 0x62, 0x61,
+    0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C,
+    0x6F, 0x72, 0x3A, 0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 0x30, 0x2C, 0x20,
+    0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2E, 0x33, 0x35, 0x29, 0x3B,
+    0x0A, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x64, 0x72, 0x6F, 0x70, 0x2D,
+    0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x3A, 0x20, 0x62, 0x6C, 0x75, 0x72,
+    0x28, 0x33, 0x70, 0x78, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x64, 0x69, 0x73,
+    0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x3B, 0x0A,
+    0x20, 0x20, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x2D, 0x69, 0x74, 0x65, 0x6D,
+    0x73, 0x3A, 0x20, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x3B, 0x0A, 0x20,
+    0x20, 0x6A, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2D, 0x63, 0x6F, 0x6E,
+    0x74, 0x65, 0x6E, 0x74, 0x3A, 0x20, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72,
+    0x3B, 0x0A, 0x20, 0x20, 0x7A, 0x2D, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x3A,
+    0x20, 0x39, 0x39, 0x39, 0x39, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x6D, 0x6F,
+    0x64, 0x61, 0x6C, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20,
+    0x7B, 0x0A, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75,
+    0x6E, 0x64, 0x3A, 0x20, 0x23, 0x66, 0x66, 0x66, 0x3B, 0x0A, 0x20, 0x20,
+    0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75,
+    0x73, 0x3A, 0x20, 0x38, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x62, 0x6F,
+    0x78, 0x2D, 0x73, 0x68, 0x61, 0x64, 0x6F, 0x77, 0x3A, 0x20, 0x30, 0x20,
+    0x34, 0x70, 0x78, 0x20, 0x32, 0x30, 0x70, 0x78, 0x20, 0x72, 0x67, 0x62,
+    0x61, 0x28, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20, 0x30,
+    0x2E, 0x33, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x6D, 0x61, 0x78, 0x2D, 0x77,
+    0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x34, 0x30, 0x30, 0x70, 0x78, 0x3B,
+    0x0A, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x39, 0x30,
+    0x25, 0x3B, 0x0A, 0x20, 0x20, 0x61, 0x6E, 0x69, 0x6D, 0x61, 0x74, 0x69,
+    0x6F, 0x6E, 0x3A, 0x20, 0x6D, 0x6F, 0x64, 0x61, 0x6C, 0x53, 0x6C, 0x69,
+    0x64, 0x65, 0x49, 0x6E, 0x20, 0x30, 0x2E, 0x33, 0x73, 0x20, 0x65, 0x61,
+    0x73, 0x65, 0x3B, 0x0A, 0x7D, 0x0A, 0x40, 0x6B, 0x65, 0x79, 0x66, 0x72,
+    0x61, 0x6D, 0x65, 0x73, 0x20, 0x6D, 0x6F, 0x64, 0x61, 0x6C, 0x53, 0x6C,
+    0x69, 0x64, 0x65, 0x49, 0x6E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x66, 0x72,
+    0x6F, 0x6D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x70, 0x61,
+    0x63, 0x69, 0x74, 0x79, 0x3A, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x3A, 0x20,
+    0x74, 0x72, 0x61, 0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x59, 0x28, 0x2D,
+    0x32, 0x30, 0x70, 0x78, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x7D, 0x0A, 0x20,
+    0x20, 0x74, 0x6F, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x70,
+    0x61, 0x63, 0x69, 0x74, 0x79, 0x3A, 0x20, 0x31, 0x3B, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x3A,
+    0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x59, 0x28,
+    0x30, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x7D, 0x0A, 0x7D, 0x0A, 0x2E, 0x6D,
+    0x6F, 0x64, 0x61, 0x6C, 0x2D, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20,
+    0x7B, 0x0A, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A,
+    0x20, 0x32, 0x30, 0x70, 0x78, 0x20, 0x32, 0x34, 0x70, 0x78, 0x3B, 0x0A,
+    0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x62, 0x6F, 0x74,
+    0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6F, 0x6C,
+    0x69, 0x64, 0x20, 0x23, 0x65, 0x65, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x64,
+    0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65, 0x78,
+    0x3B, 0x0A, 0x20, 0x20, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x2D, 0x69, 0x74,
+    0x65, 0x6D, 0x73, 0x3A, 0x20, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x3B,
+    0x0A, 0x20, 0x20, 0x67, 0x61, 0x70, 0x3A, 0x20, 0x31, 0x32, 0x70, 0x78,
+    0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x6D, 0x6F, 0x64, 0x61, 0x6C, 0x2D, 0x68,
+    0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x68, 0x33, 0x20, 0x7B, 0x0A, 0x20,
+    0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x3A, 0x20, 0x30, 0x3B, 0x0A,
+    0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x3A,
+    0x20, 0x31, 0x2E, 0x31, 0x32, 0x35, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20,
+    0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74,
+    0x3A, 0x20, 0x35, 0x30, 0x30, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x6D, 0x6F,
+    0x64, 0x61, 0x6C, 0x2D, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x7B, 0x0A, 0x20,
+    0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x32, 0x34,
+    0x70, 0x78, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x6D, 0x6F, 0x64, 0x61, 0x6C,
+    0x2D, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x70, 0x20, 0x7B, 0x0A, 0x20, 0x20,
+    0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x3A, 0x20, 0x30, 0x3B, 0x0A, 0x20,
+    0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x36, 0x36, 0x36,
+    0x3B, 0x0A, 0x20, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x2D, 0x68, 0x65, 0x69,
+    0x67, 0x68, 0x74, 0x3A, 0x20, 0x31, 0x2E, 0x35, 0x3B, 0x0A, 0x7D, 0x0A,
+    0x2E, 0x6D, 0x6F, 0x64, 0x61, 0x6C, 0x2D, 0x61, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0x73, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69,
+    0x6E, 0x67, 0x3A, 0x20, 0x31, 0x36, 0x70, 0x78, 0x20, 0x32, 0x34, 0x70,
+    0x78, 0x3B, 0x0A, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79,
+    0x3A, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x6A, 0x75,
+    0x73, 0x74, 0x69, 0x66, 0x79, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E,
+    0x74, 0x3A, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x2D, 0x65, 0x6E, 0x64, 0x3B,
+    0x0A, 0x20, 0x20, 0x67, 0x61, 0x70, 0x3A, 0x20, 0x31, 0x32, 0x70, 0x78,
+    0x3B, 0x0A, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x74,
+    0x6F, 0x70, 0x3A, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6F, 0x6C, 0x69,
+    0x64, 0x20, 0x23, 0x65, 0x65, 0x65, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x72,
+    0x6F, 0x77, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C,
+    0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x3B, 0x0A, 0x20, 0x20,
+    0x66, 0x6C, 0x65, 0x78, 0x2D, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69,
+    0x6F, 0x6E, 0x3A, 0x20, 0x72, 0x6F, 0x77, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E,
+    0x69, 0x74, 0x65, 0x6D, 0x73, 0x2D, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72,
+    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x2D, 0x69,
+    0x74, 0x65, 0x6D, 0x73, 0x3A, 0x20, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72,
+    0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x6A, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79,
+    0x2D, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x20, 0x7B, 0x0A, 0x20,
+    0x20, 0x6A, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2D, 0x63, 0x6F, 0x6E,
+    0x74, 0x65, 0x6E, 0x74, 0x3A, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x2D,
+    0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E,
+    0x67, 0x61, 0x70, 0x2D, 0x73, 0x6D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x67,
+    0x61, 0x70, 0x3A, 0x20, 0x38, 0x70, 0x78, 0x3B, 0x0A, 0x7D, 0x0A, 0x23,
+    0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x2D, 0x6F, 0x76, 0x65, 0x72,
+    0x6C, 0x61, 0x79, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x70, 0x6F, 0x73, 0x69,
+    0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x66, 0x69, 0x78, 0x65, 0x64, 0x3B,
+    0x0A, 0x20, 0x20, 0x74, 0x6F, 0x70, 0x3A, 0x20, 0x30, 0x3B, 0x0A, 0x20,
+    0x20, 0x6C, 0x65, 0x66, 0x74, 0x3A, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20,
+    0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x31, 0x30, 0x30, 0x25, 0x3B,
+    0x0A, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x31,
+    0x30, 0x30, 0x25, 0x3B, 0x0A, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67,
+    0x72, 0x6F, 0x75, 0x6E, 0x64, 0x3A, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x61,
+    0x72, 0x2D, 0x67, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x28, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x31, 0x33, 0x35, 0x64, 0x65, 0x67, 0x2C, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x35, 0x2C,
+    0x20, 0x31, 0x31, 0x38, 0x2C, 0x20, 0x32, 0x31, 0x30, 0x2C, 0x20, 0x30,
+    0x2E, 0x35, 0x29, 0x20, 0x30, 0x25, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x31, 0x2C, 0x20, 0x31, 0x30, 0x31,
+    0x2C, 0x20, 0x31, 0x39, 0x32, 0x2C, 0x20, 0x30, 0x2E, 0x35, 0x29, 0x20,
+    0x31, 0x30, 0x30, 0x25, 0x0A, 0x20, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20,
+    0x62, 0x61, 0x63, 0x6B, 0x64, 0x72, 0x6F, 0x70, 0x2D, 0x66, 0x69, 0x6C,
+    0x74, 0x65, 0x72, 0x3A, 0x20, 0x62, 0x6C, 0x75, 0x72, 0x28, 0x38, 0x70,
+    0x78, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x7A, 0x2D, 0x69, 0x6E, 0x64, 0x65,
+    0x78, 0x3A, 0x20, 0x31, 0x30, 0x30, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x64,
+    0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65, 0x78,
+    0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x2D, 0x64, 0x69, 0x72,
+    0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x63, 0x6F, 0x6C, 0x75,
+    0x6D, 0x6E, 0x3B, 0x0A, 0x20, 0x20, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x2D,
+    0x69, 0x74, 0x65, 0x6D, 0x73, 0x3A, 0x20, 0x63, 0x65, 0x6E, 0x74, 0x65,
+    0x72, 0x3B, 0x0A, 0x20, 0x20, 0x6A, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79,
+    0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x3A, 0x20, 0x63, 0x65,
+    0x6E, 0x74, 0x65, 0x72, 0x3B, 0x0A, 0x20, 0x20, 0x61, 0x6E, 0x69, 0x6D,
+    0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x6C,
+    0x61, 0x79, 0x46, 0x61, 0x64, 0x65, 0x49, 0x6E, 0x20, 0x30, 0x2E, 0x33,
+    0x73, 0x20, 0x65, 0x61, 0x73, 0x65, 0x3B, 0x0A, 0x7D, 0x0A, 0x40, 0x6B,
+    0x65, 0x79, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x73, 0x20, 0x6F, 0x76, 0x65,
+    0x72, 0x6C, 0x61, 0x79, 0x46, 0x61, 0x64, 0x65, 0x49, 0x6E, 0x20, 0x7B,
+    0x0A, 0x20, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x7B, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x6F, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3A, 0x20, 0x30,
+    0x3B, 0x0A, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x74, 0x6F, 0x20, 0x7B,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79,
+    0x3A, 0x20, 0x31, 0x3B, 0x0A, 0x20, 0x20, 0x7D, 0x0A, 0x7D, 0x0A, 0x2E,
+    0x73, 0x70, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20,
+    0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x72, 0x65,
+    0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x77, 0x69,
+    0x64, 0x74, 0x68, 0x3A, 0x20, 0x36, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x20,
+    0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x36, 0x30, 0x70,
+    0x78, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x73, 0x70, 0x69, 0x6E, 0x6E, 0x65,
+    0x72, 0x3A, 0x3A, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x2C, 0x0A, 0x2E,
+    0x73, 0x70, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x3A, 0x3A, 0x61, 0x66, 0x74,
+    0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65,
+    0x6E, 0x74, 0x3A, 0x20, 0x27, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x70, 0x6F,
+    0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x61, 0x62, 0x73, 0x6F,
+    0x6C, 0x75, 0x74, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64,
+    0x65, 0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x35,
+    0x30, 0x25, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x73, 0x70, 0x69, 0x6E, 0x6E,
+    0x65, 0x72, 0x3A, 0x3A, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x7B,
+    0x0A, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x36, 0x30,
+    0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74,
+    0x3A, 0x20, 0x36, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x62, 0x6F,
+    0x72, 0x64, 0x65, 0x72, 0x3A, 0x20, 0x31, 0x30, 0x70, 0x78, 0x20, 0x73,
+    0x6F, 0x6C, 0x69, 0x64, 0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x35,
+    0x35, 0x2C, 0x20, 0x32, 0x35, 0x35, 0x2C, 0x20, 0x32, 0x35, 0x35, 0x2C,
+    0x20, 0x30, 0x2E, 0x33, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x61, 0x6E, 0x69,
+    0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x70, 0x75, 0x6C, 0x73,
+    0x65, 0x20, 0x31, 0x2E, 0x35, 0x73, 0x20, 0x65, 0x61, 0x73, 0x65, 0x2D,
+    0x69, 0x6E, 0x2D, 0x6F, 0x75, 0x74, 0x20, 0x69, 0x6E, 0x66, 0x69, 0x6E,
+    0x69, 0x74, 0x65, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x73, 0x70, 0x69, 0x6E,
+    0x6E, 0x65, 0x72, 0x3A, 0x3A, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x7B,
+    0x0A, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x36, 0x30,
+    0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74,
+    0x3A, 0x20, 0x36, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x62, 0x6F,
+    0x72, 0x64, 0x65, 0x72, 0x3A, 0x20, 0x31, 0x30, 0x70, 0x78, 0x20, 0x73,
+    0x6F, 0x6C, 0x69, 0x64, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x70, 0x61,
+    0x72, 0x65, 0x6E, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64,
+    0x65, 0x72, 0x2D, 0x74, 0x6F, 0x70, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72,
+    0x3A, 0x20, 0x23, 0x66, 0x66, 0x66, 0x3B, 0x0A, 0x20, 0x20, 0x62, 0x6F,
+    0x72, 0x64, 0x65, 0x72, 0x2D, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2D, 0x63,
+    0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x66, 0x66, 0x66, 0x3B, 0x0A,
+    0x20, 0x20, 0x61, 0x6E, 0x69, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3A,
+    0x20, 0x73, 0x70, 0x69, 0x6E, 0x20, 0x31, 0x73, 0x20, 0x63, 0x75, 0x62,
+    0x69, 0x63, 0x2D, 0x62, 0x65, 0x7A, 0x69, 0x65, 0x72, 0x28, 0x30, 0x2E,
+    0x36, 0x38, 0x2C, 0x20, 0x2D, 0x30, 0x2E, 0x35, 0x35, 0x2C, 0x20, 0x30,
+    0x2E, 0x32, 0x36, 0x35, 0x2C, 0x20, 0x31, 0x2E, 0x35, 0x35, 0x29, 0x20,
+    0x69, 0x6E, 0x66, 0x69, 0x6E, 0x69, 0x74, 0x65, 0x3B, 0x0A, 0x7D, 0x0A,
+    0x40, 0x6B, 0x65, 0x79, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x73, 0x20, 0x73,
+    0x70, 0x69, 0x6E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x30, 0x25, 0x20, 0x7B,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F,
+    0x72, 0x6D, 0x3A, 0x20, 0x72, 0x6F, 0x74, 0x61, 0x74, 0x65, 0x28, 0x30,
+    0x64, 0x65, 0x67, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20,
+    0x31, 0x30, 0x30, 0x25, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x74,
+    0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x3A, 0x20, 0x72, 0x6F,
+    0x74, 0x61, 0x74, 0x65, 0x28, 0x33, 0x36, 0x30, 0x64, 0x65, 0x67, 0x29,
+    0x3B, 0x0A, 0x20, 0x20, 0x7D, 0x0A, 0x7D, 0x0A, 0x40, 0x6B, 0x65, 0x79,
+    0x66, 0x72, 0x61, 0x6D, 0x65, 0x73, 0x20, 0x70, 0x75, 0x6C, 0x73, 0x65,
+    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x30, 0x25, 0x2C, 0x0A, 0x20, 0x20, 0x31,
+    0x30, 0x30, 0x25, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72,
+    0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x3A, 0x20, 0x73, 0x63, 0x61,
+    0x6C, 0x65, 0x28, 0x31, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6F,
+    0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3A, 0x20, 0x31, 0x3B, 0x0A, 0x20,
+    0x20, 0x7D, 0x0A, 0x20, 0x20, 0x35, 0x30, 0x25, 0x20, 0x7B, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D,
+    0x3A, 0x20, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x28, 0x31, 0x2E, 0x31, 0x29,
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x70, 0x61, 0x63, 0x69, 0x74,
+    0x79, 0x3A, 0x20, 0x30, 0x2E, 0x35, 0x3B, 0x0A, 0x20, 0x20, 0x7D, 0x0A,
+    0x7D, 0x0A, 0x23, 0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x2D, 0x6D,
+    0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x63,
+    0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x77, 0x68, 0x69, 0x74, 0x65, 0x3B,
+    0x0A, 0x20, 0x20, 0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x7A, 0x65,
+    0x3A, 0x20, 0x31, 0x72, 0x65, 0x6D, 0x3B, 0x0A, 0x20, 0x20, 0x66, 0x6F,
+    0x6E, 0x74, 0x2D, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x35,
+    0x30, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x6C, 0x65, 0x74, 0x74, 0x65, 0x72,
+    0x2D, 0x73, 0x70, 0x61, 0x63, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x30, 0x2E,
+    0x35, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x61, 0x6E, 0x69, 0x6D, 0x61,
+    0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x74, 0x65, 0x78, 0x74, 0x47, 0x6C,
+    0x6F, 0x77, 0x20, 0x31, 0x2E, 0x35, 0x73, 0x20, 0x65, 0x61, 0x73, 0x65,
+    0x2D, 0x69, 0x6E, 0x2D, 0x6F, 0x75, 0x74, 0x20, 0x69, 0x6E, 0x66, 0x69,
+    0x6E, 0x69, 0x74, 0x65, 0x3B, 0x0A, 0x7D, 0x0A, 0x40, 0x6B, 0x65, 0x79,
+    0x66, 0x72, 0x61, 0x6D, 0x65, 0x73, 0x20, 0x74, 0x65, 0x78, 0x74, 0x47,
+    0x6C, 0x6F, 0x77, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x30, 0x25, 0x2C, 0x0A,
+    0x20, 0x20, 0x31, 0x30, 0x30, 0x25, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x73, 0x68, 0x61, 0x64, 0x6F, 0x77,
+    0x3A, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x30, 0x70, 0x78, 0x20, 0x72,
+    0x67, 0x62, 0x61, 0x28, 0x32, 0x35, 0x35, 0x2C, 0x20, 0x32, 0x35, 0x35,
+    0x2C, 0x20, 0x32, 0x35, 0x35, 0x2C, 0x20, 0x30, 0x2E, 0x35, 0x29, 0x3B,
+    0x0A, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x35, 0x30, 0x25, 0x20, 0x7B,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x73, 0x68,
+    0x61, 0x64, 0x6F, 0x77, 0x3A, 0x20, 0x30, 0x20, 0x30, 0x20, 0x32, 0x30,
+    0x70, 0x78, 0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 0x32, 0x35, 0x35, 0x2C,
+    0x20, 0x32, 0x35, 0x35, 0x2C, 0x20, 0x32, 0x35, 0x35, 0x2C, 0x20, 0x30,
+    0x2E, 0x38, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x7D, 0x0A, 0x7D, 0x0A, 0x23,
+    0x74, 0x6F, 0x61, 0x73, 0x74, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69,
+    0x6E, 0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x70, 0x6F, 0x73, 0x69,
+    0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x66, 0x69, 0x78, 0x65, 0x64, 0x3B,
+    0x0A, 0x20, 0x20, 0x74, 0x6F, 0x70, 0x3A, 0x20, 0x32, 0x30, 0x70, 0x78,
+    0x3B, 0x0A, 0x20, 0x20, 0x6C, 0x65, 0x66, 0x74, 0x3A, 0x20, 0x35, 0x30,
+    0x25, 0x3B, 0x0A, 0x20, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F,
+    0x72, 0x6D, 0x3A, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x6C, 0x61, 0x74,
+    0x65, 0x58, 0x28, 0x2D, 0x35, 0x30, 0x25, 0x29, 0x3B, 0x0A, 0x20, 0x20,
+    0x7A, 0x2D, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x3A, 0x20, 0x32, 0x30, 0x30,
+    0x30, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x74, 0x6F, 0x61, 0x73, 0x74, 0x20,
+    0x7B, 0x0A, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75,
+    0x6E, 0x64, 0x3A, 0x20, 0x23, 0x33, 0x33, 0x33, 0x3B, 0x0A, 0x20, 0x20,
+    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x66, 0x66, 0x66, 0x3B,
+    0x0A, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20,
+    0x31, 0x32, 0x70, 0x78, 0x20, 0x32, 0x34, 0x70, 0x78, 0x3B, 0x0A, 0x20,
+    0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x72, 0x61, 0x64, 0x69,
+    0x75, 0x73, 0x3A, 0x20, 0x34, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x6D,
+    0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D,
+    0x3A, 0x20, 0x31, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x64, 0x69,
+    0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x3B,
+    0x0A, 0x20, 0x20, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x2D, 0x69, 0x74, 0x65,
+    0x6D, 0x73, 0x3A, 0x20, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x3B, 0x0A,
+    0x20, 0x20, 0x67, 0x61, 0x70, 0x3A, 0x20, 0x31, 0x30, 0x70, 0x78, 0x3B,
+    0x0A, 0x20, 0x20, 0x62, 0x6F, 0x78, 0x2D, 0x73, 0x68, 0x61, 0x64, 0x6F,
+    0x77, 0x3A, 0x20, 0x30, 0x20, 0x33, 0x70, 0x78, 0x20, 0x35, 0x70, 0x78,
+    0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 0x30, 0x2C, 0x20, 0x30, 0x2C, 0x20,
+    0x30, 0x2C, 0x20, 0x30, 0x2E, 0x32, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x61,
+    0x6E, 0x69, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x66, 0x61,
+    0x64, 0x65, 0x49, 0x6E, 0x20, 0x30, 0x2E, 0x33, 0x73, 0x2C, 0x20, 0x66,
+    0x61, 0x64, 0x65, 0x4F, 0x75, 0x74, 0x20, 0x30, 0x2E, 0x33, 0x73, 0x20,
+    0x32, 0x2E, 0x37, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x77, 0x61, 0x72, 0x64,
+    0x73, 0x3B, 0x0A, 0x7D, 0x0A, 0x2E, 0x74, 0x6F, 0x61, 0x73, 0x74, 0x2E,
+    0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x76, 0x65, 0x20, 0x7B, 0x0A, 0x20,
+    0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D,
+    0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D,
+    0x2D, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x76, 0x65, 0x29, 0x3B, 0x0A,
+    0x7D, 0x0A, 0x2E, 0x74, 0x6F, 0x61, 0x73, 0x74, 0x2E, 0x6E, 0x65, 0x67,
+    0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x62, 0x61,
+    0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C,
+    0x6F, 0x72, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x6E, 0x65,
+    0x67, 0x61, 0x74, 0x69, 0x76, 0x65, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x40,
+    0x6B, 0x65, 0x79, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x73, 0x20, 0x66, 0x61,
+    0x64, 0x65, 0x49, 0x6E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x66, 0x72, 0x6F,
+    0x6D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x70, 0x61, 0x63,
+    0x69, 0x74, 0x79, 0x3A, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x3A, 0x20, 0x74,
+    0x72, 0x61, 0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x59, 0x28, 0x2D, 0x32,
+    0x30, 0x70, 0x78, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20,
+    0x74, 0x6F, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x70, 0x61,
+    0x63, 0x69, 0x74, 0x79, 0x3A, 0x20, 0x31, 0x3B, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x3A, 0x20,
+    0x74, 0x72, 0x61, 0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x59, 0x28, 0x30,
+    0x29, 0x3B, 0x0A, 0x20, 0x20, 0x7D, 0x0A, 0x7D, 0x0A, 0x40, 0x6B, 0x65,
+    0x79, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x73, 0x20, 0x66, 0x61, 0x64, 0x65,
+    0x4F, 0x75, 0x74, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x66, 0x72, 0x6F, 0x6D,
+    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x70, 0x61, 0x63, 0x69,
+    0x74, 0x79, 0x3A, 0x20, 0x31, 0x3B, 0x0A, 0x20, 0x20, 0x7D, 0x0A, 0x20,
+    0x20, 0x74, 0x6F, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x70,
+    0x61, 0x63, 0x69, 0x74, 0x79, 0x3A, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20,
+    0x7D, 0x0A, 0x7D, 0x0A, 0x40, 0x6D, 0x65, 0x64, 0x69, 0x61, 0x20, 0x28,
+    0x6D, 0x61, 0x78, 0x2D, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x36,
+    0x30, 0x30, 0x70, 0x78, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x61, 0x73,
+    0x69, 0x64, 0x65, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72,
+    0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x3A, 0x20, 0x74, 0x72, 0x61,
+    0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x58, 0x28, 0x2D, 0x31, 0x30, 0x30,
+    0x25, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x6D, 0x61,
+    0x69, 0x6E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72,
+    0x67, 0x69, 0x6E, 0x2D, 0x6C, 0x65, 0x66, 0x74, 0x3A, 0x20, 0x30, 0x3B,
+    0x0A, 0x20, 0x20, 0x7D, 0x0A, 0x7D, 0x0A
 };
-const size_t index_html_size = 7922;
-const size_t index_html_original_size = 42906;
-const bool index_html_is_compressed = true;
+// gzip: 2208 bytes (ratio: 3.93x)
+const uint8_t assets_app_85d26ff2_css_gzip_data[] = {
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xC5, 0x5A,
+    0x5B, 0x8F, 0xDB, 0xB8, 0x15, 0x7E, 0xCF, 0xAF, 0x50, 0x31, 0x08, 0x62,
+    0x6F, 0x2D, 0x43, 0xB2, 0x47, 0xCE, 0x8C, 0x83, 0x05, 0x5A, 0x14, 0x68,
+    0xD1, 0xA7, 0x7D, 0xE8, 0x4B, 0x8B, 0xA2, 0x0F, 0x94, 0x44, 0xD9, 0xDC,
+    0xC8, 0xA2, 0x40, 0xD2, 0xE3, 0x99, 0x14, 0xF9, 0xEF, 0x3D, 0xBC, 0x8A,
+    0xA4, 0x29, 0x67, 0x66, 0xB6, 0x45, 0xE1, 0xC4, 0xB1, 0x28, 0x9E, 0xC3,
+    0x73, 0xF9, 0xCE, 0x4D, 0xCA, 0x9E, 0x51, 0x2A, 0xB2, 0x7F, 0x7F, 0xC8,
+    0xB2, 0x3C, 0x1F, 0x19, 0x39, 0x21, 0xF6, 0xB2, 0xCF, 0xEE, 0xCA, 0xC7,
+    0xCF, 0xBB, 0x76, 0xF3, 0x45, 0xAD, 0x72, 0xDC, 0xD0, 0xA1, 0xD5, 0xEB,
+    0x9B, 0x1D, 0xDA, 0x3D, 0x22, 0xBD, 0x3E, 0x52, 0x4E, 0x04, 0x79, 0xC2,
+    0x72, 0xB9, 0xAC, 0xD1, 0x7D, 0xA5, 0x97, 0x07, 0x7C, 0x40, 0x66, 0xB9,
+    0x29, 0x8B, 0xA2, 0x34, 0xCB, 0xF5, 0x21, 0x3F, 0x30, 0x2C, 0x79, 0x74,
+    0x95, 0xFC, 0x98, 0x55, 0xCA, 0x5A, 0xCC, 0xF2, 0x86, 0xF6, 0x94, 0xC1,
+    0x2D, 0x5C, 0xC8, 0x8F, 0xBE, 0xD5, 0x32, 0x74, 0x81, 0x5B, 0x17, 0xD2,
+    0x8A, 0xE3, 0x3E, 0xDB, 0x54, 0xC5, 0xF8, 0xAC, 0x6F, 0x1C, 0x31, 0x92,
+    0x34, 0x47, 0x4C, 0x0E, 0x47, 0xB1, 0xCF, 0xF4, 0x8D, 0xEF, 0x1F, 0x7E,
+    0x52, 0x4A, 0xD4, 0xF4, 0x39, 0xE7, 0xE4, 0x1B, 0x19, 0x0E, 0xFB, 0xCC,
+    0x30, 0x87, 0x25, 0x49, 0x08, 0x9A, 0x1D, 0xC8, 0xB0, 0xCF, 0x14, 0xFB,
+    0x11, 0xB5, 0xAD, 0xDA, 0x53, 0x48, 0xD2, 0x9A, 0xB6, 0x2F, 0x8A, 0xBA,
+    0xA3, 0x83, 0xC8, 0x3B, 0x74, 0x22, 0x3D, 0x08, 0xFA, 0x47, 0x46, 0x50,
+    0xBF, 0xCA, 0x38, 0x1A, 0x38, 0xD8, 0x80, 0x91, 0x4E, 0x12, 0xD6, 0xA8,
+    0xF9, 0x7A, 0x60, 0xF4, 0x3C, 0xB4, 0x56, 0xE8, 0x27, 0xC4, 0x16, 0x4E,
+    0xBD, 0xA5, 0xDC, 0x63, 0xB5, 0xD9, 0x6E, 0xB7, 0xF2, 0xD2, 0x0A, 0x0A,
+    0xC6, 0x78, 0x3A, 0xCA, 0x85, 0x96, 0xF0, 0xB1, 0x47, 0x70, 0x42, 0xD7,
+    0x63, 0x25, 0x9A, 0xFC, 0x37, 0x6F, 0x09, 0xC3, 0x8D, 0x20, 0x14, 0x44,
+    0x04, 0x06, 0xE7, 0xD3, 0x20, 0xEF, 0xD0, 0x27, 0xCC, 0xBA, 0x9E, 0x5E,
+    0xF6, 0xD9, 0x91, 0xB4, 0x2D, 0x56, 0x6B, 0x4A, 0x48, 0xD0, 0x11, 0x2C,
+    0x5C, 0xAC, 0x1F, 0x18, 0x3E, 0x49, 0x15, 0xD6, 0xC0, 0x90, 0x9E, 0xB5,
+    0x23, 0x93, 0xFC, 0xE1, 0x7C, 0x5F, 0x98, 0x06, 0xF5, 0xCD, 0x42, 0x49,
+    0x94, 0xE5, 0x46, 0x85, 0xC0, 0xAE, 0xCB, 0xA5, 0xE4, 0xAA, 0x97, 0x14,
+    0x53, 0x4B, 0x98, 0xDA, 0x7B, 0xCB, 0x30, 0x06, 0x53, 0x81, 0x61, 0xBA,
+    0xAE, 0x4B, 0xDA, 0x01, 0xF5, 0xE4, 0x30, 0xE4, 0x44, 0xE0, 0x13, 0x07,
+    0x09, 0xF1, 0x20, 0x30, 0x0B, 0x9D, 0x95, 0x95, 0x3B, 0x8D, 0x02, 0xE5,
+    0xE6, 0x23, 0x6A, 0xA5, 0x65, 0x8A, 0x6C, 0x33, 0x3E, 0x67, 0xF7, 0xF0,
+    0x37, 0x2F, 0xE1, 0x8B, 0x1D, 0x6A, 0xB4, 0x28, 0x56, 0x99, 0xF9, 0xB3,
+    0xDE, 0xA8, 0xA3, 0xBF, 0xE5, 0x64, 0x68, 0x95, 0x15, 0x94, 0xC7, 0xD7,
+    0x46, 0x81, 0x5A, 0x0C, 0x1A, 0x36, 0x4E, 0xFA, 0x7D, 0x36, 0xD0, 0x01,
+    0xEB, 0x33, 0x24, 0x7C, 0xA6, 0xEB, 0xE6, 0xCC, 0xB8, 0x14, 0x7F, 0xA4,
+    0xE4, 0x4A, 0xB2, 0x07, 0x2B, 0x96, 0x42, 0x1C, 0x43, 0x2D, 0x39, 0x73,
+    0x09, 0xCD, 0x8F, 0x13, 0xF2, 0x72, 0x66, 0x60, 0x60, 0x54, 0x78, 0xAD,
+    0xF6, 0xBF, 0x9E, 0xB9, 0x20, 0xDD, 0x0B, 0x58, 0x15, 0x56, 0x06, 0x31,
+    0xDD, 0x0A, 0xB4, 0xD8, 0x1F, 0x25, 0x54, 0x22, 0x5D, 0xAC, 0x27, 0x62,
+    0x93, 0x14, 0xD5, 0xD2, 0x27, 0x17, 0x44, 0xF4, 0x78, 0xC2, 0xBF, 0x86,
+    0x56, 0xB9, 0xAE, 0x14, 0xB4, 0xCC, 0xE2, 0xC5, 0xB8, 0xBF, 0xA6, 0x7D,
+    0x1B, 0x40, 0x6A, 0x62, 0x73, 0x42, 0x4D, 0xCC, 0xA4, 0x58, 0x7F, 0x36,
+    0x4C, 0x02, 0xD7, 0x7F, 0xFF, 0x80, 0x38, 0x69, 0xF5, 0x91, 0x26, 0xBE,
+    0x35, 0x58, 0xFC, 0x98, 0x9F, 0x41, 0x95, 0x05, 0x8F, 0x35, 0xB5, 0x31,
+    0x2A, 0x38, 0x9E, 0xD3, 0x9E, 0xB4, 0x36, 0x1C, 0xBD, 0xBC, 0xA2, 0x18,
+    0x09, 0x06, 0x61, 0x4C, 0x74, 0x78, 0xA9, 0xDF, 0x1D, 0x65, 0x27, 0x90,
+    0x6F, 0xCB, 0x33, 0x8C, 0xB8, 0xF2, 0xAF, 0xCE, 0x67, 0x72, 0x03, 0xC3,
+    0xBD, 0x4A, 0x61, 0x51, 0xF4, 0x7E, 0x0C, 0x80, 0x54, 0x29, 0xDD, 0x07,
+    0xF4, 0x94, 0xF7, 0x84, 0xEB, 0xC0, 0x93, 0x3F, 0x72, 0x2E, 0x5E, 0x7A,
+    0x3C, 0xA1, 0xC6, 0x87, 0x88, 0xCE, 0x36, 0x8A, 0x46, 0xBA, 0x59, 0xD1,
+    0xB8, 0xFB, 0xA5, 0x44, 0xF1, 0x5B, 0xC1, 0x91, 0xC0, 0xA4, 0xAF, 0x69,
+    0x6C, 0x3E, 0x19, 0x0E, 0xFC, 0x2A, 0x45, 0x79, 0x22, 0xBD, 0x0B, 0x46,
+    0x96, 0x78, 0x8D, 0x1A, 0x69, 0x35, 0x45, 0x3D, 0x9B, 0x03, 0x66, 0xD8,
+    0x6E, 0xAA, 0x55, 0x56, 0x96, 0x0F, 0xAB, 0x6C, 0x53, 0x2A, 0xDE, 0xA5,
+    0xC7, 0x1A, 0x90, 0xAF, 0x78, 0xA6, 0xE3, 0xC8, 0x16, 0x88, 0x7B, 0x7D,
+    0x69, 0xFD, 0x65, 0xAF, 0x3B, 0xD2, 0xF7, 0x7B, 0x69, 0x27, 0x06, 0x46,
+    0xFB, 0x93, 0x3C, 0xF1, 0xCB, 0xBC, 0x78, 0xD6, 0xA1, 0xA8, 0xC6, 0xFD,
+    0x7C, 0x2A, 0x4D, 0xA5, 0x6A, 0x9F, 0x12, 0x22, 0x81, 0x0C, 0xD7, 0xA1,
+    0xF0, 0x98, 0x8A, 0xA7, 0xAA, 0x28, 0x22, 0x62, 0x7E, 0xAE, 0x13, 0x61,
+    0x54, 0x45, 0x71, 0xF4, 0xB9, 0x92, 0x1F, 0x49, 0x3A, 0x1D, 0x36, 0x65,
+    0x79, 0x07, 0x2A, 0x6B, 0x05, 0x5B, 0x47, 0x72, 0x50, 0x05, 0x9D, 0x05,
+    0x55, 0x67, 0x8E, 0xE8, 0x80, 0x6F, 0x68, 0x79, 0x61, 0x68, 0xDC, 0x67,
+    0xF2, 0x5B, 0x2E, 0x1D, 0xE4, 0x85, 0x65, 0x17, 0xA0, 0x51, 0x6D, 0xE6,
+    0x02, 0x31, 0xA1, 0xB8, 0x36, 0x88, 0xB5, 0x57, 0x39, 0x35, 0x8E, 0x5A,
+    0x93, 0x20, 0x1F, 0x52, 0xD9, 0x5C, 0xC6, 0x72, 0x35, 0x9B, 0xC8, 0x0D,
+    0x08, 0x6A, 0x2A, 0x04, 0x3D, 0x4D, 0x12, 0x9D, 0xD0, 0xB3, 0x6D, 0x15,
+    0xEE, 0x0B, 0xD3, 0x2A, 0x18, 0x83, 0xC0, 0xC7, 0x2D, 0x5D, 0xD7, 0x53,
+    0x23, 0x71, 0xEE, 0x95, 0xBA, 0x29, 0x24, 0xDF, 0x18, 0x8D, 0xAE, 0xE1,
+    0xD0, 0xB2, 0x4D, 0x49, 0xE9, 0x0E, 0x77, 0xF2, 0xE3, 0xEC, 0xE8, 0xCA,
+    0x58, 0x22, 0xBD, 0x6D, 0xE4, 0x67, 0x92, 0x2B, 0x9D, 0x9C, 0x67, 0xA1,
+    0xF4, 0x7A, 0x61, 0x95, 0x20, 0x0F, 0xBA, 0x77, 0xD2, 0x47, 0xB9, 0x36,
+    0x28, 0x30, 0x80, 0xFE, 0x0A, 0x36, 0x22, 0x05, 0x7E, 0x1E, 0xEE, 0x7D,
+    0xB0, 0x5B, 0x67, 0xAD, 0x76, 0x55, 0xC9, 0x14, 0x72, 0xF0, 0xD0, 0x5E,
+    0x89, 0x23, 0x93, 0x73, 0x2E, 0x0D, 0x33, 0xFA, 0x81, 0x6F, 0xED, 0x1A,
+    0xEC, 0x62, 0xF4, 0x92, 0xC6, 0xF0, 0x6B, 0xCB, 0x29, 0x1F, 0x51, 0x83,
+    0xF3, 0x1A, 0x8B, 0x0B, 0xD6, 0xFD, 0x55, 0xFA, 0xB4, 0x44, 0x4E, 0xA8,
+    0x7B, 0xDA, 0x7C, 0x9D, 0xA3, 0xB8, 0x91, 0x02, 0x93, 0x0D, 0x1C, 0x19,
+    0xC6, 0xB3, 0xF8, 0xA7, 0x78, 0x19, 0xF1, 0xCF, 0x9F, 0x04, 0x7E, 0x16,
+    0x9F, 0xFE, 0xB5, 0x0A, 0xD6, 0x86, 0xF3, 0xA9, 0xC6, 0x4C, 0xAE, 0x72,
+    0xDC, 0x43, 0xF6, 0xF1, 0x8B, 0xA7, 0xAD, 0x4D, 0xA1, 0x2F, 0x0A, 0xBF,
+    0x27, 0x09, 0xD0, 0xD8, 0x34, 0x4D, 0x22, 0x18, 0x6D, 0xC2, 0x4C, 0xE5,
+    0xAC, 0x30, 0x96, 0x0D, 0x44, 0xA3, 0x5A, 0xE3, 0x95, 0x5C, 0x53, 0x67,
+    0x8C, 0x56, 0xFB, 0x8E, 0x36, 0x67, 0x6E, 0x05, 0xD7, 0x57, 0x4A, 0x7C,
+    0x68, 0x58, 0x7B, 0x32, 0xE0, 0xB8, 0xE5, 0xCA, 0x5F, 0x51, 0x3C, 0xA6,
+    0x56, 0x42, 0x1F, 0x01, 0x4E, 0x41, 0x75, 0x8F, 0x5B, 0xBF, 0xF8, 0xDC,
+    0x3D, 0x3E, 0x3E, 0x5E, 0x51, 0xD9, 0x11, 0x03, 0xF0, 0x23, 0xE8, 0xE1,
+    0xD0, 0xE3, 0x9C, 0x5F, 0x88, 0x68, 0x8E, 0x1A, 0xCC, 0xC9, 0x16, 0xC0,
+    0x39, 0x9C, 0x0C, 0x52, 0xDC, 0xDC, 0xF9, 0xDD, 0x25, 0x9C, 0xA8, 0xF4,
+    0x6C, 0x0C, 0x40, 0xC3, 0x03, 0x94, 0xA0, 0x5A, 0x6F, 0x80, 0x1C, 0x11,
+    0x2F, 0x66, 0x16, 0x31, 0x5C, 0x0A, 0x9F, 0x85, 0x16, 0x90, 0x83, 0xB7,
+    0x6C, 0x4E, 0x72, 0x92, 0xA1, 0x1A, 0xBC, 0x78, 0x16, 0x73, 0x2D, 0xA9,
+    0xA0, 0xA3, 0xE1, 0xD5, 0xE3, 0x4E, 0x98, 0x9F, 0xCC, 0x71, 0x95, 0x36,
+    0xD6, 0x28, 0x2D, 0x66, 0x12, 0x90, 0x01, 0x87, 0xEF, 0xDA, 0x62, 0x7D,
+    0xCF, 0x13, 0x80, 0xD9, 0xDE, 0x1B, 0x3D, 0xB5, 0x9C, 0xFB, 0x1A, 0x43,
+    0x44, 0xE2, 0x5B, 0xE2, 0xDA, 0x98, 0xFB, 0xF4, 0x29, 0x68, 0xAD, 0xC2,
+    0x4A, 0x6E, 0x2F, 0xB5, 0xFC, 0x5B, 0x8B, 0x62, 0x2D, 0xF5, 0x76, 0x2E,
+    0x71, 0x5E, 0x8E, 0x44, 0x1F, 0xF2, 0x0A, 0xC1, 0x55, 0x5F, 0x6E, 0x91,
+    0xD3, 0x1C, 0x71, 0xF3, 0x15, 0x80, 0xF3, 0xFB, 0xCC, 0xB7, 0xF7, 0x8F,
+    0xC7, 0x99, 0x59, 0x7A, 0xDF, 0x0E, 0xAE, 0xD5, 0x34, 0x5D, 0x27, 0x80,
+    0x0A, 0xFF, 0x7D, 0x51, 0x42, 0x7C, 0xEA, 0x6E, 0xC3, 0xCD, 0x1F, 0xD1,
+    0xAC, 0x91, 0x0E, 0xCD, 0xAB, 0x5C, 0xFB, 0xE5, 0xF5, 0x3D, 0xC6, 0xFB,
+    0x7B, 0xC5, 0x18, 0xFE, 0xEF, 0x9D, 0x57, 0xA2, 0x1C, 0x0F, 0xAA, 0x5B,
+    0x6B, 0xBE, 0xD2, 0xE2, 0x57, 0x03, 0xE4, 0x75, 0xDF, 0xB0, 0x4D, 0xF4,
+    0x0D, 0x65, 0xB5, 0x8C, 0x0F, 0xBC, 0xD9, 0xE6, 0xDE, 0x95, 0xD5, 0xAE,
+    0x6A, 0x8A, 0xF4, 0x98, 0xB9, 0x9B, 0x69, 0x4C, 0x0C, 0x7F, 0xFC, 0x3C,
+    0xA2, 0xA1, 0xF5, 0x73, 0x73, 0x9C, 0x1C, 0xEC, 0xB5, 0xFF, 0x04, 0x62,
+    0x6E, 0x70, 0x4C, 0x4D, 0xFF, 0x0A, 0xE7, 0xB9, 0x2A, 0x5A, 0x12, 0x2E,
+    0xBA, 0x3D, 0x0B, 0x4F, 0x57, 0xBF, 0x65, 0x0D, 0x31, 0xC5, 0xD3, 0x75,
+    0x46, 0xEA, 0xA8, 0x30, 0xF9, 0xA4, 0x8E, 0xF0, 0x51, 0x81, 0xFA, 0xDE,
+    0x9F, 0x92, 0x82, 0x83, 0x3C, 0x2B, 0x9A, 0x03, 0x74, 0x6B, 0x19, 0x4E,
+    0xEC, 0x72, 0x30, 0x2F, 0xA2, 0x6A, 0xE4, 0x14, 0xDD, 0x98, 0x65, 0x85,
+    0x8C, 0x9D, 0x87, 0x8C, 0xE0, 0x84, 0x59, 0x85, 0x4A, 0xD7, 0xD7, 0x59,
+    0xA5, 0x4A, 0xC7, 0xA1, 0x83, 0x58, 0x9B, 0x9D, 0xED, 0xE7, 0xFB, 0x7F,
+    0x4B, 0xFA, 0xE3, 0x49, 0x68, 0x66, 0x64, 0x71, 0xE3, 0xCA, 0x3B, 0x06,
+    0x13, 0x43, 0x9E, 0xF3, 0x53, 0xC0, 0x21, 0xAE, 0x2F, 0x85, 0xAD, 0x2F,
+    0x60, 0x92, 0x20, 0x86, 0xE6, 0xD5, 0xD2, 0xDE, 0x0D, 0xFB, 0x17, 0x69,
+    0x8C, 0xEC, 0x77, 0xE4, 0x34, 0x52, 0x26, 0xD0, 0xA0, 0xBA, 0xF7, 0x3B,
+    0x38, 0xBD, 0x23, 0xD0, 0x56, 0x9D, 0x68, 0x8B, 0xFA, 0xB5, 0xFA, 0x8E,
+    0x12, 0x7A, 0x47, 0x9E, 0x71, 0x3B, 0x5B, 0x69, 0xA2, 0x8E, 0x24, 0x9E,
+    0x9E, 0x7F, 0x3C, 0x54, 0x6E, 0x2B, 0x57, 0xE9, 0x5B, 0x46, 0xC7, 0x1C,
+    0xCC, 0x24, 0x64, 0x66, 0xAC, 0xFB, 0x33, 0x5B, 0x6C, 0x55, 0xDE, 0xFC,
+    0x2F, 0x3C, 0x3B, 0xF1, 0xE6, 0xF8, 0x47, 0xD5, 0x25, 0x80, 0x89, 0x94,
+    0xB2, 0x76, 0xEB, 0x6F, 0x9A, 0x60, 0x24, 0xE4, 0xA5, 0x93, 0xAE, 0x95,
+    0x5B, 0xCE, 0xCD, 0x2A, 0xE6, 0xFA, 0x51, 0x9B, 0x09, 0x0D, 0xE0, 0x3A,
+    0x6D, 0x6E, 0x25, 0xD5, 0xDF, 0x64, 0x61, 0xF9, 0xEB, 0x10, 0x46, 0xE2,
+    0x1F, 0xBE, 0xE2, 0x97, 0x8E, 0xA1, 0x13, 0xE6, 0xE1, 0x26, 0x35, 0x2B,
+    0x30, 0xAA, 0x21, 0x14, 0xC7, 0x7B, 0xBA, 0x24, 0xFD, 0x63, 0x91, 0x4B,
+    0x79, 0x95, 0x74, 0xDF, 0x95, 0x6B, 0x63, 0xE2, 0xF2, 0x16, 0x71, 0x61,
+    0x08, 0x9D, 0x11, 0x53, 0xC3, 0x94, 0x32, 0x88, 0x05, 0xFF, 0x8D, 0x49,
+    0x09, 0xE3, 0x37, 0x4F, 0x31, 0xA5, 0x6D, 0xB8, 0x82, 0xD3, 0x8F, 0x5B,
+    0x6F, 0x78, 0x30, 0xEA, 0x07, 0x0F, 0xB8, 0xCA, 0x4D, 0x75, 0x6B, 0x24,
+    0xD7, 0xCC, 0xAE, 0x87, 0xA2, 0xCD, 0x7D, 0x70, 0x9A, 0xDA, 0x30, 0x5E,
+    0x1F, 0x65, 0xAB, 0xC9, 0x6E, 0xB7, 0x53, 0x31, 0x22, 0x4B, 0xA7, 0x0B,
+    0x87, 0x75, 0xE5, 0x71, 0x48, 0x8E, 0x53, 0x6A, 0x94, 0xB2, 0xE6, 0x7A,
+    0xC7, 0x28, 0xA5, 0x6D, 0xE2, 0x2C, 0xAD, 0x82, 0x35, 0x36, 0x33, 0x48,
+    0x30, 0x3B, 0x3E, 0xC5, 0x0F, 0x3A, 0x60, 0xA3, 0xCE, 0x4F, 0xD2, 0x03,
+    0xB9, 0x76, 0x80, 0xA2, 0x4C, 0x3A, 0x06, 0x36, 0x5A, 0x11, 0xCD, 0x64,
+    0xA5, 0xF6, 0xFE, 0x68, 0xF8, 0x02, 0x32, 0x10, 0xDE, 0xA6, 0x3F, 0xBF,
+    0x5D, 0xB8, 0xEB, 0x29, 0x92, 0x86, 0xC9, 0x65, 0x56, 0x06, 0x41, 0xFF,
+    0x37, 0x49, 0x69, 0xAF, 0xDC, 0x84, 0x18, 0xCC, 0x9E, 0x70, 0x1A, 0x48,
+    0xB8, 0x50, 0xA8, 0x2F, 0xB7, 0x55, 0x8B, 0x0F, 0x2B, 0xF5, 0x3B, 0x99,
+    0xFA, 0xAB, 0x65, 0x56, 0x7C, 0xF4, 0xEF, 0x97, 0x70, 0xBF, 0x90, 0x5F,
+    0x8F, 0x1B, 0x73, 0x5F, 0x1E, 0x06, 0x1B, 0x6E, 0x24, 0xB7, 0x07, 0x13,
+    0x80, 0xDE, 0xA3, 0xEA, 0x99, 0x89, 0x7E, 0xFE, 0x7D, 0xC1, 0xDB, 0xF3,
+    0xA0, 0x97, 0x6A, 0x8C, 0x69, 0xFF, 0x8C, 0x6E, 0xE6, 0x9A, 0x70, 0xD7,
+    0xCD, 0x64, 0x73, 0x23, 0x95, 0xA8, 0x64, 0xC1, 0x47, 0x32, 0x0C, 0x57,
+    0x03, 0x8E, 0x3F, 0x7A, 0x19, 0xCF, 0xED, 0xA2, 0x0A, 0xB8, 0xB3, 0x15,
+    0xD0, 0x70, 0xD8, 0x9B, 0x9E, 0x7B, 0xE5, 0xAD, 0xA0, 0xCE, 0x22, 0x34,
+    0x1A, 0x3B, 0xD2, 0xB3, 0x49, 0x7A, 0x44, 0x88, 0x0F, 0xF0, 0xCB, 0x72,
+    0x5A, 0x28, 0x6F, 0xE0, 0x2E, 0x5C, 0xB8, 0x19, 0xD0, 0x00, 0x6A, 0xA6,
+    0x2F, 0x5B, 0x0D, 0x3C, 0x07, 0x8C, 0xE7, 0x9E, 0x63, 0x99, 0x1C, 0xB4,
+    0xE1, 0x01, 0x07, 0xB9, 0x7C, 0xA7, 0x43, 0xA0, 0x24, 0x0F, 0x6A, 0xBA,
+    0xF9, 0x9E, 0xD4, 0xEF, 0xED, 0xF2, 0xA8, 0xDC, 0x3D, 0x22, 0xD9, 0x79,
+    0x84, 0x39, 0xE2, 0xD6, 0x53, 0xF6, 0xF8, 0x9E, 0x27, 0xB8, 0x14, 0x2A,
+    0x2B, 0x39, 0x74, 0x33, 0x35, 0x69, 0x20, 0x9C, 0xBF, 0x11, 0xCC, 0x16,
+    0xC5, 0x7A, 0x07, 0x11, 0x92, 0x03, 0xFA, 0x95, 0xB6, 0x9B, 0x9D, 0x0C,
+    0x1A, 0xB8, 0x58, 0x06, 0x0A, 0x79, 0xC8, 0x52, 0x5C, 0xA4, 0x42, 0xC5,
+    0x47, 0x83, 0x19, 0xAF, 0xDC, 0x30, 0x2A, 0xA0, 0xD6, 0x2C, 0x0A, 0x08,
+    0x44, 0x57, 0xA6, 0x64, 0x4C, 0xCD, 0xEE, 0xDC, 0xEE, 0xBC, 0xBD, 0xC1,
+    0x39, 0xDA, 0xCC, 0xFA, 0xA0, 0xD5, 0x2C, 0x1B, 0xDE, 0xA0, 0x1E, 0x2F,
+    0xCA, 0xE5, 0x97, 0x24, 0x7A, 0x33, 0x89, 0x90, 0x59, 0xA2, 0xF5, 0x15,
+    0x59, 0xB1, 0xAE, 0xAC, 0x24, 0x2E, 0x95, 0x81, 0x2C, 0xDC, 0x3E, 0x82,
+    0x8D, 0xA7, 0xD8, 0x57, 0x3E, 0xEC, 0xEB, 0xB1, 0x00, 0x14, 0xA8, 0x71,
+    0x40, 0xF7, 0xDB, 0xEB, 0xCA, 0x3C, 0xA1, 0x9D, 0x9C, 0x23, 0xBB, 0xC4,
+    0xBF, 0x40, 0x8B, 0x7F, 0x1B, 0x58, 0x9E, 0x7D, 0x1C, 0x41, 0xDA, 0x44,
+    0xB2, 0xE9, 0x9C, 0x7A, 0x1D, 0xDD, 0xDA, 0xCF, 0x20, 0xBC, 0x5A, 0x26,
+    0xAC, 0x15, 0xD3, 0x6F, 0xE6, 0xE9, 0x1F, 0x9C, 0xFB, 0xEE, 0x04, 0x45,
+    0x5C, 0xA8, 0x04, 0x86, 0xC8, 0x75, 0xCE, 0x08, 0xF3, 0xBF, 0x6D, 0x98,
+    0x75, 0x09, 0x30, 0xC3, 0x54, 0x7A, 0x14, 0xCF, 0xE1, 0x6E, 0x98, 0x75,
+    0x37, 0x45, 0x61, 0x1F, 0x0F, 0x21, 0x9E, 0xE8, 0x03, 0xCD, 0x5B, 0xDD,
+    0x28, 0x18, 0xC2, 0xD7, 0x38, 0x51, 0x9B, 0x13, 0x8D, 0xF1, 0xD1, 0xE3,
+    0x42, 0x3B, 0x1A, 0xBD, 0xAD, 0xE5, 0x29, 0x52, 0x8D, 0xE7, 0xF6, 0xE6,
+    0xA3, 0x73, 0x0F, 0x13, 0xDD, 0x94, 0xE3, 0x57, 0xEA, 0xE2, 0x17, 0x80,
+    0x83, 0xCA, 0xF8, 0x9B, 0xF5, 0x67, 0x0E, 0x50, 0x63, 0x17, 0xC4, 0x5A,
+    0x3E, 0xD9, 0x61, 0x6D, 0xDF, 0xF6, 0xDF, 0x9E, 0xD5, 0xCD, 0xA6, 0xA5,
+    0x47, 0x68, 0xFF, 0x3F, 0xC0, 0x4D, 0x42, 0xBB, 0x69, 0x19, 0x41, 0xB1,
+    0x43, 0xFF, 0xF7, 0x96, 0x36, 0x92, 0xE6, 0x17, 0xF3, 0x0C, 0x2F, 0x25,
+    0x4E, 0x39, 0x7F, 0x58, 0xE1, 0xD8, 0x9D, 0x70, 0x4B, 0x50, 0xB6, 0xF0,
+    0x86, 0x80, 0x9D, 0x1C, 0x02, 0x96, 0xBA, 0x99, 0x72, 0xEF, 0x45, 0x67,
+    0x01, 0x2B, 0x43, 0xD1, 0x69, 0xE5, 0x5E, 0xFE, 0x38, 0x54, 0x79, 0x6D,
+    0x8F, 0x3C, 0xEE, 0x3F, 0xE2, 0x09, 0x13, 0xEC, 0xDF, 0x21, 0x00, 0x00
+};
+
+static const char assets_app_85d26ff2_css_identity_hdr_ok[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: text/css\r\n"
+    "Content-Length: 8671\r\n"
+    "Vary: Accept-Encoding\r\n"
+    "ETag: \"85d26ff26c47f5f2\"\r\n"
+    "Cache-Control: public, max-age=31536000, immutable\r\n"
+    "Connection: close\r\n"
+    "\r\n";
+static const char assets_app_85d26ff2_css_identity_hdr_ok_ka[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: text/css\r\n"
+    "Content-Length: 8671\r\n"
+    "Vary: Accept-Encoding\r\n"
+    "ETag: \"85d26ff26c47f5f2\"\r\n"
+    "Cache-Control: public, max-age=31536000, immutable\r\n"
+    "Connection: keep-alive\r\n"
+    "Keep-Alive: timeout=5\r\n"
+    "\r\n";
+static const char assets_app_85d26ff2_css_identity_hdr_nm[] =
+    "HTTP/1.1 304 Not Modified\r\n"
+    "Vary: Accept-Encoding\r\n"
+    "ETag: \"85d26ff26c47f5f2\"\r\n"
+    "Cache-Control: public, max-age=31536000, immutable\r\n"
+    "Connection: close\r\n"
+    "\r\n";
+static const char assets_app_85d26ff2_css_identity_hdr_nm_ka[] =
+    "HTTP/1.1 304 Not Modified\r\n"
+    "Vary: Accept-Encoding\r\n"
+    "ETag: \"85d26ff26c47f5f2\"\r\n"
+    "Cache-Control: public, max-age=31536000, immutable\r\n"
+    "Connection: keep-alive\r\n"
+    "Keep-Alive: timeout=5\r\n"
+    "\r\n";
+static const char assets_app_85d26ff2_css_gzip_hdr_ok[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: text/css\r\n"
+    "Content-Length: 2208\r\n"
+    "Content-Encoding: gzip\r\n"
+    "Vary: Accept-Encoding\r\n"
+    "ETag: \"85d26ff26c47f5f2-gz\"\r\n"
+    "Cache-Control: public, max-age=31536000, immutable\r\n"
+    "Connection: close\r\n"
+    "\r\n";
+static const char assets_app_85d26ff2_css_gzip_hdr_ok_ka[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: text/css\r\n"
+    "Content-Length: 2208\r\n"
+    "Content-Encoding: gzip\r\n"
+    "Vary: Accept-Encoding\r\n"
+    "ETag: \"85d26ff26c47f5f2-gz\"\r\n"
+    "Cache-Control: public, max-age=31536000, immutable\r\n"
+    "Connection: keep-alive\r\n"
+    "Keep-Alive: timeout=5\r\n"
+    "\r\n";
+static const char assets_app_85d26ff2_css_gzip_hdr_nm[] =
+    "HTTP/1.1 304 Not Modified\r\n"
+    "Vary: Accept-Encoding\r\n"
+    "ETag: \"85d26ff26c47f5f2-gz\"\r\n"
+    "Cache-Control: public, max-age=31536000, immutable\r\n"
+    "Connection: close\r\n"
+    "\r\n";
+static const char assets_app_85d26ff2_css_gzip_hdr_nm_ka[] =
+    "HTTP/1.1 304 Not Modified\r\n"
+    "Vary: Accept-Encoding\r\n"
+    "ETag: \"85d26ff26c47f5f2-gz\"\r\n"
+    "Cache-Control: public, max-age=31536000, immutable\r\n"
+    "Connection: keep-alive\r\n"
+    "Keep-Alive: timeout=5\r\n"
+    "\r\n";
+
+// assets_app_8864ee4b_js: original size 8651 bytes
+const uint8_t assets_app_8864ee4b_js_identity_data[] = {
+    0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20,
+    0x3D, 0x20, 0x7B, 0x20, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x3A,
+    0x20, 0x7B, 0x7D, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x3A, 0x20, 0x7B,
+    0x7D, 0x2C, 0x20, 0x67, 0x70, 0x69, 0x6F, 0x3A, 0x20, 0x7B, 0x7D, 0x20,
+    0x7D, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73,
+    0x68, 0x6F, 0x77, 0x4C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x28, 0x6D,
+    0x73, 0x67, 0x20, 0x3D, 0x20, 0x27, 0x4C, 0x6F, 0x61, 0x64, 0x69, 0x6E,
+    0x67, 0x2E, 0x2E, 0x2E, 0x27, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x64,
+    0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45,
+    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27,
+    0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x2D, 0x6D, 0x65, 0x73, 0x73,
+    0x61, 0x67, 0x65, 0x27, 0x29, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6F,
+    0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x6D, 0x73, 0x67, 0x0A,
+    0x20, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67,
+    0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49,
+    0x64, 0x28, 0x27, 0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x2D, 0x6F,
+    0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x27, 0x29, 0x2E, 0x63, 0x6C, 0x61,
+    0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76,
+    0x65, 0x28, 0x27, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6E, 0x27, 0x29, 0x0A,
+    0x7D, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68,
+    0x69, 0x64, 0x65, 0x4C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x28, 0x29,
+    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E,
+    0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+    0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E,
+    0x67, 0x2D, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x79, 0x27, 0x29, 0x2E,
+    0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x61, 0x64,
+    0x64, 0x28, 0x27, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6E, 0x27, 0x29, 0x0A,
+    0x7D, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73,
+    0x68, 0x6F, 0x77, 0x54, 0x6F, 0x61, 0x73, 0x74, 0x28, 0x6D, 0x65, 0x73,
+    0x73, 0x61, 0x67, 0x65, 0x2C, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3D,
+    0x20, 0x27, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x76, 0x65, 0x27, 0x29,
+    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63,
+    0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x65, 0x72, 0x20, 0x3D, 0x20, 0x64,
+    0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45,
+    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27,
+    0x74, 0x6F, 0x61, 0x73, 0x74, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69,
+    0x6E, 0x65, 0x72, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73,
+    0x74, 0x20, 0x74, 0x6F, 0x61, 0x73, 0x74, 0x20, 0x3D, 0x20, 0x64, 0x6F,
+    0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74,
+    0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x27, 0x64, 0x69,
+    0x76, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x74, 0x6F, 0x61, 0x73, 0x74, 0x2E,
+    0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x20, 0x3D, 0x20,
+    0x60, 0x74, 0x6F, 0x61, 0x73, 0x74, 0x20, 0x24, 0x7B, 0x74, 0x79, 0x70,
+    0x65, 0x7D, 0x60, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20,
+    0x69, 0x63, 0x6F, 0x6E, 0x49, 0x64, 0x20, 0x3D, 0x20, 0x74, 0x79, 0x70,
+    0x65, 0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x27, 0x70, 0x6F, 0x73, 0x69, 0x74,
+    0x69, 0x76, 0x65, 0x27, 0x20, 0x3F, 0x20, 0x27, 0x63, 0x68, 0x65, 0x63,
+    0x6B, 0x5F, 0x63, 0x69, 0x72, 0x63, 0x6C, 0x65, 0x27, 0x20, 0x3A, 0x20,
+    0x27, 0x63, 0x61, 0x6E, 0x63, 0x65, 0x6C, 0x27, 0x0A, 0x20, 0x20, 0x74,
+    0x6F, 0x61, 0x73, 0x74, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54,
+    0x4D, 0x4C, 0x20, 0x3D, 0x20, 0x60, 0x3C, 0x73, 0x76, 0x67, 0x20, 0x63,
+    0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x69, 0x63, 0x6F, 0x6E, 0x2D, 0x73,
+    0x6D, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x66, 0x69,
+    0x6C, 0x6C, 0x3A, 0x77, 0x68, 0x69, 0x74, 0x65, 0x22, 0x3E, 0x3C, 0x75,
+    0x73, 0x65, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x23, 0x24, 0x7B,
+    0x69, 0x63, 0x6F, 0x6E, 0x49, 0x64, 0x7D, 0x22, 0x3E, 0x3C, 0x2F, 0x75,
+    0x73, 0x65, 0x3E, 0x3C, 0x2F, 0x73, 0x76, 0x67, 0x3E, 0x3C, 0x73, 0x70,
+    0x61, 0x6E, 0x3E, 0x24, 0x7B, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65,
+    0x7D, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x60, 0x0A, 0x20, 0x20,
+    0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x65, 0x72, 0x2E, 0x61, 0x70,
+    0x70, 0x65, 0x6E, 0x64, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x74, 0x6F,
+    0x61, 0x73, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x73, 0x65, 0x74, 0x54, 0x69,
+    0x6D, 0x65, 0x6F, 0x75, 0x74, 0x28, 0x28, 0x29, 0x20, 0x3D, 0x3E, 0x20,
+    0x74, 0x6F, 0x61, 0x73, 0x74, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65,
+    0x28, 0x29, 0x2C, 0x20, 0x33, 0x30, 0x30, 0x30, 0x29, 0x0A, 0x7D, 0x0A,
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x68, 0x6F,
+    0x77, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x72, 0x6D, 0x4D, 0x6F, 0x64, 0x61,
+    0x6C, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73,
+    0x74, 0x20, 0x6D, 0x6F, 0x64, 0x61, 0x6C, 0x20, 0x3D, 0x20, 0x64, 0x6F,
+    0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C,
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x63,
+    0x6F, 0x6E, 0x66, 0x69, 0x72, 0x6D, 0x2D, 0x6D, 0x6F, 0x64, 0x61, 0x6C,
+    0x27, 0x29, 0x0A, 0x20, 0x20, 0x6D, 0x6F, 0x64, 0x61, 0x6C, 0x2E, 0x63,
+    0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x72, 0x65, 0x6D,
+    0x6F, 0x76, 0x65, 0x28, 0x27, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6E, 0x27,
+    0x29, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x61,
+    0x6E, 0x63, 0x65, 0x6C, 0x42, 0x74, 0x6E, 0x20, 0x3D, 0x20, 0x64, 0x6F,
+    0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C,
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x6D,
+    0x6F, 0x64, 0x61, 0x6C, 0x2D, 0x63, 0x61, 0x6E, 0x63, 0x65, 0x6C, 0x27,
+    0x29, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x6F,
+    0x6E, 0x66, 0x69, 0x72, 0x6D, 0x42, 0x74, 0x6E, 0x20, 0x3D, 0x20, 0x64,
+    0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45,
+    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27,
+    0x6D, 0x6F, 0x64, 0x61, 0x6C, 0x2D, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x72,
+    0x6D, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20,
+    0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x43, 0x61, 0x6E, 0x63, 0x65, 0x6C,
+    0x20, 0x3D, 0x20, 0x28, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x6D, 0x6F, 0x64, 0x61, 0x6C, 0x2E, 0x63, 0x6C, 0x61,
+    0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x28, 0x27,
+    0x68, 0x69, 0x64, 0x64, 0x65, 0x6E, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x63, 0x6C, 0x65, 0x61, 0x6E, 0x75, 0x70, 0x28, 0x29, 0x0A, 0x20,
+    0x20, 0x7D, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x68,
+    0x61, 0x6E, 0x64, 0x6C, 0x65, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x72, 0x6D,
+    0x20, 0x3D, 0x20, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x28, 0x29, 0x20,
+    0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x6F, 0x64,
+    0x61, 0x6C, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74,
+    0x2E, 0x61, 0x64, 0x64, 0x28, 0x27, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6E,
+    0x27, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6C, 0x65, 0x61, 0x6E,
+    0x75, 0x70, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F,
+    0x77, 0x4C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x28, 0x27, 0x52, 0x65,
+    0x62, 0x6F, 0x6F, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x79, 0x73, 0x74,
+    0x65, 0x6D, 0x2E, 0x2E, 0x2E, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x74, 0x72, 0x79, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x20, 0x3D, 0x20,
+    0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28,
+    0x27, 0x2F, 0x61, 0x70, 0x69, 0x2F, 0x72, 0x65, 0x73, 0x74, 0x61, 0x72,
+    0x74, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+    0x20, 0x28, 0x21, 0x72, 0x65, 0x73, 0x2E, 0x6F, 0x6B, 0x29, 0x20, 0x74,
+    0x68, 0x72, 0x6F, 0x77, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x45, 0x72, 0x72,
+    0x6F, 0x72, 0x28, 0x27, 0x46, 0x61, 0x69, 0x6C, 0x65, 0x64, 0x27, 0x29,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x54,
+    0x6F, 0x61, 0x73, 0x74, 0x28, 0x27, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D,
+    0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x62, 0x6F, 0x6F, 0x74, 0x69, 0x6E,
+    0x67, 0x2E, 0x2E, 0x2E, 0x27, 0x2C, 0x20, 0x27, 0x70, 0x6F, 0x73, 0x69,
+    0x74, 0x69, 0x76, 0x65, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x28,
+    0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x28, 0x29, 0x20, 0x3D, 0x3E, 0x20,
+    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x77,
+    0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x41, 0x6C, 0x6C,
+    0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68,
+    0x69, 0x64, 0x65, 0x4C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x28, 0x29,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x2C, 0x20, 0x35, 0x30,
+    0x30, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x63, 0x61,
+    0x74, 0x63, 0x68, 0x20, 0x28, 0x65, 0x72, 0x72, 0x29, 0x20, 0x7B, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x54, 0x6F,
+    0x61, 0x73, 0x74, 0x28, 0x27, 0x46, 0x61, 0x69, 0x6C, 0x65, 0x64, 0x20,
+    0x74, 0x6F, 0x20, 0x72, 0x65, 0x62, 0x6F, 0x6F, 0x74, 0x27, 0x2C, 0x20,
+    0x27, 0x6E, 0x65, 0x67, 0x61, 0x74, 0x69, 0x76, 0x65, 0x27, 0x29, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x69, 0x64, 0x65, 0x4C, 0x6F,
+    0x61, 0x64, 0x69, 0x6E, 0x67, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x7D, 0x0A, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73,
+    0x74, 0x20, 0x63, 0x6C, 0x65, 0x61, 0x6E, 0x75, 0x70, 0x20, 0x3D, 0x20,
+    0x28, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x63, 0x61, 0x6E, 0x63, 0x65, 0x6C, 0x42, 0x74, 0x6E, 0x2E, 0x72, 0x65,
+    0x6D, 0x6F, 0x76, 0x65, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73,
+    0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x27, 0x63, 0x6C, 0x69, 0x63, 0x6B,
+    0x27, 0x2C, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x43, 0x61, 0x6E,
+    0x63, 0x65, 0x6C, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E,
+    0x66, 0x69, 0x72, 0x6D, 0x42, 0x74, 0x6E, 0x2E, 0x72, 0x65, 0x6D, 0x6F,
+    0x76, 0x65, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65,
+    0x6E, 0x65, 0x72, 0x28, 0x27, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x27, 0x2C,
+    0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x43, 0x6F, 0x6E, 0x66, 0x69,
+    0x72, 0x6D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x6F, 0x64, 0x61,
+    0x6C, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x45, 0x76, 0x65, 0x6E,
+    0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x27, 0x63,
+    0x6C, 0x69, 0x63, 0x6B, 0x27, 0x2C, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C,
+    0x65, 0x42, 0x61, 0x63, 0x6B, 0x64, 0x72, 0x6F, 0x70, 0x43, 0x6C, 0x69,
+    0x63, 0x6B, 0x29, 0x0A, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x63, 0x6F,
+    0x6E, 0x73, 0x74, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x42, 0x61,
+    0x63, 0x6B, 0x64, 0x72, 0x6F, 0x70, 0x43, 0x6C, 0x69, 0x63, 0x6B, 0x20,
+    0x3D, 0x20, 0x28, 0x65, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x65, 0x2E, 0x74, 0x61, 0x72,
+    0x67, 0x65, 0x74, 0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x6D, 0x6F, 0x64, 0x61,
+    0x6C, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68,
+    0x61, 0x6E, 0x64, 0x6C, 0x65, 0x43, 0x61, 0x6E, 0x63, 0x65, 0x6C, 0x28,
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x7D, 0x0A,
+    0x20, 0x20, 0x63, 0x61, 0x6E, 0x63, 0x65, 0x6C, 0x42, 0x74, 0x6E, 0x2E,
+    0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74,
+    0x65, 0x6E, 0x65, 0x72, 0x28, 0x27, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x27,
+    0x2C, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x43, 0x61, 0x6E, 0x63,
+    0x65, 0x6C, 0x29, 0x0A, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x72,
+    0x6D, 0x42, 0x74, 0x6E, 0x2E, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E,
+    0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x27, 0x63,
+    0x6C, 0x69, 0x63, 0x6B, 0x27, 0x2C, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C,
+    0x65, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x72, 0x6D, 0x29, 0x0A, 0x20, 0x20,
+    0x6D, 0x6F, 0x64, 0x61, 0x6C, 0x2E, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65,
+    0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x27,
+    0x63, 0x6C, 0x69, 0x63, 0x6B, 0x27, 0x2C, 0x20, 0x68, 0x61, 0x6E, 0x64,
+    0x6C, 0x65, 0x42, 0x61, 0x63, 0x6B, 0x64, 0x72, 0x6F, 0x70, 0x43, 0x6C,
+    0x69, 0x63, 0x6B, 0x29, 0x0A, 0x7D, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74,
+    0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x4E, 0x65,
+    0x74, 0x77, 0x6F, 0x72, 0x6B, 0x49, 0x6E, 0x70, 0x75, 0x74, 0x73, 0x28,
+    0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x29, 0x20, 0x7B, 0x0A,
+    0x20, 0x20, 0x3B, 0x5B, 0x27, 0x6E, 0x65, 0x74, 0x2D, 0x69, 0x70, 0x27,
+    0x2C, 0x20, 0x27, 0x6E, 0x65, 0x74, 0x2D, 0x6D, 0x61, 0x73, 0x6B, 0x27,
+    0x2C, 0x20, 0x27, 0x6E, 0x65, 0x74, 0x2D, 0x67, 0x61, 0x74, 0x65, 0x77,
+    0x61, 0x79, 0x27, 0x2C, 0x20, 0x27, 0x6E, 0x65, 0x74, 0x2D, 0x64, 0x6E,
+    0x73, 0x27, 0x5D, 0x2E, 0x66, 0x6F, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28,
+    0x28, 0x69, 0x64, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x65, 0x6C, 0x20, 0x3D,
+    0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65,
+    0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64,
+    0x28, 0x69, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+    0x28, 0x65, 0x6C, 0x29, 0x20, 0x65, 0x6C, 0x2E, 0x64, 0x69, 0x73, 0x61,
+    0x62, 0x6C, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62,
+    0x6C, 0x65, 0x64, 0x0A, 0x20, 0x20, 0x7D, 0x29, 0x0A, 0x7D, 0x0A, 0x61,
+    0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x4E, 0x65, 0x74, 0x77, 0x6F,
+    0x72, 0x6B, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x74, 0x72, 0x79,
+    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74,
+    0x20, 0x72, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74,
+    0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x61, 0x70, 0x69,
+    0x2F, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x27, 0x29, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x64, 0x61, 0x74,
+    0x61, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65,
+    0x73, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x6E, 0x65, 0x74, 0x77, 0x6F,
+    0x72, 0x6B, 0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x6E, 0x65,
+    0x74, 0x77, 0x6F, 0x72, 0x6B, 0x20, 0x7C, 0x7C, 0x20, 0x7B, 0x7D, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x68, 0x6D,
+    0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E,
+    0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79,
+    0x49, 0x64, 0x28, 0x27, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x2D, 0x6D,
+    0x61, 0x63, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+    0x28, 0x68, 0x6D, 0x29, 0x20, 0x68, 0x6D, 0x2E, 0x74, 0x65, 0x78, 0x74,
+    0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x73, 0x74,
+    0x61, 0x74, 0x65, 0x2E, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x2E,
+    0x6D, 0x61, 0x63, 0x20, 0x7C, 0x7C, 0x20, 0x27, 0x4E, 0x2F, 0x41, 0x27,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6E,
+    0x64, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74,
+    0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42,
+    0x79, 0x49, 0x64, 0x28, 0x27, 0x6E, 0x65, 0x74, 0x2D, 0x64, 0x68, 0x63,
+    0x70, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+    0x6E, 0x64, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x6E, 0x64, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x20, 0x3D,
+    0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x6E, 0x65, 0x74, 0x77, 0x6F,
+    0x72, 0x6B, 0x2E, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x65, 0x6E, 0x61, 0x62,
+    0x6C, 0x65, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F,
+    0x6E, 0x73, 0x74, 0x20, 0x6E, 0x69, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63,
+    0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65,
+    0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x6E, 0x65,
+    0x74, 0x2D, 0x69, 0x70, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6E, 0x6D, 0x20, 0x3D, 0x20,
+    0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74,
+    0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28,
+    0x27, 0x6E, 0x65, 0x74, 0x2D, 0x6D, 0x61, 0x73, 0x6B, 0x27, 0x29, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20,
+    0x6E, 0x67, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E,
+    0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+    0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x6E, 0x65, 0x74, 0x2D, 0x67, 0x61,
+    0x74, 0x65, 0x77, 0x61, 0x79, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6E, 0x64, 0x6E, 0x20,
+    0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67,
+    0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49,
+    0x64, 0x28, 0x27, 0x6E, 0x65, 0x74, 0x2D, 0x64, 0x6E, 0x73, 0x27, 0x29,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6E,
+    0x69, 0x29, 0x20, 0x6E, 0x69, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
+    0x3D, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x6E, 0x65, 0x74, 0x77,
+    0x6F, 0x72, 0x6B, 0x2E, 0x69, 0x70, 0x20, 0x7C, 0x7C, 0x20, 0x27, 0x27,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6E,
+    0x6D, 0x29, 0x20, 0x6E, 0x6D, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
+    0x3D, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x6E, 0x65, 0x74, 0x77,
+    0x6F, 0x72, 0x6B, 0x2E, 0x73, 0x75, 0x62, 0x6E, 0x65, 0x74, 0x20, 0x7C,
+    0x7C, 0x20, 0x27, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69,
+    0x66, 0x20, 0x28, 0x6E, 0x67, 0x29, 0x20, 0x6E, 0x67, 0x2E, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2E,
+    0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x2E, 0x67, 0x61, 0x74, 0x65,
+    0x77, 0x61, 0x79, 0x20, 0x7C, 0x7C, 0x20, 0x27, 0x27, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6E, 0x64, 0x6E, 0x29,
+    0x20, 0x6E, 0x64, 0x6E, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D,
+    0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x6E, 0x65, 0x74, 0x77, 0x6F,
+    0x72, 0x6B, 0x2E, 0x64, 0x6E, 0x73, 0x20, 0x7C, 0x7C, 0x20, 0x27, 0x27,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6F, 0x67, 0x67, 0x6C,
+    0x65, 0x4E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x49, 0x6E, 0x70, 0x75,
+    0x74, 0x73, 0x28, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x6E, 0x65, 0x74,
+    0x77, 0x6F, 0x72, 0x6B, 0x2E, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x65, 0x6E,
+    0x61, 0x62, 0x6C, 0x65, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x73,
+    0x69, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74,
+    0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42,
+    0x79, 0x49, 0x64, 0x28, 0x27, 0x73, 0x75, 0x6D, 0x2D, 0x69, 0x70, 0x27,
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x69,
+    0x29, 0x20, 0x73, 0x69, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E,
+    0x74, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65,
+    0x2E, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x2E, 0x69, 0x70, 0x20,
+    0x7C, 0x7C, 0x20, 0x27, 0x4E, 0x2F, 0x41, 0x27, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x73, 0x6D, 0x20, 0x3D, 0x20,
+    0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74,
+    0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28,
+    0x27, 0x73, 0x75, 0x6D, 0x2D, 0x6D, 0x61, 0x63, 0x27, 0x29, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x6D, 0x29, 0x20, 0x73,
+    0x6D, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E,
+    0x74, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x6E, 0x65,
+    0x74, 0x77, 0x6F, 0x72, 0x6B, 0x2E, 0x6D, 0x61, 0x63, 0x20, 0x7C, 0x7C,
+    0x20, 0x27, 0x4E, 0x2F, 0x41, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63,
+    0x6F, 0x6E, 0x73, 0x74, 0x20, 0x73, 0x64, 0x20, 0x3D, 0x20, 0x64, 0x6F,
+    0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C,
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x73,
+    0x75, 0x6D, 0x2D, 0x64, 0x68, 0x63, 0x70, 0x27, 0x29, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x64, 0x29, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x73, 0x64, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43,
+    0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x61,
+    0x74, 0x65, 0x2E, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x2E, 0x64,
+    0x68, 0x63, 0x70, 0x5F, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x20,
+    0x3F, 0x20, 0x27, 0x45, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x27, 0x20,
+    0x3A, 0x20, 0x27, 0x44, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x27,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x73,
+    0x6D, 0x61, 0x73, 0x6B, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D,
+    0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65,
+    0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x73, 0x75, 0x6D, 0x2D,
+    0x6D, 0x61, 0x73, 0x6B, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69,
+    0x66, 0x20, 0x28, 0x73, 0x6D, 0x61, 0x73, 0x6B, 0x29, 0x20, 0x73, 0x6D,
+    0x61, 0x73, 0x6B, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E, 0x74,
+    0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2E,
+    0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x2E, 0x73, 0x75, 0x62, 0x6E,
+    0x65, 0x74, 0x20, 0x7C, 0x7C, 0x20, 0x27, 0x4E, 0x2F, 0x41, 0x27, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x73, 0x67,
+    0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E,
+    0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79,
+    0x49, 0x64, 0x28, 0x27, 0x73, 0x75, 0x6D, 0x2D, 0x67, 0x61, 0x74, 0x65,
+    0x77, 0x61, 0x79, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+    0x20, 0x28, 0x73, 0x67, 0x29, 0x20, 0x73, 0x67, 0x2E, 0x74, 0x65, 0x78,
+    0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x73,
+    0x74, 0x61, 0x74, 0x65, 0x2E, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B,
+    0x2E, 0x67, 0x61, 0x74, 0x65, 0x77, 0x61, 0x79, 0x20, 0x7C, 0x7C, 0x20,
+    0x27, 0x4E, 0x2F, 0x41, 0x27, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F,
+    0x6E, 0x73, 0x74, 0x20, 0x73, 0x64, 0x6E, 0x20, 0x3D, 0x20, 0x64, 0x6F,
+    0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C,
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x73,
+    0x75, 0x6D, 0x2D, 0x64, 0x6E, 0x73, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x64, 0x6E, 0x29, 0x20, 0x73, 0x64,
+    0x6E, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E,
+    0x74, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x6E, 0x65,
+    0x74, 0x77, 0x6F, 0x72, 0x6B, 0x2E, 0x64, 0x6E, 0x73, 0x20, 0x7C, 0x7C,
+    0x20, 0x27, 0x4E, 0x2F, 0x41, 0x27, 0x0A, 0x20, 0x20, 0x7D, 0x20, 0x63,
+    0x61, 0x74, 0x63, 0x68, 0x20, 0x28, 0x65, 0x29, 0x20, 0x7B, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x2E, 0x65,
+    0x72, 0x72, 0x6F, 0x72, 0x28, 0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x73, 0x68, 0x6F, 0x77, 0x54, 0x6F, 0x61, 0x73, 0x74, 0x28, 0x27, 0x46,
+    0x61, 0x69, 0x6C, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x66, 0x65, 0x74,
+    0x63, 0x68, 0x20, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x27, 0x2C,
+    0x20, 0x27, 0x6E, 0x65, 0x67, 0x61, 0x74, 0x69, 0x76, 0x65, 0x27, 0x29,
+    0x0A, 0x20, 0x20, 0x7D, 0x0A, 0x7D, 0x0A, 0x61, 0x73, 0x79, 0x6E, 0x63,
+    0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x65,
+    0x74, 0x63, 0x68, 0x43, 0x6F, 0x6D, 0x6D, 0x28, 0x29, 0x20, 0x7B, 0x0A,
+    0x20, 0x20, 0x74, 0x72, 0x79, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x20, 0x3D, 0x20,
+    0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28,
+    0x27, 0x2F, 0x61, 0x70, 0x69, 0x2F, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F,
+    0x6C, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73,
+    0x74, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61,
+    0x69, 0x74, 0x20, 0x72, 0x65, 0x73, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x28,
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2E,
+    0x63, 0x6F, 0x6D, 0x6D, 0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x61, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x63, 0x74,
+    0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E,
+    0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79,
+    0x49, 0x64, 0x28, 0x27, 0x63, 0x6F, 0x6D, 0x6D, 0x2D, 0x74, 0x63, 0x70,
+    0x27, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63,
+    0x74, 0x29, 0x20, 0x63, 0x74, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
+    0x3D, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x74, 0x63, 0x70, 0x5F, 0x70,
+    0x6F, 0x72, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73,
+    0x74, 0x20, 0x63, 0x62, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D,
+    0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65,
+    0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x63, 0x6F, 0x6D, 0x6D,
+    0x2D, 0x62, 0x61, 0x75, 0x64, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x69, 0x66, 0x20, 0x28, 0x63, 0x62, 0x29, 0x20, 0x63, 0x62, 0x2E, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E,
+    0x72, 0x73, 0x32, 0x33, 0x32, 0x5F, 0x31, 0x5F, 0x62, 0x61, 0x75, 0x64,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x73,
+    0x74, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74,
+    0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42,
+    0x79, 0x49, 0x64, 0x28, 0x27, 0x73, 0x75, 0x6D, 0x2D, 0x74, 0x63, 0x70,
+    0x27, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73,
+    0x74, 0x29, 0x20, 0x73, 0x74, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6F,
+    0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x61,
+    0x2E, 0x74, 0x63, 0x70, 0x5F, 0x70, 0x6F, 0x72, 0x74, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x73, 0x62, 0x20, 0x3D,
+    0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65,
+    0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64,
+    0x28, 0x27, 0x73, 0x75, 0x6D, 0x2D, 0x62, 0x61, 0x75, 0x64, 0x27, 0x29,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x62, 0x29,
+    0x20, 0x73, 0x62, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E, 0x74,
+    0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x72,
+    0x73, 0x32, 0x33, 0x32, 0x5F, 0x31, 0x5F, 0x62, 0x61, 0x75, 0x64, 0x0A,
+    0x20, 0x20, 0x7D, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28, 0x65,
+    0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73,
+    0x6F, 0x6C, 0x65, 0x2E, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x65, 0x29,
+    0x0A, 0x20, 0x20, 0x7D, 0x0A, 0x7D, 0x0A, 0x61, 0x73, 0x79, 0x6E, 0x63,
+    0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x65,
+    0x74, 0x63, 0x68, 0x47, 0x70, 0x69, 0x6F, 0x28, 0x29, 0x20, 0x7B, 0x0A,
+    0x20, 0x20, 0x74, 0x72, 0x79, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x20, 0x3D, 0x20,
+    0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28,
+    0x27, 0x2F, 0x61, 0x70, 0x69, 0x2F, 0x67, 0x70, 0x69, 0x6F, 0x27, 0x29,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x64,
+    0x61, 0x74, 0x61, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20,
+    0x72, 0x65, 0x73, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x28, 0x29, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x67, 0x70, 0x69,
+    0x6F, 0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x67, 0x69, 0x20, 0x3D, 0x20,
+    0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74,
+    0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28,
+    0x27, 0x67, 0x70, 0x69, 0x6F, 0x2D, 0x69, 0x64, 0x27, 0x29, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x67, 0x69, 0x29, 0x20, 0x67,
+    0x69, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x64, 0x61,
+    0x74, 0x61, 0x2E, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x5F, 0x69, 0x64,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x67,
+    0x6D, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74,
+    0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42,
+    0x79, 0x49, 0x64, 0x28, 0x27, 0x67, 0x70, 0x69, 0x6F, 0x2D, 0x6D, 0x6F,
+    0x64, 0x65, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+    0x28, 0x67, 0x6D, 0x29, 0x20, 0x67, 0x6D, 0x2E, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x63, 0x6F, 0x6D,
+    0x6D, 0x5F, 0x6D, 0x6F, 0x64, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63,
+    0x6F, 0x6E, 0x73, 0x74, 0x20, 0x67, 0x61, 0x20, 0x3D, 0x20, 0x64, 0x6F,
+    0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C,
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x67,
+    0x70, 0x69, 0x6F, 0x2D, 0x61, 0x75, 0x74, 0x6F, 0x27, 0x29, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x67, 0x61, 0x29, 0x20, 0x67,
+    0x61, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x64, 0x61,
+    0x74, 0x61, 0x2E, 0x61, 0x75, 0x74, 0x6F, 0x5F, 0x72, 0x65, 0x73, 0x70,
+    0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x74, 0x6F, 0x53, 0x74, 0x72, 0x69, 0x6E,
+    0x67, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73,
+    0x74, 0x20, 0x73, 0x69, 0x64, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75,
+    0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x73, 0x75, 0x6D,
+    0x2D, 0x69, 0x64, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+    0x20, 0x28, 0x73, 0x69, 0x64, 0x29, 0x20, 0x73, 0x69, 0x64, 0x2E, 0x74,
+    0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x3D,
+    0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65,
+    0x5F, 0x69, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73,
+    0x74, 0x20, 0x73, 0x6D, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x64, 0x6F,
+    0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C,
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x73,
+    0x75, 0x6D, 0x2D, 0x6D, 0x6F, 0x64, 0x65, 0x27, 0x29, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x6D, 0x6F, 0x64, 0x65, 0x29,
+    0x20, 0x73, 0x6D, 0x6F, 0x64, 0x65, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43,
+    0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x64, 0x61, 0x74,
+    0x61, 0x2E, 0x63, 0x6F, 0x6D, 0x6D, 0x5F, 0x6D, 0x6F, 0x64, 0x65, 0x2E,
+    0x74, 0x6F, 0x55, 0x70, 0x70, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28,
+    0x29, 0x0A, 0x20, 0x20, 0x7D, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x20,
+    0x28, 0x65, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F,
+    0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x2E, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28,
+    0x65, 0x29, 0x0A, 0x20, 0x20, 0x7D, 0x0A, 0x7D, 0x0A, 0x61, 0x73, 0x79,
+    0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+    0x66, 0x65, 0x74, 0x63, 0x68, 0x41, 0x6C, 0x6C, 0x28, 0x29, 0x20, 0x7B,
+    0x0A, 0x20, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x50, 0x72, 0x6F,
+    0x6D, 0x69, 0x73, 0x65, 0x2E, 0x61, 0x6C, 0x6C, 0x28, 0x5B, 0x66, 0x65,
+    0x74, 0x63, 0x68, 0x4E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x28, 0x29,
+    0x2C, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x43, 0x6F, 0x6D, 0x6D, 0x28,
+    0x29, 0x2C, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x47, 0x70, 0x69, 0x6F,
+    0x28, 0x29, 0x5D, 0x29, 0x0A, 0x7D, 0x0A, 0x64, 0x6F, 0x63, 0x75, 0x6D,
+    0x65, 0x6E, 0x74, 0x2E, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 0x6C,
+    0x65, 0x63, 0x74, 0x6F, 0x72, 0x41, 0x6C, 0x6C, 0x28, 0x27, 0x2E, 0x6E,
+    0x61, 0x76, 0x2D, 0x69, 0x74, 0x65, 0x6D, 0x27, 0x29, 0x2E, 0x66, 0x6F,
+    0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x28, 0x69, 0x74, 0x65, 0x6D, 0x29,
+    0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x69, 0x74, 0x65, 0x6D,
+    0x2E, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73,
+    0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x27, 0x63, 0x6C, 0x69, 0x63, 0x6B,
+    0x27, 0x2C, 0x20, 0x28, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x71, 0x75, 0x65, 0x72, 0x79,
+    0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x41, 0x6C, 0x6C, 0x28,
+    0x27, 0x2E, 0x6E, 0x61, 0x76, 0x2D, 0x69, 0x74, 0x65, 0x6D, 0x27, 0x29,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x66, 0x6F, 0x72, 0x45,
+    0x61, 0x63, 0x68, 0x28, 0x28, 0x6E, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x6E,
+    0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x72,
+    0x65, 0x6D, 0x6F, 0x76, 0x65, 0x28, 0x27, 0x61, 0x63, 0x74, 0x69, 0x76,
+    0x65, 0x27, 0x29, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x74, 0x65,
+    0x6D, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E,
+    0x61, 0x64, 0x64, 0x28, 0x27, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x27,
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20,
+    0x70, 0x61, 0x67, 0x65, 0x20, 0x3D, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E,
+    0x64, 0x61, 0x74, 0x61, 0x73, 0x65, 0x74, 0x2E, 0x70, 0x61, 0x67, 0x65,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E,
+    0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x71, 0x75, 0x65,
+    0x72, 0x79, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x41, 0x6C,
+    0x6C, 0x28, 0x27, 0x2E, 0x70, 0x61, 0x67, 0x65, 0x27, 0x29, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x66, 0x6F, 0x72, 0x45, 0x61, 0x63,
+    0x68, 0x28, 0x28, 0x70, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x70, 0x2E, 0x63,
+    0x6C, 0x61, 0x73, 0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x61, 0x64, 0x64,
+    0x28, 0x27, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6E, 0x27, 0x29, 0x29, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74,
+    0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42,
+    0x79, 0x49, 0x64, 0x28, 0x27, 0x70, 0x61, 0x67, 0x65, 0x2D, 0x27, 0x20,
+    0x2B, 0x20, 0x70, 0x61, 0x67, 0x65, 0x29, 0x2E, 0x63, 0x6C, 0x61, 0x73,
+    0x73, 0x4C, 0x69, 0x73, 0x74, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65,
+    0x28, 0x27, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6E, 0x27, 0x29, 0x0A, 0x20,
+    0x20, 0x7D, 0x29, 0x0A, 0x7D, 0x29, 0x0A, 0x64, 0x6F, 0x63, 0x75, 0x6D,
+    0x65, 0x6E, 0x74, 0x0A, 0x20, 0x20, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C,
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x6E,
+    0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x2D, 0x66, 0x6F, 0x72, 0x6D, 0x27,
+    0x29, 0x0A, 0x20, 0x20, 0x2E, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E,
+    0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x27, 0x73,
+    0x75, 0x62, 0x6D, 0x69, 0x74, 0x27, 0x2C, 0x20, 0x61, 0x73, 0x79, 0x6E,
+    0x63, 0x20, 0x28, 0x65, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x65, 0x2E, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6E, 0x74,
+    0x44, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x28, 0x29, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x4C, 0x6F, 0x61, 0x64, 0x69, 0x6E,
+    0x67, 0x28, 0x27, 0x41, 0x70, 0x70, 0x6C, 0x79, 0x69, 0x6E, 0x67, 0x20,
+    0x4E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x20, 0x53, 0x65, 0x74, 0x74,
+    0x69, 0x6E, 0x67, 0x73, 0x2E, 0x2E, 0x2E, 0x27, 0x29, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x64, 0x68, 0x63, 0x70,
+    0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E,
+    0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79,
+    0x49, 0x64, 0x28, 0x27, 0x6E, 0x65, 0x74, 0x2D, 0x64, 0x68, 0x63, 0x70,
+    0x27, 0x29, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x70, 0x61, 0x79,
+    0x6C, 0x6F, 0x61, 0x64, 0x20, 0x3D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x64, 0x68, 0x63, 0x70, 0x5F, 0x65, 0x6E, 0x61, 0x62,
+    0x6C, 0x65, 0x64, 0x3A, 0x20, 0x64, 0x68, 0x63, 0x70, 0x2C, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x70, 0x3A, 0x20, 0x64, 0x68, 0x63,
+    0x70, 0x20, 0x3F, 0x20, 0x27, 0x27, 0x20, 0x3A, 0x20, 0x64, 0x6F, 0x63,
+    0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65,
+    0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x6E, 0x65,
+    0x74, 0x2D, 0x69, 0x70, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x75, 0x62, 0x6E,
+    0x65, 0x74, 0x3A, 0x20, 0x64, 0x68, 0x63, 0x70, 0x20, 0x3F, 0x20, 0x27,
+    0x27, 0x20, 0x3A, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74,
+    0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42,
+    0x79, 0x49, 0x64, 0x28, 0x27, 0x6E, 0x65, 0x74, 0x2D, 0x6D, 0x61, 0x73,
+    0x6B, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2C, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x61, 0x74, 0x65, 0x77, 0x61, 0x79,
+    0x3A, 0x20, 0x64, 0x68, 0x63, 0x70, 0x20, 0x3F, 0x20, 0x27, 0x27, 0x20,
+    0x3A, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67,
+    0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49,
+    0x64, 0x28, 0x27, 0x6E, 0x65, 0x74, 0x2D, 0x67, 0x61, 0x74, 0x65, 0x77,
+    0x61, 0x79, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2C, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6E, 0x73, 0x3A, 0x20, 0x64,
+    0x68, 0x63, 0x70, 0x20, 0x3F, 0x20, 0x27, 0x27, 0x20, 0x3A, 0x20, 0x64,
+    0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45,
+    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27,
+    0x6E, 0x65, 0x74, 0x2D, 0x64, 0x6E, 0x73, 0x27, 0x29, 0x2E, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D,
+    0x61, 0x63, 0x3A, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2E, 0x6E, 0x65,
+    0x74, 0x77, 0x6F, 0x72, 0x6B, 0x2E, 0x6D, 0x61, 0x63, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x79, 0x20,
+    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73,
+    0x74, 0x20, 0x72, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69,
+    0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x61, 0x70,
+    0x69, 0x2F, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x27, 0x2C, 0x20,
+    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x65,
+    0x74, 0x68, 0x6F, 0x64, 0x3A, 0x20, 0x27, 0x50, 0x4F, 0x53, 0x54, 0x27,
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65,
+    0x61, 0x64, 0x65, 0x72, 0x73, 0x3A, 0x20, 0x7B, 0x20, 0x27, 0x43, 0x6F,
+    0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2D, 0x54, 0x79, 0x70, 0x65, 0x27, 0x3A,
+    0x20, 0x27, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F,
+    0x6E, 0x2F, 0x6A, 0x73, 0x6F, 0x6E, 0x27, 0x20, 0x7D, 0x2C, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x3A,
+    0x20, 0x4A, 0x53, 0x4F, 0x4E, 0x2E, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x69, 0x66, 0x79, 0x28, 0x70, 0x61, 0x79, 0x6C, 0x6F, 0x61, 0x64, 0x29,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x29, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x72, 0x65, 0x73,
+    0x2E, 0x6F, 0x6B, 0x29, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x77, 0x20, 0x6E,
+    0x65, 0x77, 0x20, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x27, 0x46, 0x61,
+    0x69, 0x6C, 0x65, 0x64, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x73, 0x68, 0x6F, 0x77, 0x54, 0x6F, 0x61, 0x73, 0x74, 0x28, 0x27,
+    0x4E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x20, 0x73, 0x65, 0x74, 0x74,
+    0x69, 0x6E, 0x67, 0x73, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x64,
+    0x21, 0x27, 0x2C, 0x20, 0x27, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x76,
+    0x65, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65,
+    0x74, 0x54, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x28, 0x61, 0x73, 0x79,
+    0x6E, 0x63, 0x20, 0x28, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74,
+    0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x41, 0x6C, 0x6C, 0x28, 0x29, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x69, 0x64, 0x65,
+    0x4C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x28, 0x29, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x7D, 0x2C, 0x20, 0x35, 0x30, 0x30, 0x30, 0x29,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68,
+    0x20, 0x28, 0x65, 0x72, 0x72, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x54, 0x6F, 0x61, 0x73, 0x74,
+    0x28, 0x27, 0x46, 0x61, 0x69, 0x6C, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20,
+    0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x20, 0x6E, 0x65, 0x74, 0x77, 0x6F,
+    0x72, 0x6B, 0x27, 0x2C, 0x20, 0x27, 0x6E, 0x65, 0x67, 0x61, 0x74, 0x69,
+    0x76, 0x65, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68,
+    0x69, 0x64, 0x65, 0x4C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x28, 0x29,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x7D, 0x29, 0x0A,
+    0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74,
+    0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28,
+    0x27, 0x6E, 0x65, 0x74, 0x2D, 0x64, 0x68, 0x63, 0x70, 0x27, 0x29, 0x2E,
+    0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74,
+    0x65, 0x6E, 0x65, 0x72, 0x28, 0x27, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65,
+    0x27, 0x2C, 0x20, 0x28, 0x65, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A,
+    0x20, 0x20, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x4E, 0x65, 0x74, 0x77,
+    0x6F, 0x72, 0x6B, 0x49, 0x6E, 0x70, 0x75, 0x74, 0x73, 0x28, 0x65, 0x2E,
+    0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B,
+    0x65, 0x64, 0x29, 0x0A, 0x7D, 0x29, 0x0A, 0x64, 0x6F, 0x63, 0x75, 0x6D,
+    0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65,
+    0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x62, 0x74, 0x6E, 0x2D,
+    0x72, 0x65, 0x62, 0x6F, 0x6F, 0x74, 0x27, 0x29, 0x2E, 0x61, 0x64, 0x64,
+    0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65,
+    0x72, 0x28, 0x27, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x27, 0x2C, 0x20, 0x28,
+    0x29, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x73, 0x68, 0x6F,
+    0x77, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x72, 0x6D, 0x4D, 0x6F, 0x64, 0x61,
+    0x6C, 0x28, 0x29, 0x0A, 0x7D, 0x29, 0x0A, 0x64, 0x6F, 0x63, 0x75, 0x6D,
+    0x65, 0x6E, 0x74, 0x0A, 0x20, 0x20, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C,
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x63,
+    0x6F, 0x6D, 0x6D, 0x2D, 0x66, 0x6F, 0x72, 0x6D, 0x27, 0x29, 0x0A, 0x20,
+    0x20, 0x2E, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69,
+    0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x27, 0x73, 0x75, 0x62, 0x6D,
+    0x69, 0x74, 0x27, 0x2C, 0x20, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x28,
+    0x65, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x65, 0x2E, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x44, 0x65, 0x66,
+    0x61, 0x75, 0x6C, 0x74, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73,
+    0x68, 0x6F, 0x77, 0x4C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x28, 0x27,
+    0x41, 0x70, 0x70, 0x6C, 0x79, 0x69, 0x6E, 0x67, 0x20, 0x43, 0x6F, 0x6E,
+    0x74, 0x72, 0x6F, 0x6C, 0x20, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67,
+    0x73, 0x2E, 0x2E, 0x2E, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63,
+    0x6F, 0x6E, 0x73, 0x74, 0x20, 0x70, 0x61, 0x79, 0x6C, 0x6F, 0x61, 0x64,
+    0x20, 0x3D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74,
+    0x63, 0x70, 0x5F, 0x70, 0x6F, 0x72, 0x74, 0x3A, 0x20, 0x70, 0x61, 0x72,
+    0x73, 0x65, 0x49, 0x6E, 0x74, 0x28, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65,
+    0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x63, 0x6F, 0x6D, 0x6D, 0x2D,
+    0x74, 0x63, 0x70, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29,
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x73, 0x32, 0x33,
+    0x32, 0x5F, 0x31, 0x5F, 0x62, 0x61, 0x75, 0x64, 0x3A, 0x20, 0x70, 0x61,
+    0x72, 0x73, 0x65, 0x49, 0x6E, 0x74, 0x28, 0x64, 0x6F, 0x63, 0x75, 0x6D,
+    0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65,
+    0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x63, 0x6F, 0x6D, 0x6D,
+    0x2D, 0x62, 0x61, 0x75, 0x64, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x74, 0x72, 0x79, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x20, 0x3D,
+    0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68,
+    0x28, 0x27, 0x2F, 0x61, 0x70, 0x69, 0x2F, 0x63, 0x6F, 0x6E, 0x74, 0x72,
+    0x6F, 0x6C, 0x27, 0x2C, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x3A, 0x20, 0x27,
+    0x50, 0x4F, 0x53, 0x54, 0x27, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x3A, 0x20,
+    0x7B, 0x20, 0x27, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2D, 0x54,
+    0x79, 0x70, 0x65, 0x27, 0x3A, 0x20, 0x27, 0x61, 0x70, 0x70, 0x6C, 0x69,
+    0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 0x6A, 0x73, 0x6F, 0x6E, 0x27,
+    0x20, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x62, 0x6F, 0x64, 0x79, 0x3A, 0x20, 0x4A, 0x53, 0x4F, 0x4E, 0x2E, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x69, 0x66, 0x79, 0x28, 0x70, 0x61, 0x79,
+    0x6C, 0x6F, 0x61, 0x64, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x7D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+    0x28, 0x21, 0x72, 0x65, 0x73, 0x2E, 0x6F, 0x6B, 0x29, 0x20, 0x74, 0x68,
+    0x72, 0x6F, 0x77, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x45, 0x72, 0x72, 0x6F,
+    0x72, 0x28, 0x27, 0x46, 0x61, 0x69, 0x6C, 0x65, 0x64, 0x27, 0x29, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x54, 0x6F,
+    0x61, 0x73, 0x74, 0x28, 0x27, 0x43, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C,
+    0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x75, 0x70,
+    0x64, 0x61, 0x74, 0x65, 0x64, 0x21, 0x27, 0x2C, 0x20, 0x27, 0x70, 0x6F,
+    0x73, 0x69, 0x74, 0x69, 0x76, 0x65, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6D, 0x65, 0x6F, 0x75,
+    0x74, 0x28, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x28, 0x29, 0x20, 0x3D,
+    0x3E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x41,
+    0x6C, 0x6C, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x68, 0x69, 0x64, 0x65, 0x4C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67,
+    0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x2C, 0x20,
+    0x35, 0x30, 0x30, 0x30, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20,
+    0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28, 0x65, 0x72, 0x72, 0x29, 0x20,
+    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77,
+    0x54, 0x6F, 0x61, 0x73, 0x74, 0x28, 0x27, 0x46, 0x61, 0x69, 0x6C, 0x65,
+    0x64, 0x20, 0x74, 0x6F, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x20,
+    0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x27, 0x2C, 0x20, 0x27, 0x6E,
+    0x65, 0x67, 0x61, 0x74, 0x69, 0x76, 0x65, 0x27, 0x29, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x68, 0x69, 0x64, 0x65, 0x4C, 0x6F, 0x61, 0x64,
+    0x69, 0x6E, 0x67, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A,
+    0x20, 0x20, 0x7D, 0x29, 0x0A, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E,
+    0x74, 0x0A, 0x20, 0x20, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x67, 0x70, 0x69,
+    0x6F, 0x2D, 0x66, 0x6F, 0x72, 0x6D, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x2E,
+    0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74,
+    0x65, 0x6E, 0x65, 0x72, 0x28, 0x27, 0x73, 0x75, 0x62, 0x6D, 0x69, 0x74,
+    0x27, 0x2C, 0x20, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x28, 0x65, 0x29,
+    0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x2E,
+    0x70, 0x72, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x44, 0x65, 0x66, 0x61, 0x75,
+    0x6C, 0x74, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F,
+    0x77, 0x4C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x28, 0x27, 0x41, 0x70,
+    0x70, 0x6C, 0x79, 0x69, 0x6E, 0x67, 0x20, 0x47, 0x50, 0x49, 0x4F, 0x20,
+    0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x2E, 0x2E, 0x27,
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20,
+    0x70, 0x61, 0x79, 0x6C, 0x6F, 0x61, 0x64, 0x20, 0x3D, 0x20, 0x7B, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65,
+    0x5F, 0x69, 0x64, 0x3A, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x49, 0x6E,
+    0x74, 0x28, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67,
+    0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49,
+    0x64, 0x28, 0x27, 0x67, 0x70, 0x69, 0x6F, 0x2D, 0x69, 0x64, 0x27, 0x29,
+    0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x2C, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x72, 0x74, 0x5F, 0x6D, 0x6F, 0x64, 0x65, 0x3A, 0x20,
+    0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74,
+    0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28,
+    0x27, 0x67, 0x70, 0x69, 0x6F, 0x2D, 0x6D, 0x6F, 0x64, 0x65, 0x27, 0x29,
+    0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x61, 0x75, 0x74, 0x6F, 0x5F, 0x72, 0x65, 0x73, 0x70, 0x6F,
+    0x6E, 0x73, 0x65, 0x3A, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E,
+    0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+    0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x67, 0x70, 0x69, 0x6F, 0x2D, 0x61,
+    0x75, 0x74, 0x6F, 0x27, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
+    0x3D, 0x3D, 0x3D, 0x20, 0x27, 0x74, 0x72, 0x75, 0x65, 0x27, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x79,
+    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E,
+    0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61,
+    0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x61,
+    0x70, 0x69, 0x2F, 0x67, 0x70, 0x69, 0x6F, 0x27, 0x2C, 0x20, 0x7B, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x65, 0x74, 0x68,
+    0x6F, 0x64, 0x3A, 0x20, 0x27, 0x50, 0x4F, 0x53, 0x54, 0x27, 0x2C, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x61, 0x64,
+    0x65, 0x72, 0x73, 0x3A, 0x20, 0x7B, 0x20, 0x27, 0x43, 0x6F, 0x6E, 0x74,
+    0x65, 0x6E, 0x74, 0x2D, 0x54, 0x79, 0x70, 0x65, 0x27, 0x3A, 0x20, 0x27,
+    0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F,
+    0x6A, 0x73, 0x6F, 0x6E, 0x27, 0x20, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x3A, 0x20, 0x4A,
+    0x53, 0x4F, 0x4E, 0x2E, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x69, 0x66,
+    0x79, 0x28, 0x70, 0x61, 0x79, 0x6C, 0x6F, 0x61, 0x64, 0x29, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x72, 0x65, 0x73, 0x2E, 0x6F,
+    0x6B, 0x29, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x77, 0x20, 0x6E, 0x65, 0x77,
+    0x20, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x27, 0x46, 0x61, 0x69, 0x6C,
+    0x65, 0x64, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73,
+    0x68, 0x6F, 0x77, 0x54, 0x6F, 0x61, 0x73, 0x74, 0x28, 0x27, 0x47, 0x50,
+    0x49, 0x4F, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x20,
+    0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x64, 0x21, 0x27, 0x2C, 0x20, 0x27,
+    0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x76, 0x65, 0x27, 0x29, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x7D, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28,
+    0x65, 0x72, 0x72, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x73, 0x68, 0x6F, 0x77, 0x54, 0x6F, 0x61, 0x73, 0x74, 0x28, 0x27,
+    0x46, 0x61, 0x69, 0x6C, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x75, 0x70,
+    0x64, 0x61, 0x74, 0x65, 0x20, 0x47, 0x50, 0x49, 0x4F, 0x27, 0x2C, 0x20,
+    0x27, 0x6E, 0x65, 0x67, 0x61, 0x74, 0x69, 0x76, 0x65, 0x27, 0x29, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x66, 0x69, 0x6E, 0x61, 0x6C, 0x6C,
+    0x79, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x69,
+    0x64, 0x65, 0x4C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x28, 0x29, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x7D, 0x29, 0x0A, 0x77,
+    0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65,
+    0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x27,
+    0x44, 0x4F, 0x4D, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x4C, 0x6F,
+    0x61, 0x64, 0x65, 0x64, 0x27, 0x2C, 0x20, 0x61, 0x73, 0x79, 0x6E, 0x63,
+    0x20, 0x28, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x73,
+    0x68, 0x6F, 0x77, 0x4C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x28, 0x27,
+    0x46, 0x65, 0x74, 0x63, 0x68, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x74, 0x61,
+    0x74, 0x75, 0x73, 0x2E, 0x2E, 0x2E, 0x27, 0x29, 0x0A, 0x20, 0x20, 0x61,
+    0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x41, 0x6C,
+    0x6C, 0x28, 0x29, 0x0A, 0x20, 0x20, 0x68, 0x69, 0x64, 0x65, 0x4C, 0x6F,
+    0x61, 0x64, 0x69, 0x6E, 0x67, 0x28, 0x29, 0x0A, 0x7D, 0x29, 0x0A
+};
+// gzip: 2038 bytes (ratio: 4.24x)
+const uint8_t assets_app_8864ee4b_js_gzip_data[] = {
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xD5, 0x59,
+    0xDD, 0x6F, 0xDB, 0x36, 0x10, 0x7F, 0xEF, 0x5F, 0xA1, 0x65, 0x05, 0x24,
+    0x61, 0xB6, 0xD2, 0x6D, 0xD8, 0x4B, 0xD6, 0x74, 0x68, 0xD3, 0xAC, 0xCB,
+    0xD0, 0x2F, 0x2C, 0xD9, 0x53, 0x31, 0x64, 0xB4, 0x44, 0xCB, 0x5C, 0x24,
+    0x52, 0x13, 0xE9, 0x78, 0x46, 0xEA, 0xFF, 0x7D, 0x77, 0x24, 0x25, 0x51,
+    0x96, 0x2C, 0xC9, 0x2D, 0x30, 0xAC, 0x79, 0x70, 0x24, 0xFA, 0xBE, 0x78,
+    0xF7, 0xBB, 0xE3, 0x1D, 0x1D, 0x0B, 0x2E, 0x95, 0x27, 0x15, 0x51, 0xD4,
+    0x3B, 0xF7, 0x1E, 0x3C, 0x4E, 0xD5, 0x46, 0x94, 0x77, 0x67, 0xDE, 0xC3,
+    0x6E, 0xE6, 0xC5, 0x22, 0xCF, 0xCD, 0x53, 0x5A, 0x30, 0x81, 0x4F, 0xDE,
+    0xEE, 0xD1, 0x72, 0xCD, 0x63, 0xC5, 0x04, 0xF7, 0xE4, 0x4A, 0x6C, 0x5E,
+    0x0B, 0x92, 0x30, 0x9E, 0x06, 0xB9, 0x4C, 0x81, 0xDD, 0xB7, 0xAF, 0x51,
+    0x14, 0xF9, 0xA1, 0xF7, 0xF0, 0xC8, 0xF3, 0x12, 0x11, 0xAF, 0x73, 0xCA,
+    0x55, 0x94, 0x52, 0x75, 0x99, 0x51, 0x7C, 0x7C, 0xB1, 0xBD, 0x4A, 0x02,
+    0x3F, 0x33, 0x94, 0xF3, 0x9C, 0x4A, 0x49, 0x52, 0xEA, 0x87, 0x91, 0xA2,
+    0xFF, 0xA8, 0x0B, 0xC1, 0x15, 0x90, 0x80, 0x28, 0x10, 0x38, 0x85, 0x5D,
+    0xDC, 0xD3, 0x32, 0x23, 0x5B, 0x60, 0x8F, 0x33, 0x22, 0xE5, 0x6B, 0x26,
+    0x55, 0x54, 0xD2, 0x1C, 0x96, 0x03, 0x7F, 0xC5, 0x92, 0x84, 0x72, 0x3F,
+    0x7C, 0xE4, 0xD8, 0x0C, 0x6B, 0xB4, 0xB2, 0x79, 0xA2, 0x85, 0x7D, 0x2A,
+    0x48, 0x92, 0xF4, 0xCB, 0x47, 0x9F, 0xDC, 0x08, 0x22, 0x55, 0x60, 0x37,
+    0x36, 0xF3, 0xD4, 0xB6, 0x40, 0xD7, 0xFA, 0x85, 0x90, 0x4C, 0xB1, 0x7B,
+    0x6A, 0x3D, 0x13, 0x6B, 0xC7, 0xC3, 0xA7, 0x22, 0x8C, 0xD3, 0x12, 0x28,
+    0x0E, 0x5A, 0xA2, 0x50, 0xE0, 0xBC, 0x26, 0x05, 0x8D, 0x15, 0xBB, 0xFE,
+    0xC6, 0x65, 0x8D, 0x4B, 0x0A, 0x91, 0xB4, 0xDC, 0x81, 0x9F, 0xB0, 0x7B,
+    0x4D, 0xAD, 0xE9, 0x8C, 0xFD, 0x6F, 0x49, 0x8E, 0xE6, 0xFC, 0x69, 0x58,
+    0x1F, 0x3F, 0xA0, 0x79, 0xBB, 0x3F, 0x6B, 0x89, 0x0C, 0xFE, 0x5D, 0x25,
+    0x40, 0x60, 0xCC, 0x3E, 0x77, 0x0D, 0xF7, 0x7E, 0xF2, 0xFC, 0x78, 0x45,
+    0xE3, 0xBB, 0xDB, 0x98, 0x95, 0x71, 0x06, 0x0B, 0x67, 0xB0, 0x40, 0x78,
+    0x4C, 0x33, 0xBF, 0x56, 0xC2, 0x38, 0x98, 0xF8, 0xCB, 0xCD, 0x9B, 0xD7,
+    0xA8, 0xE4, 0xA9, 0xBC, 0x4F, 0x3D, 0xAD, 0xF6, 0xFC, 0x04, 0x25, 0xCF,
+    0x65, 0x7E, 0x02, 0x60, 0xDB, 0x66, 0xF4, 0xFC, 0x64, 0xC9, 0xB2, 0xEC,
+    0x6C, 0xB3, 0x62, 0x8A, 0x9E, 0x3C, 0x7B, 0xBA, 0x96, 0xD4, 0x5B, 0x95,
+    0x74, 0x79, 0x7E, 0xF2, 0xF5, 0xE3, 0x07, 0x63, 0xC3, 0x0E, 0x96, 0x4F,
+    0x61, 0x1D, 0x3E, 0x41, 0xCA, 0xB3, 0xA7, 0xB2, 0x20, 0xFC, 0xD9, 0xE3,
+    0x07, 0xEB, 0xD7, 0x1D, 0xAC, 0xE2, 0x82, 0xB5, 0xDC, 0x78, 0x26, 0x22,
+    0x45, 0x41, 0x79, 0x72, 0xB1, 0x62, 0x59, 0x12, 0x68, 0x73, 0x70, 0xF3,
+    0x92, 0xAA, 0x1B, 0x96, 0x53, 0xB1, 0x56, 0x01, 0xC4, 0xFC, 0xFC, 0x99,
+    0x35, 0xD4, 0xC2, 0x24, 0x9C, 0x79, 0xDF, 0x3F, 0x79, 0xF2, 0xA4, 0x13,
+    0x45, 0x80, 0xE2, 0x92, 0x95, 0xF9, 0x1B, 0x91, 0x90, 0x2C, 0x70, 0x43,
+    0x96, 0xE3, 0xCA, 0x50, 0xB8, 0x62, 0xC3, 0x39, 0xD7, 0x84, 0xDA, 0xFD,
+    0xFA, 0x69, 0x08, 0xA1, 0x35, 0x1C, 0xB4, 0x33, 0x5F, 0x28, 0x3E, 0x24,
+    0x5F, 0x4B, 0x9B, 0x5B, 0xBF, 0x87, 0x2E, 0x94, 0x50, 0xED, 0x34, 0x66,
+    0x43, 0xEB, 0x70, 0xAF, 0x08, 0x4F, 0x32, 0x7A, 0xA1, 0x85, 0x02, 0xBF,
+    0x71, 0x14, 0x6E, 0xBA, 0x6B, 0x7D, 0x1B, 0xFC, 0x48, 0x01, 0x58, 0x20,
+    0x7C, 0x5D, 0x04, 0xF8, 0xB6, 0xDB, 0x17, 0x69, 0x54, 0x81, 0x4C, 0x22,
+    0xB7, 0x3C, 0xFE, 0x0C, 0xC9, 0x5E, 0xAB, 0xE2, 0xF8, 0xBF, 0xD1, 0x85,
+    0x10, 0x0A, 0x1E, 0x3D, 0xB9, 0x95, 0x8A, 0xE6, 0xBA, 0xE8, 0x68, 0x32,
+    0x55, 0x6E, 0xAD, 0x82, 0xCA, 0x94, 0x92, 0x4A, 0x34, 0x60, 0x43, 0x98,
+    0xF2, 0x96, 0x54, 0xC5, 0xAB, 0xC0, 0x3F, 0x25, 0x05, 0x3B, 0x85, 0x75,
+    0x45, 0x4A, 0x65, 0xF9, 0x3C, 0x8F, 0x2D, 0xBD, 0xE0, 0x2B, 0x58, 0x8C,
+    0xC4, 0x5D, 0xE8, 0xA9, 0x55, 0x29, 0x36, 0x50, 0x10, 0x37, 0xDE, 0x65,
+    0x59, 0x8A, 0x32, 0xF0, 0x7F, 0x26, 0x2C, 0xA3, 0x49, 0x4D, 0xDC, 0xE4,
+    0xBA, 0x7F, 0xAD, 0x2D, 0xF0, 0x98, 0x04, 0x4D, 0xD6, 0x2A, 0x34, 0x67,
+    0xE6, 0x66, 0x7D, 0xC5, 0xD5, 0xA0, 0xB1, 0xEB, 0x10, 0xFC, 0x73, 0xAC,
+    0x7C, 0x9E, 0x65, 0x41, 0x58, 0x7F, 0xD1, 0xAA, 0x5D, 0x76, 0x15, 0x4A,
+    0xF3, 0x0F, 0x1A, 0xBD, 0xFA, 0x05, 0xF0, 0x03, 0x5C, 0x5E, 0x40, 0xCB,
+    0x32, 0xAC, 0x25, 0x3A, 0x66, 0x9A, 0x0D, 0x00, 0xFE, 0xAD, 0x99, 0x68,
+    0x20, 0xA7, 0x29, 0x69, 0x19, 0xD8, 0x55, 0xB3, 0x6B, 0x85, 0xD5, 0x86,
+    0x64, 0x0F, 0x24, 0x35, 0x72, 0x2D, 0xB8, 0x2F, 0xEF, 0x01, 0x72, 0x18,
+    0x54, 0x0A, 0x79, 0x09, 0x39, 0x91, 0xB1, 0xF8, 0x0E, 0xD4, 0xB9, 0x30,
+    0xB3, 0x11, 0xAE, 0x61, 0x3B, 0x89, 0xD3, 0x50, 0x87, 0x0E, 0x7C, 0x26,
+    0x70, 0xBD, 0x20, 0xF1, 0x5D, 0x52, 0x8A, 0xE2, 0x02, 0x57, 0xFB, 0x40,
+    0xDA, 0x22, 0xC0, 0x9D, 0x51, 0x67, 0x6B, 0x08, 0x0A, 0x1A, 0x01, 0x4E,
+    0x20, 0x97, 0x74, 0x45, 0xD4, 0x7A, 0x1B, 0x07, 0xBB, 0x7B, 0xDA, 0xF7,
+    0x58, 0xED, 0x15, 0x80, 0xF6, 0x44, 0x97, 0x38, 0x0E, 0x19, 0x65, 0x6A,
+    0xBC, 0x61, 0x7C, 0x31, 0xC6, 0xB0, 0xE7, 0x08, 0xA7, 0xE4, 0x29, 0x91,
+    0xA6, 0x19, 0x7D, 0x6B, 0x4E, 0xFF, 0x2B, 0x5E, 0xAC, 0x95, 0x0C, 0x12,
+    0x26, 0xC9, 0x02, 0x00, 0x63, 0xB6, 0xFA, 0xE3, 0x07, 0xC0, 0x8A, 0x9A,
+    0xB3, 0xC2, 0xA0, 0x46, 0xCD, 0x73, 0x22, 0xEF, 0xAA, 0x67, 0xC0, 0x10,
+    0xDD, 0xC0, 0x21, 0x69, 0x5F, 0x13, 0x2E, 0xFD, 0x3F, 0xA2, 0xA5, 0x28,
+    0x2F, 0x09, 0xE4, 0x5A, 0xC0, 0x12, 0x17, 0x29, 0xDA, 0xEF, 0x74, 0xA8,
+    0x84, 0x02, 0x7D, 0xE3, 0x79, 0xF0, 0x34, 0xCD, 0xA2, 0xCA, 0x16, 0xE4,
+    0xB2, 0x8F, 0xE8, 0x63, 0xDC, 0x83, 0x49, 0xA3, 0x7A, 0x27, 0x3A, 0x73,
+    0xEC, 0x46, 0x6C, 0xE1, 0x6E, 0x0A, 0xC2, 0x70, 0x39, 0xB0, 0xCD, 0x8F,
+    0x1F, 0x3A, 0xB4, 0x09, 0x51, 0xA4, 0x26, 0xC6, 0xD2, 0xF0, 0x97, 0x14,
+    0xBC, 0xAA, 0x47, 0xD8, 0x36, 0x45, 0x96, 0x0B, 0x2D, 0x03, 0xDA, 0xFA,
+    0xF5, 0xE3, 0x47, 0xE8, 0x97, 0x1C, 0x41, 0xAB, 0x7C, 0xA8, 0x2E, 0xAF,
+    0x28, 0x49, 0x68, 0x09, 0x3E, 0x8D, 0xFD, 0x66, 0xEF, 0xAB, 0x3C, 0x04,
+    0xB6, 0xBD, 0xCE, 0xA8, 0xA5, 0x34, 0x02, 0x06, 0xD4, 0xE4, 0xBF, 0x3D,
+    0x7D, 0xEE, 0x3B, 0xCA, 0x78, 0x32, 0xA4, 0x4C, 0x87, 0x68, 0x15, 0x17,
+    0x8E, 0x2A, 0x9E, 0x34, 0x80, 0xE6, 0x49, 0xA4, 0x8F, 0x79, 0xED, 0xED,
+    0xB6, 0x3A, 0xE4, 0xBA, 0xA5, 0xBC, 0xF2, 0xBF, 0xA3, 0x90, 0x8D, 0x29,
+    0x64, 0x45, 0x5D, 0x62, 0x2C, 0x4B, 0x3E, 0xC6, 0xA2, 0x11, 0xB6, 0xC7,
+    0x94, 0x8E, 0x31, 0x55, 0x50, 0xDC, 0xE3, 0x4B, 0xF8, 0xA8, 0x47, 0x00,
+    0xB4, 0xEE, 0x41, 0xC0, 0x59, 0x08, 0xDB, 0x8A, 0xEE, 0x49, 0xB6, 0xA6,
+    0x1D, 0x47, 0xB0, 0x42, 0xBB, 0xDD, 0x77, 0xE9, 0x21, 0x5A, 0x3C, 0x3F,
+    0x40, 0x2F, 0xD7, 0x0B, 0x78, 0xEC, 0xF2, 0xA4, 0xC0, 0x93, 0x1E, 0xE0,
+    0xB1, 0x3B, 0xE9, 0x32, 0x25, 0x3C, 0xC4, 0x0D, 0x1D, 0x60, 0x83, 0x7D,
+    0xB4, 0x58, 0xFA, 0x52, 0xFB, 0x70, 0x54, 0x9B, 0x02, 0x56, 0xB9, 0x4E,
+    0x0E, 0x86, 0x56, 0xAE, 0xF3, 0x26, 0xB4, 0x68, 0x9D, 0x04, 0xB7, 0x49,
+    0x36, 0x08, 0x5A, 0xEB, 0xBC, 0x3D, 0xCC, 0xCA, 0x7C, 0x4C, 0x4F, 0x3B,
+    0x3B, 0x24, 0xF8, 0x5B, 0x7E, 0x52, 0x76, 0xC8, 0x64, 0x4C, 0xD3, 0x5E,
+    0x76, 0xC8, 0xA4, 0x3E, 0xBE, 0x93, 0x41, 0x85, 0xAE, 0x27, 0xB1, 0x5D,
+    0xBE, 0x34, 0x8F, 0xBA, 0x53, 0x7E, 0x69, 0xEB, 0x56, 0x7B, 0xCF, 0x00,
+    0xF1, 0xF1, 0x6D, 0xD7, 0x69, 0x60, 0xF6, 0x0D, 0xEF, 0xA1, 0x61, 0x1D,
+    0x34, 0xC6, 0xC1, 0xDC, 0xBE, 0x03, 0xD2, 0x31, 0x9D, 0xED, 0x2C, 0xD2,
+    0x6A, 0x01, 0xAA, 0x32, 0x1D, 0x54, 0xE8, 0x02, 0xB6, 0xE3, 0x72, 0x3E,
+    0xEA, 0xF3, 0x3A, 0xFF, 0x8C, 0xCB, 0x01, 0xE4, 0xF0, 0x31, 0xEC, 0x6E,
+    0x0B, 0x75, 0xAB, 0xAC, 0x69, 0x80, 0x42, 0xA7, 0xDE, 0x8B, 0x8C, 0x46,
+    0x54, 0x77, 0x70, 0xB4, 0x69, 0x23, 0x3B, 0x1D, 0x91, 0x3E, 0x07, 0xAA,
+    0xF1, 0xB7, 0xD3, 0x18, 0xED, 0x0E, 0x9C, 0x33, 0x17, 0x30, 0x21, 0x1F,
+    0x79, 0xC8, 0xE0, 0xB4, 0x52, 0x8A, 0xEC, 0xC8, 0x43, 0x06, 0x47, 0x71,
+    0x7B, 0xC2, 0x38, 0x7C, 0xB1, 0x1A, 0x1E, 0x44, 0xF2, 0x7C, 0xAE, 0x5A,
+    0x40, 0x8E, 0x55, 0x08, 0x4C, 0x75, 0xE1, 0xD0, 0x07, 0x16, 0x50, 0xDC,
+    0x16, 0xA2, 0x54, 0xAE, 0xDC, 0xC5, 0xA8, 0xDC, 0x05, 0x59, 0x27, 0xAE,
+    0xE0, 0x05, 0x08, 0x5E, 0xB4, 0x05, 0x97, 0xF2, 0xBB, 0xEF, 0xBF, 0xBB,
+    0xFD, 0xF6, 0x16, 0x49, 0x5D, 0x28, 0xA8, 0x31, 0x24, 0xB4, 0x6D, 0x86,
+    0x29, 0x0E, 0x78, 0xF6, 0x70, 0x70, 0xC8, 0x72, 0xB9, 0x18, 0x13, 0xBE,
+    0x67, 0xB8, 0x04, 0xC3, 0xE5, 0xA2, 0x4F, 0xFA, 0x9E, 0xF9, 0x93, 0xC0,
+    0x75, 0x08, 0x27, 0xAF, 0x0A, 0x26, 0x8E, 0xC4, 0x09, 0x5E, 0xB9, 0x1C,
+    0x09, 0x12, 0x64, 0xE9, 0x82, 0x24, 0x1D, 0xAC, 0xDF, 0xC8, 0x33, 0x67,
+    0xAE, 0x47, 0x52, 0x28, 0xE0, 0x29, 0x6B, 0x87, 0x32, 0xA1, 0xF7, 0x2C,
+    0xA6, 0xB7, 0xCC, 0x8D, 0x63, 0x9A, 0x8F, 0xCA, 0x85, 0xAE, 0x94, 0xBA,
+    0x92, 0xA1, 0x62, 0xA7, 0x79, 0x5B, 0x32, 0x82, 0xE9, 0x16, 0xE9, 0x5C,
+    0xC9, 0x64, 0x54, 0x32, 0x59, 0x2B, 0xE1, 0x4A, 0x26, 0x20, 0x99, 0xB4,
+    0x25, 0x23, 0xC9, 0x2D, 0xF8, 0xA9, 0x00, 0x99, 0xD0, 0xBF, 0x8B, 0x6B,
+    0x55, 0x36, 0x33, 0x4D, 0x75, 0xB4, 0x8D, 0x9E, 0x04, 0x2D, 0xD7, 0x48,
+    0xEC, 0x64, 0xE1, 0xA3, 0x0F, 0x2E, 0x7D, 0x2E, 0x92, 0xB8, 0xB1, 0xD1,
+    0xF2, 0xDE, 0x76, 0x92, 0xE6, 0x09, 0x0D, 0x6B, 0x9F, 0x9E, 0xDA, 0x61,
+    0xB0, 0xA5, 0xDF, 0x8B, 0x82, 0x96, 0x17, 0x44, 0x52, 0x33, 0x7A, 0x7F,
+    0x0E, 0x42, 0xF5, 0xAC, 0xA9, 0xD9, 0x0C, 0xC0, 0xDE, 0x97, 0x22, 0x67,
+    0xE0, 0x37, 0x02, 0xEB, 0x1F, 0xDA, 0x3D, 0xF5, 0xCC, 0xAD, 0x7D, 0x33,
+    0x17, 0xE0, 0x7F, 0x60, 0x3F, 0x5E, 0x6F, 0xF6, 0xEF, 0x35, 0x2D, 0xB7,
+    0xD7, 0x34, 0xA3, 0xB1, 0x12, 0x25, 0xCA, 0xF7, 0x23, 0x4E, 0xEE, 0xE7,
+    0x0C, 0x46, 0x65, 0x3F, 0x74, 0xA6, 0x03, 0x78, 0xAF, 0xE7, 0x03, 0x7C,
+    0x19, 0x18, 0x63, 0xDC, 0x91, 0xB3, 0xD2, 0x63, 0x4F, 0xE6, 0x61, 0x75,
+    0x15, 0x51, 0xAD, 0x95, 0x6B, 0x49, 0xBC, 0xE7, 0x56, 0x86, 0xC4, 0xA6,
+    0xEC, 0xDB, 0x90, 0xA0, 0x41, 0x7B, 0x57, 0x14, 0x15, 0x85, 0x13, 0xE9,
+    0x82, 0xA4, 0x18, 0x68, 0x4D, 0x8D, 0x61, 0x82, 0x31, 0x3F, 0xC2, 0xB5,
+    0xA9, 0x96, 0x16, 0xFA, 0x12, 0xB4, 0x63, 0x65, 0xA1, 0xAD, 0x2C, 0x0E,
+    0xDD, 0x91, 0x84, 0x2D, 0xF1, 0x1D, 0x74, 0xA1, 0xD0, 0xB9, 0xEF, 0x7D,
+    0xA3, 0xAD, 0x0B, 0x87, 0x2F, 0xA0, 0x70, 0x94, 0x0A, 0x1F, 0x39, 0x96,
+    0xF6, 0xF5, 0xC8, 0x18, 0xFF, 0x39, 0x18, 0x67, 0x1C, 0xDA, 0x13, 0x27,
+    0x68, 0x39, 0x72, 0x86, 0xF7, 0x0A, 0xF6, 0x6E, 0xC3, 0x9D, 0xA3, 0x69,
+    0x54, 0x94, 0x14, 0xC9, 0x5F, 0xD2, 0x25, 0x59, 0x67, 0xAA, 0xEF, 0x52,
+    0xE7, 0x79, 0x51, 0x64, 0x5B, 0xBC, 0xD3, 0xB1, 0x60, 0xF3, 0xAE, 0xA9,
+    0xC2, 0xDB, 0x14, 0xD9, 0xDC, 0xEE, 0xD8, 0x62, 0x08, 0x8D, 0xD6, 0xB4,
+    0x11, 0xA7, 0x9A, 0x65, 0x5A, 0xC1, 0xDA, 0xE2, 0xED, 0x2E, 0x5E, 0x78,
+    0x5B, 0x8F, 0xBB, 0x7D, 0xDB, 0x99, 0x7E, 0x9B, 0x55, 0x0D, 0x77, 0x61,
+    0xDE, 0xB1, 0x9B, 0xC3, 0x36, 0x6E, 0x74, 0xC6, 0x31, 0x45, 0xA8, 0x62,
+    0x37, 0x3D, 0xD8, 0x11, 0x22, 0x4C, 0xB3, 0xD7, 0x16, 0x62, 0xFB, 0xAA,
+    0x23, 0xA4, 0xD4, 0xED, 0x5B, 0x5B, 0x10, 0xF4, 0x4B, 0x47, 0x08, 0xD1,
+    0x0D, 0x59, 0x5B, 0x00, 0x34, 0xD4, 0x67, 0xDD, 0x1E, 0xDB, 0x19, 0x19,
+    0xA6, 0xDF, 0xBD, 0x35, 0xAD, 0x56, 0x73, 0xF7, 0x95, 0x53, 0xB5, 0x12,
+    0x10, 0x00, 0xFF, 0xFD, 0xBB, 0xEB, 0x1B, 0x7F, 0xD6, 0x5C, 0x7D, 0xE9,
+    0xE9, 0x18, 0x6C, 0x7F, 0xF0, 0x7C, 0x5B, 0x0E, 0xE7, 0x37, 0xDB, 0x82,
+    0xFA, 0x40, 0x4A, 0x00, 0x32, 0x0C, 0x0A, 0x1F, 0x54, 0xB2, 0x53, 0x3C,
+    0x11, 0x7D, 0x6F, 0xD7, 0x30, 0x2E, 0x44, 0x02, 0x6E, 0xFB, 0xF5, 0xFA,
+    0xDD, 0xDB, 0x48, 0xEA, 0xF2, 0xCF, 0x96, 0xDB, 0xC0, 0x86, 0xBF, 0xBE,
+    0x43, 0xFB, 0xDC, 0xDB, 0xBF, 0x0A, 0xAB, 0xD2, 0x62, 0xD5, 0x5B, 0x17,
+    0x50, 0x02, 0x68, 0xF2, 0xD5, 0xFF, 0xF8, 0x02, 0xD0, 0x98, 0x78, 0xB0,
+    0xDF, 0x1D, 0xB8, 0x08, 0x6C, 0x8A, 0xC4, 0x50, 0xD2, 0xF5, 0x94, 0xF0,
+    0x15, 0xE1, 0x50, 0xE3, 0x66, 0x6E, 0x51, 0xE8, 0x1B, 0x4D, 0xAB, 0xAB,
+    0xB6, 0x2A, 0x6F, 0x5B, 0x75, 0xA9, 0xA3, 0x72, 0xA1, 0xF8, 0xDC, 0x5E,
+    0x66, 0x86, 0x93, 0xCE, 0x8D, 0xEE, 0xDD, 0xFE, 0x58, 0xDD, 0xD3, 0xED,
+    0xEE, 0x7F, 0x52, 0xF4, 0x2E, 0xCC, 0x68, 0x70, 0xB0, 0xE8, 0x75, 0xEB,
+    0x56, 0xD5, 0x01, 0x9F, 0xC1, 0x77, 0xA5, 0xA4, 0x57, 0x5C, 0x05, 0x13,
+    0xC6, 0x01, 0x93, 0xD3, 0x61, 0x95, 0x26, 0x6E, 0xA3, 0x3B, 0x59, 0x90,
+    0x69, 0xA3, 0xAD, 0xA4, 0x4F, 0x2A, 0x00, 0xD5, 0x20, 0xF4, 0xE5, 0x17,
+    0x80, 0x2A, 0x6E, 0x5F, 0x60, 0x01, 0x68, 0x82, 0xF0, 0x09, 0x05, 0xA0,
+    0x2F, 0x5B, 0x74, 0x77, 0xFE, 0x9F, 0x64, 0xCB, 0xAB, 0xF7, 0x57, 0xEF,
+    0x8E, 0x48, 0x95, 0xBA, 0x3F, 0x9F, 0x02, 0xF1, 0x7A, 0x2A, 0xDA, 0x4F,
+    0x15, 0xA5, 0x5B, 0xEF, 0xB3, 0x49, 0x73, 0x4F, 0xFB, 0xE8, 0x6C, 0x8D,
+    0x23, 0x67, 0x93, 0xC6, 0x9B, 0x6A, 0x9E, 0xC1, 0x5F, 0x61, 0x55, 0xB9,
+    0xA6, 0xFE, 0x27, 0xE5, 0x99, 0x1E, 0x24, 0xBF, 0xFC, 0x24, 0xD3, 0xE1,
+    0x9E, 0x92, 0x61, 0xC7, 0x27, 0x01, 0x8A, 0xEE, 0xC9, 0x80, 0x9D, 0xB7,
+    0x64, 0x1C, 0xE6, 0x9F, 0xC6, 0xD1, 0x07, 0x33, 0x62, 0xC3, 0x78, 0x22,
+    0x36, 0x3D, 0x68, 0x7F, 0xF9, 0xEE, 0x8D, 0x75, 0x25, 0xF2, 0xC1, 0xCE,
+    0x66, 0x9D, 0xDF, 0x41, 0x5B, 0xE8, 0xFE, 0x19, 0x03, 0xA7, 0x7F, 0xD4,
+    0x84, 0x26, 0x6B, 0x5D, 0xC3, 0xBA, 0xA7, 0x24, 0xB4, 0x6D, 0x01, 0x1B,
+    0xFE, 0x05, 0x08, 0xD4, 0x48, 0xB9, 0xCB, 0x21, 0x00, 0x00
+};
+
+static const char assets_app_8864ee4b_js_identity_hdr_ok[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: application/javascript\r\n"
+    "Content-Length: 8651\r\n"
+    "Vary: Accept-Encoding\r\n"
+    "ETag: \"8864ee4b07b0e610\"\r\n"
+    "Cache-Control: public, max-age=31536000, immutable\r\n"
+    "Connection: close\r\n"
+    "\r\n";
+static const char assets_app_8864ee4b_js_identity_hdr_ok_ka[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: application/javascript\r\n"
+    "Content-Length: 8651\r\n"
+    "Vary: Accept-Encoding\r\n"
+    "ETag: \"8864ee4b07b0e610\"\r\n"
+    "Cache-Control: public, max-age=31536000, immutable\r\n"
+    "Connection: keep-alive\r\n"
+    "Keep-Alive: timeout=5\r\n"
+    "\r\n";
+static const char assets_app_8864ee4b_js_identity_hdr_nm[] =
+    "HTTP/1.1 304 Not Modified\r\n"
+    "Vary: Accept-Encoding\r\n"
+    "ETag: \"8864ee4b07b0e610\"\r\n"
+    "Cache-Control: public, max-age=31536000, immutable\r\n"
+    "Connection: close\r\n"
+    "\r\n";
+static const char assets_app_8864ee4b_js_identity_hdr_nm_ka[] =
+    "HTTP/1.1 304 Not Modified\r\n"
+    "Vary: Accept-Encoding\r\n"
+    "ETag: \"8864ee4b07b0e610\"\r\n"
+    "Cache-Control: public, max-age=31536000, immutable\r\n"
+    "Connection: keep-alive\r\n"
+    "Keep-Alive: timeout=5\r\n"
+    "\r\n";
+static const char assets_app_8864ee4b_js_gzip_hdr_ok[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: application/javascript\r\n"
+    "Content-Length: 2038\r\n"
+    "Content-Encoding: gzip\r\n"
+    "Vary: Accept-Encoding\r\n"
+    "ETag: \"8864ee4b07b0e610-gz\"\r\n"
+    "Cache-Control: public, max-age=31536000, immutable\r\n"
+    "Connection: close\r\n"
+    "\r\n";
+static const char assets_app_8864ee4b_js_gzip_hdr_ok_ka[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: application/javascript\r\n"
+    "Content-Length: 2038\r\n"
+    "Content-Encoding: gzip\r\n"
+    "Vary: Accept-Encoding\r\n"
+    "ETag: \"8864ee4b07b0e610-gz\"\r\n"
+    "Cache-Control: public, max-age=31536000, immutable\r\n"
+    "Connection: keep-alive\r\n"
+    "Keep-Alive: timeout=5\r\n"
+    "\r\n";
+static const char assets_app_8864ee4b_js_gzip_hdr_nm[] =
+    "HTTP/1.1 304 Not Modified\r\n"
+    "Vary: Accept-Encoding\r\n"
+    "ETag: \"8864ee4b07b0e610-gz\"\r\n"
+    "Cache-Control: public, max-age=31536000, immutable\r\n"
+    "Connection: close\r\n"
+    "\r\n";
+static const char assets_app_8864ee4b_js_gzip_hdr_nm_ka[] =
+    "HTTP/1.1 304 Not Modified\r\n"
+    "Vary: Accept-Encoding\r\n"
+    "ETag: \"8864ee4b07b0e610-gz\"\r\n"
+    "Cache-Control: public, max-age=31536000, immutable\r\n"
+    "Connection: keep-alive\r\n"
+    "Keep-Alive: timeout=5\r\n"
+    "\r\n";
+
+// index_html: original size 19918 bytes
+const uint8_t index_html_identity_data[] = {
+    0x3C, 0x21, 0x2D, 0x2D, 0x20, 0x40, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74,
+    0x20, 0x2D, 0x2D, 0x3E, 0x0A, 0x0A, 0x3C, 0x21, 0x44, 0x4F, 0x43, 0x54,
+    0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0A, 0x3C, 0x68,
+    0x74, 0x6D, 0x6C, 0x20, 0x6C, 0x61, 0x6E, 0x67, 0x3D, 0x22, 0x65, 0x6E,
+    0x22, 0x3E, 0x0A, 0x20, 0x20, 0x3C, 0x68, 0x65, 0x61, 0x64, 0x3E, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x6D, 0x65, 0x74, 0x61, 0x20, 0x63, 0x68,
+    0x61, 0x72, 0x73, 0x65, 0x74, 0x3D, 0x22, 0x55, 0x54, 0x46, 0x2D, 0x38,
+    0x22, 0x20, 0x2F, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6D, 0x65,
+    0x74, 0x61, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x61, 0x6D,
+    0x65, 0x3D, 0x22, 0x76, 0x69, 0x65, 0x77, 0x70, 0x6F, 0x72, 0x74, 0x22,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65,
+    0x6E, 0x74, 0x3D, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x64, 0x65,
+    0x76, 0x69, 0x63, 0x65, 0x2D, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x20,
+    0x69, 0x6E, 0x69, 0x74, 0x69, 0x61, 0x6C, 0x2D, 0x73, 0x63, 0x61, 0x6C,
+    0x65, 0x3D, 0x31, 0x2E, 0x30, 0x22, 0x20, 0x2F, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x3C, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x3E, 0x50, 0x69, 0x63,
+    0x6F, 0x20, 0x43, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x3C, 0x2F, 0x74,
+    0x69, 0x74, 0x6C, 0x65, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C,
+    0x69, 0x6E, 0x6B, 0x20, 0x72, 0x65, 0x6C, 0x3D, 0x22, 0x73, 0x74, 0x79,
+    0x6C, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x22, 0x20, 0x68, 0x72, 0x65,
+    0x66, 0x3D, 0x22, 0x2F, 0x61, 0x73, 0x73, 0x65, 0x74, 0x73, 0x2F, 0x61,
+    0x70, 0x70, 0x2E, 0x38, 0x35, 0x64, 0x32, 0x36, 0x66, 0x66, 0x32, 0x2E,
+    0x63, 0x73, 0x73, 0x22, 0x20, 0x2F, 0x3E, 0x0A, 0x20, 0x20, 0x3C, 0x2F,
+    0x68, 0x65, 0x61, 0x64, 0x3E, 0x0A, 0x20, 0x20, 0x3C, 0x62, 0x6F, 0x64,
+    0x79, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x6C, 0x6F,
+    0x61, 0x64, 0x69, 0x6E, 0x67, 0x2D, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61,
+    0x79, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6C, 0x61,
+    0x73, 0x73, 0x3D, 0x22, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6E, 0x22, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20,
+    0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x73, 0x70, 0x69, 0x6E, 0x6E,
+    0x65, 0x72, 0x22, 0x3E, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x6C, 0x6F,
+    0x61, 0x64, 0x69, 0x6E, 0x67, 0x2D, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67,
+    0x65, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73,
+    0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E,
+    0x2D, 0x74, 0x6F, 0x70, 0x3A, 0x20, 0x36, 0x34, 0x70, 0x78, 0x3B, 0x20,
+    0x66, 0x6F, 0x6E, 0x74, 0x2D, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A,
+    0x20, 0x35, 0x30, 0x30, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x4C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x2E, 0x2E,
+    0x2E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69,
+    0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x69,
+    0x64, 0x3D, 0x22, 0x74, 0x6F, 0x61, 0x73, 0x74, 0x2D, 0x63, 0x6F, 0x6E,
+    0x74, 0x61, 0x69, 0x6E, 0x65, 0x72, 0x22, 0x3E, 0x3C, 0x2F, 0x64, 0x69,
+    0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x63, 0x6F,
+    0x6E, 0x66, 0x69, 0x72, 0x6D, 0x2D, 0x6D, 0x6F, 0x64, 0x61, 0x6C, 0x22,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73,
+    0x3D, 0x22, 0x6D, 0x6F, 0x64, 0x61, 0x6C, 0x20, 0x68, 0x69, 0x64, 0x64,
+    0x65, 0x6E, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x6D,
+    0x6F, 0x64, 0x61, 0x6C, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74,
+    0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x6D,
+    0x6F, 0x64, 0x61, 0x6C, 0x2D, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x22,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x73, 0x76, 0x67, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22,
+    0x69, 0x63, 0x6F, 0x6E, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x70, 0x72,
+    0x69, 0x6D, 0x61, 0x72, 0x79, 0x22, 0x3E, 0x3C, 0x75, 0x73, 0x65, 0x20,
+    0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x23, 0x70, 0x6F, 0x77, 0x65, 0x72,
+    0x22, 0x3E, 0x3C, 0x2F, 0x75, 0x73, 0x65, 0x3E, 0x3C, 0x2F, 0x73, 0x76,
+    0x67, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3C, 0x68, 0x33, 0x3E, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x72, 0x6D,
+    0x20, 0x52, 0x65, 0x62, 0x6F, 0x6F, 0x74, 0x3C, 0x2F, 0x68, 0x33, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64,
+    0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22,
+    0x6D, 0x6F, 0x64, 0x61, 0x6C, 0x2D, 0x62, 0x6F, 0x64, 0x79, 0x22, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x70, 0x3E, 0x41, 0x72, 0x65, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x73, 0x75,
+    0x72, 0x65, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x77, 0x61, 0x6E, 0x74, 0x20,
+    0x74, 0x6F, 0x20, 0x72, 0x65, 0x62, 0x6F, 0x6F, 0x74, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x3F, 0x3C, 0x2F, 0x70,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F,
+    0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
+    0x22, 0x6D, 0x6F, 0x64, 0x61, 0x6C, 0x2D, 0x61, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0x73, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69,
+    0x64, 0x3D, 0x22, 0x6D, 0x6F, 0x64, 0x61, 0x6C, 0x2D, 0x63, 0x61, 0x6E,
+    0x63, 0x65, 0x6C, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22,
+    0x62, 0x74, 0x6E, 0x20, 0x62, 0x74, 0x6E, 0x2D, 0x66, 0x6C, 0x61, 0x74,
+    0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x43, 0x61, 0x6E, 0x63, 0x65, 0x6C, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x62, 0x75,
+    0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x69, 0x64, 0x3D, 0x22, 0x6D, 0x6F, 0x64, 0x61, 0x6C, 0x2D, 0x63, 0x6F,
+    0x6E, 0x66, 0x69, 0x72, 0x6D, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73,
+    0x3D, 0x22, 0x62, 0x74, 0x6E, 0x20, 0x62, 0x74, 0x6E, 0x2D, 0x70, 0x72,
+    0x69, 0x6D, 0x61, 0x72, 0x79, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x65, 0x62, 0x6F,
+    0x6F, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69,
+    0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x68, 0x65, 0x61, 0x64, 0x65,
+    0x72, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x62, 0x75,
+    0x74, 0x74, 0x6F, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22,
+    0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x2D, 0x62, 0x74, 0x6E, 0x22, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x76,
+    0x67, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x69, 0x63, 0x6F,
+    0x6E, 0x22, 0x3E, 0x3C, 0x75, 0x73, 0x65, 0x20, 0x68, 0x72, 0x65, 0x66,
+    0x3D, 0x22, 0x23, 0x6C, 0x6F, 0x67, 0x6F, 0x32, 0x22, 0x3E, 0x3C, 0x2F,
+    0x75, 0x73, 0x65, 0x3E, 0x3C, 0x2F, 0x73, 0x76, 0x67, 0x3E, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F,
+    0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69,
+    0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x68, 0x65, 0x61,
+    0x64, 0x65, 0x72, 0x2D, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x22, 0x3E, 0x4D,
+    0x49, 0x43, 0x20, 0x43, 0x4F, 0x4E, 0x54, 0x52, 0x4F, 0x4C, 0x3C, 0x2F,
+    0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x64, 0x69, 0x76, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x68, 0x65, 0x61, 0x64, 0x65,
+    0x72, 0x2D, 0x6D, 0x61, 0x63, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x68, 0x65, 0x61, 0x64, 0x65,
+    0x72, 0x2D, 0x6D, 0x61, 0x63, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x4E, 0x2F, 0x41, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x3C, 0x2F, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x3E, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73,
+    0x73, 0x3D, 0x22, 0x6C, 0x61, 0x79, 0x6F, 0x75, 0x74, 0x22, 0x3E, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x61, 0x73, 0x69, 0x64, 0x65,
+    0x20, 0x69, 0x64, 0x3D, 0x22, 0x73, 0x69, 0x64, 0x65, 0x62, 0x61, 0x72,
+    0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x75, 0x6C, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x6E, 0x61,
+    0x76, 0x2D, 0x6C, 0x69, 0x73, 0x74, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x69, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
+    0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x6E, 0x61, 0x76, 0x2D, 0x69, 0x74,
+    0x65, 0x6D, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x22, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64,
+    0x61, 0x74, 0x61, 0x2D, 0x70, 0x61, 0x67, 0x65, 0x3D, 0x22, 0x73, 0x75,
+    0x6D, 0x6D, 0x61, 0x72, 0x79, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x76, 0x67,
+    0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x6E, 0x61, 0x76, 0x2D,
+    0x69, 0x63, 0x6F, 0x6E, 0x22, 0x3E, 0x3C, 0x75, 0x73, 0x65, 0x20, 0x68,
+    0x72, 0x65, 0x66, 0x3D, 0x22, 0x23, 0x68, 0x6F, 0x6D, 0x65, 0x22, 0x3E,
+    0x3C, 0x2F, 0x75, 0x73, 0x65, 0x3E, 0x3C, 0x2F, 0x73, 0x76, 0x67, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
+    0x22, 0x6E, 0x61, 0x76, 0x2D, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x22, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61,
+    0x73, 0x73, 0x3D, 0x22, 0x6E, 0x61, 0x76, 0x2D, 0x6C, 0x61, 0x62, 0x65,
+    0x6C, 0x2D, 0x6D, 0x61, 0x69, 0x6E, 0x22, 0x3E, 0x48, 0x6F, 0x6D, 0x65,
+    0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73,
+    0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x6E,
+    0x61, 0x76, 0x2D, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x2D, 0x73, 0x75, 0x62,
+    0x22, 0x3E, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x53, 0x75, 0x6D,
+    0x6D, 0x61, 0x72, 0x79, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6C, 0x69, 0x3E, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x69,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x6E, 0x61, 0x76, 0x2D,
+    0x69, 0x74, 0x65, 0x6D, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2D, 0x70,
+    0x61, 0x67, 0x65, 0x3D, 0x22, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67,
+    0x73, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x76, 0x67, 0x20, 0x63, 0x6C, 0x61,
+    0x73, 0x73, 0x3D, 0x22, 0x6E, 0x61, 0x76, 0x2D, 0x69, 0x63, 0x6F, 0x6E,
+    0x22, 0x3E, 0x3C, 0x75, 0x73, 0x65, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D,
+    0x22, 0x23, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x22, 0x3E,
+    0x3C, 0x2F, 0x75, 0x73, 0x65, 0x3E, 0x3C, 0x2F, 0x73, 0x76, 0x67, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
+    0x22, 0x6E, 0x61, 0x76, 0x2D, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x22, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61,
+    0x73, 0x73, 0x3D, 0x22, 0x6E, 0x61, 0x76, 0x2D, 0x6C, 0x61, 0x62, 0x65,
+    0x6C, 0x2D, 0x6D, 0x61, 0x69, 0x6E, 0x22, 0x3E, 0x53, 0x65, 0x74, 0x74,
+    0x69, 0x6E, 0x67, 0x73, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73,
+    0x73, 0x3D, 0x22, 0x6E, 0x61, 0x76, 0x2D, 0x6C, 0x61, 0x62, 0x65, 0x6C,
+    0x2D, 0x73, 0x75, 0x62, 0x22, 0x3E, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D,
+    0x20, 0x43, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x74, 0x69,
+    0x6F, 0x6E, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F,
+    0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6C, 0x69, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x75, 0x6C, 0x3E, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x61, 0x73, 0x69, 0x64, 0x65,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6D, 0x61, 0x69,
+    0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x64, 0x69, 0x76, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x70, 0x61, 0x67, 0x65, 0x2D, 0x73,
+    0x75, 0x6D, 0x6D, 0x61, 0x72, 0x79, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
+    0x22, 0x70, 0x61, 0x67, 0x65, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63,
+    0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x61, 0x72, 0x64, 0x22, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
+    0x22, 0x63, 0x61, 0x72, 0x64, 0x2D, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72,
+    0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x76, 0x67, 0x20, 0x63, 0x6C,
+    0x61, 0x73, 0x73, 0x3D, 0x22, 0x69, 0x63, 0x6F, 0x6E, 0x20, 0x74, 0x65,
+    0x78, 0x74, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x22, 0x3E,
+    0x3C, 0x75, 0x73, 0x65, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x23,
+    0x68, 0x6F, 0x6D, 0x65, 0x22, 0x3E, 0x3C, 0x2F, 0x75, 0x73, 0x65, 0x3E,
+    0x3C, 0x2F, 0x73, 0x76, 0x67, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70,
+    0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x61,
+    0x72, 0x64, 0x2D, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x22, 0x3E, 0x53, 0x79,
+    0x73, 0x74, 0x65, 0x6D, 0x20, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x3C,
+    0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73,
+    0x3D, 0x22, 0x63, 0x61, 0x72, 0x64, 0x2D, 0x62, 0x6F, 0x64, 0x79, 0x22,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61,
+    0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F,
+    0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61,
+    0x62, 0x65, 0x6C, 0x3E, 0x4E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x3C,
+    0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x64, 0x69, 0x76, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73,
+    0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20,
+    0x38, 0x70, 0x78, 0x20, 0x38, 0x70, 0x78, 0x20, 0x38, 0x70, 0x78, 0x20,
+    0x32, 0x34, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66,
+    0x6C, 0x65, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x66, 0x6C, 0x65, 0x78, 0x2D, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
+    0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x63, 0x6F, 0x6C, 0x75, 0x6D, 0x6E, 0x3B,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x61, 0x70,
+    0x3A, 0x20, 0x31, 0x32, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x72,
+    0x6F, 0x77, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x2D, 0x63, 0x65, 0x6E,
+    0x74, 0x65, 0x72, 0x20, 0x6A, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2D,
+    0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x22, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x3E,
+    0x4D, 0x41, 0x43, 0x20, 0x41, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x3C,
+    0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x20, 0x69,
+    0x64, 0x3D, 0x22, 0x73, 0x75, 0x6D, 0x2D, 0x6D, 0x61, 0x63, 0x22, 0x3E,
+    0x4C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x2E, 0x2E, 0x2E, 0x3C, 0x2F,
+    0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73,
+    0x73, 0x3D, 0x22, 0x72, 0x6F, 0x77, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x73,
+    0x2D, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x6A, 0x75, 0x73, 0x74,
+    0x69, 0x66, 0x79, 0x2D, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x22,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73,
+    0x70, 0x61, 0x6E, 0x3E, 0x44, 0x48, 0x43, 0x50, 0x3C, 0x2F, 0x73, 0x70,
+    0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x20, 0x69, 0x64, 0x3D, 0x22,
+    0x73, 0x75, 0x6D, 0x2D, 0x64, 0x68, 0x63, 0x70, 0x22, 0x3E, 0x4C, 0x6F,
+    0x61, 0x64, 0x69, 0x6E, 0x67, 0x2E, 0x2E, 0x2E, 0x3C, 0x2F, 0x73, 0x74,
+    0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
+    0x22, 0x72, 0x6F, 0x77, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x2D, 0x63,
+    0x65, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x6A, 0x75, 0x73, 0x74, 0x69, 0x66,
+    0x79, 0x2D, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x22, 0x3E, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61,
+    0x6E, 0x3E, 0x49, 0x50, 0x20, 0x41, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73,
+    0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x20,
+    0x69, 0x64, 0x3D, 0x22, 0x73, 0x75, 0x6D, 0x2D, 0x69, 0x70, 0x22, 0x3E,
+    0x4C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x2E, 0x2E, 0x2E, 0x3C, 0x2F,
+    0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73,
+    0x73, 0x3D, 0x22, 0x72, 0x6F, 0x77, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x73,
+    0x2D, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x6A, 0x75, 0x73, 0x74,
+    0x69, 0x66, 0x79, 0x2D, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x22,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73,
+    0x70, 0x61, 0x6E, 0x3E, 0x4E, 0x65, 0x74, 0x6D, 0x61, 0x73, 0x6B, 0x3C,
+    0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x20, 0x69,
+    0x64, 0x3D, 0x22, 0x73, 0x75, 0x6D, 0x2D, 0x6D, 0x61, 0x73, 0x6B, 0x22,
+    0x3E, 0x4C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x2E, 0x2E, 0x2E, 0x3C,
+    0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61,
+    0x73, 0x73, 0x3D, 0x22, 0x72, 0x6F, 0x77, 0x20, 0x69, 0x74, 0x65, 0x6D,
+    0x73, 0x2D, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x6A, 0x75, 0x73,
+    0x74, 0x69, 0x66, 0x79, 0x2D, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E,
+    0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x73, 0x70, 0x61, 0x6E, 0x3E, 0x47, 0x61, 0x74, 0x65, 0x77, 0x61, 0x79,
+    0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x20,
+    0x69, 0x64, 0x3D, 0x22, 0x73, 0x75, 0x6D, 0x2D, 0x67, 0x61, 0x74, 0x65,
+    0x77, 0x61, 0x79, 0x22, 0x3E, 0x4C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67,
+    0x2E, 0x2E, 0x2E, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76,
+    0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x72, 0x6F, 0x77, 0x20,
+    0x69, 0x74, 0x65, 0x6D, 0x73, 0x2D, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72,
+    0x20, 0x6A, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2D, 0x62, 0x65, 0x74,
+    0x77, 0x65, 0x65, 0x6E, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x44, 0x4E, 0x53,
+    0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x20,
+    0x69, 0x64, 0x3D, 0x22, 0x73, 0x75, 0x6D, 0x2D, 0x64, 0x6E, 0x73, 0x22,
+    0x3E, 0x4C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x2E, 0x2E, 0x2E, 0x3C,
+    0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76,
+    0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D,
+    0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x43, 0x6F, 0x6D, 0x6D,
+    0x75, 0x6E, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3C, 0x2F, 0x6C,
+    0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64,
+    0x69, 0x76, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x79,
+    0x6C, 0x65, 0x3D, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x38, 0x70,
+    0x78, 0x20, 0x38, 0x70, 0x78, 0x20, 0x38, 0x70, 0x78, 0x20, 0x32, 0x34,
+    0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65,
+    0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66,
+    0x6C, 0x65, 0x78, 0x2D, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0x3A, 0x20, 0x63, 0x6F, 0x6C, 0x75, 0x6D, 0x6E, 0x3B, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x61, 0x70, 0x3A, 0x20,
+    0x31, 0x32, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69,
+    0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x72, 0x6F, 0x77,
+    0x20, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x2D, 0x63, 0x65, 0x6E, 0x74, 0x65,
+    0x72, 0x20, 0x6A, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2D, 0x62, 0x65,
+    0x74, 0x77, 0x65, 0x65, 0x6E, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x54, 0x43,
+    0x50, 0x20, 0x50, 0x6F, 0x72, 0x74, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73,
+    0x74, 0x72, 0x6F, 0x6E, 0x67, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x73, 0x75,
+    0x6D, 0x2D, 0x74, 0x63, 0x70, 0x22, 0x3E, 0x4C, 0x6F, 0x61, 0x64, 0x69,
+    0x6E, 0x67, 0x2E, 0x2E, 0x2E, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E,
+    0x67, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64,
+    0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64,
+    0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x72, 0x6F,
+    0x77, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x2D, 0x63, 0x65, 0x6E, 0x74,
+    0x65, 0x72, 0x20, 0x6A, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2D, 0x62,
+    0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x42,
+    0x61, 0x75, 0x64, 0x20, 0x52, 0x61, 0x74, 0x65, 0x3C, 0x2F, 0x73, 0x70,
+    0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x20, 0x69, 0x64, 0x3D, 0x22,
+    0x73, 0x75, 0x6D, 0x2D, 0x62, 0x61, 0x75, 0x64, 0x22, 0x3E, 0x4C, 0x6F,
+    0x61, 0x64, 0x69, 0x6E, 0x67, 0x2E, 0x2E, 0x2E, 0x3C, 0x2F, 0x73, 0x74,
+    0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69,
+    0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C,
+    0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72,
+    0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C,
+    0x61, 0x62, 0x65, 0x6C, 0x3E, 0x47, 0x50, 0x49, 0x4F, 0x20, 0x43, 0x6F,
+    0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64,
+    0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x38, 0x70, 0x78, 0x20, 0x38, 0x70,
+    0x78, 0x20, 0x38, 0x70, 0x78, 0x20, 0x32, 0x34, 0x70, 0x78, 0x3B, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70,
+    0x6C, 0x61, 0x79, 0x3A, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x3B, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 0x65, 0x78, 0x2D,
+    0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x63,
+    0x6F, 0x6C, 0x75, 0x6D, 0x6E, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x67, 0x61, 0x70, 0x3A, 0x20, 0x31, 0x32, 0x70, 0x78,
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x3E, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C,
+    0x61, 0x73, 0x73, 0x3D, 0x22, 0x72, 0x6F, 0x77, 0x20, 0x69, 0x74, 0x65,
+    0x6D, 0x73, 0x2D, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x6A, 0x75,
+    0x73, 0x74, 0x69, 0x66, 0x79, 0x2D, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65,
+    0x6E, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x44, 0x65, 0x76, 0x69, 0x63, 0x65,
+    0x20, 0x49, 0x44, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F,
+    0x6E, 0x67, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x73, 0x75, 0x6D, 0x2D, 0x69,
+    0x64, 0x22, 0x3E, 0x4C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x2E, 0x2E,
+    0x2E, 0x3C, 0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63,
+    0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x72, 0x6F, 0x77, 0x20, 0x69, 0x74,
+    0x65, 0x6D, 0x73, 0x2D, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x6A,
+    0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2D, 0x62, 0x65, 0x74, 0x77, 0x65,
+    0x65, 0x6E, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x4D, 0x6F, 0x64, 0x65, 0x3C,
+    0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x20, 0x69,
+    0x64, 0x3D, 0x22, 0x73, 0x75, 0x6D, 0x2D, 0x6D, 0x6F, 0x64, 0x65, 0x22,
+    0x3E, 0x4C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x2E, 0x2E, 0x2E, 0x3C,
+    0x2F, 0x73, 0x74, 0x72, 0x6F, 0x6E, 0x67, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x64, 0x3D, 0x22,
+    0x70, 0x61, 0x67, 0x65, 0x2D, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67,
+    0x73, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x70, 0x61, 0x67, 0x65,
+    0x20, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6E, 0x22, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76,
+    0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x61, 0x72, 0x64,
+    0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73,
+    0x73, 0x3D, 0x22, 0x63, 0x61, 0x72, 0x64, 0x2D, 0x68, 0x65, 0x61, 0x64,
+    0x65, 0x72, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x76, 0x67, 0x20,
+    0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x69, 0x63, 0x6F, 0x6E, 0x20,
+    0x74, 0x65, 0x78, 0x74, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79,
+    0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x75, 0x73, 0x65, 0x20,
+    0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x23, 0x6E, 0x65, 0x74, 0x77, 0x6F,
+    0x72, 0x6B, 0x2D, 0x6E, 0x6F, 0x64, 0x65, 0x22, 0x3E, 0x3C, 0x2F, 0x75,
+    0x73, 0x65, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73, 0x76, 0x67, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61,
+    0x73, 0x73, 0x3D, 0x22, 0x63, 0x61, 0x72, 0x64, 0x2D, 0x74, 0x69, 0x74,
+    0x6C, 0x65, 0x22, 0x3E, 0x4E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x20,
+    0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x66, 0x6F,
+    0x72, 0x6D, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x6E, 0x65, 0x74, 0x77, 0x6F,
+    0x72, 0x6B, 0x2D, 0x66, 0x6F, 0x72, 0x6D, 0x22, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22,
+    0x63, 0x61, 0x72, 0x64, 0x2D, 0x62, 0x6F, 0x64, 0x79, 0x22, 0x3E, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61,
+    0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x72, 0x6F, 0x77,
+    0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69,
+    0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x72, 0x6F, 0x77,
+    0x20, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x2D, 0x63, 0x65, 0x6E, 0x74, 0x65,
+    0x72, 0x20, 0x67, 0x61, 0x70, 0x2D, 0x73, 0x6D, 0x22, 0x3E, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x76, 0x67, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6C,
+    0x61, 0x73, 0x73, 0x3D, 0x22, 0x69, 0x63, 0x6F, 0x6E, 0x2D, 0x73, 0x6D,
+    0x20, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72,
+    0x79, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x66, 0x69, 0x6C, 0x6C,
+    0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D,
+    0x61, 0x72, 0x79, 0x29, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x75, 0x73, 0x65, 0x20, 0x68, 0x72,
+    0x65, 0x66, 0x3D, 0x22, 0x23, 0x61, 0x64, 0x6A, 0x75, 0x73, 0x74, 0x22,
+    0x3E, 0x3C, 0x2F, 0x75, 0x73, 0x65, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73, 0x76, 0x67, 0x3E, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E,
+    0x3E, 0x44, 0x48, 0x43, 0x50, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62,
+    0x65, 0x6C, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x74, 0x6F,
+    0x67, 0x67, 0x6C, 0x65, 0x2D, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x22,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x69,
+    0x6E, 0x70, 0x75, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x63, 0x68, 0x65,
+    0x63, 0x6B, 0x62, 0x6F, 0x78, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x6E, 0x65, 0x74,
+    0x2D, 0x64, 0x68, 0x63, 0x70, 0x22, 0x20, 0x2F, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20,
+    0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x73, 0x6C, 0x69, 0x64, 0x65,
+    0x72, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C,
+    0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72,
+    0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x49, 0x50, 0x20, 0x41, 0x64,
+    0x64, 0x72, 0x65, 0x73, 0x73, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x69, 0x6E, 0x70,
+    0x75, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74,
+    0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x6E,
+    0x65, 0x74, 0x2D, 0x69, 0x70, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x74, 0x74,
+    0x65, 0x72, 0x6E, 0x3D, 0x22, 0x5E, 0x28, 0x28, 0x32, 0x35, 0x5B, 0x30,
+    0x2D, 0x35, 0x5D, 0x7C, 0x28, 0x32, 0x5B, 0x30, 0x2D, 0x34, 0x5D, 0x7C,
+    0x31, 0x5C, 0x64, 0x7C, 0x5B, 0x31, 0x2D, 0x39, 0x5D, 0x7C, 0x29, 0x5C,
+    0x64, 0x29, 0x5C, 0x2E, 0x3F, 0x5C, 0x62, 0x29, 0x7B, 0x34, 0x7D, 0x24,
+    0x22, 0x20, 0x2F, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64,
+    0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76,
+    0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D,
+    0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x4E, 0x65,
+    0x74, 0x6D, 0x61, 0x73, 0x6B, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x69, 0x6E, 0x70,
+    0x75, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74,
+    0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x6E,
+    0x65, 0x74, 0x2D, 0x6D, 0x61, 0x73, 0x6B, 0x22, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65,
+    0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61,
+    0x74, 0x74, 0x65, 0x72, 0x6E, 0x3D, 0x22, 0x5E, 0x28, 0x28, 0x32, 0x35,
+    0x5B, 0x30, 0x2D, 0x35, 0x5D, 0x7C, 0x28, 0x32, 0x5B, 0x30, 0x2D, 0x34,
+    0x5D, 0x7C, 0x31, 0x5C, 0x64, 0x7C, 0x5B, 0x31, 0x2D, 0x39, 0x5D, 0x7C,
+    0x29, 0x5C, 0x64, 0x29, 0x5C, 0x2E, 0x3F, 0x5C, 0x62, 0x29, 0x7B, 0x34,
+    0x7D, 0x24, 0x22, 0x20, 0x2F, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64,
+    0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F,
+    0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E,
+    0x47, 0x61, 0x74, 0x65, 0x77, 0x61, 0x79, 0x3C, 0x2F, 0x6C, 0x61, 0x62,
+    0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x69,
+    0x6E, 0x70, 0x75, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x64, 0x3D,
+    0x22, 0x6E, 0x65, 0x74, 0x2D, 0x67, 0x61, 0x74, 0x65, 0x77, 0x61, 0x79,
+    0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65,
+    0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x3D, 0x22,
+    0x5E, 0x28, 0x28, 0x32, 0x35, 0x5B, 0x30, 0x2D, 0x35, 0x5D, 0x7C, 0x28,
+    0x32, 0x5B, 0x30, 0x2D, 0x34, 0x5D, 0x7C, 0x31, 0x5C, 0x64, 0x7C, 0x5B,
+    0x31, 0x2D, 0x39, 0x5D, 0x7C, 0x29, 0x5C, 0x64, 0x29, 0x5C, 0x2E, 0x3F,
+    0x5C, 0x62, 0x29, 0x7B, 0x34, 0x7D, 0x24, 0x22, 0x20, 0x2F, 0x3E, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73,
+    0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75,
+    0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C,
+    0x61, 0x62, 0x65, 0x6C, 0x3E, 0x44, 0x4E, 0x53, 0x3C, 0x2F, 0x6C, 0x61,
+    0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x69, 0x6E, 0x70, 0x75, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74,
+    0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x64,
+    0x3D, 0x22, 0x6E, 0x65, 0x74, 0x2D, 0x64, 0x6E, 0x73, 0x22, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69,
+    0x72, 0x65, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x3D, 0x22, 0x5E, 0x28, 0x28,
+    0x32, 0x35, 0x5B, 0x30, 0x2D, 0x35, 0x5D, 0x7C, 0x28, 0x32, 0x5B, 0x30,
+    0x2D, 0x34, 0x5D, 0x7C, 0x31, 0x5C, 0x64, 0x7C, 0x5B, 0x31, 0x2D, 0x39,
+    0x5D, 0x7C, 0x29, 0x5C, 0x64, 0x29, 0x5C, 0x2E, 0x3F, 0x5C, 0x62, 0x29,
+    0x7B, 0x34, 0x7D, 0x24, 0x22, 0x20, 0x2F, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F,
+    0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20,
+    0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x61, 0x72, 0x64, 0x2D,
+    0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x22, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x73, 0x75,
+    0x62, 0x6D, 0x69, 0x74, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x62, 0x74, 0x6E, 0x20, 0x62,
+    0x74, 0x6E, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x20, 0x62,
+    0x74, 0x6E, 0x2D, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x22, 0x3E, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x76, 0x67, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73,
+    0x3D, 0x22, 0x69, 0x63, 0x6F, 0x6E, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x66,
+    0x69, 0x6C, 0x6C, 0x3A, 0x20, 0x77, 0x68, 0x69, 0x74, 0x65, 0x3B, 0x20,
+    0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x32, 0x30, 0x70, 0x78, 0x3B,
+    0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x32, 0x30, 0x70,
+    0x78, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x75, 0x73, 0x65, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x23,
+    0x63, 0x68, 0x65, 0x63, 0x6B, 0x5F, 0x63, 0x69, 0x72, 0x63, 0x6C, 0x65,
+    0x22, 0x3E, 0x3C, 0x2F, 0x75, 0x73, 0x65, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73, 0x76, 0x67, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C,
+    0x61, 0x73, 0x73, 0x3D, 0x22, 0x62, 0x74, 0x6E, 0x2D, 0x74, 0x65, 0x78,
+    0x74, 0x22, 0x3E, 0x41, 0x70, 0x70, 0x6C, 0x79, 0x3C, 0x2F, 0x73, 0x70,
+    0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x62, 0x75,
+    0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69,
+    0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x2F, 0x66, 0x6F, 0x72, 0x6D, 0x3E, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64,
+    0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73,
+    0x3D, 0x22, 0x63, 0x61, 0x72, 0x64, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69,
+    0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x61, 0x72,
+    0x64, 0x2D, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x22, 0x3E, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3C, 0x73, 0x76, 0x67, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
+    0x22, 0x69, 0x63, 0x6F, 0x6E, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x70,
+    0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x22, 0x3E, 0x3C, 0x75, 0x73, 0x65,
+    0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x23, 0x61, 0x64, 0x6A, 0x75,
+    0x73, 0x74, 0x22, 0x3E, 0x3C, 0x2F, 0x75, 0x73, 0x65, 0x3E, 0x3C, 0x2F,
+    0x73, 0x76, 0x67, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E,
+    0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x61, 0x72, 0x64,
+    0x2D, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x22, 0x3E, 0x43, 0x6F, 0x6D, 0x6D,
+    0x75, 0x6E, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3C, 0x2F, 0x73,
+    0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x63, 0x6F,
+    0x6D, 0x6D, 0x2D, 0x66, 0x6F, 0x72, 0x6D, 0x22, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22,
+    0x63, 0x61, 0x72, 0x64, 0x2D, 0x62, 0x6F, 0x64, 0x79, 0x22, 0x3E, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61,
+    0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F,
+    0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x64, 0x69, 0x76, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x72, 0x6F, 0x77, 0x20, 0x69,
+    0x74, 0x65, 0x6D, 0x73, 0x2D, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x20,
+    0x67, 0x61, 0x70, 0x2D, 0x73, 0x6D, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x6D,
+    0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D,
+    0x3A, 0x20, 0x38, 0x70, 0x78, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x76, 0x67, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73,
+    0x3D, 0x22, 0x69, 0x63, 0x6F, 0x6E, 0x2D, 0x73, 0x6D, 0x20, 0x74, 0x65,
+    0x78, 0x74, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x22, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74,
+    0x79, 0x6C, 0x65, 0x3D, 0x22, 0x66, 0x69, 0x6C, 0x6C, 0x3A, 0x20, 0x76,
+    0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79,
+    0x29, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3C, 0x75, 0x73, 0x65, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D,
+    0x22, 0x23, 0x74, 0x65, 0x72, 0x6D, 0x69, 0x6E, 0x61, 0x6C, 0x22, 0x3E,
+    0x3C, 0x2F, 0x75, 0x73, 0x65, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73, 0x76, 0x67, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x3E,
+    0x54, 0x43, 0x50, 0x20, 0x50, 0x4F, 0x52, 0x54, 0x3C, 0x2F, 0x73, 0x70,
+    0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F,
+    0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x69, 0x6E, 0x70, 0x75, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x6E, 0x75, 0x6D, 0x62,
+    0x65, 0x72, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x69, 0x64, 0x3D, 0x22, 0x63, 0x6F, 0x6D, 0x6D, 0x2D, 0x74, 0x63, 0x70,
+    0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65,
+    0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x6D, 0x69, 0x6E, 0x3D, 0x22, 0x31, 0x22, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x78, 0x3D, 0x22,
+    0x36, 0x35, 0x35, 0x33, 0x35, 0x22, 0x20, 0x2F, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
+    0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6C, 0x61,
+    0x73, 0x73, 0x3D, 0x22, 0x72, 0x6F, 0x77, 0x20, 0x69, 0x74, 0x65, 0x6D,
+    0x73, 0x2D, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x67, 0x61, 0x70,
+    0x2D, 0x73, 0x6D, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x6D, 0x61, 0x72, 0x67,
+    0x69, 0x6E, 0x2D, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x38,
+    0x70, 0x78, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3C, 0x73, 0x76, 0x67, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x69,
+    0x63, 0x6F, 0x6E, 0x2D, 0x73, 0x6D, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2D,
+    0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x22, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65,
+    0x3D, 0x22, 0x66, 0x69, 0x6C, 0x6C, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28,
+    0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x29, 0x22, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x75, 0x73, 0x65, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x23, 0x74,
+    0x65, 0x72, 0x6D, 0x69, 0x6E, 0x61, 0x6C, 0x22, 0x3E, 0x3C, 0x2F, 0x75,
+    0x73, 0x65, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x2F, 0x73, 0x76, 0x67, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x52, 0x53, 0x32,
+    0x33, 0x32, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74,
+    0x20, 0x69, 0x64, 0x3D, 0x22, 0x63, 0x6F, 0x6D, 0x6D, 0x2D, 0x62, 0x61,
+    0x75, 0x64, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3C, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x3D, 0x22, 0x39, 0x36, 0x30, 0x30, 0x22, 0x3E, 0x39, 0x36,
+    0x30, 0x30, 0x3C, 0x2F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3E, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6F, 0x70, 0x74,
+    0x69, 0x6F, 0x6E, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x22, 0x31,
+    0x39, 0x32, 0x30, 0x30, 0x22, 0x3E, 0x31, 0x39, 0x32, 0x30, 0x30, 0x3C,
+    0x2F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x22, 0x33, 0x38, 0x34, 0x30,
+    0x30, 0x22, 0x3E, 0x33, 0x38, 0x34, 0x30, 0x30, 0x3C, 0x2F, 0x6F, 0x70,
+    0x74, 0x69, 0x6F, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3C, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x3D, 0x22, 0x35, 0x37, 0x36, 0x30, 0x30, 0x22, 0x3E,
+    0x35, 0x37, 0x36, 0x30, 0x30, 0x3C, 0x2F, 0x6F, 0x70, 0x74, 0x69, 0x6F,
+    0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x3D, 0x22, 0x31, 0x31, 0x35, 0x32, 0x30, 0x30, 0x22, 0x3E, 0x31, 0x31,
+    0x35, 0x32, 0x30, 0x30, 0x3C, 0x2F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73, 0x65,
+    0x6C, 0x65, 0x63, 0x74, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F,
+    0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61,
+    0x73, 0x73, 0x3D, 0x22, 0x63, 0x61, 0x72, 0x64, 0x2D, 0x61, 0x63, 0x74,
+    0x69, 0x6F, 0x6E, 0x73, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x73, 0x75, 0x62, 0x6D, 0x69,
+    0x74, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6C, 0x61,
+    0x73, 0x73, 0x3D, 0x22, 0x62, 0x74, 0x6E, 0x20, 0x62, 0x74, 0x6E, 0x2D,
+    0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x20, 0x62, 0x74, 0x6E, 0x2D,
+    0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x73, 0x76, 0x67, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x69,
+    0x63, 0x6F, 0x6E, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x66, 0x69, 0x6C, 0x6C,
+    0x3A, 0x20, 0x77, 0x68, 0x69, 0x74, 0x65, 0x3B, 0x20, 0x77, 0x69, 0x64,
+    0x74, 0x68, 0x3A, 0x20, 0x32, 0x30, 0x70, 0x78, 0x3B, 0x20, 0x68, 0x65,
+    0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x32, 0x30, 0x70, 0x78, 0x22, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x75, 0x73,
+    0x65, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x23, 0x63, 0x68, 0x65,
+    0x63, 0x6B, 0x5F, 0x63, 0x69, 0x72, 0x63, 0x6C, 0x65, 0x22, 0x3E, 0x3C,
+    0x2F, 0x75, 0x73, 0x65, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x2F, 0x73, 0x76, 0x67, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73,
+    0x3D, 0x22, 0x62, 0x74, 0x6E, 0x2D, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3E,
+    0x41, 0x70, 0x70, 0x6C, 0x79, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F,
+    0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x2F, 0x66, 0x6F, 0x72, 0x6D, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63,
+    0x61, 0x72, 0x64, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63,
+    0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x61, 0x72, 0x64, 0x2D, 0x68,
+    0x65, 0x61, 0x64, 0x65, 0x72, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73,
+    0x76, 0x67, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x69, 0x63,
+    0x6F, 0x6E, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x70, 0x72, 0x69, 0x6D,
+    0x61, 0x72, 0x79, 0x22, 0x3E, 0x3C, 0x75, 0x73, 0x65, 0x20, 0x68, 0x72,
+    0x65, 0x66, 0x3D, 0x22, 0x23, 0x61, 0x64, 0x6A, 0x75, 0x73, 0x74, 0x22,
+    0x3E, 0x3C, 0x2F, 0x75, 0x73, 0x65, 0x3E, 0x3C, 0x2F, 0x73, 0x76, 0x67,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C,
+    0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x61, 0x72, 0x64, 0x2D, 0x74, 0x69,
+    0x74, 0x6C, 0x65, 0x22, 0x3E, 0x47, 0x50, 0x49, 0x4F, 0x20, 0x53, 0x65,
+    0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x66, 0x6F,
+    0x72, 0x6D, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x67, 0x70, 0x69, 0x6F, 0x2D,
+    0x66, 0x6F, 0x72, 0x6D, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69,
+    0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x61, 0x72,
+    0x64, 0x2D, 0x62, 0x6F, 0x64, 0x79, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
+    0x22, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6C, 0x61,
+    0x73, 0x73, 0x3D, 0x22, 0x72, 0x6F, 0x77, 0x20, 0x69, 0x74, 0x65, 0x6D,
+    0x73, 0x2D, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x67, 0x61, 0x70,
+    0x2D, 0x73, 0x6D, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x6D, 0x61, 0x72, 0x67,
+    0x69, 0x6E, 0x2D, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x38,
+    0x70, 0x78, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3C, 0x73, 0x76, 0x67, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x69,
+    0x63, 0x6F, 0x6E, 0x2D, 0x73, 0x6D, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2D,
+    0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x22, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65,
+    0x3D, 0x22, 0x66, 0x69, 0x6C, 0x6C, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28,
+    0x2D, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x29, 0x22, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x75, 0x73, 0x65, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x23, 0x74,
+    0x65, 0x72, 0x6D, 0x69, 0x6E, 0x61, 0x6C, 0x22, 0x3E, 0x3C, 0x2F, 0x75,
+    0x73, 0x65, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x2F, 0x73, 0x76, 0x67, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x44, 0x45, 0x56,
+    0x49, 0x43, 0x45, 0x20, 0x49, 0x44, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69,
+    0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x69, 0x6E,
+    0x70, 0x75, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+    0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x64,
+    0x3D, 0x22, 0x67, 0x70, 0x69, 0x6F, 0x2D, 0x69, 0x64, 0x22, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69,
+    0x72, 0x65, 0x64, 0x20, 0x2F, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64,
+    0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F,
+    0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
+    0x22, 0x72, 0x6F, 0x77, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x2D, 0x63,
+    0x65, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x67, 0x61, 0x70, 0x2D, 0x73, 0x6D,
+    0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74,
+    0x79, 0x6C, 0x65, 0x3D, 0x22, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D,
+    0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x38, 0x70, 0x78, 0x22,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73,
+    0x76, 0x67, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x69, 0x63, 0x6F, 0x6E,
+    0x2D, 0x73, 0x6D, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x70, 0x72, 0x69,
+    0x6D, 0x61, 0x72, 0x79, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x66,
+    0x69, 0x6C, 0x6C, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70,
+    0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x29, 0x22, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x75, 0x73, 0x65,
+    0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x23, 0x74, 0x65, 0x72, 0x6D,
+    0x69, 0x6E, 0x61, 0x6C, 0x22, 0x3E, 0x3C, 0x2F, 0x75, 0x73, 0x65, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73,
+    0x76, 0x67, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x4D, 0x4F, 0x44, 0x45, 0x3C, 0x2F,
+    0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3C, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x69, 0x64, 0x3D,
+    0x22, 0x67, 0x70, 0x69, 0x6F, 0x2D, 0x6D, 0x6F, 0x64, 0x65, 0x22, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6F, 0x70,
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x22,
+    0x74, 0x65, 0x78, 0x74, 0x22, 0x3E, 0x54, 0x45, 0x58, 0x54, 0x3C, 0x2F,
+    0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x22, 0x6A, 0x73, 0x6F, 0x6E, 0x22,
+    0x3E, 0x4A, 0x53, 0x4F, 0x4E, 0x3C, 0x2F, 0x6F, 0x70, 0x74, 0x69, 0x6F,
+    0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73,
+    0x65, 0x6C, 0x65, 0x63, 0x74, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64,
+    0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x66, 0x6F,
+    0x72, 0x6D, 0x2D, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x3E, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
+    0x22, 0x72, 0x6F, 0x77, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x2D, 0x63,
+    0x65, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x67, 0x61, 0x70, 0x2D, 0x73, 0x6D,
+    0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74,
+    0x79, 0x6C, 0x65, 0x3D, 0x22, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D,
+    0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x38, 0x70, 0x78, 0x22,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73,
+    0x76, 0x67, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x69, 0x63, 0x6F, 0x6E,
+    0x2D, 0x73, 0x6D, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x70, 0x72, 0x69,
+    0x6D, 0x61, 0x72, 0x79, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x66,
+    0x69, 0x6C, 0x6C, 0x3A, 0x20, 0x76, 0x61, 0x72, 0x28, 0x2D, 0x2D, 0x70,
+    0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x29, 0x22, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x75, 0x73, 0x65,
+    0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x23, 0x74, 0x65, 0x72, 0x6D,
+    0x69, 0x6E, 0x61, 0x6C, 0x22, 0x3E, 0x3C, 0x2F, 0x75, 0x73, 0x65, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73,
+    0x76, 0x67, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x41, 0x55, 0x54, 0x4F, 0x20, 0x52,
+    0x45, 0x53, 0x50, 0x4F, 0x4E, 0x53, 0x45, 0x3C, 0x2F, 0x73, 0x70, 0x61,
+    0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64,
+    0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73,
+    0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x67, 0x70,
+    0x69, 0x6F, 0x2D, 0x61, 0x75, 0x74, 0x6F, 0x22, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6F, 0x70, 0x74, 0x69, 0x6F,
+    0x6E, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x22, 0x74, 0x72, 0x75,
+    0x65, 0x22, 0x3E, 0x45, 0x4E, 0x41, 0x42, 0x4C, 0x45, 0x44, 0x3C, 0x2F,
+    0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x22, 0x66, 0x61, 0x6C, 0x73, 0x65,
+    0x22, 0x3E, 0x44, 0x49, 0x53, 0x41, 0x42, 0x4C, 0x45, 0x44, 0x3C, 0x2F,
+    0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3C, 0x2F, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x3E, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64,
+    0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x61,
+    0x72, 0x64, 0x2D, 0x61, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x22, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D,
+    0x22, 0x73, 0x75, 0x62, 0x6D, 0x69, 0x74, 0x22, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x62, 0x74,
+    0x6E, 0x20, 0x62, 0x74, 0x6E, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72,
+    0x79, 0x20, 0x62, 0x74, 0x6E, 0x2D, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64,
+    0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x76,
+    0x67, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6C,
+    0x61, 0x73, 0x73, 0x3D, 0x22, 0x69, 0x63, 0x6F, 0x6E, 0x22, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65,
+    0x3D, 0x22, 0x66, 0x69, 0x6C, 0x6C, 0x3A, 0x20, 0x77, 0x68, 0x69, 0x74,
+    0x65, 0x3B, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x32, 0x30,
+    0x70, 0x78, 0x3B, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20,
+    0x32, 0x30, 0x70, 0x78, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x75, 0x73, 0x65, 0x20, 0x68, 0x72, 0x65, 0x66,
+    0x3D, 0x22, 0x23, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x5F, 0x63, 0x69, 0x72,
+    0x63, 0x6C, 0x65, 0x22, 0x3E, 0x3C, 0x2F, 0x75, 0x73, 0x65, 0x3E, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73, 0x76, 0x67, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E,
+    0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x62, 0x74, 0x6E, 0x2D,
+    0x74, 0x65, 0x78, 0x74, 0x22, 0x3E, 0x41, 0x70, 0x70, 0x6C, 0x79, 0x3C,
+    0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x66, 0x6F, 0x72, 0x6D,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C,
+    0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x61, 0x72, 0x64, 0x22, 0x3E, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22,
+    0x63, 0x61, 0x72, 0x64, 0x2D, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x22,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x76, 0x67, 0x20, 0x63, 0x6C, 0x61,
+    0x73, 0x73, 0x3D, 0x22, 0x69, 0x63, 0x6F, 0x6E, 0x20, 0x74, 0x65, 0x78,
+    0x74, 0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x22, 0x3E, 0x3C,
+    0x75, 0x73, 0x65, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x23, 0x73,
+    0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x22, 0x3E, 0x3C, 0x2F, 0x75,
+    0x73, 0x65, 0x3E, 0x3C, 0x2F, 0x73, 0x76, 0x67, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D,
+    0x22, 0x63, 0x61, 0x72, 0x64, 0x2D, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x22,
+    0x3E, 0x53, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x20, 0x41, 0x63, 0x74, 0x69,
+    0x6F, 0x6E, 0x73, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63,
+    0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x63, 0x61, 0x72, 0x64, 0x2D, 0x62,
+    0x6F, 0x64, 0x79, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76,
+    0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x72, 0x6F, 0x77, 0x20,
+    0x69, 0x74, 0x65, 0x6D, 0x73, 0x2D, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72,
+    0x20, 0x6A, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x2D, 0x62, 0x65, 0x74,
+    0x77, 0x65, 0x65, 0x6E, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x72,
+    0x6F, 0x77, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x2D, 0x63, 0x65, 0x6E,
+    0x74, 0x65, 0x72, 0x20, 0x67, 0x61, 0x70, 0x2D, 0x73, 0x6D, 0x22, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x76, 0x67, 0x20,
+    0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x69, 0x63, 0x6F, 0x6E, 0x2D,
+    0x73, 0x6D, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x70, 0x72, 0x69, 0x6D,
+    0x61, 0x72, 0x79, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3C, 0x75, 0x73, 0x65, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D,
+    0x22, 0x23, 0x70, 0x6F, 0x77, 0x65, 0x72, 0x22, 0x3E, 0x3C, 0x2F, 0x75,
+    0x73, 0x65, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F,
+    0x73, 0x76, 0x67, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x73, 0x70, 0x61, 0x6E, 0x3E, 0x52, 0x45, 0x42, 0x4F, 0x4F, 0x54, 0x3C,
+    0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x62,
+    0x75, 0x74, 0x74, 0x6F, 0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x69, 0x64, 0x3D, 0x22, 0x62, 0x74, 0x6E, 0x2D, 0x72, 0x65, 0x62, 0x6F,
+    0x6F, 0x74, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6C,
+    0x61, 0x73, 0x73, 0x3D, 0x22, 0x62, 0x74, 0x6E, 0x20, 0x62, 0x74, 0x6E,
+    0x2D, 0x70, 0x72, 0x69, 0x6D, 0x61, 0x72, 0x79, 0x20, 0x62, 0x74, 0x6E,
+    0x2D, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x22, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x76, 0x67, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22,
+    0x69, 0x63, 0x6F, 0x6E, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x66, 0x69, 0x6C,
+    0x6C, 0x3A, 0x20, 0x77, 0x68, 0x69, 0x74, 0x65, 0x3B, 0x20, 0x77, 0x69,
+    0x64, 0x74, 0x68, 0x3A, 0x20, 0x32, 0x30, 0x70, 0x78, 0x3B, 0x20, 0x68,
+    0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x32, 0x30, 0x70, 0x78, 0x22,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x75,
+    0x73, 0x65, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x23, 0x70, 0x6F,
+    0x77, 0x65, 0x72, 0x22, 0x3E, 0x3C, 0x2F, 0x75, 0x73, 0x65, 0x3E, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73, 0x76, 0x67, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x70, 0x61, 0x6E,
+    0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x62, 0x74, 0x6E, 0x2D,
+    0x74, 0x65, 0x78, 0x74, 0x22, 0x3E, 0x52, 0x65, 0x62, 0x6F, 0x6F, 0x74,
+    0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x6D, 0x61, 0x69, 0x6E, 0x3E, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x73, 0x76, 0x67, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x78, 0x6D, 0x6C, 0x6E, 0x73, 0x3D, 0x22, 0x68, 0x74, 0x74,
+    0x70, 0x3A, 0x2F, 0x2F, 0x77, 0x77, 0x77, 0x2E, 0x77, 0x33, 0x2E, 0x6F,
+    0x72, 0x67, 0x2F, 0x32, 0x30, 0x30, 0x30, 0x2F, 0x73, 0x76, 0x67, 0x22,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65,
+    0x3D, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x6E,
+    0x6F, 0x6E, 0x65, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x6C, 0x6F, 0x67, 0x6F,
+    0x32, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76,
+    0x69, 0x65, 0x77, 0x42, 0x6F, 0x78, 0x3D, 0x22, 0x30, 0x20, 0x30, 0x20,
+    0x32, 0x35, 0x20, 0x32, 0x35, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x70, 0x61, 0x74, 0x68, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x3D, 0x22, 0x4D,
+    0x37, 0x2E, 0x39, 0x32, 0x34, 0x33, 0x34, 0x32, 0x32, 0x37, 0x2C, 0x39,
+    0x2E, 0x35, 0x30, 0x37, 0x36, 0x30, 0x31, 0x36, 0x37, 0x20, 0x4C, 0x31,
+    0x33, 0x2E, 0x31, 0x36, 0x36, 0x31, 0x36, 0x36, 0x2C, 0x31, 0x37, 0x2E,
+    0x31, 0x37, 0x31, 0x33, 0x39, 0x33, 0x34, 0x20, 0x4C, 0x33, 0x2E, 0x31,
+    0x31, 0x33, 0x39, 0x31, 0x31, 0x30, 0x36, 0x2C, 0x31, 0x37, 0x2E, 0x34,
+    0x33, 0x35, 0x35, 0x37, 0x38, 0x31, 0x20, 0x4C, 0x37, 0x2E, 0x39, 0x32,
+    0x34, 0x33, 0x34, 0x32, 0x32, 0x37, 0x2C, 0x39, 0x2E, 0x35, 0x30, 0x37,
+    0x36, 0x30, 0x31, 0x36, 0x37, 0x20, 0x5A, 0x22, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x6F, 0x6B,
+    0x65, 0x3D, 0x22, 0x23, 0x30, 0x30, 0x42, 0x38, 0x34, 0x39, 0x22, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69,
+    0x6C, 0x6C, 0x3D, 0x22, 0x23, 0x30, 0x30, 0x42, 0x38, 0x34, 0x39, 0x22,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74,
+    0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x3D, 0x22, 0x74, 0x72,
+    0x61, 0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x28, 0x38, 0x2E, 0x30, 0x36,
+    0x38, 0x36, 0x38, 0x33, 0x2C, 0x20, 0x31, 0x33, 0x2E, 0x32, 0x35, 0x30,
+    0x35, 0x39, 0x31, 0x29, 0x20, 0x72, 0x6F, 0x74, 0x61, 0x74, 0x65, 0x28,
+    0x39, 0x30, 0x2E, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x29, 0x20, 0x74,
+    0x72, 0x61, 0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x28, 0x2D, 0x38, 0x2E,
+    0x30, 0x36, 0x38, 0x36, 0x38, 0x33, 0x2C, 0x20, 0x2D, 0x31, 0x33, 0x2E,
+    0x32, 0x35, 0x30, 0x35, 0x39, 0x31, 0x29, 0x22, 0x3E, 0x3C, 0x2F, 0x70,
+    0x61, 0x74, 0x68, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3C, 0x70, 0x61, 0x74, 0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x3D, 0x22, 0x4D, 0x31, 0x30, 0x2E,
+    0x30, 0x34, 0x38, 0x36, 0x38, 0x34, 0x39, 0x2C, 0x38, 0x2E, 0x34, 0x34,
+    0x38, 0x36, 0x31, 0x32, 0x37, 0x39, 0x20, 0x4C, 0x32, 0x30, 0x2E, 0x33,
+    0x37, 0x30, 0x39, 0x34, 0x37, 0x31, 0x2C, 0x31, 0x38, 0x2E, 0x34, 0x32,
+    0x39, 0x31, 0x37, 0x36, 0x36, 0x20, 0x4C, 0x31, 0x30, 0x2E, 0x32, 0x32,
+    0x31, 0x31, 0x35, 0x34, 0x33, 0x2C, 0x31, 0x38, 0x2E, 0x37, 0x32, 0x33,
+    0x31, 0x34, 0x37, 0x31, 0x20, 0x4C, 0x31, 0x30, 0x2E, 0x30, 0x34, 0x38,
+    0x36, 0x38, 0x34, 0x39, 0x2C, 0x38, 0x2E, 0x34, 0x34, 0x38, 0x36, 0x31,
+    0x32, 0x37, 0x39, 0x20, 0x5A, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x6F, 0x6B, 0x65, 0x3D,
+    0x22, 0x23, 0x30, 0x30, 0x33, 0x32, 0x36, 0x34, 0x22, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x6C, 0x6C,
+    0x3D, 0x22, 0x23, 0x30, 0x30, 0x33, 0x32, 0x36, 0x34, 0x22, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x61,
+    0x6E, 0x73, 0x66, 0x6F, 0x72, 0x6D, 0x3D, 0x22, 0x74, 0x72, 0x61, 0x6E,
+    0x73, 0x6C, 0x61, 0x74, 0x65, 0x28, 0x31, 0x35, 0x2E, 0x35, 0x33, 0x38,
+    0x30, 0x30, 0x30, 0x2C, 0x20, 0x31, 0x33, 0x2E, 0x31, 0x38, 0x38, 0x31,
+    0x34, 0x32, 0x29, 0x20, 0x72, 0x6F, 0x74, 0x61, 0x74, 0x65, 0x28, 0x32,
+    0x37, 0x30, 0x2E, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x29, 0x20, 0x74,
+    0x72, 0x61, 0x6E, 0x73, 0x6C, 0x61, 0x74, 0x65, 0x28, 0x2D, 0x31, 0x35,
+    0x2E, 0x35, 0x33, 0x38, 0x30, 0x30, 0x30, 0x2C, 0x20, 0x2D, 0x31, 0x33,
+    0x2E, 0x31, 0x38, 0x38, 0x31, 0x34, 0x32, 0x29, 0x22, 0x3E, 0x3C, 0x2F,
+    0x70, 0x61, 0x74, 0x68, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3C, 0x70, 0x61, 0x74, 0x68, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x3D, 0x22, 0x4D, 0x32, 0x34,
+    0x2E, 0x34, 0x35, 0x37, 0x35, 0x33, 0x33, 0x39, 0x2C, 0x30, 0x2E, 0x37,
+    0x30, 0x39, 0x32, 0x38, 0x39, 0x32, 0x33, 0x20, 0x4C, 0x32, 0x34, 0x2E,
+    0x37, 0x34, 0x36, 0x34, 0x35, 0x36, 0x39, 0x2C, 0x31, 0x38, 0x2E, 0x35,
+    0x31, 0x34, 0x32, 0x34, 0x36, 0x35, 0x20, 0x4C, 0x32, 0x33, 0x2E, 0x39,
+    0x33, 0x38, 0x37, 0x32, 0x34, 0x35, 0x2C, 0x31, 0x38, 0x2E, 0x36, 0x32,
+    0x39, 0x36, 0x33, 0x36, 0x38, 0x20, 0x4C, 0x32, 0x33, 0x2E, 0x37, 0x34,
+    0x39, 0x34, 0x35, 0x38, 0x39, 0x2C, 0x32, 0x2E, 0x34, 0x36, 0x39, 0x32,
+    0x38, 0x35, 0x39, 0x38, 0x20, 0x4C, 0x32, 0x33, 0x2E, 0x37, 0x34, 0x39,
+    0x34, 0x35, 0x38, 0x39, 0x2C, 0x32, 0x2E, 0x34, 0x36, 0x39, 0x32, 0x38,
+    0x35, 0x39, 0x38, 0x20, 0x4C, 0x32, 0x33, 0x2E, 0x36, 0x37, 0x33, 0x30,
+    0x39, 0x31, 0x33, 0x2C, 0x32, 0x2E, 0x35, 0x32, 0x36, 0x33, 0x31, 0x30,
+    0x32, 0x37, 0x20, 0x43, 0x32, 0x33, 0x2E, 0x31, 0x35, 0x31, 0x39, 0x35,
+    0x33, 0x39, 0x2C, 0x32, 0x2E, 0x39, 0x31, 0x35, 0x34, 0x35, 0x31, 0x32,
+    0x37, 0x20, 0x32, 0x30, 0x2E, 0x37, 0x30, 0x39, 0x33, 0x31, 0x30, 0x37,
+    0x2C, 0x34, 0x2E, 0x37, 0x33, 0x39, 0x34, 0x36, 0x33, 0x36, 0x37, 0x20,
+    0x31, 0x38, 0x2E, 0x32, 0x32, 0x31, 0x34, 0x36, 0x38, 0x35, 0x2C, 0x36,
+    0x2E, 0x35, 0x39, 0x37, 0x38, 0x35, 0x35, 0x30, 0x31, 0x20, 0x4C, 0x31,
+    0x37, 0x2E, 0x37, 0x33, 0x39, 0x38, 0x39, 0x30, 0x31, 0x2C, 0x36, 0x2E,
+    0x39, 0x35, 0x37, 0x35, 0x39, 0x36, 0x38, 0x36, 0x20, 0x43, 0x31, 0x36,
+    0x2E, 0x38, 0x35, 0x37, 0x38, 0x30, 0x39, 0x32, 0x2C, 0x37, 0x2E, 0x36,
+    0x31, 0x36, 0x35, 0x33, 0x31, 0x36, 0x34, 0x20, 0x31, 0x35, 0x2E, 0x39,
+    0x38, 0x35, 0x32, 0x37, 0x38, 0x39, 0x2C, 0x38, 0x2E, 0x32, 0x36, 0x38,
+    0x34, 0x31, 0x38, 0x35, 0x33, 0x20, 0x31, 0x35, 0x2E, 0x32, 0x30, 0x36,
+    0x31, 0x32, 0x38, 0x39, 0x2C, 0x38, 0x2E, 0x38, 0x35, 0x30, 0x36, 0x38,
+    0x36, 0x34, 0x33, 0x20, 0x43, 0x31, 0x34, 0x2E, 0x36, 0x32, 0x36, 0x38,
+    0x35, 0x32, 0x2C, 0x39, 0x2E, 0x32, 0x38, 0x33, 0x35, 0x38, 0x36, 0x37,
+    0x36, 0x20, 0x31, 0x34, 0x2E, 0x30, 0x39, 0x39, 0x31, 0x38, 0x38, 0x36,
+    0x2C, 0x39, 0x2E, 0x36, 0x37, 0x38, 0x30, 0x30, 0x37, 0x30, 0x37, 0x20,
+    0x31, 0x33, 0x2E, 0x36, 0x35, 0x39, 0x37, 0x39, 0x38, 0x2C, 0x31, 0x30,
+    0x2E, 0x30, 0x30, 0x36, 0x35, 0x38, 0x33, 0x38, 0x20, 0x4C, 0x31, 0x33,
+    0x2E, 0x32, 0x35, 0x31, 0x31, 0x38, 0x39, 0x34, 0x2C, 0x31, 0x30, 0x2E,
+    0x33, 0x31, 0x32, 0x31, 0x39, 0x39, 0x31, 0x20, 0x4C, 0x31, 0x33, 0x2E,
+    0x32, 0x35, 0x31, 0x31, 0x38, 0x39, 0x34, 0x2C, 0x31, 0x30, 0x2E, 0x33,
+    0x31, 0x32, 0x31, 0x39, 0x39, 0x31, 0x20, 0x4C, 0x31, 0x33, 0x2E, 0x30,
+    0x37, 0x31, 0x34, 0x39, 0x39, 0x31, 0x2C, 0x31, 0x30, 0x2E, 0x34, 0x34,
+    0x36, 0x36, 0x34, 0x35, 0x37, 0x20, 0x4C, 0x32, 0x2E, 0x36, 0x38, 0x32,
+    0x34, 0x38, 0x36, 0x33, 0x35, 0x2C, 0x33, 0x2E, 0x35, 0x33, 0x37, 0x39,
+    0x32, 0x38, 0x35, 0x37, 0x20, 0x4C, 0x31, 0x2E, 0x32, 0x34, 0x34, 0x37,
+    0x36, 0x38, 0x33, 0x31, 0x2C, 0x32, 0x2E, 0x34, 0x36, 0x35, 0x32, 0x30,
+    0x31, 0x33, 0x20, 0x4C, 0x31, 0x2E, 0x32, 0x34, 0x34, 0x37, 0x36, 0x38,
+    0x33, 0x31, 0x2C, 0x31, 0x38, 0x2E, 0x35, 0x31, 0x33, 0x37, 0x34, 0x30,
+    0x33, 0x20, 0x4C, 0x30, 0x2E, 0x34, 0x33, 0x33, 0x39, 0x35, 0x39, 0x38,
+    0x32, 0x38, 0x2C, 0x31, 0x38, 0x2E, 0x36, 0x32, 0x39, 0x35, 0x37, 0x30,
+    0x31, 0x20, 0x4C, 0x30, 0x2E, 0x32, 0x35, 0x34, 0x38, 0x34, 0x39, 0x39,
+    0x37, 0x34, 0x2C, 0x30, 0x2E, 0x38, 0x34, 0x35, 0x31, 0x37, 0x32, 0x39,
+    0x35, 0x38, 0x20, 0x43, 0x38, 0x2E, 0x32, 0x33, 0x34, 0x34, 0x33, 0x32,
+    0x37, 0x37, 0x2C, 0x36, 0x2E, 0x33, 0x36, 0x38, 0x39, 0x34, 0x34, 0x39,
+    0x35, 0x20, 0x31, 0x32, 0x2E, 0x31, 0x36, 0x30, 0x33, 0x35, 0x38, 0x39,
+    0x2C, 0x39, 0x2E, 0x32, 0x38, 0x33, 0x36, 0x39, 0x33, 0x34, 0x34, 0x20,
+    0x31, 0x32, 0x2E, 0x33, 0x30, 0x30, 0x30, 0x36, 0x33, 0x2C, 0x39, 0x2E,
+    0x34, 0x36, 0x36, 0x32, 0x38, 0x39, 0x39, 0x38, 0x20, 0x43, 0x31, 0x32,
+    0x2E, 0x38, 0x33, 0x38, 0x31, 0x39, 0x36, 0x2C, 0x39, 0x2E, 0x32, 0x38,
+    0x35, 0x34, 0x38, 0x38, 0x38, 0x33, 0x20, 0x31, 0x36, 0x2E, 0x37, 0x36,
+    0x32, 0x35, 0x31, 0x37, 0x36, 0x2C, 0x36, 0x2E, 0x33, 0x36, 0x39, 0x35,
+    0x30, 0x39, 0x38, 0x34, 0x20, 0x32, 0x34, 0x2E, 0x34, 0x35, 0x37, 0x35,
+    0x33, 0x33, 0x39, 0x2C, 0x30, 0x2E, 0x37, 0x30, 0x39, 0x32, 0x38, 0x39,
+    0x32, 0x33, 0x20, 0x4C, 0x32, 0x34, 0x2E, 0x34, 0x35, 0x37, 0x35, 0x33,
+    0x33, 0x39, 0x2C, 0x30, 0x2E, 0x37, 0x30, 0x39, 0x32, 0x38, 0x39, 0x32,
+    0x33, 0x20, 0x5A, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x73, 0x74, 0x72, 0x6F, 0x6B, 0x65, 0x3D, 0x22, 0x23,
+    0x30, 0x39, 0x32, 0x33, 0x33, 0x33, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x6C, 0x6C, 0x3D, 0x22,
+    0x23, 0x30, 0x39, 0x32, 0x33, 0x33, 0x33, 0x22, 0x3E, 0x3C, 0x2F, 0x70,
+    0x61, 0x74, 0x68, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x2F, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x68,
+    0x6F, 0x6D, 0x65, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x76, 0x69, 0x65, 0x77, 0x42, 0x6F, 0x78, 0x3D, 0x22, 0x30, 0x20,
+    0x2D, 0x39, 0x36, 0x30, 0x20, 0x39, 0x36, 0x30, 0x20, 0x39, 0x36, 0x30,
+    0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x70, 0x61, 0x74, 0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x64, 0x3D, 0x22, 0x4D, 0x32, 0x34, 0x30, 0x2D, 0x32,
+    0x30, 0x30, 0x68, 0x31, 0x32, 0x30, 0x76, 0x2D, 0x32, 0x34, 0x30, 0x68,
+    0x32, 0x34, 0x30, 0x76, 0x32, 0x34, 0x30, 0x68, 0x31, 0x32, 0x30, 0x76,
+    0x2D, 0x33, 0x36, 0x30, 0x4C, 0x34, 0x38, 0x30, 0x2D, 0x37, 0x34, 0x30,
+    0x20, 0x32, 0x34, 0x30, 0x2D, 0x35, 0x36, 0x30, 0x76, 0x33, 0x36, 0x30,
+    0x5A, 0x6D, 0x2D, 0x38, 0x30, 0x20, 0x38, 0x30, 0x76, 0x2D, 0x34, 0x38,
+    0x30, 0x6C, 0x33, 0x32, 0x30, 0x2D, 0x32, 0x34, 0x30, 0x20, 0x33, 0x32,
+    0x30, 0x20, 0x32, 0x34, 0x30, 0x76, 0x34, 0x38, 0x30, 0x48, 0x35, 0x32,
+    0x30, 0x76, 0x2D, 0x32, 0x34, 0x30, 0x68, 0x2D, 0x38, 0x30, 0x76, 0x32,
+    0x34, 0x30, 0x48, 0x31, 0x36, 0x30, 0x5A, 0x6D, 0x33, 0x32, 0x30, 0x2D,
+    0x33, 0x35, 0x30, 0x5A, 0x22, 0x20, 0x2F, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x79, 0x6D, 0x62,
+    0x6F, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69,
+    0x64, 0x3D, 0x22, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x2D, 0x6E,
+    0x6F, 0x64, 0x65, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x76, 0x69, 0x65, 0x77, 0x42, 0x6F, 0x78, 0x3D, 0x22, 0x30, 0x20,
+    0x2D, 0x39, 0x36, 0x30, 0x20, 0x39, 0x36, 0x30, 0x20, 0x39, 0x36, 0x30,
+    0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x70, 0x61, 0x74, 0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x64, 0x3D, 0x22, 0x4D, 0x32, 0x32, 0x30, 0x2D, 0x38,
+    0x30, 0x71, 0x2D, 0x35, 0x38, 0x20, 0x30, 0x2D, 0x39, 0x39, 0x2D, 0x34,
+    0x31, 0x74, 0x2D, 0x34, 0x31, 0x2D, 0x39, 0x39, 0x71, 0x30, 0x2D, 0x35,
+    0x38, 0x20, 0x34, 0x31, 0x2D, 0x39, 0x39, 0x74, 0x39, 0x39, 0x2D, 0x34,
+    0x31, 0x71, 0x31, 0x38, 0x20, 0x30, 0x20, 0x33, 0x35, 0x20, 0x34, 0x2E,
+    0x35, 0x74, 0x33, 0x32, 0x20, 0x31, 0x32, 0x2E, 0x35, 0x6C, 0x31, 0x35,
+    0x33, 0x2D, 0x31, 0x35, 0x33, 0x76, 0x2D, 0x31, 0x31, 0x30, 0x71, 0x2D,
+    0x34, 0x34, 0x2D, 0x31, 0x33, 0x2D, 0x37, 0x32, 0x2D, 0x34, 0x39, 0x2E,
+    0x35, 0x54, 0x33, 0x34, 0x30, 0x2D, 0x37, 0x34, 0x30, 0x71, 0x30, 0x2D,
+    0x35, 0x38, 0x20, 0x34, 0x31, 0x2D, 0x39, 0x39, 0x74, 0x39, 0x39, 0x2D,
+    0x34, 0x31, 0x71, 0x35, 0x38, 0x20, 0x30, 0x20, 0x39, 0x39, 0x20, 0x34,
+    0x31, 0x74, 0x34, 0x31, 0x20, 0x39, 0x39, 0x71, 0x30, 0x20, 0x34, 0x38,
+    0x2D, 0x32, 0x38, 0x20, 0x38, 0x34, 0x2E, 0x35, 0x54, 0x35, 0x32, 0x30,
+    0x2D, 0x36, 0x30, 0x36, 0x76, 0x31, 0x31, 0x30, 0x6C, 0x31, 0x35, 0x34,
+    0x20, 0x31, 0x35, 0x33, 0x71, 0x31, 0x35, 0x2D, 0x38, 0x20, 0x33, 0x31,
+    0x2E, 0x35, 0x2D, 0x31, 0x32, 0x2E, 0x35, 0x54, 0x37, 0x34, 0x30, 0x2D,
+    0x33, 0x36, 0x30, 0x71, 0x35, 0x38, 0x20, 0x30, 0x20, 0x39, 0x39, 0x20,
+    0x34, 0x31, 0x74, 0x34, 0x31, 0x20, 0x39, 0x39, 0x71, 0x30, 0x20, 0x35,
+    0x38, 0x2D, 0x34, 0x31, 0x20, 0x39, 0x39, 0x74, 0x2D, 0x39, 0x39, 0x20,
+    0x34, 0x31, 0x71, 0x2D, 0x35, 0x38, 0x20, 0x30, 0x2D, 0x39, 0x39, 0x2D,
+    0x34, 0x31, 0x74, 0x2D, 0x34, 0x31, 0x2D, 0x39, 0x39, 0x71, 0x30, 0x2D,
+    0x31, 0x38, 0x20, 0x34, 0x2E, 0x35, 0x2D, 0x33, 0x35, 0x74, 0x31, 0x32,
+    0x2E, 0x35, 0x2D, 0x33, 0x32, 0x4C, 0x34, 0x38, 0x30, 0x2D, 0x34, 0x32,
+    0x34, 0x20, 0x33, 0x34, 0x33, 0x2D, 0x32, 0x38, 0x37, 0x71, 0x38, 0x20,
+    0x31, 0x35, 0x20, 0x31, 0x32, 0x2E, 0x35, 0x20, 0x33, 0x32, 0x74, 0x34,
+    0x2E, 0x35, 0x20, 0x33, 0x35, 0x71, 0x30, 0x20, 0x35, 0x38, 0x2D, 0x34,
+    0x31, 0x20, 0x39, 0x39, 0x74, 0x2D, 0x39, 0x39, 0x20, 0x34, 0x31, 0x5A,
+    0x6D, 0x35, 0x32, 0x30, 0x2D, 0x38, 0x30, 0x71, 0x32, 0x35, 0x20, 0x30,
+    0x20, 0x34, 0x32, 0x2E, 0x35, 0x2D, 0x31, 0x37, 0x2E, 0x35, 0x54, 0x38,
+    0x30, 0x30, 0x2D, 0x32, 0x32, 0x30, 0x71, 0x30, 0x2D, 0x32, 0x35, 0x2D,
+    0x31, 0x37, 0x2E, 0x35, 0x2D, 0x34, 0x32, 0x2E, 0x35, 0x54, 0x37, 0x34,
+    0x30, 0x2D, 0x32, 0x38, 0x30, 0x71, 0x2D, 0x32, 0x35, 0x20, 0x30, 0x2D,
+    0x34, 0x32, 0x2E, 0x35, 0x20, 0x31, 0x37, 0x2E, 0x35, 0x54, 0x36, 0x38,
+    0x30, 0x2D, 0x32, 0x32, 0x30, 0x71, 0x30, 0x20, 0x32, 0x35, 0x20, 0x31,
+    0x37, 0x2E, 0x35, 0x20, 0x34, 0x32, 0x2E, 0x35, 0x54, 0x37, 0x34, 0x30,
+    0x2D, 0x31, 0x36, 0x30, 0x5A, 0x4D, 0x34, 0x38, 0x30, 0x2D, 0x36, 0x38,
+    0x30, 0x71, 0x32, 0x35, 0x20, 0x30, 0x20, 0x34, 0x32, 0x2E, 0x35, 0x2D,
+    0x31, 0x37, 0x2E, 0x35, 0x54, 0x35, 0x34, 0x30, 0x2D, 0x37, 0x34, 0x30,
+    0x71, 0x30, 0x2D, 0x32, 0x35, 0x2D, 0x31, 0x37, 0x2E, 0x35, 0x2D, 0x34,
+    0x32, 0x2E, 0x35, 0x54, 0x34, 0x38, 0x30, 0x2D, 0x38, 0x30, 0x30, 0x71,
+    0x2D, 0x32, 0x35, 0x20, 0x30, 0x2D, 0x34, 0x32, 0x2E, 0x35, 0x20, 0x31,
+    0x37, 0x2E, 0x35, 0x54, 0x34, 0x32, 0x30, 0x2D, 0x37, 0x34, 0x30, 0x71,
+    0x30, 0x20, 0x32, 0x35, 0x20, 0x31, 0x37, 0x2E, 0x35, 0x20, 0x34, 0x32,
+    0x2E, 0x35, 0x54, 0x34, 0x38, 0x30, 0x2D, 0x36, 0x38, 0x30, 0x5A, 0x4D,
+    0x32, 0x32, 0x30, 0x2D, 0x31, 0x36, 0x30, 0x71, 0x32, 0x35, 0x20, 0x30,
+    0x20, 0x34, 0x32, 0x2E, 0x35, 0x2D, 0x31, 0x37, 0x2E, 0x35, 0x54, 0x32,
+    0x38, 0x30, 0x2D, 0x32, 0x32, 0x30, 0x71, 0x30, 0x2D, 0x32, 0x35, 0x2D,
+    0x31, 0x37, 0x2E, 0x35, 0x2D, 0x34, 0x32, 0x2E, 0x35, 0x54, 0x32, 0x32,
+    0x30, 0x2D, 0x32, 0x38, 0x30, 0x71, 0x2D, 0x32, 0x35, 0x20, 0x30, 0x2D,
+    0x34, 0x32, 0x2E, 0x35, 0x20, 0x31, 0x37, 0x2E, 0x35, 0x54, 0x31, 0x36,
+    0x30, 0x2D, 0x32, 0x32, 0x30, 0x71, 0x30, 0x20, 0x32, 0x35, 0x20, 0x31,
+    0x37, 0x2E, 0x35, 0x20, 0x34, 0x32, 0x2E, 0x35, 0x54, 0x32, 0x32, 0x30,
+    0x2D, 0x31, 0x36, 0x30, 0x5A, 0x22, 0x20, 0x2F, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x79, 0x6D,
+    0x62, 0x6F, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x69, 0x64, 0x3D, 0x22, 0x61, 0x64, 0x6A, 0x75, 0x73, 0x74, 0x22, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x69, 0x65, 0x77,
+    0x42, 0x6F, 0x78, 0x3D, 0x22, 0x30, 0x20, 0x2D, 0x39, 0x36, 0x30, 0x20,
+    0x39, 0x36, 0x30, 0x20, 0x39, 0x36, 0x30, 0x22, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x70, 0x61, 0x74, 0x68, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x3D,
+    0x22, 0x4D, 0x34, 0x38, 0x30, 0x2D, 0x33, 0x36, 0x30, 0x71, 0x35, 0x30,
+    0x20, 0x30, 0x20, 0x38, 0x35, 0x2D, 0x33, 0x35, 0x74, 0x33, 0x35, 0x2D,
+    0x38, 0x35, 0x71, 0x30, 0x2D, 0x35, 0x30, 0x2D, 0x33, 0x35, 0x2D, 0x38,
+    0x35, 0x74, 0x2D, 0x38, 0x35, 0x2D, 0x33, 0x35, 0x71, 0x2D, 0x35, 0x30,
+    0x20, 0x30, 0x2D, 0x38, 0x35, 0x20, 0x33, 0x35, 0x74, 0x2D, 0x33, 0x35,
+    0x20, 0x38, 0x35, 0x71, 0x30, 0x20, 0x35, 0x30, 0x20, 0x33, 0x35, 0x20,
+    0x38, 0x35, 0x74, 0x38, 0x35, 0x20, 0x33, 0x35, 0x5A, 0x6D, 0x30, 0x20,
+    0x32, 0x38, 0x30, 0x71, 0x2D, 0x38, 0x33, 0x20, 0x30, 0x2D, 0x31, 0x35,
+    0x36, 0x2D, 0x33, 0x31, 0x2E, 0x35, 0x54, 0x31, 0x39, 0x37, 0x2D, 0x31,
+    0x39, 0x37, 0x71, 0x2D, 0x35, 0x34, 0x2D, 0x35, 0x34, 0x2D, 0x38, 0x35,
+    0x2E, 0x35, 0x2D, 0x31, 0x32, 0x37, 0x54, 0x38, 0x30, 0x2D, 0x34, 0x38,
+    0x30, 0x71, 0x30, 0x2D, 0x38, 0x33, 0x20, 0x33, 0x31, 0x2E, 0x35, 0x2D,
+    0x31, 0x35, 0x36, 0x54, 0x31, 0x39, 0x37, 0x2D, 0x37, 0x36, 0x33, 0x71,
+    0x35, 0x34, 0x2D, 0x35, 0x34, 0x20, 0x31, 0x32, 0x37, 0x2D, 0x38, 0x35,
+    0x2E, 0x35, 0x54, 0x34, 0x38, 0x30, 0x2D, 0x38, 0x38, 0x30, 0x71, 0x38,
+    0x33, 0x20, 0x30, 0x20, 0x31, 0x35, 0x36, 0x20, 0x33, 0x31, 0x2E, 0x35,
+    0x54, 0x37, 0x36, 0x33, 0x2D, 0x37, 0x36, 0x33, 0x71, 0x35, 0x34, 0x20,
+    0x35, 0x34, 0x20, 0x38, 0x35, 0x2E, 0x35, 0x20, 0x31, 0x32, 0x37, 0x54,
+    0x38, 0x38, 0x30, 0x2D, 0x34, 0x38, 0x30, 0x71, 0x30, 0x20, 0x38, 0x33,
+    0x2D, 0x33, 0x31, 0x2E, 0x35, 0x20, 0x31, 0x35, 0x36, 0x54, 0x37, 0x36,
+    0x33, 0x2D, 0x31, 0x39, 0x37, 0x71, 0x2D, 0x35, 0x34, 0x20, 0x35, 0x34,
+    0x2D, 0x31, 0x32, 0x37, 0x20, 0x38, 0x35, 0x2E, 0x35, 0x54, 0x34, 0x38,
+    0x30, 0x2D, 0x38, 0x30, 0x5A, 0x6D, 0x30, 0x2D, 0x38, 0x30, 0x71, 0x31,
+    0x33, 0x34, 0x20, 0x30, 0x20, 0x32, 0x32, 0x37, 0x2D, 0x39, 0x33, 0x74,
+    0x39, 0x33, 0x2D, 0x32, 0x32, 0x37, 0x71, 0x30, 0x2D, 0x31, 0x33, 0x34,
+    0x2D, 0x39, 0x33, 0x2D, 0x32, 0x32, 0x37, 0x74, 0x2D, 0x32, 0x32, 0x37,
+    0x2D, 0x39, 0x33, 0x71, 0x2D, 0x31, 0x33, 0x34, 0x20, 0x30, 0x2D, 0x32,
+    0x32, 0x37, 0x20, 0x39, 0x33, 0x74, 0x2D, 0x39, 0x33, 0x20, 0x32, 0x32,
+    0x37, 0x71, 0x30, 0x20, 0x31, 0x33, 0x34, 0x20, 0x39, 0x33, 0x20, 0x32,
+    0x32, 0x37, 0x74, 0x32, 0x32, 0x37, 0x20, 0x39, 0x33, 0x5A, 0x6D, 0x30,
+    0x2D, 0x33, 0x32, 0x30, 0x5A, 0x22, 0x20, 0x2F, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x79, 0x6D,
+    0x62, 0x6F, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x69, 0x64, 0x3D, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x5F, 0x63, 0x69,
+    0x72, 0x63, 0x6C, 0x65, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x76, 0x69, 0x65, 0x77, 0x42, 0x6F, 0x78, 0x3D, 0x22, 0x30,
+    0x20, 0x2D, 0x39, 0x36, 0x30, 0x20, 0x39, 0x36, 0x30, 0x20, 0x39, 0x36,
+    0x30, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x70, 0x61, 0x74, 0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x64, 0x3D, 0x22, 0x6D, 0x34, 0x32, 0x34, 0x2D,
+    0x32, 0x39, 0x36, 0x20, 0x32, 0x38, 0x32, 0x2D, 0x32, 0x38, 0x32, 0x2D,
+    0x35, 0x36, 0x2D, 0x35, 0x36, 0x2D, 0x32, 0x32, 0x36, 0x20, 0x32, 0x32,
+    0x36, 0x2D, 0x31, 0x31, 0x34, 0x2D, 0x31, 0x31, 0x34, 0x2D, 0x35, 0x36,
+    0x20, 0x35, 0x36, 0x20, 0x31, 0x37, 0x30, 0x20, 0x31, 0x37, 0x30, 0x5A,
+    0x6D, 0x35, 0x36, 0x20, 0x32, 0x31, 0x36, 0x71, 0x2D, 0x38, 0x33, 0x20,
+    0x30, 0x2D, 0x31, 0x35, 0x36, 0x2D, 0x33, 0x31, 0x2E, 0x35, 0x54, 0x31,
+    0x39, 0x37, 0x2D, 0x31, 0x39, 0x37, 0x71, 0x2D, 0x35, 0x34, 0x2D, 0x35,
+    0x34, 0x2D, 0x38, 0x35, 0x2E, 0x35, 0x2D, 0x31, 0x32, 0x37, 0x54, 0x38,
+    0x30, 0x2D, 0x34, 0x38, 0x30, 0x71, 0x30, 0x2D, 0x38, 0x33, 0x20, 0x33,
+    0x31, 0x2E, 0x35, 0x2D, 0x31, 0x35, 0x36, 0x54, 0x31, 0x39, 0x37, 0x2D,
+    0x37, 0x36, 0x33, 0x71, 0x35, 0x34, 0x2D, 0x35, 0x34, 0x20, 0x31, 0x32,
+    0x37, 0x2D, 0x38, 0x35, 0x2E, 0x35, 0x54, 0x34, 0x38, 0x30, 0x2D, 0x38,
+    0x38, 0x30, 0x71, 0x38, 0x33, 0x20, 0x30, 0x20, 0x31, 0x35, 0x36, 0x20,
+    0x33, 0x31, 0x2E, 0x35, 0x54, 0x37, 0x36, 0x33, 0x2D, 0x37, 0x36, 0x33,
+    0x71, 0x35, 0x34, 0x20, 0x35, 0x34, 0x20, 0x38, 0x35, 0x2E, 0x35, 0x20,
+    0x31, 0x32, 0x37, 0x54, 0x38, 0x38, 0x30, 0x2D, 0x34, 0x38, 0x30, 0x71,
+    0x30, 0x20, 0x38, 0x33, 0x2D, 0x33, 0x31, 0x2E, 0x35, 0x20, 0x31, 0x35,
+    0x36, 0x54, 0x37, 0x36, 0x33, 0x2D, 0x31, 0x39, 0x37, 0x71, 0x2D, 0x35,
+    0x34, 0x20, 0x35, 0x34, 0x2D, 0x31, 0x32, 0x37, 0x20, 0x38, 0x35, 0x2E,
+    0x35, 0x54, 0x34, 0x38, 0x30, 0x2D, 0x38, 0x30, 0x5A, 0x6D, 0x30, 0x2D,
+    0x38, 0x30, 0x71, 0x31, 0x33, 0x34, 0x20, 0x30, 0x20, 0x32, 0x32, 0x37,
+    0x2D, 0x39, 0x33, 0x74, 0x39, 0x33, 0x2D, 0x32, 0x32, 0x37, 0x71, 0x30,
+    0x2D, 0x31, 0x33, 0x34, 0x2D, 0x39, 0x33, 0x2D, 0x32, 0x32, 0x37, 0x74,
+    0x2D, 0x32, 0x32, 0x37, 0x2D, 0x39, 0x33, 0x71, 0x2D, 0x31, 0x33, 0x34,
+    0x20, 0x30, 0x2D, 0x32, 0x32, 0x37, 0x20, 0x39, 0x33, 0x74, 0x2D, 0x39,
+    0x33, 0x20, 0x32, 0x32, 0x37, 0x71, 0x30, 0x20, 0x31, 0x33, 0x34, 0x20,
+    0x39, 0x33, 0x20, 0x32, 0x32, 0x37, 0x74, 0x32, 0x32, 0x37, 0x20, 0x39,
+    0x33, 0x5A, 0x6D, 0x30, 0x2D, 0x33, 0x32, 0x30, 0x5A, 0x22, 0x20, 0x2F,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73, 0x79,
+    0x6D, 0x62, 0x6F, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x3C, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x63, 0x61, 0x6E, 0x63,
+    0x65, 0x6C, 0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x76, 0x69, 0x65, 0x77, 0x42, 0x6F, 0x78, 0x3D, 0x22, 0x30, 0x20, 0x2D,
+    0x39, 0x36, 0x30, 0x20, 0x39, 0x36, 0x30, 0x20, 0x39, 0x36, 0x30, 0x22,
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x70,
+    0x61, 0x74, 0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x64, 0x3D, 0x22, 0x6D, 0x33, 0x33, 0x36, 0x2D, 0x32, 0x38,
+    0x30, 0x20, 0x31, 0x34, 0x34, 0x2D, 0x31, 0x34, 0x34, 0x20, 0x31, 0x34,
+    0x34, 0x20, 0x31, 0x34, 0x34, 0x20, 0x35, 0x36, 0x2D, 0x35, 0x36, 0x2D,
+    0x31, 0x34, 0x34, 0x2D, 0x31, 0x34, 0x34, 0x20, 0x31, 0x34, 0x34, 0x2D,
+    0x31, 0x34, 0x34, 0x2D, 0x35, 0x36, 0x2D, 0x35, 0x36, 0x2D, 0x31, 0x34,
+    0x34, 0x20, 0x31, 0x34, 0x34, 0x2D, 0x31, 0x34, 0x34, 0x2D, 0x31, 0x34,
+    0x34, 0x2D, 0x35, 0x36, 0x20, 0x35, 0x36, 0x20, 0x31, 0x34, 0x34, 0x20,
+    0x31, 0x34, 0x34, 0x2D, 0x31, 0x34, 0x34, 0x20, 0x31, 0x34, 0x34, 0x20,
+    0x35, 0x36, 0x20, 0x35, 0x36, 0x5A, 0x4D, 0x34, 0x38, 0x30, 0x2D, 0x38,
+    0x30, 0x71, 0x2D, 0x38, 0x33, 0x20, 0x30, 0x2D, 0x31, 0x35, 0x36, 0x2D,
+    0x33, 0x31, 0x2E, 0x35, 0x54, 0x31, 0x39, 0x37, 0x2D, 0x31, 0x39, 0x37,
+    0x71, 0x2D, 0x35, 0x34, 0x2D, 0x35, 0x34, 0x2D, 0x38, 0x35, 0x2E, 0x35,
+    0x2D, 0x31, 0x32, 0x37, 0x54, 0x38, 0x30, 0x2D, 0x34, 0x38, 0x30, 0x71,
+    0x30, 0x2D, 0x38, 0x33, 0x20, 0x33, 0x31, 0x2E, 0x35, 0x2D, 0x31, 0x35,
+    0x36, 0x54, 0x31, 0x39, 0x37, 0x2D, 0x37, 0x36, 0x33, 0x71, 0x35, 0x34,
+    0x2D, 0x35, 0x34, 0x20, 0x31, 0x32, 0x37, 0x2D, 0x38, 0x35, 0x2E, 0x35,
+    0x54, 0x34, 0x38, 0x30, 0x2D, 0x38, 0x38, 0x30, 0x71, 0x38, 0x33, 0x20,
+    0x30, 0x20, 0x31, 0x35, 0x36, 0x20, 0x33, 0x31, 0x2E, 0x35, 0x54, 0x37,
+    0x36, 0x33, 0x2D, 0x37, 0x36, 0x33, 0x71, 0x35, 0x34, 0x20, 0x35, 0x34,
+    0x20, 0x38, 0x35, 0x2E, 0x35, 0x20, 0x31, 0x32, 0x37, 0x54, 0x38, 0x38,
+    0x30, 0x2D, 0x34, 0x38, 0x30, 0x71, 0x30, 0x20, 0x38, 0x33, 0x2D, 0x33,
+    0x31, 0x2E, 0x35, 0x20, 0x31, 0x35, 0x36, 0x54, 0x37, 0x36, 0x33, 0x2D,
+    0x31, 0x39, 0x37, 0x71, 0x2D, 0x35, 0x34, 0x20, 0x35, 0x34, 0x2D, 0x31,
+    0x32, 0x37, 0x20, 0x38, 0x35, 0x2E, 0x35, 0x54, 0x34, 0x38, 0x30, 0x2D,
+    0x38, 0x30, 0x5A, 0x6D, 0x30, 0x2D, 0x38, 0x30, 0x71, 0x31, 0x33, 0x34,
+    0x20, 0x30, 0x20, 0x32, 0x32, 0x37, 0x2D, 0x39, 0x33, 0x74, 0x39, 0x33,
+    0x2D, 0x32, 0x32, 0x37, 0x71, 0x30, 0x2D, 0x31, 0x33, 0x34, 0x2D, 0x39,
+    0x33, 0x2D, 0x32, 0x32, 0x37, 0x74, 0x2D, 0x32, 0x32, 0x37, 0x2D, 0x39,
+    0x33, 0x71, 0x2D, 0x31, 0x33, 0x34, 0x20, 0x30, 0x2D, 0x32, 0x32, 0x37,
+    0x20, 0x39, 0x33, 0x74, 0x2D, 0x39, 0x33, 0x20, 0x32, 0x32, 0x37, 0x71,
+    0x30, 0x20, 0x31, 0x33, 0x34, 0x20, 0x39, 0x33, 0x20, 0x32, 0x32, 0x37,
+    0x74, 0x32, 0x32, 0x37, 0x20, 0x39, 0x33, 0x5A, 0x6D, 0x30, 0x2D, 0x33,
+    0x32, 0x30, 0x5A, 0x22, 0x20, 0x2F, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3C, 0x2F, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x3E, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x79, 0x6D, 0x62, 0x6F,
+    0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x64,
+    0x3D, 0x22, 0x74, 0x65, 0x72, 0x6D, 0x69, 0x6E, 0x61, 0x6C, 0x22, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x69, 0x65, 0x77,
+    0x42, 0x6F, 0x78, 0x3D, 0x22, 0x30, 0x20, 0x2D, 0x39, 0x36, 0x30, 0x20,
+    0x39, 0x36, 0x30, 0x20, 0x39, 0x36, 0x30, 0x22, 0x3E, 0x0A, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x70, 0x61, 0x74, 0x68, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x3D,
+    0x22, 0x4D, 0x31, 0x36, 0x30, 0x2D, 0x31, 0x36, 0x30, 0x71, 0x2D, 0x33,
+    0x33, 0x20, 0x30, 0x2D, 0x35, 0x36, 0x2E, 0x35, 0x2D, 0x32, 0x33, 0x2E,
+    0x35, 0x54, 0x38, 0x30, 0x2D, 0x32, 0x34, 0x30, 0x76, 0x2D, 0x34, 0x38,
+    0x30, 0x71, 0x30, 0x2D, 0x33, 0x33, 0x20, 0x32, 0x33, 0x2E, 0x35, 0x2D,
+    0x35, 0x36, 0x2E, 0x35, 0x54, 0x31, 0x36, 0x30, 0x2D, 0x38, 0x30, 0x30,
+    0x68, 0x36, 0x34, 0x30, 0x71, 0x33, 0x33, 0x20, 0x30, 0x20, 0x35, 0x36,
+    0x2E, 0x35, 0x20, 0x32, 0x33, 0x2E, 0x35, 0x54, 0x38, 0x38, 0x30, 0x2D,
+    0x37, 0x32, 0x30, 0x76, 0x34, 0x38, 0x30, 0x71, 0x30, 0x20, 0x33, 0x33,
+    0x2D, 0x32, 0x33, 0x2E, 0x35, 0x20, 0x35, 0x36, 0x2E, 0x35, 0x54, 0x38,
+    0x30, 0x30, 0x2D, 0x31, 0x36, 0x30, 0x48, 0x31, 0x36, 0x30, 0x5A, 0x6D,
+    0x30, 0x2D, 0x38, 0x30, 0x68, 0x36, 0x34, 0x30, 0x76, 0x2D, 0x34, 0x30,
+    0x30, 0x48, 0x31, 0x36, 0x30, 0x76, 0x34, 0x30, 0x30, 0x5A, 0x6D, 0x31,
+    0x34, 0x30, 0x2D, 0x34, 0x30, 0x2D, 0x35, 0x36, 0x2D, 0x35, 0x36, 0x20,
+    0x31, 0x30, 0x33, 0x2D, 0x31, 0x30, 0x34, 0x2D, 0x31, 0x30, 0x34, 0x2D,
+    0x31, 0x30, 0x34, 0x20, 0x35, 0x37, 0x2D, 0x35, 0x36, 0x20, 0x31, 0x36,
+    0x30, 0x20, 0x31, 0x36, 0x30, 0x2D, 0x31, 0x36, 0x30, 0x20, 0x31, 0x36,
+    0x30, 0x5A, 0x6D, 0x31, 0x38, 0x30, 0x20, 0x30, 0x76, 0x2D, 0x38, 0x30,
+    0x68, 0x32, 0x34, 0x30, 0x76, 0x38, 0x30, 0x48, 0x34, 0x38, 0x30, 0x5A,
+    0x22, 0x20, 0x2F, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x2F, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x0A, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x73,
+    0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x22, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x69, 0x65, 0x77, 0x42, 0x6F, 0x78,
+    0x3D, 0x22, 0x30, 0x20, 0x2D, 0x39, 0x36, 0x30, 0x20, 0x39, 0x36, 0x30,
+    0x20, 0x39, 0x36, 0x30, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3C, 0x70, 0x61, 0x74, 0x68, 0x0A, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x3D, 0x22, 0x6D, 0x33,
+    0x37, 0x30, 0x2D, 0x38, 0x30, 0x2D, 0x31, 0x36, 0x2D, 0x31, 0x32, 0x38,
+    0x71, 0x2D, 0x31, 0x33, 0x2D, 0x35, 0x2D, 0x32, 0x34, 0x2E, 0x35, 0x2D,
+    0x31, 0x32, 0x54, 0x33, 0x30, 0x37, 0x2D, 0x32, 0x33, 0x35, 0x6C, 0x2D,
+    0x31, 0x31, 0x39, 0x20, 0x35, 0x30, 0x4C, 0x37, 0x38, 0x2D, 0x33, 0x37,
+    0x35, 0x6C, 0x31, 0x30, 0x33, 0x2D, 0x37, 0x38, 0x71, 0x2D, 0x31, 0x2D,
+    0x37, 0x2D, 0x31, 0x2D, 0x31, 0x33, 0x2E, 0x35, 0x76, 0x2D, 0x32, 0x37,
+    0x71, 0x30, 0x2D, 0x36, 0x2E, 0x35, 0x20, 0x31, 0x2D, 0x31, 0x33, 0x2E,
+    0x35, 0x4C, 0x37, 0x38, 0x2D, 0x35, 0x38, 0x35, 0x6C, 0x31, 0x31, 0x30,
+    0x2D, 0x31, 0x39, 0x30, 0x20, 0x31, 0x31, 0x39, 0x20, 0x35, 0x30, 0x71,
+    0x31, 0x31, 0x2D, 0x38, 0x20, 0x32, 0x33, 0x2D, 0x31, 0x35, 0x74, 0x32,
+    0x34, 0x2D, 0x31, 0x32, 0x6C, 0x31, 0x36, 0x2D, 0x31, 0x32, 0x38, 0x68,
+    0x32, 0x32, 0x30, 0x6C, 0x31, 0x36, 0x20, 0x31, 0x32, 0x38, 0x71, 0x31,
+    0x33, 0x20, 0x35, 0x20, 0x32, 0x34, 0x2E, 0x35, 0x20, 0x31, 0x32, 0x74,
+    0x32, 0x32, 0x2E, 0x35, 0x20, 0x31, 0x35, 0x6C, 0x31, 0x31, 0x39, 0x2D,
+    0x35, 0x30, 0x20, 0x31, 0x31, 0x30, 0x20, 0x31, 0x39, 0x30, 0x2D, 0x31,
+    0x30, 0x33, 0x20, 0x37, 0x38, 0x71, 0x31, 0x20, 0x37, 0x20, 0x31, 0x20,
+    0x31, 0x33, 0x2E, 0x35, 0x76, 0x32, 0x37, 0x71, 0x30, 0x20, 0x36, 0x2E,
+    0x35, 0x2D, 0x32, 0x20, 0x31, 0x33, 0x2E, 0x35, 0x6C, 0x31, 0x30, 0x33,
+    0x20, 0x37, 0x38, 0x2D, 0x31, 0x31, 0x30, 0x20, 0x31, 0x39, 0x30, 0x2D,
+    0x31, 0x31, 0x38, 0x2D, 0x35, 0x30, 0x71, 0x2D, 0x31, 0x31, 0x20, 0x38,
+    0x2D, 0x32, 0x33, 0x20, 0x31, 0x35, 0x74, 0x2D, 0x32, 0x34, 0x20, 0x31,
+    0x32, 0x4C, 0x35, 0x39, 0x30, 0x2D, 0x38, 0x30, 0x48, 0x33, 0x37, 0x30,
+    0x5A, 0x6D, 0x37, 0x30, 0x2D, 0x38, 0x30, 0x68, 0x37, 0x39, 0x6C, 0x31,
+    0x34, 0x2D, 0x31, 0x30, 0x36, 0x71, 0x33, 0x31, 0x2D, 0x38, 0x20, 0x35,
+    0x37, 0x2E, 0x35, 0x2D, 0x32, 0x33, 0x2E, 0x35, 0x54, 0x36, 0x33, 0x39,
+    0x2D, 0x33, 0x32, 0x37, 0x6C, 0x39, 0x39, 0x20, 0x34, 0x31, 0x20, 0x33,
+    0x39, 0x2D, 0x36, 0x38, 0x2D, 0x38, 0x36, 0x2D, 0x36, 0x35, 0x71, 0x35,
+    0x2D, 0x31, 0x34, 0x20, 0x37, 0x2D, 0x32, 0x39, 0x2E, 0x35, 0x74, 0x32,
+    0x2D, 0x33, 0x31, 0x2E, 0x35, 0x71, 0x30, 0x2D, 0x31, 0x36, 0x2D, 0x32,
+    0x2D, 0x33, 0x31, 0x2E, 0x35, 0x74, 0x2D, 0x37, 0x2D, 0x32, 0x39, 0x2E,
+    0x35, 0x6C, 0x38, 0x36, 0x2D, 0x36, 0x35, 0x2D, 0x33, 0x39, 0x2D, 0x36,
+    0x38, 0x2D, 0x39, 0x39, 0x20, 0x34, 0x32, 0x71, 0x2D, 0x32, 0x32, 0x2D,
+    0x32, 0x33, 0x2D, 0x34, 0x38, 0x2E, 0x35, 0x2D, 0x33, 0x38, 0x2E, 0x35,
+    0x54, 0x35, 0x33, 0x33, 0x2D, 0x36, 0x39, 0x34, 0x6C, 0x2D, 0x31, 0x33,
+    0x2D, 0x31, 0x30, 0x36, 0x68, 0x2D, 0x37, 0x39, 0x6C, 0x2D, 0x31, 0x34,
+    0x20, 0x31, 0x30, 0x36, 0x71, 0x2D, 0x33, 0x31, 0x20, 0x38, 0x2D, 0x35,
+    0x37, 0x2E, 0x35, 0x20, 0x32, 0x33, 0x2E, 0x35, 0x54, 0x33, 0x32, 0x31,
+    0x2D, 0x36, 0x33, 0x33, 0x6C, 0x2D, 0x39, 0x39, 0x2D, 0x34, 0x31, 0x2D,
+    0x33, 0x39, 0x20, 0x36, 0x38, 0x20, 0x38, 0x36, 0x20, 0x36, 0x34, 0x71,
+    0x2D, 0x35, 0x20, 0x31, 0x35, 0x2D, 0x37, 0x20, 0x33, 0x30, 0x74, 0x2D,
+    0x32, 0x20, 0x33, 0x32, 0x71, 0x30, 0x20, 0x31, 0x36, 0x20, 0x32, 0x20,
+    0x33, 0x31, 0x74, 0x37, 0x20, 0x33, 0x30, 0x6C, 0x2D, 0x38, 0x36, 0x20,
+    0x36, 0x35, 0x20, 0x33, 0x39, 0x20, 0x36, 0x38, 0x20, 0x39, 0x39, 0x2D,
+    0x34, 0x32, 0x71, 0x32, 0x32, 0x20, 0x32, 0x33, 0x20, 0x34, 0x38, 0x2E,
+    0x35, 0x20, 0x33, 0x38, 0x2E, 0x35, 0x54, 0x34, 0x32, 0x37, 0x2D, 0x32,
+    0x36, 0x36, 0x6C, 0x31, 0x33, 0x20, 0x31, 0x30, 0x36, 0x5A, 0x6D, 0x34,
+    0x32, 0x2D, 0x31, 0x38, 0x30, 0x71, 0x35, 0x38, 0x20, 0x30, 0x20, 0x39,
+    0x39, 0x2D, 0x34, 0x31, 0x74, 0x34, 0x31, 0x2D, 0x39, 0x39, 0x71, 0x30,
+    0x2D, 0x35, 0x38, 0x2D, 0x34, 0x31, 0x2D, 0x39, 0x39, 0x74, 0x2D, 0x39,
+    0x39, 0x2D, 0x34, 0x31, 0x71, 0x2D, 0x35, 0x39, 0x20, 0x30, 0x2D, 0x39,
+    0x39, 0x2E, 0x35, 0x20, 0x34, 0x31, 0x54, 0x33, 0x34, 0x32, 0x2D, 0x34,
+    0x38, 0x30, 0x71, 0x30, 0x20, 0x35, 0x38, 0x20, 0x34, 0x30, 0x2E, 0x35,
+    0x20, 0x39, 0x39, 0x74, 0x39, 0x39, 0x2E, 0x35, 0x20, 0x34, 0x31, 0x5A,
+    0x6D, 0x2D, 0x32, 0x2D, 0x31, 0x34, 0x30, 0x5A, 0x22, 0x20, 0x2F, 0x3E,
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73, 0x79, 0x6D,
+    0x62, 0x6F, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x70, 0x6F, 0x77, 0x65, 0x72,
+    0x22, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x69,
+    0x65, 0x77, 0x42, 0x6F, 0x78, 0x3D, 0x22, 0x30, 0x20, 0x2D, 0x39, 0x36,
+    0x30, 0x20, 0x39, 0x36, 0x30, 0x20, 0x39, 0x36, 0x30, 0x22, 0x3E, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x70, 0x61, 0x74,
+    0x68, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x64, 0x3D, 0x22, 0x4D, 0x34, 0x38, 0x30, 0x2D, 0x38, 0x30, 0x71, 0x2D,
+    0x38, 0x33, 0x20, 0x30, 0x2D, 0x31, 0x35, 0x36, 0x2D, 0x33, 0x31, 0x2E,
+    0x35, 0x54, 0x31, 0x39, 0x37, 0x2D, 0x31, 0x39, 0x37, 0x71, 0x2D, 0x35,
+    0x34, 0x2D, 0x35, 0x34, 0x2D, 0x38, 0x35, 0x2E, 0x35, 0x2D, 0x31, 0x32,
+    0x37, 0x54, 0x38, 0x30, 0x2D, 0x34, 0x38, 0x30, 0x71, 0x30, 0x2D, 0x38,
+    0x34, 0x20, 0x33, 0x31, 0x2E, 0x35, 0x2D, 0x31, 0x35, 0x36, 0x2E, 0x35,
+    0x54, 0x31, 0x39, 0x37, 0x2D, 0x37, 0x36, 0x33, 0x6C, 0x35, 0x36, 0x20,
+    0x35, 0x36, 0x71, 0x2D, 0x34, 0x34, 0x20, 0x34, 0x34, 0x2D, 0x36, 0x38,
+    0x2E, 0x35, 0x20, 0x31, 0x30, 0x32, 0x54, 0x31, 0x36, 0x30, 0x2D, 0x34,
+    0x38, 0x30, 0x71, 0x30, 0x20, 0x31, 0x33, 0x34, 0x20, 0x39, 0x33, 0x20,
+    0x32, 0x32, 0x37, 0x74, 0x32, 0x32, 0x37, 0x20, 0x39, 0x33, 0x71, 0x31,
+    0x33, 0x34, 0x20, 0x30, 0x20, 0x32, 0x32, 0x37, 0x2D, 0x39, 0x33, 0x74,
+    0x39, 0x33, 0x2D, 0x32, 0x32, 0x37, 0x71, 0x30, 0x2D, 0x36, 0x37, 0x2D,
+    0x32, 0x34, 0x2E, 0x35, 0x2D, 0x31, 0x32, 0x35, 0x54, 0x37, 0x30, 0x37,
+    0x2D, 0x37, 0x30, 0x37, 0x6C, 0x35, 0x36, 0x2D, 0x35, 0x36, 0x71, 0x35,
+    0x34, 0x20, 0x35, 0x34, 0x20, 0x38, 0x35, 0x2E, 0x35, 0x20, 0x31, 0x32,
+    0x36, 0x2E, 0x35, 0x54, 0x38, 0x38, 0x30, 0x2D, 0x34, 0x38, 0x30, 0x71,
+    0x30, 0x20, 0x38, 0x33, 0x2D, 0x33, 0x31, 0x2E, 0x35, 0x20, 0x31, 0x35,
+    0x36, 0x54, 0x37, 0x36, 0x33, 0x2D, 0x31, 0x39, 0x37, 0x71, 0x2D, 0x35,
+    0x34, 0x20, 0x35, 0x34, 0x2D, 0x31, 0x32, 0x37, 0x20, 0x38, 0x35, 0x2E,
+    0x35, 0x54, 0x34, 0x38, 0x30, 0x2D, 0x38, 0x30, 0x5A, 0x6D, 0x2D, 0x34,
+    0x30, 0x2D, 0x33, 0x36, 0x30, 0x76, 0x2D, 0x34, 0x34, 0x30, 0x68, 0x38,
+    0x30, 0x76, 0x34, 0x34, 0x30, 0x68, 0x2D, 0x38, 0x30, 0x5A, 0x22, 0x20,
+    0x2F, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73,
+    0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C,
+    0x2F, 0x73, 0x76, 0x67, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73,
+    0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D, 0x22, 0x2F,
+    0x61, 0x73, 0x73, 0x65, 0x74, 0x73, 0x2F, 0x61, 0x70, 0x70, 0x2E, 0x38,
+    0x38, 0x36, 0x34, 0x65, 0x65, 0x34, 0x62, 0x2E, 0x6A, 0x73, 0x22, 0x20,
+    0x64, 0x65, 0x66, 0x65, 0x72, 0x3E, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x3E, 0x0A, 0x20, 0x20, 0x3C, 0x2F, 0x62, 0x6F, 0x64, 0x79,
+    0x3E, 0x0A, 0x3C, 0x2F, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0A
+};
+// gzip: 3857 bytes (ratio: 5.16x)
+const uint8_t index_html_gzip_data[] = {
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xED, 0x5C,
+    0x6B, 0x73, 0xDB, 0xCA, 0x91, 0xFD, 0xEE, 0x5F, 0x31, 0x61, 0xF6, 0x83,
+    0x5D, 0xA5, 0xA1, 0x30, 0x2F, 0x3C, 0x1C, 0x49, 0x59, 0x5B, 0xD6, 0xC6,
+    0xDE, 0x92, 0x2D, 0x97, 0xC5, 0x6C, 0xED, 0x3A, 0xF7, 0xEE, 0x16, 0x44,
+    0x42, 0x24, 0xAE, 0x41, 0x82, 0x22, 0x86, 0x94, 0x55, 0xB9, 0xF9, 0xEF,
+    0x7B, 0x7A, 0x00, 0xBE, 0x41, 0x4A, 0x94, 0xE4, 0x44, 0xF7, 0x96, 0x5C,
+    0xA4, 0x09, 0xF6, 0xF4, 0xF4, 0xF4, 0xE3, 0x4C, 0x77, 0x0F, 0x48, 0xEA,
+    0xE0, 0x0F, 0x9C, 0xB3, 0x7F, 0xBF, 0xCC, 0x47, 0xFD, 0xD8, 0x32, 0xCE,
+    0x8F, 0x5E, 0xBC, 0x38, 0xF8, 0xC3, 0xBB, 0xB3, 0xE3, 0xD6, 0xFF, 0x7C,
+    0x3E, 0x61, 0x3D, 0xDB, 0xCF, 0x8E, 0x5E, 0x1C, 0xD0, 0x0B, 0xCB, 0xE2,
+    0x41, 0xF7, 0xB0, 0x91, 0x0C, 0x1A, 0x47, 0x2F, 0x18, 0x3B, 0xE8, 0x25,
+    0x71, 0x87, 0x2E, 0x70, 0xD9, 0x4F, 0x6C, 0xCC, 0xDA, 0xBD, 0x78, 0x54,
+    0x24, 0xF6, 0xB0, 0xF1, 0xD7, 0xD6, 0x7F, 0xF0, 0xB0, 0xC1, 0xF6, 0x17,
+    0x06, 0xDD, 0x15, 0x63, 0x83, 0xB8, 0x9F, 0x1C, 0x36, 0x26, 0x69, 0x72,
+    0x3D, 0xCC, 0x47, 0xB6, 0x51, 0x51, 0xDB, 0xF9, 0xC0, 0x26, 0x03, 0x4C,
+    0xBC, 0x4E, 0x3B, 0xB6, 0x77, 0xD8, 0x49, 0x26, 0x69, 0x3B, 0xE1, 0xEE,
+    0xCD, 0x1E, 0x4B, 0x07, 0xA9, 0x4D, 0xE3, 0x8C, 0x17, 0xED, 0x38, 0x4B,
+    0x0E, 0x45, 0xD3, 0x9B, 0x0B, 0xB6, 0xA9, 0xCD, 0x92, 0xA3, 0xCF, 0x69,
+    0x3B, 0x67, 0xC7, 0x10, 0x31, 0xCA, 0xB3, 0x83, 0xFD, 0x92, 0x56, 0x8E,
+    0x67, 0xE9, 0xE0, 0x1B, 0x1B, 0x25, 0xD9, 0x61, 0xA3, 0xB0, 0x37, 0x59,
+    0x52, 0xF4, 0x92, 0xC4, 0x36, 0x58, 0x6F, 0x94, 0x5C, 0x1E, 0x36, 0xF6,
+    0xE3, 0x02, 0xBA, 0x16, 0xFB, 0xF1, 0x70, 0xD8, 0x0C, 0x4D, 0x47, 0xFA,
+    0x97, 0x97, 0xB2, 0xD9, 0x2E, 0x8A, 0x4A, 0xFA, 0xC1, 0xFE, 0xD4, 0xBA,
+    0x83, 0x8B, 0xBC, 0x73, 0x53, 0x09, 0xEC, 0xA4, 0x93, 0x4A, 0xE5, 0xB4,
+    0x73, 0xD8, 0xC8, 0xF2, 0xB8, 0x93, 0x0E, 0xBA, 0x3C, 0x9F, 0x24, 0xA3,
+    0x2C, 0xBE, 0x99, 0x59, 0x93, 0x41, 0xF4, 0x61, 0xA3, 0x97, 0x76, 0x3A,
+    0x95, 0xA7, 0xA6, 0x73, 0xA7, 0x43, 0xC5, 0x30, 0x1D, 0x0C, 0x92, 0x51,
+    0xE3, 0xE8, 0x60, 0x1F, 0xD4, 0x45, 0x8E, 0xEA, 0x72, 0x59, 0x7E, 0x3F,
+    0x29, 0x8A, 0xB8, 0x9B, 0x34, 0x66, 0x83, 0xCE, 0x9A, 0xC3, 0x46, 0x3F,
+    0x1E, 0x75, 0xD3, 0x01, 0xB7, 0xF9, 0xF0, 0x35, 0xF3, 0xF5, 0xF0, 0xFB,
+    0x9F, 0xD8, 0x25, 0xBC, 0xC0, 0xAF, 0x93, 0xB4, 0xDB, 0xB3, 0xAF, 0x99,
+    0xF1, 0xBC, 0xD9, 0xEA, 0x8C, 0x9D, 0x96, 0xC2, 0x9A, 0xCD, 0xE6, 0x74,
+    0xB9, 0xF9, 0xDA, 0x8B, 0x97, 0xA4, 0x26, 0x2D, 0x6E, 0xF3, 0xB8, 0xB0,
+    0x9C, 0x22, 0x13, 0xA7, 0xAB, 0xBA, 0xAE, 0xF8, 0x01, 0x4C, 0x97, 0xE9,
+    0xA8, 0xCF, 0xFB, 0x79, 0x27, 0xCE, 0x56, 0xBC, 0xE0, 0x68, 0x6C, 0x8B,
+    0x2F, 0x1C, 0x03, 0xAF, 0x10, 0xB0, 0xA0, 0xEF, 0x3A, 0x0F, 0x05, 0x84,
+    0x14, 0x99, 0xB1, 0x80, 0xA9, 0x98, 0x74, 0xA7, 0x4C, 0x40, 0xC1, 0x80,
+    0xD9, 0xE4, 0xBB, 0xE5, 0xC3, 0x51, 0x0A, 0xD7, 0xDC, 0x40, 0xE5, 0x71,
+    0x91, 0x54, 0xE1, 0xFE, 0xE3, 0x30, 0xBF, 0x2E, 0xAD, 0x00, 0x0D, 0xFF,
+    0x63, 0xE2, 0x92, 0xA0, 0x9E, 0x3A, 0x3A, 0x2E, 0xCD, 0x60, 0x5F, 0x92,
+    0x8B, 0x3C, 0xB7, 0x00, 0x80, 0x5A, 0xD0, 0x66, 0x31, 0x50, 0x75, 0xCA,
+    0x11, 0x48, 0x96, 0x55, 0x1B, 0x1E, 0xBD, 0x19, 0x25, 0xEC, 0x26, 0x1F,
+    0xB3, 0x62, 0x5C, 0x5D, 0x5C, 0xC7, 0x03, 0xCB, 0x6C, 0x0E, 0x48, 0xD2,
+    0x0A, 0xCC, 0xF6, 0x12, 0x56, 0xDC, 0x14, 0x36, 0xE9, 0xFF, 0xF9, 0x60,
+    0x7F, 0xB8, 0xC3, 0x62, 0x71, 0xDB, 0xA6, 0xF9, 0xA0, 0x58, 0x5E, 0xEF,
+    0x62, 0x6C, 0x6D, 0x3E, 0x58, 0xA0, 0x94, 0xC1, 0xA9, 0xFC, 0x1B, 0x0F,
+    0xDA, 0x49, 0xD6, 0x58, 0x1A, 0xAD, 0x44, 0x5E, 0xD8, 0x01, 0xC3, 0x93,
+    0x5F, 0x66, 0xB1, 0x5D, 0x92, 0xC8, 0xD8, 0xB1, 0x9B, 0xB5, 0xB8, 0xC8,
+    0x7E, 0xB9, 0xCA, 0x0E, 0x0B, 0x97, 0x4E, 0xDD, 0xBA, 0xF2, 0x2C, 0x5E,
+    0x4B, 0x4C, 0x65, 0x18, 0xB6, 0x2E, 0xBE, 0xBC, 0x7D, 0xEA, 0xF1, 0x5C,
+    0xA2, 0x66, 0xC6, 0x54, 0x8A, 0x98, 0xED, 0x51, 0x37, 0xC8, 0xA1, 0xC4,
+    0x22, 0xF2, 0x56, 0x40, 0xB5, 0x8C, 0xA3, 0x2C, 0xEF, 0xE6, 0xB2, 0x16,
+    0x47, 0xAB, 0xFA, 0x2D, 0xC6, 0xAD, 0x5A, 0xC8, 0x25, 0xA7, 0xC6, 0xD1,
+    0xC7, 0x0F, 0xC7, 0xEC, 0xF8, 0xEC, 0x53, 0xEB, 0xCB, 0xD9, 0xE9, 0xE6,
+    0x0C, 0xB0, 0x3C, 0xB3, 0x1F, 0xB7, 0x1B, 0x4B, 0xC9, 0x61, 0x81, 0x3E,
+    0x57, 0xFD, 0xD3, 0xFE, 0x9B, 0x3A, 0x6F, 0x2C, 0xFA, 0x60, 0x51, 0x2B,
+    0x24, 0xAD, 0x7C, 0x3C, 0x0F, 0xFA, 0x41, 0x5C, 0xA4, 0x9D, 0xC4, 0x49,
+    0xA7, 0x8B, 0x8B, 0x78, 0x71, 0xB3, 0x1D, 0x8C, 0xB3, 0xE9, 0xB4, 0x41,
+    0x3C, 0xE1, 0x59, 0x5A, 0x2C, 0xA3, 0x05, 0xC9, 0xB6, 0x2E, 0xC6, 0xC4,
+    0x9B, 0x02, 0xE1, 0x8C, 0x30, 0x3B, 0x49, 0x96, 0x71, 0xD0, 0x89, 0x6D,
+    0xCC, 0x87, 0x48, 0x6D, 0x58, 0x70, 0xDC, 0xAF, 0xC1, 0xC0, 0x62, 0x28,
+    0x9C, 0xA4, 0xB5, 0x70, 0xF4, 0xF2, 0x7E, 0xB2, 0x71, 0x57, 0x2F, 0x5B,
+    0xEB, 0xD4, 0x8E, 0x2F, 0xB0, 0x0D, 0x96, 0x79, 0x68, 0x99, 0x61, 0x3C,
+    0x58, 0x63, 0x83, 0x6F, 0x53, 0xAC, 0xF6, 0x1E, 0x2B, 0x40, 0x32, 0x38,
+    0xEE, 0x38, 0xAD, 0x18, 0x5F, 0x34, 0x8E, 0xCE, 0x6D, 0x6C, 0xC7, 0x05,
+    0x3B, 0x2F, 0xCD, 0xAA, 0x9B, 0xBF, 0xB2, 0xCB, 0x89, 0x90, 0xA5, 0x3B,
+    0x78, 0x74, 0xB3, 0x2B, 0x13, 0x6B, 0x91, 0xE9, 0x8B, 0x9D, 0x7D, 0x39,
+    0x9F, 0xF8, 0x23, 0xFD, 0x79, 0x5E, 0xAD, 0x72, 0x0F, 0x9F, 0xBA, 0x5C,
+    0xC9, 0x5C, 0x9E, 0xEE, 0x8E, 0x47, 0x31, 0x25, 0xC1, 0x7B, 0x78, 0x16,
+    0xC6, 0x65, 0xF3, 0x3D, 0xEB, 0x30, 0x3F, 0x7B, 0x4B, 0x2A, 0x2E, 0x67,
+    0xDE, 0x17, 0xCB, 0x59, 0x8D, 0x5C, 0xCC, 0xA7, 0x60, 0x7D, 0xB1, 0x16,
+    0x1C, 0x1A, 0x5E, 0xDE, 0x16, 0x0B, 0x0E, 0x6B, 0xC7, 0xA3, 0x4E, 0x63,
+    0xB3, 0x3F, 0x69, 0xB8, 0xAE, 0xC8, 0xED, 0x58, 0xE8, 0x6E, 0xD9, 0x11,
+    0x2B, 0x2E, 0x76, 0x8B, 0x56, 0x69, 0xA9, 0xF2, 0x6F, 0x09, 0xDD, 0x3B,
+    0x39, 0xB6, 0xC6, 0x80, 0xB5, 0x42, 0xB8, 0xCA, 0x45, 0x5D, 0x26, 0xEF,
+    0x8E, 0xF2, 0xF1, 0x70, 0x8D, 0x8D, 0x30, 0x4F, 0xE1, 0x3E, 0xFA, 0x94,
+    0xD8, 0xEB, 0x7C, 0xF4, 0x0D, 0x71, 0x73, 0x6F, 0xD7, 0xD9, 0x96, 0x03,
+    0xB3, 0xD2, 0x17, 0xD5, 0x8C, 0x30, 0x36, 0x8C, 0x3B, 0xD4, 0xFF, 0xBC,
+    0x66, 0xE1, 0xF0, 0xFB, 0xEC, 0x29, 0xA9, 0x6B, 0xAA, 0x65, 0xEF, 0xA4,
+    0xC5, 0x10, 0xE9, 0xF1, 0x35, 0xBB, 0xCC, 0x92, 0x0D, 0x2C, 0x34, 0xC2,
+    0x3B, 0xE9, 0x28, 0x71, 0xD5, 0xF8, 0x35, 0xBA, 0xD8, 0x6C, 0xDC, 0x1F,
+    0xD4, 0xF3, 0x76, 0x63, 0xF4, 0x68, 0x42, 0xD6, 0xAF, 0x56, 0xE3, 0x87,
+    0x65, 0x97, 0x8D, 0xF2, 0x6B, 0x46, 0x5B, 0xBE, 0xE0, 0x6D, 0x34, 0x49,
+    0xC9, 0x88, 0xFD, 0x32, 0x2E, 0x6C, 0x7A, 0x79, 0xC3, 0x2F, 0xE0, 0xA7,
+    0x24, 0x19, 0xD4, 0x0A, 0xA8, 0x02, 0x7D, 0xF4, 0xF1, 0xCD, 0x31, 0x7B,
+    0xD3, 0xE9, 0x8C, 0xD0, 0x44, 0xD6, 0x6F, 0xB9, 0x29, 0x33, 0xFA, 0xE7,
+    0x41, 0xB7, 0xCC, 0xFE, 0xE3, 0x7E, 0x59, 0x58, 0xE6, 0x4D, 0x23, 0xA6,
+    0xBA, 0xF1, 0x5A, 0x55, 0xD7, 0x61, 0xF1, 0xC8, 0x36, 0xBC, 0x7B, 0x7F,
+    0xFC, 0x79, 0x17, 0xE5, 0x3B, 0xBD, 0xF6, 0xF0, 0xE9, 0x68, 0xFF, 0xE1,
+    0xF3, 0x7D, 0x02, 0x90, 0x3E, 0x21, 0x0B, 0xB0, 0x1F, 0xFB, 0x71, 0xF1,
+    0x6D, 0x37, 0xFC, 0x14, 0xDF, 0x9E, 0x8E, 0x01, 0x7F, 0x89, 0x6D, 0x72,
+    0x1D, 0xDF, 0xEC, 0x62, 0x40, 0xB7, 0x9C, 0xF2, 0x84, 0x36, 0xC1, 0xA7,
+    0xF3, 0x9D, 0xF6, 0x00, 0x1D, 0x10, 0x1E, 0xA4, 0x7B, 0x2D, 0xB9, 0x9E,
+    0xB8, 0x63, 0x7E, 0x3F, 0xCE, 0xFB, 0xFD, 0xF1, 0x20, 0x6D, 0x57, 0x25,
+    0xFC, 0x39, 0xCB, 0x3F, 0x18, 0x1C, 0xAD, 0xE3, 0xCF, 0xEC, 0x73, 0x3E,
+    0xB2, 0xBB, 0x20, 0xC4, 0x3E, 0xA5, 0x24, 0xF9, 0x36, 0x1E, 0x77, 0xD8,
+    0x17, 0xEC, 0xB9, 0x5D, 0x2C, 0xB8, 0xC0, 0xA4, 0x27, 0x0B, 0xF2, 0xBF,
+    0x7C, 0xFE, 0x70, 0x36, 0xBF, 0x2F, 0xF5, 0x8C, 0xF1, 0x87, 0x27, 0x40,
+    0x77, 0x5F, 0x90, 0x7D, 0x78, 0xB7, 0x53, 0x19, 0xED, 0x3C, 0x1D, 0x8C,
+    0x7F, 0xCC, 0x3B, 0x3B, 0xC1, 0xBB, 0x0F, 0xFE, 0x7F, 0x12, 0xBC, 0x6B,
+    0xCE, 0x4C, 0xCB, 0x37, 0xA1, 0xD6, 0xEF, 0x49, 0xD5, 0x9E, 0x8C, 0xA6,
+    0x47, 0xC8, 0xFA, 0xA3, 0xD1, 0xEA, 0x8D, 0xC0, 0x7F, 0xDE, 0x09, 0x69,
+    0xDD, 0x31, 0x0B, 0x47, 0xA6, 0x41, 0x79, 0xDC, 0xE0, 0x03, 0xE7, 0xEF,
+    0xF2, 0xE8, 0xB4, 0xE6, 0xB2, 0x5D, 0x4E, 0x52, 0xD5, 0xF9, 0x65, 0xC7,
+    0xA3, 0x14, 0x25, 0x15, 0xE7, 0xCA, 0xA9, 0x3E, 0x44, 0xD8, 0x7A, 0x96,
+    0xDA, 0x7C, 0xE2, 0xAA, 0x49, 0x57, 0x80, 0xEE, 0xEE, 0xFB, 0x13, 0xDB,
+    0x9D, 0x17, 0xFD, 0x8D, 0xA8, 0x9E, 0x74, 0x6B, 0x07, 0xD8, 0x62, 0x24,
+    0x30, 0x7F, 0x39, 0x18, 0x1B, 0xA6, 0x54, 0x39, 0xEF, 0x32, 0xCD, 0xB2,
+    0xD7, 0x6C, 0x12, 0x8F, 0x5E, 0xF2, 0xE9, 0x8C, 0x57, 0x1B, 0xD6, 0x5F,
+    0x8E, 0x62, 0xDC, 0xA1, 0xBD, 0xB8, 0x21, 0x7E, 0x5B, 0xA2, 0x78, 0xF7,
+    0x83, 0xC6, 0xE6, 0x0C, 0xE1, 0xB2, 0xFB, 0xD4, 0x68, 0x9B, 0x77, 0xBB,
+    0x19, 0xF6, 0xC2, 0x75, 0x6A, 0xDB, 0xBD, 0x4D, 0xAE, 0x4B, 0x07, 0xC3,
+    0xB1, 0xDD, 0x60, 0x95, 0xBD, 0x19, 0xC2, 0x11, 0xED, 0x5E, 0xD2, 0xFE,
+    0x76, 0x91, 0x7F, 0xDF, 0xE4, 0xAF, 0x0A, 0x29, 0xE5, 0x61, 0x67, 0xFA,
+    0x99, 0x48, 0xAD, 0x59, 0xB3, 0xCF, 0x1D, 0xB2, 0xB4, 0x53, 0xDE, 0x04,
+    0xDF, 0x6C, 0xE1, 0xA6, 0x3A, 0xB5, 0x21, 0xBD, 0xDC, 0xB5, 0x26, 0xCE,
+    0xAA, 0xE2, 0xE2, 0x61, 0x68, 0xC3, 0x5A, 0x5B, 0xBD, 0x53, 0xFA, 0x86,
+    0xF0, 0x54, 0xEF, 0x97, 0xA9, 0x57, 0x70, 0x7C, 0xAA, 0x1D, 0x1F, 0x25,
+    0x57, 0x63, 0x54, 0xBA, 0xCE, 0x86, 0xD2, 0x6A, 0x01, 0xFA, 0xC1, 0x61,
+    0xE3, 0x7F, 0x5F, 0xBE, 0x94, 0xE6, 0x6F, 0x1E, 0x37, 0x3F, 0xFF, 0xFA,
+    0x52, 0xE2, 0x55, 0xFF, 0xFC, 0xAB, 0xF8, 0xA9, 0xF3, 0xEB, 0xDF, 0x04,
+    0x8F, 0x7E, 0xFE, 0xF5, 0xD5, 0x4F, 0x9D, 0x57, 0x3F, 0x35, 0xFF, 0xFC,
+    0xD3, 0xC5, 0xAB, 0xBF, 0xEB, 0x7F, 0xFC, 0x5B, 0xAD, 0xEB, 0x1F, 0xCD,
+    0x5D, 0xB3, 0x93, 0xD7, 0x8F, 0xF4, 0x95, 0x3B, 0xAB, 0xFD, 0x1E, 0xBC,
+    0x35, 0x3B, 0xE6, 0xFD, 0x48, 0x6F, 0x4D, 0x0F, 0x86, 0xBF, 0x07, 0x87,
+    0xB9, 0x33, 0xE5, 0x8F, 0x74, 0x16, 0x9D, 0x42, 0x9F, 0x9A, 0xA3, 0x6E,
+    0xED, 0xEE, 0x5D, 0x59, 0xAD, 0xFB, 0x90, 0x6D, 0xF3, 0x27, 0x5E, 0x8B,
+    0x5E, 0x29, 0xC6, 0x17, 0xFD, 0xB4, 0xD6, 0x2F, 0xF5, 0x1F, 0x7C, 0xB9,
+    0xEB, 0xE4, 0x3B, 0x52, 0x72, 0xA7, 0x3E, 0x56, 0x9B, 0xCA, 0xEC, 0xE2,
+    0x87, 0x54, 0x2F, 0x6E, 0x2D, 0xA9, 0xD7, 0x3D, 0x54, 0xF6, 0x3F, 0x31,
+    0xF7, 0xB1, 0xFA, 0x6B, 0x26, 0x3D, 0xFA, 0xC0, 0xB8, 0x57, 0x7D, 0x56,
+    0x4C, 0xEF, 0x36, 0x55, 0xAA, 0x85, 0x12, 0xEB, 0x4A, 0xD2, 0xFF, 0xB5,
+    0xD3, 0x51, 0x3B, 0x4B, 0xB6, 0x14, 0xDA, 0x8D, 0x65, 0x76, 0xA9, 0x1A,
+    0x91, 0xD5, 0x0E, 0x40, 0x47, 0x6F, 0x86, 0xC3, 0x6C, 0xE3, 0xBD, 0x99,
+    0xBA, 0xCF, 0x1C, 0x37, 0x36, 0xB1, 0x84, 0xFA, 0x2D, 0x5D, 0xEC, 0xBF,
+    0xE2, 0x7E, 0xFC, 0x72, 0x5B, 0xB2, 0x5B, 0x1F, 0xB9, 0x72, 0x9F, 0x64,
+    0xC7, 0x36, 0xB2, 0x8D, 0xD9, 0x8F, 0xDC, 0x43, 0x6E, 0x49, 0x28, 0xF5,
+    0x07, 0x59, 0x76, 0x5B, 0x67, 0xB9, 0x0D, 0xB7, 0xD5, 0x17, 0x1C, 0x2E,
+    0x72, 0xC4, 0xBF, 0xEF, 0xCE, 0xBB, 0xBF, 0x89, 0x46, 0x14, 0xD6, 0xF5,
+    0xD3, 0x41, 0x9C, 0x3D, 0xAC, 0x15, 0x75, 0x77, 0x74, 0xCE, 0xBE, 0xB4,
+    0xEE, 0xD3, 0x8E, 0xDE, 0x96, 0xB7, 0x07, 0xE3, 0xFE, 0x05, 0x50, 0xBD,
+    0x31, 0x73, 0x3B, 0xE4, 0xD0, 0xED, 0xA1, 0xDD, 0x53, 0x37, 0x2C, 0x3F,
+    0x6C, 0x88, 0xFA, 0x89, 0xFD, 0xF8, 0xFB, 0x61, 0xC3, 0x37, 0x46, 0x99,
+    0x1F, 0x55, 0xD5, 0x9E, 0x41, 0xF8, 0xB8, 0x20, 0xFC, 0x72, 0x2E, 0x95,
+    0xBC, 0x0F, 0x02, 0x8B, 0x24, 0x4B, 0xDA, 0x76, 0x0E, 0xA6, 0xF2, 0x4E,
+    0x5D, 0xFD, 0x4A, 0xF9, 0x90, 0xD2, 0x1B, 0x8C, 0xCC, 0xC6, 0xB0, 0x38,
+    0xF2, 0xE9, 0x7B, 0x4B, 0xF4, 0xFF, 0xC1, 0x7E, 0x39, 0x72, 0xA7, 0x69,
+    0x22, 0x92, 0x34, 0xCF, 0xBD, 0xEC, 0x34, 0x51, 0x85, 0x9A, 0x26, 0xBA,
+    0x97, 0x9D, 0x26, 0x9A, 0xC0, 0x69, 0xEA, 0x5E, 0x76, 0x53, 0x55, 0x98,
+    0x52, 0x57, 0xF7, 0xBA, 0x6D, 0x2A, 0x3C, 0xEF, 0xFC, 0xF8, 0xDC, 0xD8,
+    0x3C, 0x37, 0x36, 0xBF, 0xAB, 0xC6, 0xC6, 0xDD, 0x1B, 0xDF, 0xF6, 0x4D,
+    0x90, 0xAD, 0x8D, 0x4D, 0x77, 0x98, 0xE6, 0xCF, 0x8D, 0xCD, 0x6F, 0xB5,
+    0xA6, 0xBC, 0x3B, 0xF9, 0xAF, 0x0F, 0xC7, 0x27, 0x5B, 0x6F, 0xE3, 0xFF,
+    0xB8, 0xCE, 0xC6, 0x41, 0x27, 0xED, 0x6C, 0x6F, 0x6C, 0x9E, 0x9B, 0x93,
+    0xDF, 0x04, 0x90, 0x3E, 0x9E, 0xBD, 0x3B, 0x79, 0x60, 0x6F, 0xE2, 0xE0,
+    0x50, 0x7E, 0xCC, 0x72, 0x97, 0xCA, 0x5D, 0x66, 0xF5, 0xD6, 0xC9, 0x7F,
+    0xB7, 0x76, 0x2A, 0xF8, 0xBF, 0x14, 0xF4, 0x55, 0xBB, 0xFF, 0x3C, 0x3F,
+    0xFB, 0xF4, 0x88, 0xC5, 0xFE, 0x19, 0x7B, 0xFF, 0x4A, 0xEC, 0xBD, 0xF9,
+    0x6B, 0xEB, 0x8C, 0x7D, 0x39, 0x39, 0xFF, 0x7C, 0xF6, 0xE9, 0xFC, 0x51,
+    0x40, 0x18, 0x8F, 0x6D, 0x7E, 0x47, 0x10, 0x8E, 0xC6, 0x80, 0xEB, 0xC9,
+    0xA7, 0x37, 0x6F, 0x4F, 0x4F, 0xDE, 0xED, 0x84, 0xC3, 0xCB, 0x38, 0x2B,
+    0x30, 0xF5, 0xDD, 0x87, 0xF3, 0x5B, 0xE7, 0x3E, 0x77, 0x9E, 0xCF, 0x9D,
+    0xE7, 0x93, 0xED, 0x3C, 0xEF, 0xF0, 0x45, 0xE5, 0xDB, 0xBF, 0xE6, 0xFA,
+    0xA6, 0x04, 0xE3, 0x0F, 0xFB, 0x9E, 0xEB, 0x3D, 0xBE, 0x29, 0x70, 0xDF,
+    0x4F, 0x62, 0x57, 0x5D, 0xB7, 0x96, 0x4A, 0x6F, 0x87, 0xE1, 0xD2, 0xCF,
+    0x63, 0x76, 0xC6, 0xDF, 0xD1, 0x97, 0x93, 0xB7, 0x67, 0x67, 0xAD, 0xCD,
+    0x78, 0xAB, 0xAF, 0x5F, 0x1B, 0x37, 0x3D, 0x65, 0x45, 0xC2, 0x72, 0xF9,
+    0x43, 0x99, 0xDF, 0xE3, 0xB6, 0x7F, 0x98, 0xBF, 0xD7, 0xF7, 0xFB, 0xF4,
+    0x47, 0x4B, 0x8F, 0xB0, 0xE1, 0x77, 0xF8, 0x22, 0xC8, 0xC1, 0xFE, 0xFC,
+    0x0B, 0xF3, 0x8B, 0xBF, 0x38, 0x99, 0xBB, 0xF9, 0x7B, 0x3F, 0x1B, 0xD0,
+    0xAF, 0x58, 0xAC, 0x1D, 0xBE, 0xDE, 0xDF, 0xBF, 0xBE, 0xBE, 0x6E, 0x5E,
+    0xAB, 0x66, 0x3E, 0xEA, 0xEE, 0x4B, 0xCF, 0xF3, 0xC8, 0xC6, 0xA9, 0xBB,
+    0x2B, 0x07, 0xCF, 0xBE, 0xAD, 0x34, 0xC8, 0x07, 0xF3, 0xA6, 0xEC, 0xA0,
+    0xB8, 0xE9, 0x5F, 0xE4, 0xD9, 0xCA, 0xAF, 0xE3, 0xE8, 0x87, 0x38, 0x33,
+    0x12, 0xFD, 0xA6, 0xF0, 0x6D, 0xFE, 0xFD, 0xB0, 0xE1, 0x31, 0x8F, 0x49,
+    0x83, 0xC7, 0xE2, 0x8F, 0x57, 0x86, 0xB1, 0xED, 0x2D, 0xD8, 0x84, 0xE9,
+    0x1F, 0x83, 0x66, 0x24, 0xB5, 0xD2, 0x52, 0x06, 0x7B, 0x51, 0xD3, 0x78,
+    0x81, 0xEF, 0x09, 0x3F, 0x60, 0xA7, 0x42, 0x35, 0x85, 0xEF, 0xE3, 0xB1,
+    0x27, 0x82, 0xA6, 0x08, 0x84, 0x8A, 0x94, 0x66, 0xA7, 0x20, 0xE2, 0x4A,
+    0x08, 0xCF, 0x91, 0xB5, 0x32, 0x26, 0x08, 0x05, 0x3B, 0xAD, 0x97, 0xF1,
+    0x75, 0x11, 0x42, 0xF4, 0x8D, 0x9D, 0x6F, 0x30, 0xEC, 0x8F, 0x9E, 0xF7,
+    0x36, 0xD4, 0xD1, 0xE2, 0x10, 0x81, 0xA9, 0x76, 0xC0, 0x8E, 0xE2, 0x41,
+    0x41, 0x79, 0x97, 0x8A, 0x3D, 0x2E, 0xB3, 0xD8, 0x26, 0x2F, 0xC3, 0xA6,
+    0xE7, 0x87, 0x7E, 0xA8, 0xF6, 0x18, 0x54, 0x94, 0xC6, 0x33, 0x91, 0x78,
+    0xC5, 0x46, 0xB9, 0xA5, 0xB1, 0xC8, 0x6B, 0x7A, 0xEE, 0xDF, 0x2B, 0x36,
+    0x9F, 0xC0, 0xE7, 0x33, 0xF8, 0x7C, 0x0A, 0x61, 0x8E, 0xBC, 0xB1, 0xDD,
+    0x39, 0x02, 0x02, 0x35, 0xE6, 0xEA, 0x68, 0x2F, 0x6C, 0x6A, 0x5C, 0x09,
+    0x19, 0x44, 0xEC, 0x54, 0x7A, 0x4D, 0x15, 0x78, 0x91, 0x0E, 0xC4, 0x9E,
+    0x00, 0x5D, 0x46, 0x22, 0xF0, 0x7D, 0xF8, 0xCC, 0x6B, 0x4A, 0x29, 0x84,
+    0xD1, 0x8A, 0xC8, 0x81, 0x54, 0x02, 0x1C, 0x8E, 0x5C, 0x23, 0x64, 0x93,
+    0x77, 0x94, 0xF4, 0x75, 0xAD, 0x77, 0x56, 0x07, 0x6A, 0xBD, 0x23, 0x4C,
+    0xD3, 0xA8, 0x10, 0x1E, 0x70, 0xEE, 0x11, 0x61, 0x28, 0xB4, 0x9C, 0xB9,
+    0x47, 0x06, 0xB5, 0xFE, 0x59, 0x98, 0xC3, 0xE7, 0x93, 0xEE, 0xE6, 0x20,
+    0xA9, 0x9B, 0xDA, 0x04, 0x46, 0xA9, 0x68, 0xCF, 0x6B, 0xC2, 0x25, 0x32,
+    0x8C, 0xA4, 0x82, 0x83, 0x74, 0x33, 0xD0, 0xBE, 0x36, 0x7E, 0x44, 0x9E,
+    0x30, 0x90, 0xA7, 0x7D, 0x03, 0xB2, 0x6A, 0x46, 0x2A, 0x0C, 0xA4, 0x36,
+    0x44, 0xF6, 0x65, 0xE4, 0x2B, 0x3F, 0x74, 0xE4, 0x40, 0x47, 0xDA, 0x84,
+    0xD1, 0x9E, 0x6C, 0x6A, 0x1F, 0x42, 0x4C, 0xB4, 0x95, 0xEC, 0x07, 0xCA,
+    0x8B, 0x84, 0x02, 0xD9, 0x48, 0x5F, 0x09, 0x4F, 0x06, 0xEC, 0x18, 0x64,
+    0x61, 0x44, 0x64, 0x14, 0x71, 0x47, 0x08, 0x82, 0x81, 0x9B, 0x91, 0x86,
+    0x48, 0x2B, 0xB0, 0x04, 0x7B, 0x50, 0x49, 0x45, 0x1A, 0x2B, 0x06, 0x0C,
+    0x8B, 0x23, 0x50, 0xDA, 0x0F, 0xCD, 0x9E, 0xDF, 0x34, 0x51, 0x10, 0x1A,
+    0xE3, 0x51, 0xA0, 0x02, 0x62, 0x09, 0x23, 0x4F, 0x80, 0x1C, 0xC1, 0xAC,
+    0x08, 0xB8, 0x61, 0xC7, 0xC2, 0x6F, 0x86, 0xC0, 0x39, 0x8C, 0xDB, 0x0B,
+    0x9A, 0xD8, 0x12, 0x46, 0x09, 0x5F, 0x33, 0x78, 0x2D, 0x0A, 0x8D, 0x0C,
+    0x42, 0x8A, 0xAA, 0x44, 0x74, 0x45, 0x68, 0x14, 0x51, 0xA5, 0x87, 0x00,
+    0x3B, 0x6A, 0x68, 0x08, 0x78, 0x5A, 0x41, 0x84, 0x86, 0xB5, 0x58, 0x4E,
+    0x62, 0x7F, 0xC8, 0x50, 0x99, 0xD0, 0x0F, 0x7C, 0x06, 0xA2, 0x17, 0x45,
+    0x70, 0xB7, 0x0F, 0xAA, 0x8F, 0x05, 0xBC, 0xC0, 0x0B, 0x28, 0x6C, 0x3E,
+    0x54, 0x8A, 0xC2, 0x3D, 0xC2, 0x8D, 0xE7, 0x9B, 0x50, 0x85, 0x6E, 0x3B,
+    0x4A, 0x23, 0x44, 0x18, 0x69, 0x22, 0x2B, 0x21, 0x05, 0x66, 0x6E, 0x23,
+    0x7B, 0x81, 0xD0, 0xB8, 0x26, 0xB2, 0xD6, 0x3E, 0x42, 0x81, 0x3D, 0x2D,
+    0x9B, 0x7E, 0x28, 0x81, 0x3F, 0x65, 0xF6, 0x14, 0x42, 0x1E, 0x90, 0x47,
+    0x69, 0xAB, 0x37, 0xA5, 0xD6, 0x01, 0x36, 0x88, 0x70, 0x7E, 0x36, 0xD2,
+    0x13, 0x6A, 0x89, 0xEA, 0x42, 0xA8, 0x02, 0xED, 0x81, 0x0C, 0x71, 0x08,
+    0x36, 0x02, 0x21, 0xC3, 0x2A, 0x86, 0x26, 0x20, 0xDF, 0x01, 0xFA, 0x46,
+    0x03, 0xE2, 0x51, 0xA0, 0x81, 0x84, 0x10, 0xDE, 0x0F, 0x30, 0x14, 0xB2,
+    0x63, 0x38, 0x47, 0x69, 0xAD, 0x64, 0x10, 0xC0, 0xA9, 0x08, 0x77, 0xA4,
+    0x75, 0x64, 0x98, 0x90, 0x48, 0x2F, 0x9E, 0xA2, 0xD8, 0x3A, 0x8F, 0xF8,
+    0x48, 0x2F, 0x9A, 0xA8, 0x0A, 0x38, 0xF4, 0x15, 0x88, 0x50, 0x1A, 0x5E,
+    0x44, 0xC0, 0x8F, 0x41, 0x85, 0x0F, 0x44, 0xE4, 0x3B, 0x56, 0xAC, 0x12,
+    0x86, 0x70, 0xB4, 0xDF, 0x0C, 0x7C, 0xD8, 0x1E, 0xF8, 0x4E, 0x6C, 0x64,
+    0xBC, 0x28, 0xD4, 0x6C, 0x33, 0x1C, 0x6B, 0xC8, 0x1B, 0x76, 0x20, 0x86,
+    0x94, 0xAA, 0xDB, 0x81, 0xE5, 0xC0, 0xCA, 0xB6, 0x40, 0xA9, 0x71, 0x39,
+    0x79, 0x5B, 0x8A, 0x76, 0x3F, 0x45, 0xAA, 0xCB, 0xD0, 0x3C, 0xF2, 0x3D,
+    0x56, 0x3D, 0x1B, 0xB7, 0x6D, 0x34, 0x8F, 0xA3, 0x56, 0xF4, 0x84, 0xF4,
+    0x26, 0x1C, 0x6F, 0x7A, 0x78, 0x4E, 0xE8, 0xD5, 0x11, 0x94, 0xEF, 0x9D,
+    0xEA, 0xD0, 0xE3, 0x88, 0x11, 0x23, 0x4E, 0xE3, 0x7B, 0x13, 0xD0, 0xBE,
+    0xF6, 0x79, 0xE8, 0xB1, 0x10, 0x0C, 0x18, 0xCC, 0x94, 0xF4, 0x68, 0x26,
+    0xC3, 0x2B, 0x31, 0x4D, 0x40, 0x7B, 0x6F, 0xA6, 0xE2, 0xC0, 0x48, 0xE2,
+    0xDE, 0x0B, 0x9A, 0x45, 0x9C, 0xCA, 0x78, 0x5F, 0x17, 0x3E, 0x9E, 0xBA,
+    0x8B, 0x9D, 0x4B, 0xDF, 0x1F, 0x7C, 0xA8, 0xBD, 0x50, 0x21, 0xF4, 0xAE,
+    0x38, 0x20, 0xE4, 0xF1, 0x28, 0xE2, 0x5A, 0x58, 0x3C, 0x71, 0x75, 0xE5,
+    0x11, 0xCD, 0x5D, 0x5A, 0x47, 0xBF, 0x12, 0x60, 0x61, 0xCA, 0x30, 0xDD,
+    0x34, 0x56, 0x49, 0x02, 0x91, 0xC9, 0x84, 0x51, 0xC8, 0x6B, 0x6A, 0xC2,
+    0x51, 0xAB, 0xAE, 0xB8, 0xD6, 0x48, 0x6C, 0x3C, 0x90, 0x5C, 0xA3, 0x3C,
+    0xB5, 0x94, 0x76, 0x8E, 0x5A, 0x17, 0x44, 0x6B, 0xB1, 0x28, 0x02, 0xCD,
+    0x6A, 0xC1, 0x68, 0x29, 0xA6, 0x43, 0x2E, 0x43, 0x16, 0x42, 0x74, 0x0B,
+    0xAE, 0xE2, 0xBE, 0xE7, 0x4F, 0x20, 0x11, 0xE2, 0x29, 0x01, 0xA8, 0x2B,
+    0x61, 0x78, 0xC8, 0x94, 0x68, 0x1A, 0x4E, 0xAB, 0xB6, 0x20, 0x95, 0x42,
+    0x51, 0x27, 0xC8, 0x84, 0xDC, 0x5D, 0x5A, 0xEE, 0xE8, 0xF5, 0x86, 0xC1,
+    0x12, 0xAC, 0x04, 0xD7, 0x5B, 0x12, 0xC7, 0x95, 0x74, 0x41, 0x45, 0xF2,
+    0x64, 0x4A, 0x2B, 0x28, 0x12, 0x5C, 0x85, 0x58, 0xD6, 0x59, 0x88, 0x28,
+    0x5A, 0x4D, 0x2F, 0x66, 0x5D, 0xF8, 0xD7, 0xBE, 0x29, 0xBD, 0x87, 0xFA,
+    0x0F, 0x13, 0x48, 0x14, 0x52, 0x9B, 0x69, 0x21, 0xC3, 0x70, 0xF8, 0x15,
+    0x0B, 0xC9, 0x92, 0xC2, 0xF5, 0x54, 0x6B, 0x49, 0xBE, 0x26, 0x76, 0x47,
+    0x62, 0x8E, 0xDD, 0x0F, 0x2B, 0x76, 0xEA, 0x23, 0x88, 0xC2, 0x66, 0xEC,
+    0x84, 0x92, 0x8F, 0xA4, 0x9B, 0xBF, 0xBE, 0x8A, 0x99, 0xB9, 0x77, 0x69,
+    0x15, 0xE2, 0x86, 0x02, 0x6B, 0xAB, 0x68, 0x59, 0xB1, 0x2F, 0xAF, 0x52,
+    0x09, 0xFF, 0xEA, 0x80, 0x80, 0xE5, 0x56, 0x57, 0x91, 0x61, 0xAD, 0x2D,
+    0xC4, 0x5D, 0x67, 0x0B, 0x24, 0xD4, 0xD9, 0x52, 0x09, 0xDF, 0x15, 0xE8,
+    0xD5, 0x2D, 0xFF, 0x07, 0x42, 0x9C, 0x4C, 0x74, 0x68, 0xA1, 0x56, 0x2D,
+    0x74, 0x61, 0x57, 0xC0, 0x93, 0x21, 0x60, 0xD2, 0xFE, 0xC3, 0xA5, 0xE5,
+    0x8E, 0x0E, 0xB4, 0x80, 0x07, 0xD7, 0x08, 0xB7, 0xC5, 0x7B, 0x16, 0xBA,
+    0xA8, 0x3B, 0xD4, 0x83, 0xC9, 0xD1, 0xBF, 0xF6, 0x61, 0x1B, 0x59, 0x8E,
+    0xE4, 0x08, 0xA3, 0x8C, 0xCF, 0x09, 0x97, 0x2D, 0x11, 0x05, 0x1C, 0x4F,
+    0x48, 0xD0, 0xF4, 0x08, 0x8D, 0xC3, 0x6A, 0xD0, 0x22, 0x5C, 0x85, 0xE4,
+    0x3E, 0xB0, 0x97, 0x00, 0x36, 0xBE, 0x63, 0x0E, 0x7C, 0x75, 0xE5, 0x78,
+    0x01, 0xB3, 0xC0, 0xF1, 0x97, 0xA1, 0x03, 0x33, 0x49, 0x06, 0xFE, 0x7C,
+    0x37, 0xA1, 0x05, 0xC6, 0x8A, 0x99, 0xE1, 0x41, 0x8C, 0xCC, 0x09, 0x9E,
+    0x4A, 0x66, 0xA1, 0x72, 0x2A, 0xD0, 0x0C, 0xC7, 0x5C, 0xA9, 0x01, 0x6E,
+    0xD2, 0x80, 0xCD, 0x45, 0x23, 0xE3, 0x38, 0xB8, 0x0A, 0xB4, 0x98, 0x30,
+    0x02, 0xCB, 0x46, 0xCA, 0x46, 0x00, 0xBC, 0x0C, 0x68, 0x53, 0x28, 0xCD,
+    0xCB, 0x37, 0x96, 0x97, 0x63, 0x57, 0xDC, 0x71, 0xD2, 0x3B, 0x06, 0x4E,
+    0x50, 0x98, 0x63, 0x65, 0x44, 0x2E, 0xDF, 0xD8, 0x72, 0x8C, 0x04, 0x23,
+    0x99, 0xED, 0x1A, 0xDF, 0xA5, 0x9B, 0x11, 0x0F, 0x8B, 0x72, 0x1F, 0xBB,
+    0x97, 0xA3, 0xD1, 0x41, 0x6C, 0x24, 0xA7, 0x27, 0x02, 0x83, 0x87, 0x94,
+    0xA0, 0x48, 0x1F, 0xE9, 0x49, 0xBB, 0x27, 0x9C, 0x8A, 0x87, 0x08, 0x3C,
+    0x7A, 0x62, 0xFF, 0x62, 0x54, 0xF8, 0xCF, 0xB1, 0x7C, 0x8C, 0x58, 0xAE,
+    0xFC, 0xC9, 0x87, 0xFB, 0x45, 0x51, 0x29, 0x9F, 0xF2, 0x0A, 0x7A, 0x36,
+    0x18, 0x4C, 0x9D, 0x4A, 0xF5, 0x2C, 0xA3, 0xB9, 0x40, 0x75, 0xD7, 0x33,
+    0xEA, 0x8C, 0x52, 0x52, 0x5D, 0x8C, 0xE7, 0xD4, 0x4A, 0x02, 0x1E, 0x65,
+    0x32, 0x7D, 0xDE, 0xBD, 0x8F, 0x12, 0xF1, 0xD9, 0x9D, 0xED, 0x07, 0xE6,
+    0x67, 0xAA, 0x19, 0x54, 0x79, 0xB8, 0xA2, 0x98, 0x18, 0x9C, 0x14, 0x38,
+    0x0E, 0x19, 0x54, 0x46, 0xA9, 0x63, 0x9A, 0x54, 0x11, 0xC0, 0x20, 0x51,
+    0xDD, 0xB8, 0x2B, 0x33, 0x28, 0x72, 0x3D, 0x1F, 0x05, 0x8D, 0x66, 0x31,
+    0xA2, 0xB2, 0x72, 0x16, 0xB5, 0x67, 0xD2, 0x75, 0x5D, 0xB0, 0x55, 0x29,
+    0x27, 0xCB, 0x8D, 0xBB, 0xBA, 0x8C, 0x99, 0x65, 0xEF, 0x45, 0x02, 0x68,
+    0x3E, 0xE4, 0x7B, 0x8E, 0x34, 0xC1, 0xEB, 0xD7, 0xBE, 0x40, 0x55, 0x75,
+    0x8D, 0x1D, 0xC1, 0x48, 0x78, 0x88, 0x87, 0xA7, 0xA7, 0x4F, 0x66, 0x02,
+    0x47, 0x85, 0x55, 0x95, 0xCE, 0xCC, 0x89, 0x12, 0x00, 0x2C, 0xE4, 0x84,
+    0x65, 0xB3, 0x88, 0x6E, 0x0F, 0x6B, 0xEF, 0xEA, 0xCC, 0xF5, 0x5F, 0xB2,
+    0xDC, 0x73, 0x03, 0x05, 0x64, 0x18, 0x74, 0x03, 0x7A, 0x42, 0x82, 0x00,
+    0x87, 0x37, 0xB5, 0x83, 0x73, 0x4B, 0x79, 0x01, 0xBC, 0x61, 0x32, 0x64,
+    0xC2, 0x08, 0x55, 0xED, 0x34, 0x08, 0xB9, 0x0A, 0xD0, 0xC3, 0xC1, 0xCA,
+    0x80, 0x78, 0x39, 0x36, 0x01, 0x9D, 0x4C, 0x0D, 0x5A, 0x55, 0xC2, 0x14,
+    0xF9, 0xB4, 0x24, 0x10, 0xAB, 0x09, 0xC1, 0x2A, 0x20, 0x3A, 0x82, 0xD9,
+    0x4E, 0xC0, 0x95, 0x10, 0x68, 0xCB, 0x24, 0x75, 0x80, 0x56, 0x12, 0x5C,
+    0xB3, 0x72, 0xD9, 0x1E, 0xCA, 0x3D, 0x2E, 0x19, 0x69, 0x80, 0x23, 0x8E,
+    0xA1, 0xE3, 0x02, 0xC1, 0x1E, 0x70, 0x73, 0x40, 0x87, 0x98, 0x88, 0x2A,
+    0x2D, 0xA4, 0x31, 0x48, 0x83, 0x6B, 0x15, 0x83, 0x02, 0x82, 0xE1, 0x54,
+    0xC6, 0xDC, 0xFA, 0x0E, 0xA7, 0x0E, 0x08, 0xEE, 0x7D, 0x56, 0x72, 0xF0,
+    0xD9, 0x04, 0x01, 0x75, 0x00, 0x18, 0x21, 0x18, 0xFA, 0x46, 0x3A, 0x0D,
+    0x02, 0xF4, 0xB4, 0x15, 0x4F, 0x4D, 0x44, 0xE6, 0xBF, 0x57, 0x94, 0xDC,
+    0x9D, 0x27, 0x7A, 0x41, 0x94, 0x51, 0xEE, 0xF7, 0xFC, 0x2B, 0x45, 0xDA,
+    0x9A, 0x60, 0x0A, 0x2F, 0x5F, 0x45, 0x40, 0x7D, 0x90, 0xB9, 0x56, 0x8E,
+    0xE1, 0x8D, 0x1F, 0xF2, 0xD0, 0xE7, 0xBE, 0xB9, 0x82, 0xB3, 0x34, 0x83,
+    0xAB, 0xD0, 0xC4, 0x5A, 0xE9, 0x76, 0xE7, 0x95, 0xF3, 0x68, 0x79, 0x6D,
+    0x79, 0x39, 0x94, 0x39, 0x66, 0x5E, 0x4E, 0x24, 0x21, 0x12, 0xDD, 0x10,
+    0x6A, 0x8F, 0x02, 0x60, 0xA9, 0xA9, 0x0C, 0xA9, 0x47, 0x03, 0xFE, 0xFC,
+    0x48, 0x67, 0x14, 0x07, 0xA8, 0xD0, 0xE3, 0xD0, 0x86, 0x84, 0x93, 0x3A,
+    0x10, 0x06, 0xED, 0x49, 0x9F, 0x12, 0xB8, 0x4A, 0x0A, 0xEE, 0x2B, 0x95,
+    0x95, 0xCD, 0x2A, 0xE4, 0x32, 0x9C, 0xD9, 0x71, 0x2E, 0xF6, 0x35, 0xF2,
+    0x01, 0x4C, 0xE4, 0x01, 0x53, 0x1E, 0xEC, 0x44, 0x47, 0x4A, 0x9B, 0x18,
+    0x95, 0x0B, 0x19, 0xC6, 0x12, 0x31, 0xE3, 0xC4, 0x86, 0xE6, 0xC4, 0x4D,
+    0xA1, 0xE9, 0xF2, 0x4A, 0x4A, 0x48, 0x65, 0xA4, 0x09, 0x73, 0x9A, 0x68,
+    0xE4, 0x04, 0xE9, 0xFB, 0x19, 0xE2, 0x81, 0xC5, 0xBF, 0xA2, 0x5C, 0xA2,
+    0x0B, 0x9E, 0x75, 0xD0, 0xDC, 0x75, 0xD0, 0xD3, 0xAE, 0xBF, 0xEC, 0x93,
+    0x6D, 0xA9, 0x08, 0x16, 0x8F, 0x5C, 0x07, 0x4D, 0xBD, 0x9C, 0x40, 0x53,
+    0x2F, 0xAB, 0xC4, 0x45, 0x4D, 0xBD, 0x07, 0xA2, 0x6B, 0xEB, 0xDD, 0x20,
+    0x8E, 0x41, 0x90, 0xAA, 0x77, 0xC6, 0x7E, 0x79, 0x73, 0xF2, 0x11, 0xBA,
+    0xBC, 0xFB, 0x24, 0x76, 0x3D, 0x4B, 0xEC, 0x15, 0x3B, 0x92, 0x70, 0xE6,
+    0x8A, 0x05, 0x9D, 0x67, 0x18, 0x2A, 0x88, 0x4F, 0x4E, 0x14, 0x9E, 0x74,
+    0x59, 0xA7, 0xB4, 0x7D, 0x2D, 0x85, 0x6E, 0xC8, 0xCA, 0x7E, 0x30, 0xDD,
+    0x7C, 0xA8, 0x04, 0xD8, 0x7D, 0x78, 0x66, 0x2E, 0xB5, 0x2C, 0xD7, 0x03,
+    0xBF, 0xCA, 0x5B, 0xBB, 0x57, 0x04, 0x5E, 0x9E, 0x84, 0x90, 0xC4, 0x70,
+    0xB6, 0xC4, 0xD1, 0x52, 0x97, 0x47, 0xCC, 0xCD, 0x11, 0x58, 0xB8, 0xD1,
+    0x7B, 0x50, 0xB4, 0x47, 0xE9, 0xD0, 0xB2, 0x62, 0xD4, 0x5E, 0xF9, 0xFB,
+    0x64, 0xA1, 0xAF, 0x93, 0x44, 0x5F, 0x34, 0x7F, 0x29, 0x1A, 0xAC, 0x93,
+    0x5C, 0x26, 0x23, 0xFA, 0xC8, 0xC3, 0x31, 0x97, 0x7F, 0xAB, 0xAC, 0xFC,
+    0x13, 0x65, 0x07, 0xFB, 0xE5, 0xDF, 0x6A, 0xFB, 0x7F, 0x28, 0x41, 0xAF,
+    0x92, 0xCE, 0x4D, 0x00, 0x00
+};
+
+static const char index_html_identity_hdr_ok[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: text/html\r\n"
+    "Content-Length: 19918\r\n"
+    "Vary: Accept-Encoding\r\n"
+    "ETag: \"770c03de48386a40\"\r\n"
+    "Cache-Control: no-cache\r\n"
+    "Connection: close\r\n"
+    "\r\n";
+static const char index_html_identity_hdr_ok_ka[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: text/html\r\n"
+    "Content-Length: 19918\r\n"
+    "Vary: Accept-Encoding\r\n"
+    "ETag: \"770c03de48386a40\"\r\n"
+    "Cache-Control: no-cache\r\n"
+    "Connection: keep-alive\r\n"
+    "Keep-Alive: timeout=5\r\n"
+    "\r\n";
+static const char index_html_identity_hdr_nm[] =
+    "HTTP/1.1 304 Not Modified\r\n"
+    "Vary: Accept-Encoding\r\n"
+    "ETag: \"770c03de48386a40\"\r\n"
+    "Cache-Control: no-cache\r\n"
+    "Connection: close\r\n"
+    "\r\n";
+static const char index_html_identity_hdr_nm_ka[] =
+    "HTTP/1.1 304 Not Modified\r\n"
+    "Vary: Accept-Encoding\r\n"
+    "ETag: \"770c03de48386a40\"\r\n"
+    "Cache-Control: no-cache\r\n"
+    "Connection: keep-alive\r\n"
+    "Keep-Alive: timeout=5\r\n"
+    "\r\n";
+static const char index_html_gzip_hdr_ok[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: text/html\r\n"
+    "Content-Length: 3857\r\n"
+    "Content-Encoding: gzip\r\n"
+    "Vary: Accept-Encoding\r\n"
+    "ETag: \"770c03de48386a40-gz\"\r\n"
+    "Cache-Control: no-cache\r\n"
+    "Connection: close\r\n"
+    "\r\n";
+static const char index_html_gzip_hdr_ok_ka[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: text/html\r\n"
+    "Content-Length: 3857\r\n"
+    "Content-Encoding: gzip\r\n"
+    "Vary: Accept-Encoding\r\n"
+    "ETag: \"770c03de48386a40-gz\"\r\n"
+    "Cache-Control: no-cache\r\n"
+    "Connection: keep-alive\r\n"
+    "Keep-Alive: timeout=5\r\n"
+    "\r\n";
+static const char index_html_gzip_hdr_nm[] =
+    "HTTP/1.1 304 Not Modified\r\n"
+    "Vary: Accept-Encoding\r\n"
+    "ETag: \"770c03de48386a40-gz\"\r\n"
+    "Cache-Control: no-cache\r\n"
+    "Connection: close\r\n"
+    "\r\n";
+static const char index_html_gzip_hdr_nm_ka[] =
+    "HTTP/1.1 304 Not Modified\r\n"
+    "Vary: Accept-Encoding\r\n"
+    "ETag: \"770c03de48386a40-gz\"\r\n"
+    "Cache-Control: no-cache\r\n"
+    "Connection: keep-alive\r\n"
+    "Keep-Alive: timeout=5\r\n"
+    "\r\n";
 
 // 임베드된 파일 테이블
 const embedded_file_t embedded_files[] = {
-    {"/index.html", "text/html", index_html_data, 7922, 42906, true},
-    {"/", "text/html", index_html_data, 7922, 42906, true}
+    {"/assets/app.85d26ff2.css", "text/css", 8671, {{assets_app_85d26ff2_css_identity_data, 8671, "\"85d26ff26c47f5f2\"", {{assets_app_85d26ff2_css_identity_hdr_ok, sizeof(assets_app_85d26ff2_css_identity_hdr_ok) - 1}, {assets_app_85d26ff2_css_identity_hdr_ok_ka, sizeof(assets_app_85d26ff2_css_identity_hdr_ok_ka) - 1}, {assets_app_85d26ff2_css_identity_hdr_nm, sizeof(assets_app_85d26ff2_css_identity_hdr_nm) - 1}, {assets_app_85d26ff2_css_identity_hdr_nm_ka, sizeof(assets_app_85d26ff2_css_identity_hdr_nm_ka) - 1}}}, {assets_app_85d26ff2_css_gzip_data, 2208, "\"85d26ff26c47f5f2-gz\"", {{assets_app_85d26ff2_css_gzip_hdr_ok, sizeof(assets_app_85d26ff2_css_gzip_hdr_ok) - 1}, {assets_app_85d26ff2_css_gzip_hdr_ok_ka, sizeof(assets_app_85d26ff2_css_gzip_hdr_ok_ka) - 1}, {assets_app_85d26ff2_css_gzip_hdr_nm, sizeof(assets_app_85d26ff2_css_gzip_hdr_nm) - 1}, {assets_app_85d26ff2_css_gzip_hdr_nm_ka, sizeof(assets_app_85d26ff2_css_gzip_hdr_nm_ka) - 1}}}, {NULL, 0, NULL, {{NULL, 0}}}}, true},
+    {"/assets/app.8864ee4b.js", "application/javascript", 8651, {{assets_app_8864ee4b_js_identity_data, 8651, "\"8864ee4b07b0e610\"", {{assets_app_8864ee4b_js_identity_hdr_ok, sizeof(assets_app_8864ee4b_js_identity_hdr_ok) - 1}, {assets_app_8864ee4b_js_identity_hdr_ok_ka, sizeof(assets_app_8864ee4b_js_identity_hdr_ok_ka) - 1}, {assets_app_8864ee4b_js_identity_hdr_nm, sizeof(assets_app_8864ee4b_js_identity_hdr_nm) - 1}, {assets_app_8864ee4b_js_identity_hdr_nm_ka, sizeof(assets_app_8864ee4b_js_identity_hdr_nm_ka) - 1}}}, {assets_app_8864ee4b_js_gzip_data, 2038, "\"8864ee4b07b0e610-gz\"", {{assets_app_8864ee4b_js_gzip_hdr_ok, sizeof(assets_app_8864ee4b_js_gzip_hdr_ok) - 1}, {assets_app_8864ee4b_js_gzip_hdr_ok_ka, sizeof(assets_app_8864ee4b_js_gzip_hdr_ok_ka) - 1}, {assets_app_8864ee4b_js_gzip_hdr_nm, sizeof(assets_app_8864ee4b_js_gzip_hdr_nm) - 1}, {assets_app_8864ee4b_js_gzip_hdr_nm_ka, sizeof(assets_app_8864ee4b_js_gzip_hdr_nm_ka) - 1}}}, {NULL, 0, NULL, {{NULL, 0}}}}, true},
+    {"/index.html", "text/html", 19918, {{index_html_identity_data, 19918, "\"770c03de48386a40\"", {{index_html_identity_hdr_ok, sizeof(index_html_identity_hdr_ok) - 1}, {index_html_identity_hdr_ok_ka, sizeof(index_html_identity_hdr_ok_ka) - 1}, {index_html_identity_hdr_nm, sizeof(index_html_identity_hdr_nm) - 1}, {index_html_identity_hdr_nm_ka, sizeof(index_html_identity_hdr_nm_ka) - 1}}}, {index_html_gzip_data, 3857, "\"770c03de48386a40-gz\"", {{index_html_gzip_hdr_ok, sizeof(index_html_gzip_hdr_ok) - 1}, {index_html_gzip_hdr_ok_ka, sizeof(index_html_gzip_hdr_ok_ka) - 1}, {index_html_gzip_hdr_nm, sizeof(index_html_gzip_hdr_nm) - 1}, {index_html_gzip_hdr_nm_ka, sizeof(index_html_gzip_hdr_nm_ka) - 1}}}, {NULL, 0, NULL, {{NULL, 0}}}}, false},
+    {"/", "text/html", 19918, {{index_html_identity_data, 19918, "\"770c03de48386a40\"", {{index_html_identity_hdr_ok, sizeof(index_html_identity_hdr_ok) - 1}, {index_html_identity_hdr_ok_ka, sizeof(index_html_identity_hdr_ok_ka) - 1}, {index_html_identity_hdr_nm, sizeof(index_html_identity_hdr_nm) - 1}, {index_html_identity_hdr_nm_ka, sizeof(index_html_identity_hdr_nm_ka) - 1}}}, {index_html_gzip_data, 3857, "\"770c03de48386a40-gz\"", {{index_html_gzip_hdr_ok, sizeof(index_html_gzip_hdr_ok) - 1}, {index_html_gzip_hdr_ok_ka, sizeof(index_html_gzip_hdr_ok_ka) - 1}, {index_html_gzip_hdr_nm, sizeof(index_html_gzip_hdr_nm) - 1}, {index_html_gzip_hdr_nm_ka, sizeof(index_html_gzip_hdr_nm_ka) - 1}}}, {NULL, 0, NULL, {{NULL, 0}}}}, false}
 };
 
-const size_t embedded_files_count = 2;
+const size_t embedded_files_count = 4;
 
 #include <string.h>
 
@@ -700,21 +4048,47 @@ const char* get_content_type(const char* file_path) {
     return "application/octet-stream";
 }
 
-// 임베드된 파일 찾기 (Content-Type 포함)
-const char* get_embedded_file_with_content_type(const char* path, size_t* file_size, bool* is_compressed, size_t* original_size, const char** content_type) {
-    if (!path || !file_size || !is_compressed || !original_size || !content_type) {
+// Content-Encoding 헤더 값
+const char* embedded_encoding_name(embedded_encoding_t encoding) {
+    switch (encoding) {
+        case EMBEDDED_ENCODING_GZIP: return "gzip";
+        case EMBEDDED_ENCODING_BR:   return "br";
+        default:                     return "identity";
+    }
+}
+
+// 임베드된 파일 항목 찾기
+const embedded_file_t* find_embedded_file(const char* path) {
+    if (!path) {
         return NULL;
     }
     
     for (size_t i = 0; i < embedded_files_count; i++) {
         if (strcmp(embedded_files[i].path, path) == 0) {
-            *file_size = embedded_files[i].size;
-            *original_size = embedded_files[i].original_size;
-            *is_compressed = embedded_files[i].is_compressed;
-            *content_type = embedded_files[i].content_type;
-            return (const char*)embedded_files[i].data;
+            return &embedded_files[i];
         }
     }
     
     return NULL;
 }
+
+// 임베드된 파일 찾기 (Content-Type 포함, gzip 변형이 있으면 gzip)
+const char* get_embedded_file_with_content_type(const char* path, size_t* file_size, bool* is_compressed, size_t* original_size, const char** content_type) {
+    if (!path || !file_size || !is_compressed || !original_size || !content_type) {
+        return NULL;
+    }
+    
+    const embedded_file_t* file = find_embedded_file(path);
+    if (!file) {
+        return NULL;
+    }
+    const embedded_variant_t* variant = &file->variants[EMBEDDED_ENCODING_GZIP];
+    *is_compressed = variant->data != NULL;
+    if (!*is_compressed) {
+        variant = &file->variants[EMBEDDED_ENCODING_IDENTITY];
+    }
+    *file_size = variant->size;
+    *original_size = file->original_size;
+    *content_type = file->content_type;
+    return (const char*)variant->data;
+}
@@ -5,20 +5,55 @@
 #include <stddef.h>
 #include <stdbool.h>
 
+// 미리 만든 헤더의 Keep-Alive timeout (초)
+#define EMBEDDED_KEEP_ALIVE_TIMEOUT_S 5
+
+// 전송 인코딩 (Content-Encoding 값)
+typedef enum {
+    EMBEDDED_ENCODING_IDENTITY = 0,     // 압축 안 함 (항상 있음)
+    EMBEDDED_ENCODING_GZIP,
+    EMBEDDED_ENCODING_BR,
+    EMBEDDED_ENCODING_COUNT
+} embedded_encoding_t;
+
+// 미리 만든 응답 헤더 종류 (상태 코드 x Connection)
+typedef enum {
+    EMBEDDED_HEADER_OK = 0,                     // 200, Connection: close
+    EMBEDDED_HEADER_OK_KEEP_ALIVE,              // 200, Connection: keep-alive
+    EMBEDDED_HEADER_NOT_MODIFIED,               // 304, Connection: close
+    EMBEDDED_HEADER_NOT_MODIFIED_KEEP_ALIVE,    // 304, Connection: keep-alive
+    EMBEDDED_HEADER_COUNT
+} embedded_header_kind_t;
+
+// 전송 준비가 끝난 응답 헤더 (상태 줄부터 빈 줄까지)
+typedef struct {
+    const char* data;
+    uint16_t len;
+} embedded_header_t;
+
+// 인코딩 변형 하나
+typedef struct {
+    const uint8_t* data;    // NULL이면 이 인코딩 없음 (원본보다 크거나 생성하지 않음)
+    size_t size;
+    const char* etag;       // 내용 해시 + 인코딩 (따옴표 포함, ETag 헤더 값)
+    embedded_header_t headers[EMBEDDED_HEADER_COUNT];
+} embedded_variant_t;
+
 // 임베드된 파일 구조체
 typedef struct {
     const char* path;
     const char* content_type;
-    const uint8_t* data;
-    size_t size;
     size_t original_size;
-    bool is_compressed;
+    embedded_variant_t variants[EMBEDDED_ENCODING_COUNT];
+    bool immutable;         // 파일 이름에 내용 해시 포함 (영구 캐시)
 } embedded_file_t;
 
-extern const uint8_t index_html_data[];
-extern const size_t index_html_size;
-extern const size_t index_html_original_size;
-extern const bool index_html_is_compressed;
+extern const uint8_t assets_app_85d26ff2_css_identity_data[];
+extern const uint8_t assets_app_85d26ff2_css_gzip_data[];
+extern const uint8_t assets_app_8864ee4b_js_identity_data[];
+extern const uint8_t assets_app_8864ee4b_js_gzip_data[];
+extern const uint8_t index_html_identity_data[];
+extern const uint8_t index_html_gzip_data[];
 
 // 임베드된 파일 테이블
 extern const embedded_file_t embedded_files[];
@@ -26,6 +61,8 @@ extern const size_t embedded_files_count;
 
 // 함수 선언
 const char* get_content_type(const char* file_path);
+const char* embedded_encoding_name(embedded_encoding_t encoding);
+const embedded_file_t* find_embedded_file(const char* path);
 const char* get_embedded_file_with_content_type(const char* path, size_t* file_size, bool* is_compressed, size_t* original_size, const char** content_type);
 
 #endif // STATIC_FILES_H
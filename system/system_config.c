@@ -3,6 +3,7 @@
 #include "hardware/flash.h"
 #include "hardware/sync.h"
 #include "pico/stdlib.h"
+#include <stddef.h>
 #include <string.h>
 
 // =============================================================================
@@ -36,6 +37,43 @@ static uint32_t calculate_checksum(const system_config_t* config) {
     return checksum;
 }
 
+// 이전 버전 설정의 크기 (checksum 앞까지, 새 필드는 항상 checksum 직전에 추가)
+// 0이면 변환할 수 없는 버전
+static size_t legacy_config_size(uint32_t version) {
+    switch (version) {
+        case 1: return offsetof(system_config_t, history_enabled);
+        default: return 0;
+    }
+}
+
+// 이전 버전 설정을 현재 버전으로 변환 (앞부분은 그대로, 새 필드는 기본값)
+static bool system_config_migrate(const system_config_t* flash_config) {
+    size_t legacy_size = legacy_config_size(flash_config->version);
+    if (legacy_size == 0) {
+        return false;
+    }
+
+    // 이전 버전의 체크섬은 앞부분 바로 뒤에 저장됨
+    const uint32_t* words = (const uint32_t*)flash_config;
+    uint32_t calculated_checksum = 0;
+    for (size_t i = 0; i < legacy_size / sizeof(uint32_t); i++) {
+        calculated_checksum ^= words[i];
+    }
+    if (words[legacy_size / sizeof(uint32_t)] != calculated_checksum) {
+        DBG_MAIN_PRINT("Checksum mismatch in v%u config, using defaults\n", flash_config->version);
+        return false;
+    }
+
+    uint32_t old_version = flash_config->version;
+    system_config_reset_to_defaults();
+    memcpy(&g_system_config, flash_config, legacy_size);
+    g_system_config.version = SYSTEM_CONFIG_VERSION;
+    system_config_save_to_flash();
+
+    DBG_MAIN_PRINT("System config migrated from v%u to v%u\n", old_version, SYSTEM_CONFIG_VERSION);
+    return true;
+}
+
 // =============================================================================
 // 공개 함수
 // =============================================================================
@@ -80,6 +118,18 @@ void system_config_reset_to_defaults(void) {
     // 디버그 플래그 기본값 (모두 활성화)
     g_system_config.debug_flags = 0xFFFFFFFF;
     
+    // 입력 변화 기록 기본값 (비활성화)
+    g_system_config.history_enabled = false;
+    
+    // TCP 송신 큐 정책 기본값 (오래된 알림 버림)
+    g_system_config.tcp_tx_policy = 0;
+    
+    // TCP 무활동 종료 기본값 (사용 안 함, 끊긴 상대는 keepalive로 정리)
+    g_system_config.tcp_idle_timeout_s = 0;
+    
+    // 소켓 프로파일 기본값 (모든 소켓 2KB, 기존 배치)
+    g_system_config.socket_profile = 0;
+    
     // 체크섬 계산
     g_system_config.checksum = calculate_checksum(&g_system_config);
     
@@ -120,6 +170,10 @@ bool system_config_load_from_flash(void) {
     
     // 버전 확인
     if (flash_config->version != SYSTEM_CONFIG_VERSION) {
+        // 이전 버전은 네트워크/포트 등 기존 설정을 유지한 채 변환
+        if (system_config_migrate(flash_config)) {
+            return true;
+        }
         DBG_MAIN_PRINT("Config version mismatch (%u != %u), using defaults\n", 
                        flash_config->version, SYSTEM_CONFIG_VERSION);
         system_config_reset_to_defaults();
@@ -220,3 +274,35 @@ uint32_t system_config_get_debug_flags(void) {
 void system_config_set_debug_flags(uint32_t flags) {
     g_system_config.debug_flags = flags;
 }
+
+bool system_config_get_history_enabled(void) {
+    return g_system_config.history_enabled;
+}
+
+void system_config_set_history_enabled(bool enabled) {
+    g_system_config.history_enabled = enabled;
+}
+
+uint8_t system_config_get_tcp_tx_policy(void) {
+    return g_system_config.tcp_tx_policy;
+}
+
+void system_config_set_tcp_tx_policy(uint8_t policy) {
+    g_system_config.tcp_tx_policy = policy;
+}
+
+uint16_t system_config_get_tcp_idle_timeout(void) {
+    return g_system_config.tcp_idle_timeout_s;
+}
+
+void system_config_set_tcp_idle_timeout(uint16_t seconds) {
+    g_system_config.tcp_idle_timeout_s = seconds;
+}
+
+uint8_t system_config_get_socket_profile(void) {
+    return g_system_config.socket_profile;
+}
+
+void system_config_set_socket_profile(uint8_t profile) {
+    g_system_config.socket_profile = profile;
+}
@@ -12,7 +12,8 @@ extern "C"
 #endif
 
 // 시스템 설정 버전 (구조체가 변경될 때마다 증가)
-#define SYSTEM_CONFIG_VERSION 1
+// 새 필드는 checksum 직전에 추가하고 이전 버전 크기는 legacy_config_size()에 등록 (로드 시 변환)
+#define SYSTEM_CONFIG_VERSION 2
 
 // 시스템 전체 설정 구조체
 typedef struct
@@ -45,6 +46,18 @@ typedef struct
     // 디버그 플래그
     uint32_t debug_flags;
     
+    // 입력 변화 기록 (플래시 링)
+    bool history_enabled;
+    
+    // TCP 송신 큐가 가득 찼을 때 정책 (tcp_tx_policy_t)
+    uint8_t tcp_tx_policy;
+    
+    // TCP 클라이언트 무활동 종료 시간 (초, 0 = 사용 안 함)
+    uint16_t tcp_idle_timeout_s;
+    
+    // W5500 소켓 버퍼/역할 프로파일 (socket_profile_t, 재시작 후 적용)
+    uint8_t socket_profile;
+    
     // 체크섬 (구조체 전체의 간단한 체크섬)
     uint32_t checksum;
 } system_config_t;
@@ -69,6 +82,14 @@ bool system_config_get_multicast_enabled(void);
 void system_config_set_multicast_enabled(bool enabled);
 uint32_t system_config_get_debug_flags(void);
 void system_config_set_debug_flags(uint32_t flags);
+bool system_config_get_history_enabled(void);
+void system_config_set_history_enabled(bool enabled);
+uint8_t system_config_get_tcp_tx_policy(void);
+void system_config_set_tcp_tx_policy(uint8_t policy);
+uint16_t system_config_get_tcp_idle_timeout(void);
+void system_config_set_tcp_idle_timeout(uint16_t seconds);
+uint8_t system_config_get_socket_profile(void);
+void system_config_set_socket_profile(uint8_t profile);
 
 #ifdef __cplusplus
 }
@@ -3,9 +3,388 @@
 #include "handlers/command_handler.h"
 #include "gpio/gpio.h"
 #include "led/status_led.h"
+#include "network/socket_pool.h"
+#include <stdlib.h>
 // 필요 라이브러리 include는 헤더에서 처리됨
 uint16_t tcp_port = 5050;
 
+// 소켓별 클라이언트 상태 (줄 단위 명령어 조립 + 송신 큐)
+typedef struct {
+    uint8_t sn;              // 담당 W5500 소켓
+    bool attached;           // 소켓 풀에서 받은 소켓에 연결됨
+
+    // 수신: 읽어 온 데이터 중 아직 처리하지 않은 부분 (송신 큐가 찰 때 보관)
+    uint8_t rx_buf[512];
+    uint16_t rx_len;
+    uint16_t rx_pos;
+    char line[TCP_LINE_BUF_SIZE];
+    uint16_t line_len;
+    bool overflow;           // 최대 길이 초과, 다음 줄바꿈까지 버림
+    uint32_t last_rx_ms;     // 미완성 줄의 마지막 수신 시각
+
+    // 송신: W5500 TX 메모리에 들어가지 못한 데이터 (원형 버퍼)
+    uint8_t tx_buf[TCP_TX_RING_SIZE];
+    uint8_t tx_notify_map[TCP_TX_RING_SIZE / 8];    // tx_buf 바이트별 알림 표시 (drop 정책은 알림 줄만 버림)
+    uint16_t tx_tail;        // 가장 오래된 데이터 위치
+    uint16_t tx_count;       // 대기 중인 바이트
+    uint16_t tx_uncommitted; // 칩에 썼지만 아직 SEND 하지 않은 바이트
+    uint16_t tx_send_seq;    // SEND 명령 실행 횟수 (응답 되돌리기 가능 여부 판단)
+    uint8_t tx_cork;         // cork 깊이 (0보다 크면 SEND 보류, 데이터만 기록)
+    bool tx_sending;         // SEND 진행 중 (SENDOK 대기)
+    bool tx_partial;         // 큐의 첫 줄이 일부만 전송됨
+    bool tx_resync;          // coalesce 정책: 알림을 버렸으므로 현재 상태 재전송 필요
+    bool tx_defer;           // 명령어 실행 중: 알림은 tx_deferred에 모았다가 응답 뒤에 전송
+    uint8_t tx_deferred[TCP_TX_DEFERRED_SIZE];
+    uint16_t tx_deferred_len;
+
+    // 이벤트 구독
+    uint8_t sub_events;      // TCP_EVENT_* 비트
+    uint16_t sub_channels;   // 채널 마스크 (bit0 = 채널 1)
+
+    // 연결 통계 (시각은 부팅 후 ms)
+    uint32_t connect_ms;
+    uint32_t last_activity_ms;
+    tcp_client_stats_t stats;
+} tcp_client_t;
+
+static tcp_client_t tcp_clients[TCP_CLIENT_MAX];
+static uint32_t tcp_tx_disconnects = 0;   // 느린 클라이언트 강제 종료 횟수 (누적)
+static uint32_t tcp_idle_reaped = 0;      // 무활동 종료 횟수 (누적)
+static bool tcp_servers_started = false;
+
+static void tcp_client_reset(tcp_client_t* client) {
+    client->rx_len = 0;
+    client->rx_pos = 0;
+    client->line_len = 0;
+    client->overflow = false;
+    client->last_rx_ms = 0;
+    client->tx_tail = 0;
+    client->tx_count = 0;
+    client->tx_uncommitted = 0;
+    client->tx_send_seq = 0;
+    client->tx_cork = 0;
+    client->tx_sending = false;
+    client->tx_partial = false;
+    client->tx_resync = false;
+    client->tx_defer = false;
+    client->tx_deferred_len = 0;
+    client->sub_events = TCP_EVENT_DEFAULT;
+    client->sub_channels = 0xFFFF;
+    client->connect_ms = 0;
+    client->last_activity_ms = 0;
+    memset(&client->stats, 0, sizeof(client->stats));
+}
+
+// 서버 소켓 열기 (keepalive 설정 후 대기)
+// 전원이 꺼진 상대처럼 FIN 없이 사라진 연결은 keepalive 응답이 없어 타임아웃으로 닫힘
+static void tcp_server_listen(uint8_t sn, uint16_t port) {
+    socket(sn, Sn_MR_TCP, port, 0x00);
+    setSn_KPALVTR(sn, TCP_KEEPALIVE_UNITS);
+    listen(sn);
+}
+
+static tcp_client_t* tcp_client_get(uint8_t sn) {
+    for (uint8_t k = 0; k < TCP_CLIENT_MAX; k++) {
+        if (tcp_clients[k].attached && tcp_clients[k].sn == sn) {
+            return &tcp_clients[k];
+        }
+    }
+    return NULL;
+}
+
+// 소켓을 빈 클라이언트 슬롯에 연결
+static tcp_client_t* tcp_client_attach(uint8_t sn) {
+    for (uint8_t k = 0; k < TCP_CLIENT_MAX; k++) {
+        if (!tcp_clients[k].attached) {
+            tcp_clients[k].sn = sn;
+            tcp_clients[k].attached = true;
+            tcp_client_reset(&tcp_clients[k]);
+            return &tcp_clients[k];
+        }
+    }
+    return NULL;
+}
+
+// 요청 시 할당받은 소켓을 닫고 풀에 반환
+static void tcp_client_detach(tcp_client_t* client) {
+    close(client->sn);
+    tcp_client_reset(client);
+    client->attached = false;
+    socket_pool_release(client->sn);
+}
+
+static inline uint8_t tcp_tx_peek(const tcp_client_t* client, uint16_t index) {
+    return client->tx_buf[(client->tx_tail + index) % TCP_TX_RING_SIZE];
+}
+
+static inline bool tcp_tx_is_notify(const tcp_client_t* client, uint16_t index) {
+    uint16_t pos = (client->tx_tail + index) % TCP_TX_RING_SIZE;
+    return (client->tx_notify_map[pos >> 3] >> (pos & 7)) & 1;
+}
+
+static inline void tcp_tx_mark(tcp_client_t* client, uint16_t pos, bool notify) {
+    if (notify) {
+        client->tx_notify_map[pos >> 3] |= (uint8_t)(1u << (pos & 7));
+    } else {
+        client->tx_notify_map[pos >> 3] &= (uint8_t)~(1u << (pos & 7));
+    }
+}
+
+// 큐에서 가장 오래된 (전송이 시작되지 않은) 알림 한 줄 제거
+// 명령어 응답 줄은 클라이언트가 기다리고 있으므로 버리지 않음 (알림 줄이 없으면 false)
+static bool tcp_tx_drop_oldest_notification(tcp_client_t* client) {
+    uint16_t start = 0;
+    if (client->tx_partial) {
+        // 일부 전송된 줄의 나머지는 유지 (스트림이 깨지지 않도록)
+        while (start < client->tx_count && tcp_tx_peek(client, start) != '\n') start++;
+        start++;
+    }
+
+    uint16_t end;
+    for (;;) {
+        if (start >= client->tx_count) {
+            return false;
+        }
+        end = start;
+        while (end < client->tx_count && tcp_tx_peek(client, end) != '\n') end++;
+        if (end < client->tx_count) end++;
+        if (tcp_tx_is_notify(client, start)) {
+            break;
+        }
+        start = end;
+    }
+    uint16_t removed = end - start;
+
+    // 앞쪽에 남길 데이터(와 알림 표시)를 제거한 구간만큼 뒤로 이동
+    for (int k = (int)start - 1; k >= 0; k--) {
+        uint16_t from = (client->tx_tail + k) % TCP_TX_RING_SIZE;
+        uint16_t to = (client->tx_tail + k + removed) % TCP_TX_RING_SIZE;
+        client->tx_buf[to] = client->tx_buf[from];
+        tcp_tx_mark(client, to, tcp_tx_is_notify(client, (uint16_t)k));
+    }
+    client->tx_tail = (client->tx_tail + removed) % TCP_TX_RING_SIZE;
+    client->tx_count -= removed;
+    return true;
+}
+
+static void tcp_tx_enqueue(tcp_client_t* client, const uint8_t* data, uint16_t len, bool notify) {
+    uint16_t head = (client->tx_tail + client->tx_count) % TCP_TX_RING_SIZE;
+    uint16_t first = TCP_TX_RING_SIZE - head;
+    if (first > len) first = len;
+    memcpy(&client->tx_buf[head], data, first);
+    memcpy(&client->tx_buf[0], data + first, len - first);
+    for (uint16_t k = 0; k < len; k++) {
+        tcp_tx_mark(client, (head + k) % TCP_TX_RING_SIZE, notify);
+    }
+    client->tx_count += len;
+    if (client->tx_count > client->stats.tx_peak) {
+        client->stats.tx_peak = client->tx_count;
+    }
+}
+
+// 현재 입력 상태 스냅샷 (coalesce 정책에서 버린 알림을 대신함)
+static uint16_t tcp_format_input_snapshot(char* buf, size_t size) {
+    uint16_t data = gpio_input_data;
+    if (get_gpio_rt_mode() == GPIO_RT_MODE_CHANNEL) {
+        char binary_str[17];
+        for (int i = 0; i < 16; i++) {
+            binary_str[i] = (data & (1 << i)) ? '1' : '0';
+        }
+        binary_str[16] = '\0';
+        return (uint16_t)snprintf(buf, size, "inputs_ch,%d,%s\r\n", get_gpio_device_id(), binary_str);
+    }
+    return (uint16_t)snprintf(buf, size, "input_bytes,%d,%d,%d\r\n",
+                              get_gpio_device_id(), data & 0xFF, (data >> 8) & 0xFF);
+}
+
+// 송신 큐를 W5500 TX 메모리로 옮기고 SEND 명령 실행 (블로킹 없음)
+static void tcp_client_drain(uint8_t sn, tcp_client_t* client) {
+    // 이전 SEND 완료 확인
+    if (client->tx_sending) {
+        uint8_t ir = getSn_IR(sn);
+        if (ir & Sn_IR_SENDOK) {
+            setSn_IR(sn, Sn_IR_SENDOK);
+            client->tx_sending = false;
+            client->last_activity_ms = to_ms_since_boot(get_absolute_time());
+        } else if (ir & Sn_IR_TIMEOUT) {
+            return; // 소켓이 닫히면 상태 처리에서 정리
+        }
+    }
+
+    // coalesce: 큐가 비었으면 버린 알림 대신 현재 상태 전송
+    if (client->tx_resync && client->tx_count == 0) {
+        char snapshot[48];
+        uint16_t len = tcp_format_input_snapshot(snapshot, sizeof(snapshot));
+        tcp_tx_enqueue(client, (const uint8_t*)snapshot, len, true);
+        client->tx_resync = false;
+    }
+
+    if (client->tx_count > 0) {
+        // SEND 전인 데이터도 TX 메모리를 차지하므로 보수적으로 계산
+        uint16_t free_size = getSn_TX_FSR(sn);
+        free_size = free_size > client->tx_uncommitted ? free_size - client->tx_uncommitted : 0;
+        uint16_t n = client->tx_count < free_size ? client->tx_count : free_size;
+
+        // 가능하면 줄 단위로 끊어서 전송
+        if (n > 0 && n < client->tx_count) {
+            uint16_t k = n;
+            while (k > 0 && tcp_tx_peek(client, k - 1) != '\n') k--;
+            if (k > 0) n = k;
+        }
+
+        if (n > 0) {
+            uint16_t first = TCP_TX_RING_SIZE - client->tx_tail;
+            if (first > n) first = n;
+            wiz_send_data(sn, &client->tx_buf[client->tx_tail], first);
+            if (n > first) {
+                wiz_send_data(sn, &client->tx_buf[0], n - first);
+            }
+            client->tx_partial = tcp_tx_peek(client, n - 1) != '\n';
+            client->tx_tail = (client->tx_tail + n) % TCP_TX_RING_SIZE;
+            client->tx_count -= n;
+            client->tx_uncommitted += n;
+            client->stats.tx_bytes += n;
+        }
+    }
+
+    // 한 번에 하나의 SEND만 진행 (SENDOK 이후 다음 SEND), cork 중에는 보류
+    if (!client->tx_sending && client->tx_cork == 0 && client->tx_uncommitted > 0) {
+        setSn_CR(sn, Sn_CR_SEND);
+        while (getSn_CR(sn));
+        client->tx_sending = true;
+        client->tx_uncommitted = 0;
+        client->tx_send_seq++;
+    }
+}
+
+// cork: 응답과 알림을 TX 메모리에 모아 두고 uncork 시 SEND 한 번으로 전송
+// (응답 본문과 줄바꿈이 별도 세그먼트로 나가지 않도록 함, 중첩 가능)
+static inline void tcp_client_cork(tcp_client_t* client) {
+    client->tx_cork++;
+}
+
+static void tcp_client_uncork(uint8_t sn, tcp_client_t* client) {
+    if (client->tx_cork > 0 && --client->tx_cork == 0) {
+        tcp_client_drain(sn, client);
+    }
+}
+
+// 송신 데이터 기록 (SEND 없음): 큐가 비어 있으면 W5500 TX 메모리에 바로 쓰고,
+// 칩에 들어가지 않는 나머지는 큐 뒤에 붙임 (전송 순서 유지). 큐가 넘치면 잘림
+// notify: 비동기 알림 (큐에서 drop 정책 대상), false면 명령어 응답
+static uint16_t tcp_client_put(uint8_t sn, tcp_client_t* client, const uint8_t* data, uint16_t len, bool notify) {
+    uint16_t direct = 0;
+    if (client->tx_count == 0) {
+        uint16_t free_size = getSn_TX_FSR(sn);
+        free_size = free_size > client->tx_uncommitted ? free_size - client->tx_uncommitted : 0;
+        direct = len < free_size ? len : free_size;
+        if (direct > 0) {
+            wiz_send_data(sn, (uint8_t*)data, direct);
+            client->tx_uncommitted += direct;
+            client->stats.tx_bytes += direct;
+            client->tx_partial = data[direct - 1] != '\n';
+        }
+    }
+
+    uint16_t rest = len - direct;
+    if (rest > TCP_TX_RING_SIZE - client->tx_count) {
+        client->stats.tx_dropped++;
+        rest = TCP_TX_RING_SIZE - client->tx_count;
+    }
+    if (rest > 0) {
+        tcp_tx_enqueue(client, data + direct, rest, notify);
+    }
+    return direct + rest;
+}
+
+// 클라이언트 송신 (응답: notify=false, 비동기 알림: notify=true)
+// 큐가 가득 차면 알림은 설정된 정책에 따라 처리하고, 응답은 넘치는 부분만 버림
+static bool tcp_client_write(uint8_t sn, const uint8_t* data, uint16_t len, bool notify) {
+    tcp_client_t* client = tcp_client_get(sn);
+
+    if (notify && client->tx_resync) {
+        // 상태 스냅샷으로 대체될 예정이므로 중간 알림은 생략
+        client->stats.tx_coalesced++;
+        return false;
+    }
+
+    if (notify && client->tx_defer) {
+        // 명령어 실행 중 알림: 오류 시 되돌릴 수 있는 응답 구간에 섞이지 않도록 응답 뒤로 미룸
+        if (len > TCP_TX_DEFERRED_SIZE - client->tx_deferred_len) {
+            client->stats.tx_dropped++;
+            return false;
+        }
+        memcpy(&client->tx_deferred[client->tx_deferred_len], data, len);
+        client->tx_deferred_len += len;
+        return true;
+    }
+
+    if (len > TCP_TX_RING_SIZE - client->tx_count) {
+        if (!notify) {
+            client->stats.tx_dropped++;
+            len = TCP_TX_RING_SIZE - client->tx_count;
+        } else {
+            switch ((tcp_tx_policy_t)system_config_get_tcp_tx_policy()) {
+                case TCP_TX_POLICY_DISCONNECT:
+                    DBG_TCP_PRINT("TCP[%d] TX queue full, disconnecting slow client\n", sn);
+                    tcp_tx_disconnects++;
+                    // 블로킹 disconnect()는 상대가 응답하지 않으면 타임아웃까지 멈추므로 DISCON만 요청 (CLOSED 처리에서 재오픈)
+                    setSn_CR(sn, Sn_CR_DISCON);
+                    while (getSn_CR(sn));
+                    tcp_client_reset(client);
+                    return false;
+                case TCP_TX_POLICY_COALESCE:
+                    client->tx_resync = true;
+                    client->stats.tx_coalesced++;
+                    return false;
+                case TCP_TX_POLICY_DROP_OLDEST:
+                default:
+                    // 오래된 알림부터 버리고, 남은 것이 응답뿐이면 새 알림을 버림
+                    while (len > TCP_TX_RING_SIZE - client->tx_count && tcp_tx_drop_oldest_notification(client)) {
+                        client->stats.tx_dropped++;
+                    }
+                    if (len > TCP_TX_RING_SIZE - client->tx_count) {
+                        client->stats.tx_dropped++;
+                        return false;
+                    }
+                    break;
+            }
+        }
+    }
+
+    if (notify) {
+        client->stats.notifications++;
+    }
+    tcp_client_put(sn, client, data, len, notify);
+    tcp_client_drain(sn, client);
+    return true;
+}
+
+// 명령어 실행 중 미뤄 둔 알림을 줄 단위로 전송 (큐가 차면 알림 정책 적용)
+static void tcp_client_flush_deferred(uint8_t sn, tcp_client_t* client) {
+    client->tx_defer = false;
+    uint16_t pos = 0;
+    // DISCONNECT 정책으로 연결이 초기화되면 tx_deferred_len이 0이 되어 중단
+    while (pos < client->tx_deferred_len) {
+        uint16_t end = pos;
+        while (end < client->tx_deferred_len && client->tx_deferred[end] != '\n') end++;
+        if (end < client->tx_deferred_len) end++;
+        tcp_client_write(sn, &client->tx_deferred[pos], end - pos, true);
+        pos = end;
+    }
+    client->tx_deferred_len = 0;
+}
+
+// 명령어 응답 sink: 핸들러 출력이 중간 버퍼 없이 TX 메모리(또는 송신 큐)로 바로 감
+static size_t tcp_sink_write(cmd_sink_t* sink, const char* data, size_t len) {
+    tcp_client_t* client = (tcp_client_t*)sink->ctx;
+    uint8_t sn = client->sn;
+    if (len > TCP_TX_RING_SIZE) {
+        len = TCP_TX_RING_SIZE;
+    }
+    return tcp_client_put(sn, client, (const uint8_t*)data, (uint16_t)len, false);
+}
+
 void save_tcp_port_to_flash(uint16_t port) {
     system_config_set_tcp_port(port);
     system_config_save_to_flash();
@@ -18,14 +397,19 @@ void load_tcp_port_from_flash(void) {
 }
 
 
-// 모든 연결된 TCP 클라이언트에 메시지 전송
+// 모든 연결된 TCP 클라이언트에 메시지 전송 (송신 큐에 넣고 바로 반환)
 void tcp_servers_broadcast(const uint8_t* data, uint16_t len) {
     int sent_count = 0;
-    for (uint8_t i = TCP_SOCKET_START; i < TCP_SOCKET_START + TCP_SOCKET_COUNT; i++) {
+    for (uint8_t k = 0; k < TCP_CLIENT_MAX; k++) {
+        if (!tcp_clients[k].attached) {
+            continue;
+        }
+        uint8_t i = tcp_clients[k].sn;
         uint8_t status = getSn_SR(i);
         if (status == SOCK_ESTABLISHED) {
-            int32_t result = send(i, (uint8_t*)data, len);
-            DBG_TCP_PRINT("Broadcast to socket %d: sent %d bytes (status=ESTABLISHED)\n", i, result);
+            bool queued = tcp_client_write(i, data, len, true);
+            DBG_TCP_PRINT("Broadcast to socket %d: %s %d bytes (queue=%u)\n", i,
+                          queued ? "queued" : "skipped", len, tcp_clients[k].tx_count);
             sent_count++;
         } else {
             DBG_TCP_PRINT("Socket %d not available (status=0x%02X)\n", i, status);
@@ -38,105 +422,374 @@ void tcp_servers_broadcast(const uint8_t* data, uint16_t len) {
     }
 }
 
+static inline bool tcp_client_wants(const tcp_client_t* client, uint8_t event, uint16_t channel_mask) {
+    if (!(client->sub_events & event)) {
+        return false;
+    }
+    return channel_mask == 0 || (client->sub_channels & channel_mask) != 0;
+}
+
+// 해당 이벤트를 구독한 연결이 있는지 (없으면 메시지 생성 생략 가능)
+bool tcp_servers_has_subscribers(uint8_t event, uint16_t channel_mask) {
+    for (uint8_t k = 0; k < TCP_CLIENT_MAX; k++) {
+        const tcp_client_t* client = &tcp_clients[k];
+        if (client->attached && tcp_client_wants(client, event, channel_mask) &&
+            getSn_SR(client->sn) == SOCK_ESTABLISHED) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// 이벤트를 구독한 클라이언트에만 전송
+void tcp_servers_notify(uint8_t event, uint16_t channel_mask, const uint8_t* data, uint16_t len) {
+    for (uint8_t k = 0; k < TCP_CLIENT_MAX; k++) {
+        const tcp_client_t* client = &tcp_clients[k];
+        if (!client->attached || !tcp_client_wants(client, event, channel_mask)) {
+            continue;
+        }
+        if (getSn_SR(client->sn) == SOCK_ESTABLISHED) {
+            tcp_client_write(client->sn, data, len, true);
+        }
+    }
+}
+
+// 구독 명령어 응답 전송 (응답 통계 포함)
+static void tcp_subscription_reply(uint8_t sn, tcp_client_t* client, const char* response) {
+    client->stats.responses++;
+    tcp_client_write(sn, (const uint8_t*)response, (uint16_t)strlen(response), false);
+}
+
+// 구독 명령어 처리 (소켓별 상태이므로 전송 계층에서 처리)
+//   subscribe,id,channel_mask[,event_mask]  마스크는 10진수 또는 0x 16진수
+//   unsubscribe,id[,event_mask]             event_mask 생략 시 전체 해제
+// 구독 명령어가 아니면 false 반환
+static bool tcp_handle_subscription(uint8_t sn, tcp_client_t* client, const char* line) {
+    bool subscribe;
+    const char* param;
+    if (strncmp(line, "subscribe", 9) == 0 && (line[9] == ',' || line[9] == '\0')) {
+        subscribe = true;
+        param = line + 9;
+    } else if (strncmp(line, "unsubscribe", 11) == 0 && (line[11] == ',' || line[11] == '\0')) {
+        subscribe = false;
+        param = line + 11;
+    } else {
+        return false;
+    }
+
+    char response[96];
+    char param_copy[64];
+    strncpy(param_copy, *param == ',' ? param + 1 : param, sizeof(param_copy) - 1);
+    param_copy[sizeof(param_copy) - 1] = '\0';
+
+    char* id_str = strtok(param_copy, ",");
+    char* first_str = strtok(NULL, ",");
+    char* second_str = strtok(NULL, ",");
+
+    if (id_str == NULL || (subscribe && first_str == NULL)) {
+        snprintf(response, sizeof(response), subscribe
+                 ? "Error: Use format 'subscribe,id,channel_mask[,event_mask]'\r\n"
+                 : "Error: Use format 'unsubscribe,id[,event_mask]'\r\n");
+        tcp_subscription_reply(sn, client, response);
+        return true;
+    }
+
+    // 디바이스 ID 체크 (ID가 맞지 않으면 응답하지 않음)
+    uint8_t target_id = (uint8_t)atoi(id_str);
+    if (target_id != 0 && target_id != get_gpio_device_id()) {
+        return true;
+    }
+
+    if (subscribe) {
+        unsigned long channels = strtoul(first_str, NULL, 0);
+        unsigned long events = second_str ? strtoul(second_str, NULL, 0) : TCP_EVENT_DEFAULT;
+        if (channels > 0xFFFF || events == 0 || (events & ~(unsigned long)TCP_EVENT_ALL)) {
+            snprintf(response, sizeof(response), "Error: Invalid mask. channel 0-0xFFFF, event 1-7 (1=input,2=output,4=link)\r\n");
+            tcp_subscription_reply(sn, client, response);
+            return true;
+        }
+        client->sub_channels = (uint16_t)channels;
+        client->sub_events = (uint8_t)events;
+    } else {
+        unsigned long events = first_str ? strtoul(first_str, NULL, 0) : TCP_EVENT_ALL;
+        client->sub_events &= (uint8_t)~events;
+    }
+
+    snprintf(response, sizeof(response), "subscribe,%d,0x%04X,0x%02X\r\n",
+             get_gpio_device_id(), client->sub_channels, client->sub_events);
+    tcp_subscription_reply(sn, client, response);
+    DBG_TCP_PRINT("TCP[%d] 구독: channels=0x%04X events=0x%02X\n", sn, client->sub_channels, client->sub_events);
+    return true;
+}
+
+bool tcp_servers_get_client_stats(uint8_t index, tcp_client_stats_t* stats) {
+    if (index >= TCP_CLIENT_MAX || stats == NULL || !tcp_clients[index].attached) {
+        return false;
+    }
+    tcp_client_t* client = &tcp_clients[index];
+    *stats = client->stats;
+    stats->socket = client->sn;
+    stats->connected = getSn_SR(stats->socket) == SOCK_ESTABLISHED;
+    stats->tx_queued = client->tx_count;
+    if (stats->connected) {
+        uint32_t now = to_ms_since_boot(get_absolute_time());
+        getSn_DIPR(stats->socket, stats->peer_ip);
+        stats->peer_port = getSn_DPORT(stats->socket);
+        stats->connected_ms = now - client->connect_ms;
+        stats->idle_ms = now - client->last_activity_ms;
+    }
+    return true;
+}
+
+uint32_t tcp_servers_get_tx_disconnects(void) {
+    return tcp_tx_disconnects;
+}
+
+uint32_t tcp_servers_get_idle_reaped(void) {
+    return tcp_idle_reaped;
+}
+
 // 모든 TCP 서버 소켓을 닫고 다시 여는 함수 (기존 포트)
 void tcp_servers_restart(void) {
-    for (uint8_t i = TCP_SOCKET_START; i < TCP_SOCKET_START + TCP_SOCKET_COUNT; i++) {
-        close(i);
-        socket(i, Sn_MR_TCP, tcp_port, 0x00);
-        listen(i);
-    DBG_TCP_PRINT("TCP 서버 재시작 (소켓: %d, 포트: %d)\n", i, tcp_port);
-    }
+    tcp_servers_restart_with_port(tcp_port);
 }
 
 // 새로운 포트 번호로 모든 TCP 서버 소켓을 닫고 다시 여는 함수
+// 요청 시 할당받은 소켓은 풀에 반환 (필요하면 다시 할당받음)
 void tcp_servers_restart_with_port(uint16_t new_port) {
     tcp_port = new_port;
-    for (uint8_t i = TCP_SOCKET_START; i < TCP_SOCKET_START + TCP_SOCKET_COUNT; i++) {
-        close(i);
-        socket(i, Sn_MR_TCP, tcp_port, 0x00);
-        listen(i);
-    DBG_TCP_PRINT("TCP 서버 재시작 (소켓: %d, 포트: %d)\n", i, tcp_port);
+    for (uint8_t k = 0; k < TCP_CLIENT_MAX; k++) {
+        tcp_client_t* client = &tcp_clients[k];
+        if (!client->attached) {
+            continue;
+        }
+        if (socket_pool_is_dynamic(client->sn)) {
+            tcp_client_detach(client);
+            continue;
+        }
+        close(client->sn);
+        tcp_client_reset(client);
+        tcp_server_listen(client->sn, tcp_port);
+    DBG_TCP_PRINT("TCP 서버 재시작 (소켓: %d, 포트: %d)\n", client->sn, tcp_port);
     }
 }
 
+// 소켓 풀에서 TCP 역할 소켓을 받아 대기 시작
 void tcp_servers_init(uint16_t port) {
-    for (uint8_t i = TCP_SOCKET_START; i < TCP_SOCKET_START + TCP_SOCKET_COUNT; i++) {
+    uint8_t sockets[SOCKET_POOL_SIZE];
+    uint8_t count = socket_pool_list(SOCKET_ROLE_TCP, sockets, SOCKET_POOL_SIZE);
+
+    tcp_port = port;
+    tcp_servers_started = true;
+    for (uint8_t k = 0; k < TCP_CLIENT_MAX; k++) {
+        if (tcp_clients[k].attached && socket_pool_is_dynamic(tcp_clients[k].sn)) {
+            tcp_client_detach(&tcp_clients[k]);
+        }
+        tcp_clients[k].attached = false;
+    }
+    for (uint8_t n = 0; n < count; n++) {
+        uint8_t i = sockets[n];
         if (getSn_SR(i) != SOCK_CLOSED) close(i);
-        socket(i, Sn_MR_TCP, port, 0x00);
-        listen(i);
+        if (tcp_client_attach(i) == NULL) {
+            break;
+        }
+        tcp_server_listen(i, port);
     DBG_TCP_PRINT("TCP 서버 시작 (소켓: %d, 포트: %d)\n", i, port);
     }
 }
 
+// 대기 중인 소켓이 없으면 (모두 연결됨) 빈 소켓을 받아 추가 클라이언트 수용
+static void tcp_servers_grow(void) {
+    for (uint8_t k = 0; k < TCP_CLIENT_MAX; k++) {
+        if (tcp_clients[k].attached) {
+            uint8_t status = getSn_SR(tcp_clients[k].sn);
+            if (status == SOCK_LISTEN || status == SOCK_INIT || status == SOCK_CLOSED) {
+                return;
+            }
+        }
+    }
+
+    int8_t sn = socket_pool_acquire(SOCKET_ROLE_TCP);
+    if (sn < 0) {
+        return;
+    }
+    if (tcp_client_attach((uint8_t)sn) == NULL) {
+        socket_pool_release((uint8_t)sn);
+        return;
+    }
+    tcp_server_listen((uint8_t)sn, tcp_port);
+    DBG_TCP_PRINT("TCP 추가 소켓 대기 (소켓: %d, 포트: %d)\n", sn, tcp_port);
+}
+
+// 완성된 한 줄의 명령어 실행 및 응답 전송
+// 응답은 sink를 통해 TX 메모리에 바로 기록하고 마지막에 SEND 한 번으로 전송
+static void tcp_execute_line(uint8_t sn, const char* line) {
+    DBG_TCP_PRINT("TCP[%d] 수신: %s\n", sn, line);
+    tcp_client_t* client = tcp_client_get(sn);
+    client->stats.commands++;
+    
+    // 구독 명령어는 응답을 보낸 경우에만 응답 수에 포함 (ID가 다르면 응답 없음)
+    if (tcp_handle_subscription(sn, client, line)) {
+        return;
+    }
+    client->stats.responses++;
+    
+    // 오류 시 응답을 오류 메시지로 바꿀 수 있도록 기록 시작 위치 보관
+    uint16_t mark_wr = getSn_TX_WR(sn);
+    uint16_t mark_uncommitted = client->tx_uncommitted;
+    uint16_t mark_send_seq = client->tx_send_seq;
+    uint16_t mark_tail = client->tx_tail;
+    uint16_t mark_count = client->tx_count;
+    uint32_t mark_bytes = client->stats.tx_bytes;
+    bool mark_partial = client->tx_partial;
+
+    // 텍스트 명령어 처리 (실행 중 발생한 알림은 응답 뒤에 이어서 전송)
+    tcp_client_cork(client);
+    client->tx_defer = true;
+    cmd_sink_t sink;
+    cmd_sink_init(&sink, tcp_sink_write, client);
+    cmd_result_t result = process_command(line, &sink);
+    
+    if (result == CMD_SUCCESS || result == CMD_ERROR_INVALID) {
+        // 줄바꿈 추가
+        tcp_client_put(sn, client, (const uint8_t*)"\r\n", 2, false);
+    } else {
+        // 아직 SEND 하지 않았고 큐 앞부분이 그대로면 기록한 응답을 되돌림
+        if (client->tx_send_seq == mark_send_seq && client->tx_tail == mark_tail &&
+            client->tx_count >= mark_count && client->tx_uncommitted >= mark_uncommitted) {
+            setSn_TX_WR(sn, mark_wr);
+            client->tx_uncommitted = mark_uncommitted;
+            client->tx_count = mark_count;
+            client->stats.tx_bytes = mark_bytes;
+            client->tx_partial = mark_partial;
+        }
+        char error_msg[32];
+        snprintf(error_msg, sizeof(error_msg), "Command error: %d\r\n", result);
+        tcp_client_put(sn, client, (const uint8_t*)error_msg, (uint16_t)strlen(error_msg), false);
+    }
+    tcp_client_flush_deferred(sn, client);
+    tcp_client_uncork(sn, client);
+}
+
+// 보관 중인 수신 데이터를 줄 단위로 조립하여 완성된 줄을 순서대로 실행
+// 송신 큐에 응답 한 개 분량의 여유가 없으면 멈추고 나머지는 다음 루프에서 처리 (backpressure)
+static void tcp_client_feed(uint8_t sn, tcp_client_t* client) {
+    while (client->rx_pos < client->rx_len) {
+        char c = (char)client->rx_buf[client->rx_pos];
+        if (c == '\r' || c == '\n') {
+            if (client->tx_count > TCP_TX_RING_SIZE - TCP_TX_RESPONSE_RESERVE) {
+                return;
+            }
+            client->rx_pos++;
+            if (client->overflow) {
+                const char* error_msg = "Error: Command too long\r\n";
+                tcp_client_write(sn, (const uint8_t*)error_msg, (uint16_t)strlen(error_msg), false);
+            } else if (client->line_len > 0) {
+                client->line[client->line_len] = '\0';
+                tcp_execute_line(sn, client->line);
+            }
+            client->line_len = 0;
+            client->overflow = false;
+            continue;
+        }
+        client->rx_pos++;
+        if (client->overflow) {
+            // 줄 끝까지 버림
+        } else if (client->line_len + 1 < sizeof(client->line)) {
+            client->line[client->line_len++] = c;
+        } else {
+            client->overflow = true;
+        }
+    }
+    if (client->line_len > 0) {
+        client->last_rx_ms = to_ms_since_boot(get_absolute_time());
+    }
+}
+
 void tcp_servers_process(void) {
-    for (uint8_t i = TCP_SOCKET_START; i < TCP_SOCKET_START + TCP_SOCKET_COUNT; i++) {
+    for (uint8_t k = 0; k < TCP_CLIENT_MAX; k++) {
+        tcp_client_t* client = &tcp_clients[k];
+        if (!client->attached) {
+            continue;
+        }
+        uint8_t i = client->sn;
         switch (getSn_SR(i)) {
             case SOCK_ESTABLISHED: {
                 // 최초 연결 시에만 환영 메시지 전송 (텍스트 모드)
                 if (getSn_IR(i) & Sn_IR_CON) {
+                    tcp_client_reset(client);
+                    client->connect_ms = to_ms_since_boot(get_absolute_time());
+                    client->last_activity_ms = client->connect_ms;
                     char welcome_text[64];
                     snprintf(welcome_text, sizeof(welcome_text), 
                             "Connected,%d,text\r\n", get_gpio_device_id());
-                    send(i, (uint8_t*)welcome_text, strlen(welcome_text));
+                    tcp_client_write(i, (const uint8_t*)welcome_text, (uint16_t)strlen(welcome_text), false);
                     setSn_IR(i, Sn_IR_CON);
                 }
+
+                // 대기 중인 송신 데이터 처리
+                tcp_client_drain(i, client);
+
+                // 무활동 연결 종료 (DISCON만 요청하고 대기하지 않음, CLOSED 처리에서 재오픈)
+                uint16_t idle_timeout = system_config_get_tcp_idle_timeout();
+                if (idle_timeout > 0 && getSn_RX_RSR(i) == 0 &&
+                    to_ms_since_boot(get_absolute_time()) - client->last_activity_ms >= (uint32_t)idle_timeout * 1000u) {
+                    DBG_TCP_PRINT("TCP[%d] 무활동 %u초 초과, 연결 종료\n", i, idle_timeout);
+                    tcp_idle_reaped++;
+                    setSn_CR(i, Sn_CR_DISCON);
+                    while (getSn_CR(i));
+                    tcp_client_reset(client);
+                    break;
+                }
+
+                // 한 번에 받은 명령어들(파이프라인)의 응답은 모아서 전송
+                tcp_client_cork(client);
+
+                // 보관 중인 데이터를 모두 처리한 경우에만 새로 읽음
                 uint16_t rx_size = getSn_RX_RSR(i);
-                if (rx_size > 0) {
+                while (client->rx_pos >= client->rx_len && rx_size > 0) {
                     // TCP 데이터 수신 시 LED 깜빡임
                     status_led_activity_blink();
-                    
-                    uint8_t buf[512];
-                    if (rx_size > sizeof(buf)) rx_size = sizeof(buf);
-                    int len = recv(i, buf, rx_size);
-                    buf[len] = 0;
-                    DBG_TCP_PRINT("TCP[%d] 수신: %s\n", i, buf);
-                    
-                    // 텍스트 명령어 처리
-                    char response[2048];
-                    cmd_result_t result;
-                    
-                    result = process_command((char*)buf, response, sizeof(response));
-                    
-                    if (result == CMD_SUCCESS || result == CMD_ERROR_INVALID) {
-                        size_t resp_len = strlen(response);
-                        size_t sent = 0;
-                        const size_t CHUNK_SIZE = 256;
-                        while (sent < resp_len) {
-                            size_t remaining = resp_len - sent;
-                            uint16_t this_len = (uint16_t)(remaining > CHUNK_SIZE ? CHUNK_SIZE : remaining);
-                            int s = send(i, (uint8_t*)response + sent, this_len);
-                            if (s <= 0) break;
-                            sent += (size_t)s;
-                        }
-                        // 줄바꿈 추가
-                        const char* newline = "\r\n";
-                        send(i, (uint8_t*)newline, 2);
-                    } else {
-                        char error_msg[128];
-                        snprintf(error_msg, sizeof(error_msg), "Command error: %d\r\n", result);
-                        size_t err_len = strlen(error_msg);
-                        size_t sent = 0;
-                        const size_t CHUNK_SIZE = 256;
-                        while (sent < err_len) {
-                            size_t remaining = err_len - sent;
-                            uint16_t this_len = (uint16_t)(remaining > CHUNK_SIZE ? CHUNK_SIZE : remaining);
-                            int s = send(i, (uint8_t*)error_msg + sent, this_len);
-                            if (s <= 0) break;
-                            sent += (size_t)s;
-                        }
-                    }
+
+                    uint16_t chunk = rx_size > sizeof(client->rx_buf) ? sizeof(client->rx_buf) : rx_size;
+                    int32_t len = recv(i, client->rx_buf, chunk);
+                    if (len <= 0) break;
+                    client->stats.rx_bytes += (uint32_t)len;
+                    client->last_activity_ms = to_ms_since_boot(get_absolute_time());
+                    client->rx_len = (uint16_t)len;
+                    client->rx_pos = 0;
+                    rx_size -= (uint16_t)len;
+                    tcp_client_feed(i, client);
                 }
+                if (client->rx_pos < client->rx_len) {
+                    // 송신 큐 여유가 생기면 이어서 처리
+                    tcp_client_feed(i, client);
+                } else if (rx_size == 0 && client->line_len > 0 && !client->overflow &&
+                           client->tx_count <= TCP_TX_RING_SIZE - TCP_TX_RESPONSE_RESERVE &&
+                           to_ms_since_boot(get_absolute_time()) - client->last_rx_ms >= TCP_LINE_IDLE_MS) {
+                    // 줄바꿈 없이 보내는 기존 클라이언트 호환: 일정 시간 추가 입력이 없으면 실행
+                    client->line[client->line_len] = '\0';
+                    client->line_len = 0;
+                    tcp_execute_line(i, client->line);
+                }
+                tcp_client_uncork(i, client);
                 break;
             }
             case SOCK_CLOSE_WAIT:
+                tcp_client_reset(client);
                 disconnect(i);
                 break;
             case SOCK_CLOSED:
+                if (socket_pool_is_dynamic(i)) {
+                    // 추가 소켓은 연결이 끝나면 풀에 반환
+                    tcp_client_detach(client);
+                    break;
+                }
+                tcp_client_reset(client);
                 // 네트워크가 연결된 경우에만 재오픈
                 if (network_is_connected()) {
                     close(i); // 안전하게 닫기
-                    socket(i, Sn_MR_TCP, tcp_port, 0x00);
-                    listen(i);
+                    tcp_server_listen(i, tcp_port);
                     DBG_TCP_PRINT("TCP 서버 재오픈 (소켓: %d, 포트: %d)\n", i, tcp_port);
                 }
                 break;
@@ -144,5 +797,8 @@ void tcp_servers_process(void) {
                 break;
         }
     }
-}
 
+    if (tcp_servers_started && network_is_connected()) {
+        tcp_servers_grow();
+    }
+}
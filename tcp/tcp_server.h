@@ -19,9 +19,48 @@ extern "C"
 {
 #endif
 
-#define TCP_SOCKET_START 2
-#define TCP_SOCKET_COUNT 4  // 소켓 2, 3, 4, 5 사용
+#define TCP_CLIENT_MAX 5    // 최대 동시 클라이언트 (소켓 2-6, 배치는 socket_pool 프로파일에 따름)
 #define MULTICAST_SOCKET 7  // 소켓 7은 멀티캐스트용 예약
+#define TCP_LINE_BUF_SIZE 1024  // 소켓별 명령어 줄 버퍼 (batch 명령어 포함)
+#define TCP_LINE_IDLE_MS 250    // 줄바꿈 없는 명령어를 실행하기까지 대기 시간
+#define TCP_TX_RING_SIZE 4096   // 소켓별 송신 큐 (W5500 TX 메모리에 못 들어간 데이터)
+#define TCP_TX_DEFERRED_SIZE 512    // 명령어 실행 중 발생한 알림 보관 (응답 뒤에 전송, 16채널 출력 변화 분량)
+#define TCP_KEEPALIVE_UNITS 2   // Sn_KPALVTR (5초 단위): 10초 무통신 시 keepalive, 응답 없으면 타임아웃 후 소켓 종료
+#define TCP_IDLE_TIMEOUT_MAX 65535  // setidletimeout 최대값 (초)
+#define TCP_TX_RESPONSE_RESERVE 3000  // 명령어 실행 전 필요한 송신 큐 여유 (최대 응답인 help + 줄바꿈)
+
+  // 이벤트 구독 (subscribe 명령어의 event_mask)
+#define TCP_EVENT_INPUT   0x01    // 입력 변화 (input_channel / input_bytes)
+#define TCP_EVENT_OUTPUT  0x02    // 출력 변화 (output_channel / output_bytes)
+#define TCP_EVENT_LINK    0x04    // 이더넷 링크 상태
+#define TCP_EVENT_ALL     (TCP_EVENT_INPUT | TCP_EVENT_OUTPUT | TCP_EVENT_LINK)
+#define TCP_EVENT_DEFAULT (TCP_EVENT_INPUT | TCP_EVENT_LINK)   // 연결 시 기본 구독
+
+  // 송신 큐가 가득 찼을 때 비동기 알림 처리 정책
+  typedef enum {
+    TCP_TX_POLICY_DROP_OLDEST = 0, // 가장 오래된 알림 줄부터 버림 (응답 줄은 유지)
+    TCP_TX_POLICY_DISCONNECT = 1,  // 느린 클라이언트 연결 종료
+    TCP_TX_POLICY_COALESCE = 2     // 알림을 버리고 큐가 비면 현재 입력 상태 한 줄 전송
+  } tcp_tx_policy_t;
+
+  // 클라이언트별 연결/송수신 통계 (연결 시 초기화)
+  typedef struct {
+    uint8_t socket;
+    bool connected;
+    uint8_t peer_ip[4];
+    uint16_t peer_port;
+    uint32_t connected_ms;  // 연결 유지 시간
+    uint32_t idle_ms;       // 마지막 활동(수신 또는 전송 완료) 이후 시간
+    uint32_t rx_bytes;      // 수신 바이트
+    uint32_t commands;      // 실행한 명령어 줄
+    uint32_t responses;     // 전송한 응답
+    uint32_t notifications; // 큐에 넣은 비동기 알림
+    uint16_t tx_queued;     // 현재 큐에 대기 중인 바이트
+    uint16_t tx_peak;       // 최대 큐 사용량
+    uint32_t tx_bytes;      // W5500으로 전달한 바이트
+    uint32_t tx_dropped;    // 버린 줄 (drop 정책 / 응답 잘림)
+    uint32_t tx_coalesced;  // 상태 스냅샷으로 대체된 알림
+  } tcp_client_stats_t;
 
   extern uint16_t tcp_port;
   void save_tcp_port_to_flash(uint16_t port);
@@ -31,6 +70,12 @@ extern "C"
   void tcp_servers_restart(void);
   void tcp_servers_restart_with_port(uint16_t new_port);
   void tcp_servers_broadcast(const uint8_t *data, uint16_t len);
+  // 구독한 클라이언트에만 전송 (channel_mask 0 = 채널 무관 이벤트)
+  void tcp_servers_notify(uint8_t event, uint16_t channel_mask, const uint8_t *data, uint16_t len);
+  bool tcp_servers_has_subscribers(uint8_t event, uint16_t channel_mask);
+  bool tcp_servers_get_client_stats(uint8_t index, tcp_client_stats_t *stats);
+  uint32_t tcp_servers_get_tx_disconnects(void);
+  uint32_t tcp_servers_get_idle_reaped(void);
 
 #ifdef __cplusplus
 }
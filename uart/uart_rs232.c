@@ -29,6 +29,25 @@ bool uart_rs232_init(rs232_port_t port, uint32_t baudrate) {
     return false;
 }
 
+// 명령어 응답 도중에 바꾸면 응답이 새 속도로 나가므로 uart_rs232_process 끝에서 적용
+static uint32_t uart_pending_baud = 0;
+
+void uart_rs232_set_baud(rs232_port_t port, uint32_t baudrate) {
+    if (port == RS232_PORT_1) {
+        uart_pending_baud = baudrate;
+    }
+}
+
+static void uart_rs232_apply_baud(void) {
+    if (uart_pending_baud == 0) {
+        return;
+    }
+    uart_tx_wait_blocking(uart0);
+    uint32_t actual = uart_set_baudrate(uart0, uart_pending_baud);
+    DBG_UART_PRINT("UART RS232 Port 1 baud changed to %u (actual %u)\n", uart_pending_baud, actual);
+    uart_pending_baud = 0;
+}
+
 bool uart_rs232_write(rs232_port_t port, const uint8_t* data, uint32_t len) {
     if (port == RS232_PORT_1) {
         uart_write_blocking(uart0, data, len);
@@ -52,6 +71,36 @@ bool uart_rs232_available(rs232_port_t port) {
     return false;
 }
 
+// 명령어 응답 sink: 작은 스테이징 버퍼가 차면 바로 UART로 출력
+// 오류 결과는 아직 출력하지 않은 응답을 버리고 오류 메시지로 대체
+static char uart_sink_stage[128];
+static size_t uart_sink_len = 0;
+static bool uart_sink_flushed = false;
+
+static void uart_sink_flush(void) {
+    if (uart_sink_len > 0) {
+        uart_rs232_write(RS232_PORT_1, (const uint8_t*)uart_sink_stage, (uint32_t)uart_sink_len);
+        uart_sink_len = 0;
+        uart_sink_flushed = true;
+    }
+}
+
+static size_t uart_sink_write(cmd_sink_t* sink, const char* data, size_t len) {
+    (void)sink;
+    size_t done = 0;
+    while (done < len) {
+        if (uart_sink_len == sizeof(uart_sink_stage)) {
+            uart_sink_flush();
+        }
+        size_t n = sizeof(uart_sink_stage) - uart_sink_len;
+        if (n > len - done) n = len - done;
+        memcpy(uart_sink_stage + uart_sink_len, data + done, n);
+        uart_sink_len += n;
+        done += n;
+    }
+    return done;
+}
+
 // UART RS232 명령어 처리 함수
 void uart_rs232_process(void) {
     static uint8_t uart_line_buf[512];
@@ -70,36 +119,26 @@ void uart_rs232_process(void) {
                 
                 DBG_UART_PRINT("UART1 RX: %s\n", (char*)uart_line_buf);
                 
-                // 명령어 처리
-                char response[512];
-                cmd_result_t result = process_command((char*)uart_line_buf, response, sizeof(response));
+                // 명령어 처리 (응답은 sink로 바로 출력)
+                cmd_sink_t sink;
+                cmd_sink_init(&sink, uart_sink_write, NULL);
+                uart_sink_len = 0;
+                uart_sink_flushed = false;
+                cmd_result_t result = process_command((char*)uart_line_buf, &sink);
                 
-                // 응답 전송 (TCP와 동일한 형식 - 청크 단위, 줄바꿈 없음)
-                size_t resp_len = strlen(response);
-                const size_t CHUNK_SIZE = 256;
+                // 응답 전송 (TCP와 동일한 형식)
                 if (result == CMD_SUCCESS || result == CMD_ERROR_INVALID) {
-                    size_t sent = 0;
-                    while (sent < resp_len) {
-                        size_t remaining = resp_len - sent;
-                        size_t this_len = remaining > CHUNK_SIZE ? CHUNK_SIZE : remaining;
-                        uart_rs232_write(RS232_PORT_1, (uint8_t*)response + sent, (uint32_t)this_len);
-                        sent += this_len;
-                    }
                     // 줄바꿈 추가
-                    const char* newline = "\r\n";
-                    uart_rs232_write(RS232_PORT_1, (uint8_t*)newline, 2);
+                    uart_sink_write(&sink, "\r\n", 2);
                 } else {
-                    char error_msg[128];
-                    snprintf(error_msg, sizeof(error_msg), "Command error: %d\r\n", result);
-                    size_t err_len = strlen(error_msg);
-                    size_t sent = 0;
-                    while (sent < err_len) {
-                        size_t remaining = err_len - sent;
-                        size_t this_len = remaining > CHUNK_SIZE ? CHUNK_SIZE : remaining;
-                        uart_rs232_write(RS232_PORT_1, (uint8_t*)error_msg + sent, (uint32_t)this_len);
-                        sent += this_len;
+                    if (!uart_sink_flushed) {
+                        uart_sink_len = 0;
                     }
+                    char error_msg[32];
+                    snprintf(error_msg, sizeof(error_msg), "Command error: %d\r\n", result);
+                    uart_sink_write(&sink, error_msg, strlen(error_msg));
                 }
+                uart_sink_flush();
                 
                 // 버퍼 초기화
                 uart_line_pos = 0;
@@ -109,4 +148,6 @@ void uart_rs232_process(void) {
             uart_line_buf[uart_line_pos++] = ch;
         }
     }
+    
+    uart_rs232_apply_baud();
 }
@@ -42,6 +42,8 @@ extern "C"
   void save_uart_rs232_baud_to_flash(void);
   void load_uart_rs232_baud_from_flash(void);
   bool uart_rs232_init(rs232_port_t port, uint32_t baudrate);
+  // 통신 속도 변경 (재부팅 없이, 진행 중인 응답 송신이 끝난 뒤 적용)
+  void uart_rs232_set_baud(rs232_port_t port, uint32_t baudrate);
   // void uart_rs232_init_ex(const uart_rs232_config_t* config);
   bool uart_rs232_write(rs232_port_t port, const uint8_t *data, uint32_t len);
   int uart_rs232_read(rs232_port_t port, uint8_t *buf, uint32_t maxlen);
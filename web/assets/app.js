@@ -0,0 +1,245 @@
+const state = { network: {}, comm: {}, gpio: {} }
+function showLoading(msg = 'Loading...') {
+  document.getElementById('loading-message').textContent = msg
+  document.getElementById('loading-overlay').classList.remove('hidden')
+}
+function hideLoading() {
+  document.getElementById('loading-overlay').classList.add('hidden')
+}
+function showToast(message, type = 'positive') {
+  const container = document.getElementById('toast-container')
+  const toast = document.createElement('div')
+  toast.className = `toast ${type}`
+  const iconId = type === 'positive' ? 'check_circle' : 'cancel'
+  toast.innerHTML = `<svg class="icon-sm" style="fill:white"><use href="#${iconId}"></use></svg><span>${message}</span>`
+  container.appendChild(toast)
+  setTimeout(() => toast.remove(), 3000)
+}
+function showConfirmModal() {
+  const modal = document.getElementById('confirm-modal')
+  modal.classList.remove('hidden')
+  const cancelBtn = document.getElementById('modal-cancel')
+  const confirmBtn = document.getElementById('modal-confirm')
+  const handleCancel = () => {
+    modal.classList.add('hidden')
+    cleanup()
+  }
+  const handleConfirm = async () => {
+    modal.classList.add('hidden')
+    cleanup()
+    showLoading('Rebooting system...')
+    try {
+      const res = await fetch('/api/restart')
+      if (!res.ok) throw new Error('Failed')
+      showToast('System is rebooting...', 'positive')
+      setTimeout(async () => {
+        await fetchAll()
+        hideLoading()
+      }, 5000)
+    } catch (err) {
+      showToast('Failed to reboot', 'negative')
+      hideLoading()
+    }
+  }
+  const cleanup = () => {
+    cancelBtn.removeEventListener('click', handleCancel)
+    confirmBtn.removeEventListener('click', handleConfirm)
+    modal.removeEventListener('click', handleBackdropClick)
+  }
+  const handleBackdropClick = (e) => {
+    if (e.target === modal) {
+      handleCancel()
+    }
+  }
+  cancelBtn.addEventListener('click', handleCancel)
+  confirmBtn.addEventListener('click', handleConfirm)
+  modal.addEventListener('click', handleBackdropClick)
+}
+function toggleNetworkInputs(disabled) {
+  ;['net-ip', 'net-mask', 'net-gateway', 'net-dns'].forEach((id) => {
+    const el = document.getElementById(id)
+    if (el) el.disabled = disabled
+  })
+}
+async function fetchNetwork() {
+  try {
+    const res = await fetch('/api/network')
+    const data = await res.json()
+    state.network = data.network || {}
+    const hm = document.getElementById('header-mac')
+    if (hm) hm.textContent = state.network.mac || 'N/A'
+    const nd = document.getElementById('net-dhcp')
+    if (nd) {
+      nd.checked = state.network.dhcp_enabled
+      const ni = document.getElementById('net-ip')
+      const nm = document.getElementById('net-mask')
+      const ng = document.getElementById('net-gateway')
+      const ndn = document.getElementById('net-dns')
+      if (ni) ni.value = state.network.ip || ''
+      if (nm) nm.value = state.network.subnet || ''
+      if (ng) ng.value = state.network.gateway || ''
+      if (ndn) ndn.value = state.network.dns || ''
+      toggleNetworkInputs(state.network.dhcp_enabled)
+    }
+    const si = document.getElementById('sum-ip')
+    if (si) si.textContent = state.network.ip || 'N/A'
+    const sm = document.getElementById('sum-mac')
+    if (sm) sm.textContent = state.network.mac || 'N/A'
+    const sd = document.getElementById('sum-dhcp')
+    if (sd)
+      sd.textContent = state.network.dhcp_enabled ? 'Enabled' : 'Disabled'
+    const smask = document.getElementById('sum-mask')
+    if (smask) smask.textContent = state.network.subnet || 'N/A'
+    const sg = document.getElementById('sum-gateway')
+    if (sg) sg.textContent = state.network.gateway || 'N/A'
+    const sdn = document.getElementById('sum-dns')
+    if (sdn) sdn.textContent = state.network.dns || 'N/A'
+  } catch (e) {
+    console.error(e)
+    showToast('Failed to fetch network', 'negative')
+  }
+}
+async function fetchComm() {
+  try {
+    const res = await fetch('/api/control')
+    const data = await res.json()
+    state.comm = data
+    const ct = document.getElementById('comm-tcp')
+    if (ct) ct.value = data.tcp_port
+    const cb = document.getElementById('comm-baud')
+    if (cb) cb.value = data.rs232_1_baud
+    const st = document.getElementById('sum-tcp')
+    if (st) st.textContent = data.tcp_port
+    const sb = document.getElementById('sum-baud')
+    if (sb) sb.textContent = data.rs232_1_baud
+  } catch (e) {
+    console.error(e)
+  }
+}
+async function fetchGpio() {
+  try {
+    const res = await fetch('/api/gpio')
+    const data = await res.json()
+    state.gpio = data
+    const gi = document.getElementById('gpio-id')
+    if (gi) gi.value = data.device_id
+    const gm = document.getElementById('gpio-mode')
+    if (gm) gm.value = data.comm_mode
+    const ga = document.getElementById('gpio-auto')
+    if (ga) ga.value = data.auto_response.toString()
+    const sid = document.getElementById('sum-id')
+    if (sid) sid.textContent = data.device_id
+    const smode = document.getElementById('sum-mode')
+    if (smode) smode.textContent = data.comm_mode.toUpperCase()
+  } catch (e) {
+    console.error(e)
+  }
+}
+async function fetchAll() {
+  await Promise.all([fetchNetwork(), fetchComm(), fetchGpio()])
+}
+document.querySelectorAll('.nav-item').forEach((item) => {
+  item.addEventListener('click', () => {
+    document
+      .querySelectorAll('.nav-item')
+      .forEach((n) => n.classList.remove('active'))
+    item.classList.add('active')
+    const page = item.dataset.page
+    document
+      .querySelectorAll('.page')
+      .forEach((p) => p.classList.add('hidden'))
+    document.getElementById('page-' + page).classList.remove('hidden')
+  })
+})
+document
+  .getElementById('network-form')
+  .addEventListener('submit', async (e) => {
+    e.preventDefault()
+    showLoading('Applying Network Settings...')
+    const dhcp = document.getElementById('net-dhcp').checked
+    const payload = {
+      dhcp_enabled: dhcp,
+      ip: dhcp ? '' : document.getElementById('net-ip').value,
+      subnet: dhcp ? '' : document.getElementById('net-mask').value,
+      gateway: dhcp ? '' : document.getElementById('net-gateway').value,
+      dns: dhcp ? '' : document.getElementById('net-dns').value,
+      mac: state.network.mac
+    }
+    try {
+      const res = await fetch('/api/network', {
+        method: 'POST',
+        headers: { 'Content-Type': 'application/json' },
+        body: JSON.stringify(payload)
+      })
+      if (!res.ok) throw new Error('Failed')
+      showToast('Network settings updated!', 'positive')
+      setTimeout(async () => {
+        await fetchAll()
+        hideLoading()
+      }, 5000)
+    } catch (err) {
+      showToast('Failed to update network', 'negative')
+      hideLoading()
+    }
+  })
+document.getElementById('net-dhcp').addEventListener('change', (e) => {
+  toggleNetworkInputs(e.target.checked)
+})
+document.getElementById('btn-reboot').addEventListener('click', () => {
+  showConfirmModal()
+})
+document
+  .getElementById('comm-form')
+  .addEventListener('submit', async (e) => {
+    e.preventDefault()
+    showLoading('Applying Control Settings...')
+    const payload = {
+      tcp_port: parseInt(document.getElementById('comm-tcp').value),
+      rs232_1_baud: parseInt(document.getElementById('comm-baud').value)
+    }
+    try {
+      const res = await fetch('/api/control', {
+        method: 'POST',
+        headers: { 'Content-Type': 'application/json' },
+        body: JSON.stringify(payload)
+      })
+      if (!res.ok) throw new Error('Failed')
+      showToast('Control settings updated!', 'positive')
+      setTimeout(async () => {
+        await fetchAll()
+        hideLoading()
+      }, 5000)
+    } catch (err) {
+      showToast('Failed to update control', 'negative')
+      hideLoading()
+    }
+  })
+document
+  .getElementById('gpio-form')
+  .addEventListener('submit', async (e) => {
+    e.preventDefault()
+    showLoading('Applying GPIO Settings...')
+    const payload = {
+      device_id: parseInt(document.getElementById('gpio-id').value),
+      rt_mode: document.getElementById('gpio-mode').value,
+      auto_response: document.getElementById('gpio-auto').value === 'true'
+    }
+    try {
+      const res = await fetch('/api/gpio', {
+        method: 'POST',
+        headers: { 'Content-Type': 'application/json' },
+        body: JSON.stringify(payload)
+      })
+      if (!res.ok) throw new Error('Failed')
+      showToast('GPIO settings updated!', 'positive')
+    } catch (err) {
+      showToast('Failed to update GPIO', 'negative')
+    } finally {
+      hideLoading()
+    }
+  })
+window.addEventListener('DOMContentLoaded', async () => {
+  showLoading('Fetching status...')
+  await fetchAll()
+  hideLoading()
+})